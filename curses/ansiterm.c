@@ -0,0 +1,1200 @@
+/* TN5250
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#define _TN5250_TERMINAL_PRIVATE_DEFINED
+#include "tn5250-private.h"
+#include "ansiterm.h"
+
+#include <termios.h>
+
+static void ansi_terminal_init(Tn5250Terminal* This);
+static void ansi_terminal_term(Tn5250Terminal* This);
+static void ansi_terminal_destroy(Tn5250Terminal /*@only@*/* This);
+static int ansi_terminal_width(Tn5250Terminal* This);
+static int ansi_terminal_height(Tn5250Terminal* This);
+static int ansi_terminal_flags(Tn5250Terminal* This);
+static void ansi_terminal_update(Tn5250Terminal* This, Tn5250Display* display);
+static void ansi_terminal_update_indicators(Tn5250Terminal* This,
+                                            Tn5250Display* display);
+static int ansi_terminal_waitevent(Tn5250Terminal* This);
+static int ansi_terminal_getkey(Tn5250Terminal* This);
+static void ansi_terminal_beep(Tn5250Terminal* This);
+static void ansi_terminal_resize(Tn5250Terminal* This, Tn5250Display* display);
+static void ansi_terminal_render_row(Tn5250Terminal* This,
+                                     Tn5250Display* display, int y);
+static void ansi_terminal_render_indicators(Tn5250Terminal* This,
+                                            Tn5250Display* display);
+static void ansi_terminal_emit_row(Tn5250Terminal* This, int y, int w);
+static void ansi_terminal_put(Tn5250Terminal* This, const char* s, int len);
+static void ansi_terminal_move(Tn5250Terminal* This, int y, int x);
+static void ansi_terminal_flush(Tn5250Terminal* This);
+static int ansi_terminal_shortcut(Tn5250Terminal* This, int key);
+
+/* How a cell looks: one of the colours below, plus some of these flags.
+ * ANSI_BLANK is a blank cell in the terminal's default rendition, which
+ * is what the screen is filled with after it has been cleared. */
+#define ANSI_COLOR     0x07
+#define ANSI_REVERSE   0x08
+#define ANSI_UNDERLINE 0x10
+#define ANSI_BLINK     0x20
+#define ANSI_BLANK     0x40
+#define ANSI_STYLES    (ANSI_BLANK + 1)
+#define ANSI_HIDDEN    0xff /* Nondisplay attribute */
+
+#define ANSI_GREEN  0
+#define ANSI_WHITE  1
+#define ANSI_RED    2
+#define ANSI_TURQ   3
+#define ANSI_YELLOW 4
+#define ANSI_PINK   5
+#define ANSI_BLUE   6
+
+/* SGR parameters for each colour, matching the curses terminal's default
+ * colour list. */
+static const char* ansi_colors[] = {
+    "32", "1;37", "1;31", "36", "1;33", "35", "1;36", "39",
+};
+
+/* Style of each 5250 attribute, 0x20 to 0x3f.  Column separators are
+ * shown as underlines, as the curses terminal does. */
+static const unsigned char ansi_attribute_map[32] = {
+    // clang-format off
+    ANSI_GREEN,
+    ANSI_GREEN | ANSI_REVERSE,
+    ANSI_WHITE,
+    ANSI_WHITE | ANSI_REVERSE,
+    ANSI_GREEN | ANSI_UNDERLINE,
+    ANSI_GREEN | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_WHITE | ANSI_UNDERLINE,
+    ANSI_HIDDEN,
+    ANSI_RED,
+    ANSI_RED | ANSI_REVERSE,
+    ANSI_RED | ANSI_BLINK,
+    ANSI_RED | ANSI_BLINK | ANSI_REVERSE,
+    ANSI_RED | ANSI_UNDERLINE,
+    ANSI_RED | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_RED | ANSI_UNDERLINE | ANSI_BLINK,
+    ANSI_HIDDEN,
+    ANSI_TURQ | ANSI_UNDERLINE,
+    ANSI_TURQ | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_YELLOW | ANSI_UNDERLINE,
+    ANSI_YELLOW | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_TURQ | ANSI_UNDERLINE,
+    ANSI_TURQ | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_YELLOW | ANSI_UNDERLINE,
+    ANSI_HIDDEN,
+    ANSI_PINK,
+    ANSI_PINK | ANSI_REVERSE,
+    ANSI_BLUE,
+    ANSI_BLUE | ANSI_REVERSE,
+    ANSI_PINK | ANSI_UNDERLINE,
+    ANSI_PINK | ANSI_UNDERLINE | ANSI_REVERSE,
+    ANSI_BLUE | ANSI_UNDERLINE,
+    ANSI_HIDDEN,
+    // clang-format on
+};
+
+/* Escape sequences sent by xterm, the Linux console and friends for the
+ * keys which don't send a plain character. */
+struct _AnsiKey {
+    const char* seq;
+    int key;
+};
+
+static const struct _AnsiKey ansi_keys[] = {
+    // clang-format off
+    { "\033[A",     K_UP        },
+    { "\033[B",     K_DOWN      },
+    { "\033[C",     K_RIGHT     },
+    { "\033[D",     K_LEFT      },
+    { "\033OA",     K_UP        },
+    { "\033OB",     K_DOWN      },
+    { "\033OC",     K_RIGHT     },
+    { "\033OD",     K_LEFT      },
+    { "\033[H",     K_HOME      },
+    { "\033OH",     K_HOME      },
+    { "\033[1~",    K_HOME      },
+    { "\033[7~",    K_HOME      },
+    { "\033[F",     K_END       },
+    { "\033OF",     K_END       },
+    { "\033[4~",    K_END       },
+    { "\033[8~",    K_END       },
+    { "\033[2~",    K_INSERT    },
+    { "\033[3~",    K_DELETE    },
+    { "\033[5~",    K_ROLLDN    },
+    { "\033[6~",    K_ROLLUP    },
+    { "\033[Z",     K_BACKTAB   },
+    { "\033OM",     K_FIELDEXIT },
+    { "\033OP",     K_F1        },
+    { "\033OQ",     K_F2        },
+    { "\033OR",     K_F3        },
+    { "\033OS",     K_F4        },
+    { "\033[11~",   K_F1        },
+    { "\033[12~",   K_F2        },
+    { "\033[13~",   K_F3        },
+    { "\033[14~",   K_F4        },
+    { "\033[[A",    K_F1        },
+    { "\033[[B",    K_F2        },
+    { "\033[[C",    K_F3        },
+    { "\033[[D",    K_F4        },
+    { "\033[[E",    K_F5        },
+    { "\033[15~",   K_F5        },
+    { "\033[17~",   K_F6        },
+    { "\033[18~",   K_F7        },
+    { "\033[19~",   K_F8        },
+    { "\033[20~",   K_F9        },
+    { "\033[21~",   K_F10       },
+    { "\033[23~",   K_F11       },
+    { "\033[24~",   K_F12       },
+    { "\033[1;2P",  K_F13       },
+    { "\033[1;2Q",  K_F14       },
+    { "\033[1;2R",  K_F15       },
+    { "\033[1;2S",  K_F16       },
+    { "\033[15;2~", K_F17       },
+    { "\033[17;2~", K_F18       },
+    { "\033[18;2~", K_F19       },
+    { "\033[19;2~", K_F20       },
+    { "\033[20;2~", K_F21       },
+    { "\033[21;2~", K_F22       },
+    { "\033[23;2~", K_F23       },
+    { "\033[24;2~", K_F24       },
+    { "\033[25~",   K_F13       },
+    { "\033[26~",   K_F14       },
+    { "\033[28~",   K_F15       },
+    { "\033[29~",   K_F16       },
+    { "\033[31~",   K_F17       },
+    { "\033[32~",   K_F18       },
+    { "\033[33~",   K_F19       },
+    { "\033[34~",   K_F20       },
+    { NULL,         0           }
+    // clang-format on
+};
+
+#define ANSI_INBUF_SIZE 64
+
+/* Unchanged cells we will rewrite rather than move the cursor over. */
+#define ANSI_SPAN_GAP 6
+
+struct _Tn5250TerminalPrivate {
+    Tn5250Display* display;
+    struct termios saved_termios;
+    unsigned int have_termios : 1;
+    unsigned int quit_flag : 1;
+    unsigned int is_xterm : 1;
+    unsigned int utf8 : 1;
+    unsigned int underscores : 1;
+    unsigned int display_ruler : 1;
+    unsigned int repaint_all : 1;
+    unsigned int clear_screen : 1;
+
+    /* Keyboard input not yet turned into keys.  ``incomplete'' is set
+     * when it holds the start of an escape sequence. */
+    unsigned char inbuf[ANSI_INBUF_SIZE];
+    int inlen;
+    unsigned int incomplete : 1;
+
+    /* What the terminal is showing: a remote character and a style for
+     * every cell, including the indicator line below the display. */
+    int shadow_w, shadow_h;
+    int tty_rows; /* Rows the tty has, or 0 if we don't know */
+    unsigned char* shadow_char;
+    unsigned char* shadow_style;
+
+    /* The row being rendered, in the same form. */
+    unsigned char* row_char;
+    unsigned char* row_style;
+
+    /* The terminal's cursor position and rendition, or -1 if unknown. */
+    int out_y, out_x;
+    int out_style;
+
+    /* The frame being built, written out in one go by flush. */
+    char* out;
+    int out_len, out_alloc;
+
+    char sgr[ANSI_STYLES][24];
+
+    unsigned long last_serial; /* Display buffer drawn last time */
+    const Tn5250CharMap* last_map;
+    int last_cx, last_cy;
+    int rows_alloc;
+    unsigned char* dirty_rows;
+    unsigned char* row_start_attr;
+    unsigned char underscore; /* Remote code for '_' in last_map */
+
+    /* Totals since we were created, for tuning. */
+    unsigned long bytes_written;
+    unsigned long writes;
+};
+
+/****f* lib5250/tn5250_ansi_terminal_new
+ * NAME
+ *    tn5250_ansi_terminal_new
+ * SYNOPSIS
+ *    ret = tn5250_ansi_terminal_new ();
+ * INPUTS
+ *    None
+ * DESCRIPTION
+ *    Create a terminal which draws the display with ANSI escape
+ *    sequences written straight to standard output, without going
+ *    through curses.  It keeps its own copy of what is on the screen, so
+ *    an update sends only the cells that have changed, and it sends each
+ *    update with a single write.
+ *****/
+Tn5250Terminal* tn5250_ansi_terminal_new() {
+    Tn5250Terminal* r = tn5250_new(Tn5250Terminal, 1);
+    char* p;
+    int s;
+
+    if (r == NULL) return NULL;
+
+    r->data = tn5250_new(struct _Tn5250TerminalPrivate, 1);
+    if (r->data == NULL) {
+        free(r);
+        return NULL;
+    }
+
+    r->data->display = NULL;
+    r->data->have_termios = 0;
+    r->data->quit_flag = 0;
+    r->data->is_xterm = 0;
+    r->data->utf8 = 0;
+    r->data->underscores = 0;
+    r->data->display_ruler = 0;
+    r->data->repaint_all = 1;
+    r->data->clear_screen = 1;
+    r->data->inlen = 0;
+    r->data->incomplete = 0;
+    r->data->shadow_w = r->data->shadow_h = 0;
+    r->data->tty_rows = 0;
+    r->data->shadow_char = r->data->shadow_style = NULL;
+    r->data->row_char = r->data->row_style = NULL;
+    r->data->out_y = r->data->out_x = r->data->out_style = -1;
+    r->data->out = NULL;
+    r->data->out_len = r->data->out_alloc = 0;
+    r->data->last_serial = 0;
+    r->data->last_map = NULL;
+    r->data->last_cx = r->data->last_cy = -1;
+    r->data->rows_alloc = 0;
+    r->data->dirty_rows = NULL;
+    r->data->row_start_attr = NULL;
+    r->data->underscore = 0x6d;
+    r->data->bytes_written = r->data->writes = 0;
+
+    /* The escape sequence for every combination of colour and flags. */
+    for (s = 0; s < ANSI_BLANK; s++) {
+        p = r->data->sgr[s];
+        p += sprintf(p, "\x1b[0;%s", ansi_colors[s & ANSI_COLOR]);
+        if ((s & ANSI_REVERSE) != 0) {
+            p += sprintf(p, ";7");
+        }
+        if ((s & ANSI_UNDERLINE) != 0) {
+            p += sprintf(p, ";4");
+        }
+        if ((s & ANSI_BLINK) != 0) {
+            p += sprintf(p, ";5");
+        }
+        strcpy(p, "m");
+    }
+    strcpy(r->data->sgr[ANSI_BLANK], "\x1b[0m");
+
+    r->conn_fd = -1;
+    r->wait_limit = -1;
+    r->init = ansi_terminal_init;
+    r->term = ansi_terminal_term;
+    r->destroy = ansi_terminal_destroy;
+    r->width = ansi_terminal_width;
+    r->height = ansi_terminal_height;
+    r->flags = ansi_terminal_flags;
+    r->update = ansi_terminal_update;
+    r->update_indicators = ansi_terminal_update_indicators;
+    r->waitevent = ansi_terminal_waitevent;
+    r->getkey = ansi_terminal_getkey;
+    r->putkey = NULL;
+    r->beep = ansi_terminal_beep;
+    r->enhanced = NULL;
+    r->config = NULL;
+    return r;
+}
+
+/****f* lib5250/tn5250_ansi_terminal_use_underscores
+ * NAME
+ *    tn5250_ansi_terminal_use_underscores
+ * SYNOPSIS
+ *    tn5250_ansi_terminal_use_underscores (This, f);
+ * INPUTS
+ *    Tn5250Terminal  *    This       - The ANSI terminal object.
+ *    int                  f          - Flag to use underscores
+ * DESCRIPTION
+ *    As tn5250_curses_terminal_use_underscores: show blank cells in
+ *    underlined fields as underscores instead of using the underline
+ *    attribute.
+ *****/
+void tn5250_ansi_terminal_use_underscores(Tn5250Terminal* This, int u) {
+    This->data->underscores = (u != 0);
+    This->data->repaint_all = 1;
+}
+
+/****f* lib5250/tn5250_ansi_terminal_display_ruler
+ * NAME
+ *    tn5250_ansi_terminal_display_ruler
+ * SYNOPSIS
+ *    tn5250_ansi_terminal_display_ruler (This, f);
+ * INPUTS
+ *    Tn5250Terminal  *    This       - The ANSI terminal object.
+ *    int                  f          - Flag, set to 1 to show ruler
+ * DESCRIPTION
+ *    Highlight the row and column of the cursor.
+ *****/
+void tn5250_ansi_terminal_display_ruler(Tn5250Terminal* This, int f) {
+    This->data->display_ruler = (f != 0);
+    This->data->repaint_all = 1;
+}
+
+/****i* lib5250/ansi_terminal_init
+ * NAME
+ *    ansi_terminal_init
+ * SYNOPSIS
+ *    ansi_terminal_init (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Put the tty into raw mode and switch to the alternate screen.
+ *****/
+static void ansi_terminal_init(Tn5250Terminal* This) {
+    struct termios t;
+    const char* str;
+
+    if (tcgetattr(0, &This->data->saved_termios) == 0) {
+        This->data->have_termios = 1;
+        t = This->data->saved_termios;
+        t.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR |
+                       ICRNL | IXON);
+        t.c_oflag &= ~OPOST;
+        t.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+        t.c_cflag &= ~(CSIZE | PARENB);
+        t.c_cflag |= CS8;
+        t.c_cc[VMIN] = 0;
+        t.c_cc[VTIME] = 0;
+        tcsetattr(0, TCSANOW, &t);
+    }
+
+    if ((str = getenv("TERM")) != NULL && !strncmp(str, "xterm", 5)) {
+        This->data->is_xterm = 1;
+    }
+
+    /* Send UTF-8 if that is what the locale says the terminal takes. */
+    if ((str = getenv("LC_ALL")) == NULL || *str == '\0') {
+        if ((str = getenv("LC_CTYPE")) == NULL || *str == '\0') {
+            str = getenv("LANG");
+        }
+    }
+    if (str != NULL && (strstr(str, "UTF-8") != NULL ||
+                        strstr(str, "utf-8") != NULL ||
+                        strstr(str, "utf8") != NULL)) {
+        This->data->utf8 = 1;
+    }
+
+    This->data->quit_flag = 0;
+    This->data->clear_screen = 1;
+    ansi_terminal_put(This, "\x1b[?1049h", -1);
+    ansi_terminal_flush(This);
+}
+
+/****i* lib5250/ansi_terminal_term
+ * NAME
+ *    ansi_terminal_term
+ * SYNOPSIS
+ *    ansi_terminal_term (This);
+ * INPUTS
+ *    Tn5250Terminal  *    This       -
+ * DESCRIPTION
+ *    Put the tty back the way we found it.
+ *****/
+static void ansi_terminal_term(Tn5250Terminal* This) {
+    ansi_terminal_put(This, "\x1b[0m\x1b[?1049l", -1);
+    ansi_terminal_flush(This);
+    if (This->data->have_termios) {
+        tcsetattr(0, TCSANOW, &This->data->saved_termios);
+    }
+    TN5250_LOG(("ANSI: %lu bytes in %lu writes\n", This->data->bytes_written,
+                This->data->writes));
+}
+
+/****i* lib5250/ansi_terminal_destroy
+ * NAME
+ *    ansi_terminal_destroy
+ * SYNOPSIS
+ *    ansi_terminal_destroy (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Free the terminal and everything it owns.
+ *****/
+static void ansi_terminal_destroy(Tn5250Terminal* This) {
+    free(This->data->shadow_char);
+    free(This->data->shadow_style);
+    free(This->data->row_char);
+    free(This->data->row_style);
+    free(This->data->out);
+    free(This->data->dirty_rows);
+    free(This->data->row_start_attr);
+    free(This->data);
+    free(This);
+}
+
+/****i* lib5250/ansi_terminal_width
+ * NAME
+ *    ansi_terminal_width
+ * SYNOPSIS
+ *    ret = ansi_terminal_width (This);
+ * INPUTS
+ *    Tn5250Terminal  *    This       -
+ * DESCRIPTION
+ *    Returns the width of the tty, as the curses terminal does.
+ *****/
+static int ansi_terminal_width(Tn5250Terminal* This) {
+#ifdef TIOCGWINSZ
+    struct winsize ws;
+
+    if (ioctl(1, TIOCGWINSZ, &ws) == 0 && ws.ws_col > 0) {
+        return ws.ws_col + 1;
+    }
+#endif
+    return 81;
+}
+
+/****i* lib5250/ansi_terminal_height
+ * NAME
+ *    ansi_terminal_height
+ * SYNOPSIS
+ *    ret = ansi_terminal_height (This);
+ * INPUTS
+ *    Tn5250Terminal  *    This       -
+ * DESCRIPTION
+ *    Returns the height of the tty, as the curses terminal does.
+ *****/
+static int ansi_terminal_height(Tn5250Terminal* This) {
+#ifdef TIOCGWINSZ
+    struct winsize ws;
+
+    if (ioctl(1, TIOCGWINSZ, &ws) == 0 && ws.ws_row > 0) {
+        return ws.ws_row + 1;
+    }
+#endif
+    return 25;
+}
+
+static int ansi_terminal_flags(Tn5250Terminal* This) {
+    return TN5250_TERMINAL_HAS_COLOR | TN5250_TERMINAL_WAIT_LIMIT;
+}
+
+/****i* lib5250/ansi_terminal_update
+ * NAME
+ *    ansi_terminal_update
+ * SYNOPSIS
+ *    ansi_terminal_update (This, display);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    Tn5250Display *      display    -
+ * DESCRIPTION
+ *    Bring the screen up to date.  Only rows which the display buffer
+ *    says have changed are looked at, and only the cells in them which
+ *    differ from what is on the screen are sent.  The rows, indicators
+ *    and cursor position all go out in one write.
+ *****/
+static void ansi_terminal_update(Tn5250Terminal* This, Tn5250Display* display) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    unsigned char a;
+    int y;
+
+    This->data->display = display;
+
+    if (This->data->shadow_w != tn5250_display_width(display) ||
+        This->data->shadow_h != tn5250_display_height(display) + 1) {
+        ansi_terminal_resize(This, display);
+    }
+    if (This->data->clear_screen) {
+        /* Start again from a blank screen. */
+        ansi_terminal_put(This, "\x1b[0m\x1b[H\x1b[2J", -1);
+        memset(This->data->shadow_char, 0x40,
+               This->data->shadow_w * This->data->shadow_h);
+        memset(This->data->shadow_style, ANSI_BLANK,
+               This->data->shadow_w * This->data->shadow_h);
+        This->data->out_y = This->data->out_x = 0;
+        This->data->out_style = ANSI_BLANK;
+        This->data->clear_screen = 0;
+        This->data->repaint_all = 1;
+    }
+
+    if (This->data->last_serial != tn5250_dbuffer_serial(dbuffer) ||
+        This->data->last_map != tn5250_display_char_map(display)) {
+        This->data->repaint_all = 1;
+        This->data->underscore =
+            tn5250_char_map_to_remote(tn5250_display_char_map(display), '_');
+    }
+    if (This->data->display_ruler &&
+        (This->data->last_cx != tn5250_display_cursor_x(display) ||
+         This->data->last_cy != tn5250_display_cursor_y(display))) {
+        This->data->repaint_all = 1;
+    }
+    tn5250_dbuffer_take_dirty_rows(dbuffer, This->data->dirty_rows);
+
+    for (y = 0; y < tn5250_display_height(display); y++) {
+        a = tn5250_dbuffer_row_start_attr(dbuffer, y);
+        if (!This->data->repaint_all && !This->data->dirty_rows[y] &&
+            This->data->row_start_attr[y] == a) {
+            continue;
+        }
+        This->data->row_start_attr[y] = a;
+        ansi_terminal_render_row(This, display, y);
+    }
+
+    This->data->repaint_all = 0;
+    This->data->last_serial = tn5250_dbuffer_serial(dbuffer);
+    This->data->last_map = tn5250_display_char_map(display);
+    This->data->last_cx = tn5250_display_cursor_x(display);
+    This->data->last_cy = tn5250_display_cursor_y(display);
+
+    ansi_terminal_update_indicators(This, display);
+}
+
+/****i* lib5250/ansi_terminal_update_indicators
+ * NAME
+ *    ansi_terminal_update_indicators
+ * SYNOPSIS
+ *    ansi_terminal_update_indicators (This, display);
+ * INPUTS
+ *    Tn5250Terminal  *    This       -
+ *    Tn5250Display *      display    -
+ * DESCRIPTION
+ *    Redraw the indicator line if it has changed, put the cursor in
+ *    place and send whatever we have built up.  Nothing is written if
+ *    nothing has changed.
+ *****/
+static void ansi_terminal_update_indicators(Tn5250Terminal* This,
+                                            Tn5250Display* display) {
+    This->data->display = display;
+    if (This->data->shadow_w != tn5250_display_width(display) ||
+        This->data->shadow_h != tn5250_display_height(display) + 1) {
+        ansi_terminal_update(This, display);
+        return;
+    }
+    /* There's nowhere to put the indicators if the tty has no more rows
+     * than the display. */
+    if (This->data->tty_rows > tn5250_display_height(display)) {
+        ansi_terminal_render_indicators(This, display);
+    }
+    ansi_terminal_move(This, tn5250_display_cursor_y(display),
+                       tn5250_display_cursor_x(display));
+    ansi_terminal_flush(This);
+}
+
+/*
+ *    Set up for a display of a new size: ask an xterm to change size to
+ *    suit, and reallocate our copy of the screen.
+ */
+static void ansi_terminal_resize(Tn5250Terminal* This, Tn5250Display* display) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+    int w = tn5250_display_width(display);
+    int h = tn5250_display_height(display);
+    char buf[32];
+
+    if (p->is_xterm) {
+        sprintf(buf, "\x1b[8;%d;%dt", h + 1, w);
+        ansi_terminal_put(This, buf, -1);
+        p->tty_rows = h + 1;
+    }
+    else {
+        p->tty_rows = ansi_terminal_height(This) - 1;
+    }
+
+    p->shadow_w = w;
+    p->shadow_h = h + 1;
+    p->shadow_char = (unsigned char*)realloc(p->shadow_char, w * (h + 1));
+    p->shadow_style = (unsigned char*)realloc(p->shadow_style, w * (h + 1));
+    p->row_char = (unsigned char*)realloc(p->row_char, w);
+    p->row_style = (unsigned char*)realloc(p->row_style, w);
+    if (p->rows_alloc < h) {
+        p->dirty_rows = (unsigned char*)realloc(p->dirty_rows, h);
+        p->row_start_attr = (unsigned char*)realloc(p->row_start_attr, h);
+        p->rows_alloc = h;
+    }
+    TN5250_ASSERT(p->shadow_char != NULL && p->shadow_style != NULL);
+    TN5250_ASSERT(p->row_char != NULL && p->row_style != NULL);
+    TN5250_ASSERT(p->dirty_rows != NULL && p->row_start_attr != NULL);
+    p->clear_screen = 1;
+}
+
+/****i* lib5250/ansi_terminal_render_row
+ * NAME
+ *    ansi_terminal_render_row
+ * SYNOPSIS
+ *    ansi_terminal_render_row (This, display, y);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    Tn5250Display *      display    -
+ *    int                  y          - Row to paint.
+ * DESCRIPTION
+ *    Work out what row ``y'' should look like, with the same rules as
+ *    curses_terminal_render_row, and send the parts of it which are
+ *    different from what is on the screen.
+ *****/
+static void ansi_terminal_render_row(Tn5250Terminal* This,
+                                     Tn5250Display* display, int y) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    const unsigned char* chars = tn5250_dbuffer_char_row(dbuffer, y);
+    const unsigned char* attrs = tn5250_dbuffer_attr_row(dbuffer, y);
+    unsigned char* row_char = This->data->row_char;
+    unsigned char* row_style = This->data->row_style;
+    int ruler_row = This->data->display_ruler &&
+                    y == tn5250_display_cursor_y(display);
+    int ruler_col = This->data->display_ruler
+                        ? tn5250_display_cursor_x(display)
+                        : -1;
+    unsigned char c, style;
+    int x;
+
+    for (x = 0; x < tn5250_display_width(display); x++) {
+        c = 0x40;
+        style = ANSI_GREEN;
+        if (attrs[x] != 0x00 &&
+            (style = ansi_attribute_map[attrs[x] - 0x20]) != ANSI_HIDDEN) {
+            c = chars[x];
+            /* UNPRINTABLE -- print block */
+            if (c == 0x1f || c == 0x3f) {
+                c = 0x40;
+                style ^= ANSI_REVERSE;
+            }
+            /* UNPRINTABLE -- print blank */
+            else if ((c < 0x40 && c > 0x00) || c == 0xff) {
+                c = 0x40;
+            }
+            if (This->data->underscores && (style & ANSI_UNDERLINE) != 0) {
+                style &= ~ANSI_UNDERLINE;
+                if (c == 0x40 || c == 0x00) {
+                    c = This->data->underscore;
+                }
+            }
+        }
+        else {
+            style = ANSI_GREEN;
+        }
+        if (ruler_row || x == ruler_col) {
+            style |= ANSI_REVERSE;
+        }
+        /* A blank which isn't reversed or underlined looks the same
+         * whatever its colour. */
+        if ((c == 0x40 || c == 0x00) &&
+            (style & (ANSI_REVERSE | ANSI_UNDERLINE)) == 0) {
+            c = 0x40;
+            style = ANSI_BLANK;
+        }
+        row_char[x] = c;
+        row_style[x] = style;
+    }
+    ansi_terminal_emit_row(This, y, tn5250_display_width(display));
+}
+
+/*
+ *    Render the indicator line below the display, as the curses terminal
+ *    lays it out.
+ */
+static void ansi_terminal_render_indicators(Tn5250Terminal* This,
+                                            Tn5250Display* display) {
+    const Tn5250CharMap* map = tn5250_display_char_map(display);
+    int inds = tn5250_display_indicators(display);
+    char ind_buf[81];
+    int x, w;
+
+    memset(ind_buf, ' ', sizeof(ind_buf));
+    memcpy(ind_buf, "5250", 4);
+    if ((inds & TN5250_DISPLAY_IND_MESSAGE_WAITING) != 0) {
+        memcpy(ind_buf + 23, "MW", 2);
+    }
+    if ((inds & TN5250_DISPLAY_IND_INHIBIT) != 0) {
+        memcpy(ind_buf + 9, "X II", 4);
+    }
+    else if ((inds & TN5250_DISPLAY_IND_X_CLOCK) != 0) {
+        memcpy(ind_buf + 9, "X CLOCK", 7);
+    }
+    else if ((inds & TN5250_DISPLAY_IND_X_SYSTEM) != 0) {
+        memcpy(ind_buf + 9, "X SYSTEM", 8);
+    }
+    if ((inds & TN5250_DISPLAY_IND_INSERT) != 0) {
+        memcpy(ind_buf + 30, "IM", 2);
+    }
+    if ((inds & TN5250_DISPLAY_IND_FER) != 0) {
+        memcpy(ind_buf + 33, "FER", 3);
+    }
+    if ((inds & TN5250_DISPLAY_IND_MACRO) != 0) {
+        memcpy(ind_buf + 54, tn5250_macro_printstate(display), 11);
+    }
+    /* Three digits each is all the row has room for; taking them modulo
+     * 1000 lets the compiler see that too. */
+    snprintf(ind_buf + 72, sizeof(ind_buf) - 72, "%03u/%03u",
+             (unsigned)(tn5250_display_cursor_x(display) + 1) % 1000U,
+             (unsigned)(tn5250_display_cursor_y(display) + 1) % 1000U);
+
+    w = This->data->shadow_w < 80 ? This->data->shadow_w : 80;
+    for (x = 0; x < w; x++) {
+        if (ind_buf[x] == ' ') {
+            This->data->row_char[x] = 0x40;
+            This->data->row_style[x] = ANSI_BLANK;
+        }
+        else {
+            This->data->row_char[x] =
+                tn5250_char_map_to_remote(map, ind_buf[x]);
+            This->data->row_style[x] = ANSI_WHITE;
+        }
+    }
+    ansi_terminal_emit_row(This, This->data->shadow_h - 1, w);
+}
+
+/****i* lib5250/ansi_terminal_emit_row
+ * NAME
+ *    ansi_terminal_emit_row
+ * SYNOPSIS
+ *    ansi_terminal_emit_row (This, y, w);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    int                  y          - Row of the screen.
+ *    int                  w          - Number of cells in row_char.
+ * DESCRIPTION
+ *    Compare the row we have just rendered with what is on row ``y'' of
+ *    the screen, and add what it takes to change the one into the other
+ *    to the frame.  Changed cells are sent in spans, with a cursor
+ *    movement only where there's a run of unchanged cells too long to
+ *    be worth sending again, and a new rendition only where it changes.
+ *    If a span runs on to a blank end of line, that is cleared instead.
+ *****/
+static void ansi_terminal_emit_row(Tn5250Terminal* This, int y, int w) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+    unsigned char* shadow_char = p->shadow_char + y * p->shadow_w;
+    unsigned char* shadow_style = p->shadow_style + y * p->shadow_w;
+    const Tn5250CharMap* map = tn5250_display_char_map(p->display);
+    char glyph[TN5250_UTF8_MAX + 1];
+    int x, end, gap, blank_from, clear_rest, i, n;
+
+    /* Where the row goes blank to the end. */
+    for (blank_from = w; blank_from > 0; blank_from--) {
+        if (p->row_char[blank_from - 1] != 0x40 ||
+            p->row_style[blank_from - 1] != ANSI_BLANK) {
+            break;
+        }
+    }
+
+    x = 0;
+    while (x < w) {
+        if (p->row_char[x] == shadow_char[x] &&
+            p->row_style[x] == shadow_style[x]) {
+            x++;
+            continue;
+        }
+
+        end = x + 1;
+        gap = 0;
+        for (i = x + 1; i < w && gap < ANSI_SPAN_GAP; i++) {
+            if (p->row_char[i] == shadow_char[i] &&
+                p->row_style[i] == shadow_style[i]) {
+                gap++;
+            }
+            else {
+                gap = 0;
+                end = i + 1;
+            }
+        }
+
+        ansi_terminal_move(This, y, x);
+        clear_rest = 0;
+        if (end > blank_from && w - blank_from > 4) {
+            end = blank_from;
+            clear_rest = 1;
+        }
+        for (i = x; i < end; i++) {
+            if (p->row_style[i] != p->out_style) {
+                p->out_style = p->row_style[i];
+                ansi_terminal_put(This, p->sgr[p->out_style], -1);
+            }
+            if (p->utf8) {
+                n = tn5250_char_map_to_utf8_n(map, glyph, sizeof(glyph),
+                                              p->row_char + i, 1);
+            }
+            else {
+                glyph[0] = (char)tn5250_char_map_to_local(map, p->row_char[i]);
+                n = 1;
+            }
+            ansi_terminal_put(This, glyph, n);
+            shadow_char[i] = p->row_char[i];
+            shadow_style[i] = p->row_style[i];
+        }
+        p->out_x = end;
+        if (clear_rest) {
+            /* Clear the rest of the row in one go. */
+            if (p->out_style != ANSI_BLANK) {
+                p->out_style = ANSI_BLANK;
+                ansi_terminal_put(This, p->sgr[ANSI_BLANK], -1);
+            }
+            ansi_terminal_put(This, "\x1b[K", 3);
+            memset(shadow_char + end, 0x40, p->shadow_w - end);
+            memset(shadow_style + end, ANSI_BLANK, p->shadow_w - end);
+            end = w;
+        }
+        if (p->out_x >= p->shadow_w) {
+            /* The terminal may or may not have wrapped. */
+            p->out_y = p->out_x = -1;
+        }
+        x = end;
+    }
+}
+
+/*
+ *    Add ``len'' bytes to the frame, or a NUL-terminated string if len is
+ *    negative.
+ */
+static void ansi_terminal_put(Tn5250Terminal* This, const char* s, int len) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+
+    if (len < 0) {
+        len = strlen(s);
+    }
+    if (p->out_len + len > p->out_alloc) {
+        p->out_alloc = (p->out_len + len) * 2 + 256;
+        p->out = (char*)realloc(p->out, p->out_alloc);
+        TN5250_ASSERT(p->out != NULL);
+    }
+    memcpy(p->out + p->out_len, s, len);
+    p->out_len += len;
+}
+
+/*
+ *    Move the terminal's cursor to (y, x), if it isn't already there.
+ */
+static void ansi_terminal_move(Tn5250Terminal* This, int y, int x) {
+    char buf[32]; /* Room for two ints of any size. */
+
+    if (This->data->out_y == y && This->data->out_x == x) {
+        return;
+    }
+    ansi_terminal_put(This, buf,
+                      snprintf(buf, sizeof(buf), "\x1b[%d;%dH", y + 1, x + 1));
+    This->data->out_y = y;
+    This->data->out_x = x;
+}
+
+/*
+ *    Write out the frame we have built up.
+ */
+static void ansi_terminal_flush(Tn5250Terminal* This) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+    int done = 0, r;
+
+    while (done < p->out_len) {
+        r = write(1, p->out + done, p->out_len - done);
+        if (r < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            break;
+        }
+        done += r;
+        p->writes++;
+    }
+    p->bytes_written += done;
+    p->out_len = 0;
+}
+
+/****i* lib5250/ansi_terminal_waitevent
+ * NAME
+ *    ansi_terminal_waitevent
+ * SYNOPSIS
+ *    ret = ansi_terminal_waitevent (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Wait for keyboard input or data from the host.
+ *****/
+static int ansi_terminal_waitevent(Tn5250Terminal* This) {
+    fd_set fdr;
+    struct timeval tv;
+    int result = 0;
+    int sm;
+
+    if (This->data->quit_flag) return TN5250_TERMINAL_EVENT_QUIT;
+
+    /* Keys we've read but not handed out yet. */
+    if (This->data->inlen > 0 && !This->data->incomplete) {
+        return TN5250_TERMINAL_EVENT_KEY;
+    }
+
+    FD_ZERO(&fdr);
+
+    FD_SET(0, &fdr);
+    sm = 1;
+    if (This->conn_fd >= 0) {
+        FD_SET(This->conn_fd, &fdr);
+        sm = This->conn_fd + 1;
+    }
+
+    tv.tv_sec = This->wait_limit / 1000;
+    tv.tv_usec = (This->wait_limit % 1000) * 1000;
+    switch (select(sm, &fdr, NULL, NULL, This->wait_limit < 0 ? NULL : &tv)) {
+    case -1:
+        return 0;
+    case 0:
+        return TN5250_TERMINAL_EVENT_TIMEOUT;
+    }
+
+    if (FD_ISSET(0, &fdr)) {
+        result |= TN5250_TERMINAL_EVENT_KEY;
+    }
+
+    if (This->conn_fd >= 0 && FD_ISSET(This->conn_fd, &fdr)) {
+        result |= TN5250_TERMINAL_EVENT_DATA;
+    }
+
+    return result;
+}
+
+/****i* lib5250/ansi_terminal_getkey
+ * NAME
+ *    ansi_terminal_getkey
+ * SYNOPSIS
+ *    ret = ansi_terminal_getkey (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Return the next key typed, or -1 if there isn't a whole one yet.
+ *    Escape sequences are looked up in ansi_keys; the control keys and
+ *    the Esc and C-g shortcuts are the same as in the curses terminal.
+ *****/
+static int ansi_terminal_getkey(Tn5250Terminal* This) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+    const struct _AnsiKey* k;
+    int r, key, used, partial, c;
+
+    if (p->inlen == 0 || p->incomplete) {
+        r = read(0, p->inbuf + p->inlen, ANSI_INBUF_SIZE - p->inlen);
+        if (r > 0) {
+            p->inlen += r;
+        }
+    }
+    p->incomplete = 0;
+    if (p->inlen == 0) {
+        return -1;
+    }
+
+    key = p->inbuf[0];
+    used = 1;
+    if ((key == 0x1b || key == K_CTRL('G')) && p->inlen == 1) {
+        p->incomplete = 1;
+        return -1;
+    }
+    if (key == 0x1b && (p->inbuf[1] == '[' || p->inbuf[1] == 'O')) {
+        key = -1;
+        partial = 0;
+        for (k = ansi_keys; k->seq != NULL; k++) {
+            used = strlen(k->seq);
+            if (used <= p->inlen && !memcmp(p->inbuf, k->seq, used)) {
+                key = k->key;
+                break;
+            }
+            if (used > p->inlen && !memcmp(p->inbuf, k->seq, p->inlen)) {
+                partial = 1;
+            }
+        }
+        if (key == -1) {
+            if (partial && p->inlen < ANSI_INBUF_SIZE) {
+                p->incomplete = 1;
+                return -1;
+            }
+            /* Skip a sequence we don't know, up to its final byte. */
+            for (used = 2; used < p->inlen - 1; used++) {
+                c = p->inbuf[used];
+                if (p->inbuf[1] == 'O' ||
+                    (c >= 0x40 && c <= 0x7e && (used > 2 || c != '['))) {
+                    break;
+                }
+            }
+            used++;
+            if (used > p->inlen) {
+                used = p->inlen;
+            }
+            TN5250_LOG(("ANSI: unknown key sequence, %d bytes\n", used));
+        }
+    }
+    else if (key == 0x1b || key == K_CTRL('G')) {
+        key = ansi_terminal_shortcut(This, p->inbuf[1]);
+        used = 2;
+    }
+    else {
+        switch (key) {
+        case 0x0d:
+        case 0x0a:
+            key = K_ENTER;
+            break;
+        case 0x08:
+        case 0x7f:
+            key = K_BACKSPACE;
+            break;
+        case K_CTRL('A'):
+            key = K_ATTENTION;
+            break;
+        case K_CTRL('B'):
+            key = K_ROLLDN;
+            break;
+        case K_CTRL('C'):
+            key = K_SYSREQ;
+            break;
+        case K_CTRL('D'):
+            key = K_ROLLUP;
+            break;
+        case K_CTRL('E'):
+            key = K_ERASE;
+            break;
+        case K_CTRL('F'):
+            key = K_ROLLUP;
+            break;
+        case K_CTRL('K'):
+            key = K_FIELDEXIT;
+            break;
+        case K_CTRL('L'):
+            key = K_REFRESH;
+            break;
+        case K_CTRL('O'):
+            key = K_HOME;
+            break;
+        case K_CTRL('P'):
+            key = K_PRINT;
+            break;
+        case K_CTRL('R'):
+            key = K_RESET; /* Error Reset */
+            break;
+        case K_CTRL('S'):
+            key = K_MEMO;
+            break;
+        case K_CTRL('T'):
+            key = K_TESTREQ;
+            break;
+        case K_CTRL('U'):
+            key = K_ROLLDN;
+            break;
+        case K_CTRL('W'):
+            key = K_EXEC;
+            break;
+        case K_CTRL('X'):
+            key = K_FIELDPLUS;
+            break;
+        case K_CTRL('Q'):
+            p->quit_flag = 1;
+            key = -1;
+            break;
+        }
+    }
+
+    p->inlen -= used;
+    memmove(p->inbuf, p->inbuf + used, p->inlen);
+
+    if (key == K_REFRESH) {
+        p->clear_screen = 1;
+    }
+    /* -1 would tell the display there are no more keys. */
+    return key == -1 && p->inlen > 0 ? ansi_terminal_getkey(This) : key;
+}
+
+/*
+ *    The key for Esc or C-g followed by ``key'', as in
+ *    curses_terminal_get_esc_key.
+ */
+static int ansi_terminal_shortcut(Tn5250Terminal* This, int key) {
+    static const char fkeys[] = "1234567890-=!@#$%^&*()_+";
+    const char* f;
+
+    if (isalpha(key)) {
+        key = toupper(key);
+    }
+    if (key != 0 && (f = strchr(fkeys, key)) != NULL) {
+        return K_F1 + (int)(f - fkeys);
+    }
+
+    switch (key) {
+    case K_CTRL('U'):
+        return K_NEXTFLD;
+    case K_CTRL('H'):
+        return K_PREVFLD;
+    case K_CTRL('F'):
+        return K_FIELDHOME;
+
+        /* AS/400 strangeness */
+    case 'A':
+        return K_ATTENTION;
+    case 'C':
+        return K_CLEAR;
+    case 'D':
+        return K_DUPLICATE;
+    case 'H':
+        return K_HELP;
+    case 'I':
+        return K_INSERT;
+    case 'L':
+        return K_REFRESH;
+    case 'M':
+        return K_FIELDMINUS;
+    case 'P':
+        return K_PRINT;
+    case 'R':
+        return K_RESET;
+    case 'S':
+        return K_SYSREQ;
+    case 'T':
+        return K_TOGGLE;
+    case 'X':
+        return K_FIELDEXIT;
+    case 127:
+        return K_INSERT; /* ESC DEL */
+    case K_CTRL('J'):
+    case K_CTRL('M'):
+        return K_NEWLINE;
+
+    case 'Q':
+        This->data->quit_flag = 1;
+        return -1;
+
+    default:
+        ansi_terminal_beep(This);
+        return -1;
+    }
+}
+
+/****i* lib5250/ansi_terminal_beep
+ * NAME
+ *    ansi_terminal_beep
+ * SYNOPSIS
+ *    ansi_terminal_beep (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Ring the bell, with the next frame.
+ *****/
+static void ansi_terminal_beep(Tn5250Terminal* This) {
+    TN5250_LOG(("ANSI: beep\n"));
+    ansi_terminal_put(This, "\007", 1);
+}
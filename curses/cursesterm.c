@@ -90,6 +90,10 @@ static void curses_terminal_beep(Tn5250Terminal* This);
 static int curses_terminal_enhanced(Tn5250Terminal* This);
 static int curses_terminal_is_ruler(Tn5250Terminal* This,
                                     Tn5250Display* display, int x, int y);
+static void curses_terminal_render_row(Tn5250Terminal* This,
+                                       Tn5250Display* display, int y);
+static void curses_terminal_sigwinch(int sig);
+static void curses_terminal_winch(Tn5250Terminal* This);
 int curses_rgb_to_color(int r, int g, int b, int* rclr, int* rbold);
 int curses_terminal_config(Tn5250Terminal* This, Tn5250Config* config);
 void curses_terminal_print_screen(Tn5250Terminal* This, Tn5250Display* display);
@@ -126,8 +130,28 @@ struct _Tn5250TerminalPrivate {
     unsigned int is_xterm : 1;
     unsigned int display_ruler : 1;
     unsigned int local_print : 1;
+    unsigned int repaint_all : 1;
+
+    /* What we painted last time, so that update only has to repaint the
+     * rows which have changed since. */
+    unsigned long last_serial; /* Of the display buffer */
+    const Tn5250CharMap* last_map;
+    int last_cx, last_cy;
+    int rows_alloc, cols_alloc;
+    unsigned char* dirty_rows;
+    unsigned char* row_start_attr; /* Attribute in effect at column 0 */
+    chtype* row_buf;
 };
 
+/* SIGWINCH writes a byte here, and waitevent watches the other end, so
+ * that a resize is handled from the event loop rather than the signal
+ * handler. */
+static int curses_winch_pipe[2] = { -1, -1 };
+#ifdef SIGWINCH
+/* The handler we replaced (usually curses' own), put back by term. */
+static struct sigaction curses_winch_old;
+#endif
+
 #ifdef USE_OWN_KEY_PARSING
 /* This is an array mapping our key code to a termcap capability
  * name. */
@@ -288,6 +312,14 @@ Tn5250Terminal* tn5250_curses_terminal_new() {
     r->data->local_print = 0;
     r->data->display = NULL;
     r->data->config = NULL;
+    r->data->repaint_all = 1;
+    r->data->last_serial = 0;
+    r->data->last_map = NULL;
+    r->data->last_cx = r->data->last_cy = -1;
+    r->data->rows_alloc = r->data->cols_alloc = 0;
+    r->data->dirty_rows = NULL;
+    r->data->row_start_attr = NULL;
+    r->data->row_buf = NULL;
 
 #ifdef USE_OWN_KEY_PARSING
     r->data->k_buf_len = 0;
@@ -296,6 +328,7 @@ Tn5250Terminal* tn5250_curses_terminal_new() {
 #endif
 
     r->conn_fd = -1;
+    r->wait_limit = -1;
     r->init = curses_terminal_init;
     r->term = curses_terminal_term;
     r->destroy = curses_terminal_destroy;
@@ -343,6 +376,24 @@ static void curses_terminal_init(Tn5250Terminal* This) {
     nodelay(stdscr, 1);
     noecho();
 
+#ifdef SIGWINCH
+    if (curses_winch_pipe[0] < 0 && pipe(curses_winch_pipe) == 0) {
+        struct sigaction sa;
+
+        fcntl(curses_winch_pipe[0], F_SETFL, O_NONBLOCK);
+        fcntl(curses_winch_pipe[1], F_SETFL, O_NONBLOCK);
+        fcntl(curses_winch_pipe[0], F_SETFD, FD_CLOEXEC);
+        fcntl(curses_winch_pipe[1], F_SETFD, FD_CLOEXEC);
+
+        /* This replaces curses' own handler; curses_terminal_winch tells
+         * curses about the new size instead. */
+        sa.sa_handler = curses_terminal_sigwinch;
+        sigemptyset(&sa.sa_mask);
+        sa.sa_flags = SA_RESTART;
+        sigaction(SIGWINCH, &sa, &curses_winch_old);
+    }
+#endif
+
     /* Determine if we're talking to an xterm ;) */
     if ((str = getenv("TERM")) != NULL &&
         (!strcmp(str, "xterm") || !strcmp(str, "xterm-5250") ||
@@ -547,6 +598,14 @@ void tn5250_curses_terminal_set_xterm_font(Tn5250Terminal* This,
  *    DOCUMENT ME!!!
  *****/
 static void curses_terminal_term(Tn5250Terminal /*@unused@*/* This) {
+#ifdef SIGWINCH
+    if (curses_winch_pipe[0] >= 0) {
+        sigaction(SIGWINCH, &curses_winch_old, NULL);
+        close(curses_winch_pipe[0]);
+        close(curses_winch_pipe[1]);
+        curses_winch_pipe[0] = curses_winch_pipe[1] = -1;
+    }
+#endif
     endwin();
 }
 
@@ -572,6 +631,13 @@ static void curses_terminal_destroy(Tn5250Terminal* This) {
     if (This->data->font_132 != NULL) {
         free(This->data->font_132);
     }
+    if (This->data->rows_alloc != 0) {
+        free(This->data->dirty_rows);
+        free(This->data->row_start_attr);
+    }
+    if (This->data->cols_alloc != 0) {
+        free(This->data->row_buf);
+    }
     if (This->data != NULL) {
         free(This->data);
     }
@@ -621,7 +687,7 @@ static int curses_terminal_height(Tn5250Terminal /*@unused@*/* This) {
  *    DOCUMENT ME!!!
  *****/
 static int curses_terminal_flags(Tn5250Terminal /*@unused@*/* This) {
-    int f = 0;
+    int f = TN5250_TERMINAL_WAIT_LIMIT;
     if (has_colors() != 0) {
         f |= TN5250_TERMINAL_HAS_COLOR;
     }
@@ -642,9 +708,8 @@ static int curses_terminal_flags(Tn5250Terminal /*@unused@*/* This) {
 static void curses_terminal_update(Tn5250Terminal* This,
                                    Tn5250Display* display) {
     int my, mx;
-    int y, x;
-    attr_t curs_attr;
-    unsigned char a = 0x20, c;
+    int y;
+    unsigned char a;
 
     This->data->display = display;
 
@@ -663,94 +728,70 @@ static void curses_terminal_update(Tn5250Terminal* This,
             printf("\x1b[8;%d;%dt", tn5250_display_height(display) + 1,
                    tn5250_display_width(display));
             fflush(stdout);
-#ifdef HAVE_RESIZETERM
-            resizeterm(tn5250_display_height(display) + 1,
-                       tn5250_display_width(display) + 1);
-#endif
-            /* Make sure we get a SIGWINCH - We need curses to resize its
-             * buffer. */
-            raise(SIGWINCH);
-            refresh();
         }
         This->data->last_width = tn5250_display_width(display);
         This->data->last_height = tn5250_display_height(display);
+        This->data->repaint_all = 1;
 
-        /* XXX: this is somewhat of a hack.  For some reason the change to
-              132 col lags a bit, causing our update to fail, so this just waits
-              for the update to finish...  (is there a better way?) */
+        /* We don't wait for the xterm to change size: we paint what fits
+         * now, and the SIGWINCH it sends when it has resized brings us
+         * back through curses_terminal_winch to paint the lot. */
+    }
+    if (This->data->rows_alloc < tn5250_display_height(display)) {
+        int h = tn5250_display_height(display);
+        This->data->dirty_rows =
+            (unsigned char*)realloc(This->data->dirty_rows, h);
+        This->data->row_start_attr =
+            (unsigned char*)realloc(This->data->row_start_attr, h);
+        TN5250_ASSERT(This->data->dirty_rows != NULL);
+        TN5250_ASSERT(This->data->row_start_attr != NULL);
+        This->data->rows_alloc = h;
+        This->data->repaint_all = 1;
+    }
+    if (This->data->cols_alloc < tn5250_display_width(display)) {
+        This->data->cols_alloc = tn5250_display_width(display);
+        This->data->row_buf = (chtype*)realloc(
+            This->data->row_buf, This->data->cols_alloc * sizeof(chtype));
+        TN5250_ASSERT(This->data->row_buf != NULL);
+    }
 
-        for (x = 0; x < 10; x++) {
-            refresh();
-            if (tn5250_display_width(display) ==
-                curses_terminal_width(This) - 1) {
-                break;
-            }
-            usleep(10000);
-        }
+    /* Anything which changes what every row looks like, rather than the
+     * contents of the display buffer, means we have to paint it all. */
+    if (This->data->last_serial !=
+            tn5250_dbuffer_serial(tn5250_display_dbuffer(display)) ||
+        This->data->last_map != tn5250_display_char_map(display)) {
+        This->data->repaint_all = 1;
     }
+    if (This->data->display_ruler &&
+        (This->data->last_cx != tn5250_display_cursor_x(display) ||
+         This->data->last_cy != tn5250_display_cursor_y(display))) {
+        This->data->repaint_all = 1;
+    }
+    tn5250_dbuffer_take_dirty_rows(tn5250_display_dbuffer(display),
+                                   This->data->dirty_rows);
+
     attrset(A_NORMAL);
     getmaxyx(stdscr, my, mx);
     for (y = 0; y < tn5250_display_height(display); y++) {
         if (y > my) break;
 
-        move(y, 0);
-        for (x = 0; x < tn5250_display_width(display); x++) {
-            c = tn5250_display_char_at(display, y, x);
-            if ((c & 0xe0) == 0x20) { /* ATTRIBUTE */
-                a = (c & 0xff);
-                if (curses_terminal_is_ruler(This, display, x, y)) {
-                    addch(A_REVERSE | attribute_map[0] | ' ');
-                }
-                else {
-                    addch(attribute_map[0] | ' ');
-                }
-            }
-            else { /* DATA */
-                curs_attr = attribute_map[a - 0x20];
-                if (curs_attr == 0x00) { /* NONDISPLAY */
-                    if (curses_terminal_is_ruler(This, display, x, y)) {
-                        addch(A_REVERSE | attribute_map[0] | ' ');
-                    }
-                    else {
-                        addch(attribute_map[0] | ' ');
-                    }
-                }
-                else {
-                    /* UNPRINTABLE -- print block */
-                    if ((c == 0x1f) || (c == 0x3F)) {
-                        c = ' ';
-                        curs_attr ^= A_REVERSE;
-                    }
-                    /* UNPRINTABLE -- print blank */
-                    else if ((c < 0x40 && c > 0x00) || c == 0xff) {
-                        c = ' ';
-                    }
-                    else {
-                        c = tn5250_char_map_to_local(
-                            tn5250_display_char_map(display), c);
-                    }
-                    if ((curs_attr & A_VERTICAL) != 0) {
-                        curs_attr |= A_UNDERLINE;
-                        curs_attr &= ~A_VERTICAL;
-                    }
-                    /* This is a kludge since vga hardware doesn't support
-                     * under- lining characters.  It's pretty ugly. */
-                    if (This->data->underscores) {
-                        if ((curs_attr & A_UNDERLINE) != 0) {
-                            curs_attr &= ~A_UNDERLINE;
-                            if (c == ' ') {
-                                c = '_';
-                            }
-                        }
-                    }
-                    if (curses_terminal_is_ruler(This, display, x, y)) {
-                        curs_attr |= A_REVERSE;
-                    }
-                    addch((chtype)(c | curs_attr));
-                }
-            } /* if ((c & 0xe0) ... */
-        }     /* for (int x ... */
-    }         /* for (int y ... */
+        /* An attribute carries on past the end of its row, so a row needs
+         * repainting if the attribute it starts with has changed, too. */
+        a = tn5250_dbuffer_row_start_attr(tn5250_display_dbuffer(display), y);
+        if (!This->data->repaint_all && !This->data->dirty_rows[y] &&
+            This->data->row_start_attr[y] == a) {
+            continue;
+        }
+        This->data->row_start_attr[y] = a;
+        curses_terminal_render_row(This, display, y);
+    }
+
+    This->data->repaint_all = 0;
+    This->data->last_serial =
+        tn5250_dbuffer_serial(tn5250_display_dbuffer(display));
+    This->data->last_map = tn5250_display_char_map(display);
+    This->data->last_cx = tn5250_display_cursor_x(display);
+    This->data->last_cy = tn5250_display_cursor_y(display);
 
     move(tn5250_display_cursor_y(display), tn5250_display_cursor_x(display));
 
@@ -787,6 +828,89 @@ static int curses_terminal_is_ruler(Tn5250Terminal* This,
     return 0;
 }
 
+/****i* lib5250/curses_terminal_render_row
+ * NAME
+ *    curses_terminal_render_row
+ * SYNOPSIS
+ *    curses_terminal_render_row (This, display, y);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    Tn5250Display *      display    -
+ *    int                  y          - Row to paint.
+ * DESCRIPTION
+ *    Build row ``y'' of the display as a line of chtypes and put it on
+ *    the screen with a single addchnstr.  The attribute of each cell
+ *    comes from the display buffer's attribute plane, so rows can be
+ *    painted in any order.
+ *****/
+static void curses_terminal_render_row(Tn5250Terminal* This,
+                                       Tn5250Display* display, int y) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    chtype* row = This->data->row_buf;
+    const unsigned char* local = tn5250_display_text_row(display, y);
+    const unsigned char* chars = tn5250_dbuffer_char_row(dbuffer, y);
+    const unsigned char* attrs = tn5250_dbuffer_attr_row(dbuffer, y);
+    attr_t curs_attr;
+    unsigned char c;
+    int x;
+
+    for (x = 0; x < tn5250_display_width(display); x++) {
+        if (attrs[x] == 0x00) { /* ATTRIBUTE */
+            if (curses_terminal_is_ruler(This, display, x, y)) {
+                row[x] = A_REVERSE | attribute_map[0] | ' ';
+            }
+            else {
+                row[x] = attribute_map[0] | ' ';
+            }
+        }
+        else { /* DATA */
+            c = chars[x];
+            curs_attr = attribute_map[attrs[x] - 0x20];
+            if (curs_attr == 0x00) { /* NONDISPLAY */
+                if (curses_terminal_is_ruler(This, display, x, y)) {
+                    row[x] = A_REVERSE | attribute_map[0] | ' ';
+                }
+                else {
+                    row[x] = attribute_map[0] | ' ';
+                }
+            }
+            else {
+                /* UNPRINTABLE -- print block */
+                if ((c == 0x1f) || (c == 0x3F)) {
+                    c = ' ';
+                    curs_attr ^= A_REVERSE;
+                }
+                /* UNPRINTABLE -- print blank */
+                else if ((c < 0x40 && c > 0x00) || c == 0xff) {
+                    c = ' ';
+                }
+                else {
+                    c = local[x];
+                }
+                if ((curs_attr & A_VERTICAL) != 0) {
+                    curs_attr |= A_UNDERLINE;
+                    curs_attr &= ~A_VERTICAL;
+                }
+                /* This is a kludge since vga hardware doesn't support
+                 * under- lining characters.  It's pretty ugly. */
+                if (This->data->underscores) {
+                    if ((curs_attr & A_UNDERLINE) != 0) {
+                        curs_attr &= ~A_UNDERLINE;
+                        if (c == ' ') {
+                            c = '_';
+                        }
+                    }
+                }
+                if (curses_terminal_is_ruler(This, display, x, y)) {
+                    curs_attr |= A_REVERSE;
+                }
+                row[x] = (chtype)(c | curs_attr);
+            }
+        } /* if (attrs[x] ... */
+    }
+    mvaddchnstr(y, 0, row, tn5250_display_width(display));
+}
+
 /****i* lib5250/curses_terminal_update_indicators
  * NAME
  *    curses_terminal_update_indicators
@@ -848,8 +972,9 @@ static void curses_terminal_update_indicators(Tn5250Terminal /*@unused@*/* This,
  *****/
 static int curses_terminal_waitevent(Tn5250Terminal* This) {
     fd_set fdr;
+    struct timeval tv;
     int result = 0;
-    int sm;
+    int sm, n;
 
     if (This->data->quit_flag) return TN5250_TERMINAL_EVENT_QUIT;
 
@@ -861,8 +986,26 @@ static int curses_terminal_waitevent(Tn5250Terminal* This) {
         FD_SET(This->conn_fd, &fdr);
         sm = This->conn_fd + 1;
     }
+    if (curses_winch_pipe[0] >= 0) {
+        FD_SET(curses_winch_pipe[0], &fdr);
+        if (curses_winch_pipe[0] + 1 > sm) {
+            sm = curses_winch_pipe[0] + 1;
+        }
+    }
+
+    tv.tv_sec = This->wait_limit / 1000;
+    tv.tv_usec = (This->wait_limit % 1000) * 1000;
+    n = select(sm, &fdr, NULL, NULL, This->wait_limit < 0 ? NULL : &tv);
+    if (n < 0) {
+        return 0; /* Interrupted, most likely by SIGWINCH. */
+    }
+    if (n == 0) {
+        return TN5250_TERMINAL_EVENT_TIMEOUT;
+    }
 
-    select(sm, &fdr, NULL, NULL, NULL);
+    if (curses_winch_pipe[0] >= 0 && FD_ISSET(curses_winch_pipe[0], &fdr)) {
+        curses_terminal_winch(This);
+    }
 
     if (FD_ISSET(0, &fdr)) {
         result |= TN5250_TERMINAL_EVENT_KEY;
@@ -875,6 +1018,63 @@ static int curses_terminal_waitevent(Tn5250Terminal* This) {
     return result;
 }
 
+/*
+ *    SIGWINCH handler: just wake up the event loop.
+ */
+static void curses_terminal_sigwinch(int sig) {
+    int saved_errno = errno;
+
+    if (write(curses_winch_pipe[1], "w", 1) < 0) {
+        ; /* The pipe is full, so a wakeup is already pending. */
+    }
+    errno = saved_errno;
+}
+
+/****i* lib5250/curses_terminal_winch
+ * NAME
+ *    curses_terminal_winch
+ * SYNOPSIS
+ *    curses_terminal_winch (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    The tty has changed size, either because an xterm has done what
+ *    curses_terminal_update asked or because the user resized the
+ *    window.  Tell curses the new size and repaint everything.
+ *****/
+static void curses_terminal_winch(Tn5250Terminal* This) {
+    char buf[64];
+
+    while (read(curses_winch_pipe[0], buf, sizeof(buf)) > 0) {
+        ;
+    }
+
+#if defined(HAVE_RESIZETERM) && defined(TIOCGWINSZ)
+    {
+        struct winsize ws;
+
+        if (ioctl(1, TIOCGWINSZ, &ws) == 0 && ws.ws_row > 0 &&
+            ws.ws_col > 0) {
+            resizeterm(ws.ws_row, ws.ws_col);
+        }
+    }
+#else
+    /* curses reads the new size when it comes back from endwin. */
+    endwin();
+    refresh();
+#endif
+    TN5250_LOG(("SIGWINCH: tty is now %dx%d.\n",
+                curses_terminal_height(This) - 1,
+                curses_terminal_width(This) - 1));
+
+    if (This->data->display != NULL) {
+        clear();
+        This->data->repaint_all = 1;
+        curses_terminal_update(This, This->data->display);
+        curses_terminal_update_indicators(This, This->data->display);
+    }
+}
+
 #ifndef USE_OWN_KEY_PARSING
 /****i* lib5250/curses_terminal_getkey
  * NAME
@@ -1682,6 +1882,7 @@ void curses_terminal_print_screen(Tn5250Terminal* This,
     while (curses_terminal_getkey(This) != K_ENTER) { /* wait */
     }
 
+    This->data->repaint_all = 1;
     curses_terminal_update(This, display);
 }
 
@@ -20,6 +20,7 @@
 
 #include "tn5250-private.h"
 #include "cursesterm.h"
+#include "ansiterm.h"
 
 Tn5250Session* sess = NULL;
 Tn5250Stream* stream = NULL;
@@ -99,22 +100,38 @@ int main(int argc, char* argv[]) {
         goto bomb_out;
     }
 
-    term = tn5250_curses_terminal_new();
-    if (tn5250_config_get(config, "underscores")) {
-        tn5250_curses_terminal_use_underscores(
-            term, tn5250_config_get_bool(config, "underscores"));
-    }
-    if (tn5250_config_get(config, "ruler")) {
-        tn5250_curses_terminal_display_ruler(
-            term, tn5250_config_get_bool(config, "ruler"));
+    if (tn5250_config_get_bool(config, "ansi")) {
+        term = tn5250_ansi_terminal_new();
+        if (term == NULL) {
+            goto bomb_out;
+        }
+        if (tn5250_config_get(config, "underscores")) {
+            tn5250_ansi_terminal_use_underscores(
+                term, tn5250_config_get_bool(config, "underscores"));
+        }
+        if (tn5250_config_get(config, "ruler")) {
+            tn5250_ansi_terminal_display_ruler(
+                term, tn5250_config_get_bool(config, "ruler"));
+        }
     }
-    if ((tn5250_config_get(config, "font_80")) &&
-        (tn5250_config_get(config, "font_132"))) {
-        tn5250_curses_terminal_set_xterm_font(
-            term, tn5250_config_get(config, "font_80"),
-            tn5250_config_get(config, "font_132"));
+    else {
+        term = tn5250_curses_terminal_new();
+        if (tn5250_config_get(config, "underscores")) {
+            tn5250_curses_terminal_use_underscores(
+                term, tn5250_config_get_bool(config, "underscores"));
+        }
+        if (tn5250_config_get(config, "ruler")) {
+            tn5250_curses_terminal_display_ruler(
+                term, tn5250_config_get_bool(config, "ruler"));
+        }
+        if ((tn5250_config_get(config, "font_80")) &&
+            (tn5250_config_get(config, "font_132"))) {
+            tn5250_curses_terminal_set_xterm_font(
+                term, tn5250_config_get(config, "font_80"),
+                tn5250_config_get(config, "font_132"));
+        }
+        tn5250_curses_terminal_load_colorlist(config);
     }
-    tn5250_curses_terminal_load_colorlist(config);
 
     if (term == NULL) {
         goto bomb_out;
@@ -185,7 +202,7 @@ bomb_out:
 
 static void syntax() {
     struct valid_term* p;
-    Tn5250CharMap* m;
+    const Tn5250CharMap* m;
     int i = 0;
 
     printf("tn5250 - TCP/IP 5250 emulator\n\
@@ -229,6 +246,12 @@ Options:\n\
    +/-underscores          Use/don't use underscores instead of underline\n\
                            attribute.\n\
    +/-ruler		   Draw a ruler pointing to the cursor position\n\
+   +/-ansi                 Draw the screen with ANSI escape sequences\n\
+                           instead of curses.\n\
+   max_frame_rate=FPS      Redraw the screen at most FPS times a second\n\
+                           while host data is arriving (default: 0).\n\
+   record=FILE             Record the screen to FILE for playing back.\n\
+   shadow=PATH             Let others watch the session through a socket.\n\
    +/-version              Show emulator version and exit.\n\
    env.NAME=VALUE          Set telnet environment string NAME to VALUE.\n\
    env.TERM=TYPE           Emulate IBM terminal type (default: depends)");
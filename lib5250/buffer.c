@@ -124,7 +124,14 @@ void tn5250_buffer_log(Tn5250Buffer* This, const char* prefix) {
     unsigned char c;
     unsigned char a;
     int n;
-    Tn5250CharMap* map = tn5250_char_map_new("37");
+    const Tn5250CharMap* map;
+
+#ifndef NDEBUG
+    if (tn5250_logfile == NULL) {
+        return;
+    }
+#endif
+    map = tn5250_char_map_new("37");
 
     TN5250_LOG(("Dumping buffer (length=%d):\n", This->len));
     for (pos = 0; pos < This->len;) {
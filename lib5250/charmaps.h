@@ -0,0 +1,17147 @@
+/* charmaps.h was automagically generated by mkcharmaps from transmaps.h.
+   Any changes should be made in transmaps, transfix.h or mkcharmaps.c and
+   NOT in this file!  Run "make charmaps" in lib5250 to regenerate it.
+ */
+
+/* Map 37 (ISO-8859-1) */
+
+static unsigned char const charmap_37_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xba, 0xe0, 0xbb, 0xb0, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0x4a, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_37_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xa2, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0x5e, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5b, 0x5d, 0xaf, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_37_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_37_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_37_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0xb0, 0x69, 0x00, 0x00, 0xba, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x7c, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xd0, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0x4a, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xa1, 0x49,
+    0x00, 0x16, 0xc0, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0xbb,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0x5f, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x6a, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x5a,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0x4f, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 256 (ISO-8859-1) */
+
+static unsigned char const charmap_256_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0xbb, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xb3,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xbc,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xe1,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xbf,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_256_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xaf, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xb7, 0xa8, 0xb4, 0xf7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xd7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_256_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_256_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_256_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xe1, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x4a, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x7c, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xd0, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xbc, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xbf,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xa1, 0x49,
+    0x00, 0x16, 0xc0, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0x5a,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xb3, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x6a, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 273 (ISO-8859-1) */
+
+static unsigned char const charmap_273_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xb5, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x63, 0xec, 0xfc, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x43, 0xbb, 0xdc, 0x59, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0xcc, 0x7c,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x4a, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xe0, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0x5a, 0xad, 0xae, 0xa1,
+    0x44, 0x45, 0x42, 0x46, 0xc0, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0x6a, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xd0, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_273_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0x7b, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xc4, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0x7e, 0xdc, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0x5b, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0xa7, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xdf, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0x40, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xa6, 0xf2, 0xf3, 0xf5,
+    0xfc, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7d, 0xf9, 0xfa, 0xff,
+    0xd6, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x5c, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x5d, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_273_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x84, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_273_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_273_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x63, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0xb5, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0x7c,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xd0, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0x6a, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xdc, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0xc0, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xec, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0x59, 0x49,
+    0x00, 0x16, 0x43, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0xa1, 0x00, 0x00, 0x89, 0x5a, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xe0,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0xfc,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x4a, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0xcc, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 277 (ISO-8859-1) */
+
+static unsigned char const charmap_277_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x4a, 0x67, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x80, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x9e, 0xe0, 0x9f, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x9c, 0xbb, 0x47, 0xdc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x5a, 0xb2, 0x70, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x5b, 0x7b, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x7c, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0xd0, 0xc0, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x6a, 0xdd, 0xde, 0xdb, 0xa1, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_277_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0x7d,
+    0xe7, 0xf1, 0x23, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa4, 0xc5, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0x24,
+    0xc7, 0xd1, 0xf8, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xa6, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0xc6, 0xd8, 0x27, 0x3d, 0x22,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0x7b, 0xb8, 0x5b, 0x5d,
+    0xb5, 0xfc, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe6, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0xe5, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7e, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_277_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb8, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc2, 0xb8, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa6, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_277_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_277_values[512] = {
+    0x00, 0xa2, 0xc0, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x9e, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x5b, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x80, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x5a, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xa1, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0x47, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x7c, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x7b, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x4a, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xdc, 0x49,
+    0x00, 0x16, 0x9c, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0xd0, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0x9f,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x70, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x67, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x6a, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 278 (ISO-8859-1) */
+
+static unsigned char const charmap_278_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x63, 0x67, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xec, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xb5, 0xe0, 0x9f, 0x5f, 0x6d,
+    0x51, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x43, 0xbb, 0x47, 0xdc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x5a, 0xb2, 0xcc, 0x4a,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x7b, 0x5b, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x7c, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0xc0, 0xd0, 0x9c, 0x48,
+    0x54, 0x79, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0x6a, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xa1, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_278_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0x7b, 0xe0, 0xe1, 0xe3, 0x7d,
+    0xe7, 0xf1, 0xa7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x60, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa4, 0xc5, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0x23, 0xc0, 0xc1, 0xc3, 0x24,
+    0xc7, 0xd1, 0xf6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xe9, 0x3a, 0xc4, 0xd6, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0x5d,
+    0xb5, 0xfc, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0x5b, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xa6, 0xf2, 0xf3, 0xf5,
+    0xe5, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7e, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x40, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_278_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x96, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_278_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_278_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0xb5, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x5b, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0xec, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0x4a,
+    0x00, 0x00, 0xf1, 0x5a, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xa1, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0x6a, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0x47, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0xc0, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x63, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xdc, 0x49,
+    0x00, 0x16, 0x43, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0xd0, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0x7c,
+    0x00, 0x00, 0x51, 0x00, 0xee, 0x00, 0x00, 0x9f,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x7b, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0xcc, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x67, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x79, 0x00};
+
+/* Map 280 (ISO-8859-1) */
+
+static unsigned char const charmap_280_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0xb1, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xb5, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x90, 0x48, 0x51, 0x5f, 0x6d,
+    0xdd, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x44, 0xbb, 0x54, 0x58, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0x7b, 0x9f, 0xb2, 0xcd, 0x7c,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x4a, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0xc0, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xe0,
+    0xd0, 0x5a, 0x52, 0x53, 0xa1, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0x6a, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0x79, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_280_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0x7b, 0xe1, 0xe3, 0xe5,
+    0x5c, 0xf1, 0xb0, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x5d, 0xea, 0xeb, 0x7d, 0xed, 0xee, 0xef,
+    0x7e, 0xdf, 0xe9, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf2, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xf9, 0x3a, 0xa3, 0xa7, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0x5b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xec, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x23, 0xa5, 0xb7, 0xa9, 0x40, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe0, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xa6, 0xf3, 0xf5,
+    0xe8, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0x60, 0xfa, 0xff,
+    0xe7, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_280_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb2, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xb9, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xac, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa8, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_280_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_280_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0xc0, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x90, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0xb5, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x4a, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0x7c,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0x79, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0x54, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0xe0, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0x48, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0xb1, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0x58, 0x49,
+    0x00, 0x16, 0x44, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0xd0, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0xdd, 0x00, 0xee, 0x00, 0x00, 0x51,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0xcd, 0x00,
+    0x00, 0xf0, 0x7b, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0x6a, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0xa1, 0x00, 0x03, 0xa5, 0x00, 0x5a, 0x00};
+
+/* Map 284 (ISO-8859-1) */
+
+static unsigned char const charmap_284_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0xbb, 0x7f, 0x69, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0xba, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xbd, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x49, 0xb5,
+    0xa1, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x7b, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x6a, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_284_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xa6, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0x23, 0xf1, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0xd1, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xa8, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5e, 0x21, 0xaf, 0x7e, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_284_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x21, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_284_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_284_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0xba, 0x7b, 0x00, 0x00, 0x4a, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x7c, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xd0, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xa1, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x69, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xbd, 0x6a,
+    0x00, 0x16, 0xc0, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0x5a,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0x5f, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x49, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0xbb,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0x4f, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 285 (ISO-8859-1) */
+
+static unsigned char const charmap_285_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x4a, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xb1, 0xe0, 0xbb, 0xba, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xbc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0x5b, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0xa1,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_285_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x24, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x21, 0xa3, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xaf, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x5b, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5e, 0x5d, 0x7e, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_285_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x21, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_285_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_285_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0xba, 0x69, 0x00, 0x00, 0xb1, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x7c, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xd0, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xbc, 0x49,
+    0x00, 0x16, 0xc0, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0xbb,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xa1, 0x00, 0x00, 0xf9, 0x5f, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x6a, 0x00,
+    0x00, 0xf0, 0x5b, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x5a,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0x4f, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 297 (ISO-8859-1) */
+
+static unsigned char const charmap_297_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0xb1, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x44, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x90, 0x48, 0xb5, 0x5f, 0x6d,
+    0xa0, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x51, 0xbb, 0x54, 0xbd, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0x7b, 0x9f, 0xb2, 0xdd, 0x5a,
+    0xa1, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x4a, 0x8f, 0xea, 0xfa, 0xbe, 0x79, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x7c, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xe0,
+    0xd0, 0xc0, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0x6a, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_297_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0x40, 0xe1, 0xe3, 0xe5,
+    0x5c, 0xf1, 0xb0, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x7b, 0xea, 0xeb, 0x7d, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa7, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf9, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xb5, 0x3a, 0xa3, 0xe0, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0x5b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0x60, 0xa8, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x23, 0xa5, 0xb7, 0xa9, 0x5d, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0x7e, 0xb4, 0xd7,
+    0xe9, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0xe8, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xa6, 0xfa, 0xff,
+    0xe7, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_297_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb9, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc3, 0xa0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa8, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_297_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_297_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x7c, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x90, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x44, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x4a, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0x5a,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0x6a, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0x54, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0xe0, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0x48, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xa1, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0xb1, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xbd, 0x49,
+    0x00, 0x16, 0x51, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0xd0, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0xa0, 0x00, 0xee, 0x00, 0x00, 0xb5,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0x79, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0xdd, 0x00,
+    0x00, 0xf0, 0x7b, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0xc0, 0x00};
+
+/* Map 500 (ISO-8859-1) */
+
+static unsigned char const charmap_500_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0xbb, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_500_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_500_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_500_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_500_values[512] = {
+    0x00, 0xa2, 0x9c, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0x5f, 0x69, 0x00, 0x00, 0x4a, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0x7c, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xcc, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0xd0, 0x8c, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xae, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xe0, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x9e, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xbe,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xa1, 0x49,
+    0x00, 0x16, 0xc0, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0xec,
+    0x00, 0x00, 0x79, 0x00, 0xee, 0x00, 0x00, 0x5a,
+    0xac, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x6a, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x8e,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 871 (ISO-8859-1) */
+
+static unsigned char const charmap_871_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xac, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xae, 0xbe, 0x9e, 0xec, 0x6d,
+    0x8c, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x8e, 0xbb, 0x9c, 0xcc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xe0, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x5a, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x7c, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x5f, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xc0, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0xd0, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x79, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xa1, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x4a, 0xdf};
+
+static unsigned char const charmap_871_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xfe, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xc6, 0x24, 0x2a, 0x29, 0x3b, 0xd6,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xf0, 0x3a, 0x23, 0xd0, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0x60, 0xfd, 0x7b, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0x7d, 0xb8, 0x5d, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0x40, 0xdd, 0x5b, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0x5c, 0xd7,
+    0xde, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xf5,
+    0xe6, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0xb4, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x5e, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_871_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0xbe, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc3, 0x86, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xb0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x90, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc2, 0xb8, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0x9d, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0x9e, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa6, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_871_keys[512] = {
+    0x0000, 0x0073, 0x00e6, 0xffff, 0xffff, 0x0070, 0xffff, 0x00e3,
+    0xffff, 0xffff, 0x006d, 0x00e0, 0xffff, 0xffff, 0x006a, 0xffff,
+    0x00dd, 0xffff, 0xffff, 0x0067, 0x00da, 0xffff, 0xffff, 0x0064,
+    0x00d7, 0xffff, 0xffff, 0x0061, 0xffff, 0x00d4, 0xffff, 0xffff,
+    0x005e, 0x00d1, 0xffff, 0xffff, 0x005b, 0xffff, 0x00ce, 0xffff,
+    0xffff, 0x0058, 0x00cb, 0xffff, 0xffff, 0x0055, 0x00c8, 0xffff,
+    0xffff, 0x0052, 0xffff, 0x00c5, 0xffff, 0xffff, 0x004f, 0x00c2,
+    0xffff, 0xffff, 0x004c, 0xffff, 0x00bf, 0xffff, 0xffff, 0x0049,
+    0x00bc, 0xffff, 0xffff, 0x0046, 0xffff, 0x00b9, 0xffff, 0xffff,
+    0x0043, 0x00b6, 0xffff, 0xffff, 0x0040, 0x00b3, 0xffff, 0xffff,
+    0x003d, 0xffff, 0x00b0, 0xffff, 0xffff, 0x003a, 0x00ad, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00aa, 0xffff, 0xffff, 0x0034, 0x00a7,
+    0xffff, 0xffff, 0x0031, 0x00a4, 0xffff, 0xffff, 0x002e, 0xffff,
+    0x00a1, 0xffff, 0xffff, 0x002b, 0x009e, 0xffff, 0xffff, 0x0028,
+    0xffff, 0x009b, 0xffff, 0xffff, 0x0025, 0x0098, 0xffff, 0xffff,
+    0x0022, 0xffff, 0x0095, 0xffff, 0xffff, 0x001f, 0x0092, 0xffff,
+    0xffff, 0x001c, 0x008f, 0xffff, 0xffff, 0x0019, 0xffff, 0x008c,
+    0x00ff, 0xffff, 0x0016, 0x0089, 0xffff, 0x00fc, 0x0013, 0xffff,
+    0x0086, 0x00f9, 0xffff, 0x0010, 0x0083, 0x00f6, 0xffff, 0x000d,
+    0x0080, 0xffff, 0x00f3, 0x000a, 0xffff, 0x007d, 0x00f0, 0xffff,
+    0x0007, 0x007a, 0xffff, 0x00ed, 0x0004, 0xffff, 0x0077, 0x00ea,
+    0xffff, 0x0001, 0x0074, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0071,
+    0x00e4, 0xffff, 0xffff, 0x006e, 0x00e1, 0xffff, 0xffff, 0x006b,
+    0xffff, 0x00de, 0xffff, 0xffff, 0x0068, 0x00db, 0xffff, 0xffff,
+    0x0065, 0xffff, 0x00d8, 0xffff, 0xffff, 0x0062, 0x00d5, 0xffff,
+    0xffff, 0x005f, 0x00d2, 0xffff, 0xffff, 0x005c, 0xffff, 0x00cf,
+    0xffff, 0xffff, 0x0059, 0x00cc, 0xffff, 0xffff, 0x0056, 0xffff,
+    0x00c9, 0xffff, 0xffff, 0x0053, 0x00c6, 0xffff, 0xffff, 0x0050,
+    0x00c3, 0xffff, 0xffff, 0x004d, 0xffff, 0x00c0, 0xffff, 0xffff,
+    0x004a, 0x00bd, 0xffff, 0xffff, 0x0047, 0xffff, 0x00ba, 0xffff,
+    0xffff, 0x0044, 0x00b7, 0xffff, 0xffff, 0x0041, 0xffff, 0x00b4,
+    0xffff, 0xffff, 0x003e, 0x00b1, 0xffff, 0xffff, 0x003b, 0x00ae,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x00ab, 0xffff, 0xffff, 0x0035,
+    0x00a8, 0xffff, 0xffff, 0x0032, 0xffff, 0x00a5, 0xffff, 0xffff,
+    0x002f, 0x00a2, 0xffff, 0xffff, 0x002c, 0x009f, 0xffff, 0xffff,
+    0x0029, 0xffff, 0x009c, 0xffff, 0xffff, 0x0026, 0x0099, 0xffff,
+    0xffff, 0x0023, 0xffff, 0x0096, 0xffff, 0xffff, 0x0020, 0x0093,
+    0xffff, 0xffff, 0x001d, 0xffff, 0x0090, 0xffff, 0xffff, 0x001a,
+    0x008d, 0xffff, 0xffff, 0x0017, 0x008a, 0xffff, 0x00fd, 0x0014,
+    0xffff, 0x0087, 0x00fa, 0xffff, 0x0011, 0x0084, 0xffff, 0x00f7,
+    0x000e, 0xffff, 0x0081, 0x00f4, 0xffff, 0x000b, 0x007e, 0x00f1,
+    0xffff, 0x0008, 0x007b, 0xffff, 0x00ee, 0x0005, 0xffff, 0x0078,
+    0x00eb, 0xffff, 0x0002, 0x0075, 0xffff, 0x00e8, 0xffff, 0xffff,
+    0x0072, 0x00e5, 0xffff, 0xffff, 0x006f, 0xffff, 0x00e2, 0xffff,
+    0xffff, 0x006c, 0x00df, 0xffff, 0xffff, 0x0069, 0x00dc, 0xffff,
+    0xffff, 0x0066, 0xffff, 0x00d9, 0xffff, 0xffff, 0x0063, 0x00d6,
+    0xffff, 0xffff, 0x0060, 0xffff, 0x00d3, 0xffff, 0xffff, 0x005d,
+    0x00d0, 0xffff, 0xffff, 0x005a, 0x00cd, 0xffff, 0xffff, 0x0057,
+    0xffff, 0x00ca, 0xffff, 0xffff, 0x0054, 0x00c7, 0xffff, 0xffff,
+    0x0051, 0xffff, 0x00c4, 0xffff, 0xffff, 0x004e, 0x00c1, 0xffff,
+    0xffff, 0x004b, 0xffff, 0x00be, 0xffff, 0xffff, 0x0048, 0x00bb,
+    0xffff, 0xffff, 0x0045, 0x00b8, 0xffff, 0xffff, 0x0042, 0xffff,
+    0x00b5, 0xffff, 0xffff, 0x003f, 0x00b2, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00af, 0xffff, 0xffff, 0x0039, 0x00ac, 0xffff, 0xffff,
+    0x0036, 0x00a9, 0xffff, 0xffff, 0x0033, 0xffff, 0x00a6, 0xffff,
+    0xffff, 0x0030, 0x00a3, 0xffff, 0xffff, 0x002d, 0xffff, 0x00a0,
+    0xffff, 0xffff, 0x002a, 0x009d, 0xffff, 0xffff, 0x0027, 0x009a,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x0097, 0xffff, 0xffff, 0x0021,
+    0x0094, 0xffff, 0xffff, 0x001e, 0xffff, 0x0091, 0xffff, 0xffff,
+    0x001b, 0x008e, 0xffff, 0xffff, 0x0018, 0xffff, 0x008b, 0x00fe,
+    0xffff, 0x0015, 0x0088, 0x00fb, 0xffff, 0x0012, 0x0085, 0xffff,
+    0x00f8, 0x000f, 0xffff, 0x0082, 0x00f5, 0xffff, 0x000c, 0x007f,
+    0xffff, 0x00f2, 0x0009, 0xffff, 0x007c, 0x00ef, 0xffff, 0x0006,
+    0x0079, 0x00ec, 0xffff, 0x0003, 0x0076, 0xffff, 0x00e9, 0xffff};
+
+static const unsigned char utf8map_871_values[512] = {
+    0x00, 0xa2, 0xd0, 0x00, 0x00, 0x97, 0x00, 0x46,
+    0x00, 0x00, 0x94, 0x44, 0x00, 0x00, 0x91, 0x00,
+    0xad, 0x00, 0x00, 0x87, 0xfe, 0x00, 0x00, 0x84,
+    0xbf, 0x00, 0x00, 0x81, 0x00, 0xeb, 0x00, 0x00,
+    0xec, 0x69, 0x00, 0x00, 0xae, 0x00, 0x76, 0x00,
+    0x00, 0xe7, 0x73, 0x00, 0x00, 0xe4, 0x74, 0x00,
+    0x00, 0xd9, 0x00, 0x67, 0x00, 0x00, 0xd6, 0x62,
+    0x00, 0x00, 0xd3, 0x00, 0xab, 0x00, 0x00, 0xc9,
+    0xb7, 0x00, 0x00, 0xc6, 0x00, 0xda, 0x00, 0x00,
+    0xc3, 0xb6, 0x00, 0x00, 0xac, 0xfa, 0x00, 0x00,
+    0x7e, 0x00, 0x90, 0x00, 0x00, 0x7a, 0xca, 0x00,
+    0x00, 0xf7, 0x00, 0x9a, 0x00, 0x00, 0xf4, 0xb5,
+    0x00, 0x00, 0xf1, 0x9f, 0x00, 0x00, 0x4b, 0x00,
+    0xaa, 0x00, 0x00, 0x4e, 0x3e, 0x00, 0x00, 0x4d,
+    0x00, 0x3b, 0x00, 0x00, 0x6c, 0x38, 0x00, 0x00,
+    0x7f, 0x00, 0x35, 0x00, 0x00, 0x1f, 0x1a, 0x00,
+    0x00, 0x1c, 0x1b, 0x00, 0x00, 0x19, 0x00, 0x2c,
+    0xdf, 0x00, 0x32, 0x29, 0x00, 0xdc, 0x13, 0x00,
+    0x06, 0xdd, 0x00, 0x10, 0x23, 0xa1, 0x00, 0x0d,
+    0x20, 0x00, 0xce, 0x25, 0x00, 0x9c, 0x79, 0x00,
+    0x2f, 0xa9, 0x00, 0x55, 0x37, 0x00, 0xa6, 0x52,
+    0x00, 0x01, 0xa3, 0x48, 0x00, 0x00, 0x00, 0x98,
+    0x43, 0x00, 0x00, 0x95, 0x45, 0x00, 0x00, 0x92,
+    0x00, 0xc0, 0x00, 0x00, 0x88, 0xfb, 0x00, 0x00,
+    0x85, 0x00, 0x80, 0x00, 0x00, 0x82, 0xef, 0x00,
+    0x00, 0x6d, 0xed, 0x00, 0x00, 0xbe, 0x00, 0x77,
+    0x00, 0x00, 0xe8, 0x78, 0x00, 0x00, 0xe5, 0x00,
+    0x71, 0x00, 0x00, 0xe2, 0x5a, 0x00, 0x00, 0xd7,
+    0x66, 0x00, 0x00, 0xd4, 0x00, 0x64, 0x00, 0x00,
+    0xd1, 0xb8, 0x00, 0x00, 0xc7, 0x00, 0x9b, 0x00,
+    0x00, 0xc4, 0xb3, 0x00, 0x00, 0xc1, 0x00, 0xe0,
+    0x00, 0x00, 0x6e, 0x8f, 0x00, 0x00, 0x5e, 0xaf,
+    0x00, 0x00, 0xf8, 0x00, 0x8a, 0x00, 0x00, 0xf5,
+    0xbd, 0x00, 0x00, 0xf2, 0x00, 0xb2, 0x00, 0x00,
+    0x61, 0xb0, 0x00, 0x00, 0x6b, 0xff, 0x00, 0x00,
+    0x5d, 0x00, 0x04, 0x00, 0x00, 0x50, 0x39, 0x00,
+    0x00, 0x7b, 0x00, 0x36, 0x00, 0x00, 0x40, 0x33,
+    0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x26, 0x2a, 0x00, 0x8d, 0x3c,
+    0x00, 0x17, 0xde, 0x00, 0x11, 0x24, 0x00, 0xe1,
+    0x0e, 0x00, 0x21, 0xcb, 0x00, 0x0b, 0xcc, 0x49,
+    0x00, 0x16, 0x8e, 0x00, 0x56, 0x2d, 0x00, 0xa7,
+    0x53, 0x00, 0x02, 0xa4, 0x00, 0x54, 0x00, 0x00,
+    0x99, 0x47, 0x00, 0x00, 0x96, 0x00, 0x42, 0x00,
+    0x00, 0x93, 0x59, 0x00, 0x00, 0x89, 0xfc, 0x00,
+    0x00, 0x86, 0x00, 0xfd, 0x00, 0x00, 0x83, 0x5f,
+    0x00, 0x00, 0x8c, 0x00, 0xee, 0x00, 0x00, 0x9e,
+    0x7c, 0x00, 0x00, 0xe9, 0x75, 0x00, 0x00, 0xe6,
+    0x00, 0x72, 0x00, 0x00, 0xe3, 0x68, 0x00, 0x00,
+    0xd8, 0x00, 0x63, 0x00, 0x00, 0xd5, 0x65, 0x00,
+    0x00, 0xd2, 0x00, 0xb9, 0x00, 0x00, 0xc8, 0x8b,
+    0x00, 0x00, 0xc5, 0x9d, 0x00, 0x00, 0xc2, 0x00,
+    0xa0, 0x00, 0x00, 0x6f, 0xea, 0x00, 0x00, 0x4c,
+    0x00, 0xbc, 0x00, 0x00, 0xf9, 0xba, 0x00, 0x00,
+    0xf6, 0xb4, 0x00, 0x00, 0xf3, 0x00, 0x6a, 0x00,
+    0x00, 0xf0, 0xb1, 0x00, 0x00, 0x60, 0x00, 0x41,
+    0x00, 0x00, 0x5c, 0x14, 0x00, 0x00, 0x7d, 0x3a,
+    0x00, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x4f,
+    0x34, 0x00, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x00,
+    0x27, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x2b, 0x4a,
+    0x00, 0x3d, 0x28, 0xdb, 0x00, 0x12, 0x15, 0x00,
+    0x70, 0x0f, 0x00, 0x22, 0xcf, 0x00, 0x0c, 0x07,
+    0x00, 0xcd, 0x05, 0x00, 0xbb, 0x57, 0x00, 0x2e,
+    0xa8, 0x58, 0x00, 0x03, 0xa5, 0x00, 0x51, 0x00};
+
+/* Map 870 (ISO-8859-2) */
+
+static unsigned char const charmap_870_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x6a, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xb1, 0x80, 0xba, 0x9f, 0x77, 0xaa, 0xb5,
+    0xbd, 0xbc, 0x76, 0xfd, 0xb9, 0xca, 0xb9, 0xb4,
+    0x90, 0xa0, 0x9e, 0x9a, 0xbe, 0x57, 0x8a, 0x70,
+    0x9d, 0x9c, 0x8f, 0xdd, 0xb7, 0x64, 0xb7, 0xb2,
+    0xed, 0x65, 0x42, 0x44, 0x63, 0x78, 0x69, 0x68,
+    0x67, 0x71, 0x72, 0x73, 0xda, 0x75, 0x72, 0xfa,
+    0xac, 0xbb, 0xab, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0xae, 0x74, 0xfe, 0xfb, 0xfc, 0xad, 0x56, 0x59,
+    0xcd, 0x45, 0x62, 0x46, 0x43, 0x58, 0x49, 0x48,
+    0x47, 0x51, 0x52, 0x53, 0xdf, 0x55, 0xb3, 0xea,
+    0x8c, 0x9b, 0x8b, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x8e, 0x54, 0xde, 0xdb, 0xdc, 0x8d, 0xb0, 0xb6};
+
+static unsigned char const charmap_870_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xc2, 0xe4, 0xc3, 0xe1, 0xe3, 0xe8,
+    0xe7, 0xe6, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xf9, 0xed, 0xde, 0xb5,
+    0xe5, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xe2, 0xc4, 0xbd, 0xc1, 0xca, 0xc8,
+    0xc7, 0xc6, 0x7c, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xb7, 0xc9, 0xca, 0xcb, 0xd9, 0xcd, 0xaa, 0xa5,
+    0xc5, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xa2, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xb6, 0xf2, 0xf0, 0xfd, 0xf8, 0xba,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xb3, 0xf1, 0xb9, 0xb8, 0xb2, 0xa4,
+    0xb1, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa6, 0xd2, 0xd0, 0xdd, 0xd8, 0xea,
+    0xfe, 0xa1, 0xbf, 0xee, 0xaf, 0xa7, 0xff, 0xbc,
+    0xbc, 0xac, 0xa3, 0xd1, 0xa9, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xe0, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xcc, 0xfb, 0xfc, 0xbb, 0xfa, 0xec,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xef, 0xd4, 0xd6, 0xc0, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xcf, 0xdb, 0xdc, 0xab, 0xda, 0x9f};
+
+static const unsigned char utf8map_870_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc4, 0x82, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc4, 0x83, 0},
+    {2, 0xc4, 0x8d, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc4, 0x87, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc4, 0x99, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc5, 0xaf, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc5, 0xa2, 0},
+    {2, 0xc4, 0xbe, 0},
+    {2, 0xc4, 0xba, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xcb, 0x9d, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc4, 0x98, 0},
+    {2, 0xc4, 0x8c, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc4, 0x86, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xcb, 0x87, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc4, 0x98, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc5, 0xae, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc5, 0x9e, 0},
+    {2, 0xc4, 0xbd, 0},
+    {2, 0xc4, 0xb9, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xcb, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc5, 0x9b, 0},
+    {2, 0xc5, 0x88, 0},
+    {2, 0xc4, 0x91, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc5, 0x99, 0},
+    {2, 0xc5, 0x9f, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc5, 0x82, 0},
+    {2, 0xc5, 0x84, 0},
+    {2, 0xc5, 0xa1, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xcb, 0x9b, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc4, 0x85, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc5, 0x9a, 0},
+    {2, 0xc5, 0x87, 0},
+    {2, 0xc4, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc5, 0x98, 0},
+    {2, 0xc4, 0x99, 0},
+    {2, 0xc5, 0xa3, 0},
+    {2, 0xc4, 0x84, 0},
+    {2, 0xc5, 0xbc, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc5, 0xbb, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xcb, 0x99, 0},
+    {2, 0xc5, 0xba, 0},
+    {2, 0xc5, 0xba, 0},
+    {2, 0xc5, 0xb9, 0},
+    {2, 0xc5, 0x81, 0},
+    {2, 0xc5, 0x83, 0},
+    {2, 0xc5, 0xa0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc5, 0x95, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc5, 0x91, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc4, 0x9a, 0},
+    {2, 0xc5, 0xb1, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc5, 0xa5, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc4, 0x9b, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc4, 0x8f, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x94, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc5, 0x90, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc4, 0x8e, 0},
+    {2, 0xc5, 0xb0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc5, 0xa4, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_870_keys[512] = {
+    0x0000, 0x0059, 0xffff, 0xffff, 0x0164, 0x000b, 0x0064, 0xffff,
+    0xffff, 0xffff, 0x016f, 0x0016, 0x006f, 0xffff, 0xffff, 0xffff,
+    0x017a, 0x0021, 0x007a, 0x00d3, 0xffff, 0xffff, 0xffff, 0x002c,
+    0x0085, 0xffff, 0xffff, 0xffff, 0xffff, 0x0037, 0x0090, 0x00e9,
+    0x0142, 0xffff, 0xffff, 0x0042, 0x009b, 0x00f4, 0xffff, 0xffff,
+    0xffff, 0x004d, 0xffff, 0xffff, 0x0158, 0xffff, 0xffff, 0x0058,
+    0xffff, 0xffff, 0x0163, 0x000a, 0x0063, 0xffff, 0x02c7, 0xffff,
+    0x016e, 0x0015, 0x006e, 0x00c7, 0xffff, 0xffff, 0x0179, 0x0020,
+    0x0079, 0xffff, 0x02dd, 0xffff, 0xffff, 0x002b, 0x0084, 0x00dd,
+    0xffff, 0xffff, 0xffff, 0x0036, 0x008f, 0xffff, 0x0141, 0xffff,
+    0xffff, 0x0041, 0x009a, 0x00f3, 0xffff, 0xffff, 0xffff, 0x004c,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0057, 0x00b0, 0xffff,
+    0x0162, 0x0009, 0x0062, 0xffff, 0xffff, 0xffff, 0xffff, 0x0014,
+    0x006d, 0xffff, 0xffff, 0xffff, 0xffff, 0x001f, 0x0078, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x002a, 0x0083, 0x00dc, 0xffff, 0xffff,
+    0xffff, 0x0035, 0x008e, 0x00e7, 0xffff, 0xffff, 0xffff, 0x0040,
+    0x0099, 0xffff, 0xffff, 0xffff, 0xffff, 0x004b, 0x00a4, 0x00fd,
+    0xffff, 0xffff, 0xffff, 0x0056, 0xffff, 0xffff, 0x0161, 0x0008,
+    0x0061, 0xffff, 0xffff, 0xffff, 0xffff, 0x0013, 0x006c, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x001e, 0x0077, 0xffff, 0x02db, 0xffff,
+    0xffff, 0x0029, 0x0082, 0xffff, 0xffff, 0xffff, 0xffff, 0x0034,
+    0x008d, 0xffff, 0xffff, 0xffff, 0xffff, 0x003f, 0x0098, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x004a, 0xffff, 0x00fc, 0x0155, 0xffff,
+    0xffff, 0x0055, 0xffff, 0x0107, 0x0160, 0x0007, 0x0060, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0012, 0x006b, 0x00c4, 0xffff, 0xffff,
+    0xffff, 0x001d, 0x0076, 0xffff, 0xffff, 0xffff, 0xffff, 0x0028,
+    0x0081, 0x00da, 0xffff, 0xffff, 0xffff, 0x0033, 0x008c, 0xffff,
+    0x013e, 0xffff, 0xffff, 0x003e, 0x0097, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0049, 0xffff, 0xffff, 0x0154, 0xffff, 0xffff, 0x0054,
+    0x00ad, 0x0106, 0x015f, 0x0006, 0xffff, 0x005f, 0x00b8, 0x0111,
+    0xffff, 0x0011, 0x006a, 0xffff, 0xffff, 0xffff, 0xffff, 0x001c,
+    0x0075, 0x00ce, 0x02d9, 0xffff, 0xffff, 0x0027, 0x0080, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0032, 0x008b, 0x00e4, 0x013d, 0xffff,
+    0xffff, 0x003d, 0x0096, 0xffff, 0x0148, 0xffff, 0xffff, 0x0048,
+    0xffff, 0x00fa, 0xffff, 0xffff, 0xffff, 0x0053, 0xffff, 0x0105,
+    0x015e, 0x0005, 0xffff, 0x005e, 0xffff, 0x0110, 0xffff, 0x0010,
+    0x0069, 0x00c2, 0xffff, 0x011b, 0xffff, 0x001b, 0x0074, 0x00cd,
+    0x02d8, 0xffff, 0xffff, 0x0026, 0x007f, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0031, 0x008a, 0xffff, 0xffff, 0xffff, 0xffff, 0x003c,
+    0x0095, 0x00ee, 0x0147, 0xffff, 0xffff, 0x0047, 0x00a0, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0052, 0xffff, 0x0104, 0xffff, 0x0004,
+    0xffff, 0x005d, 0xffff, 0x010f, 0xffff, 0x000f, 0x0068, 0x00c1,
+    0xffff, 0x011a, 0xffff, 0x001a, 0x0073, 0xffff, 0xffff, 0x017e,
+    0xffff, 0x0025, 0x007e, 0x00d7, 0xffff, 0xffff, 0xffff, 0x0030,
+    0x0089, 0x00e2, 0xffff, 0xffff, 0xffff, 0x003b, 0x0094, 0x00ed,
+    0xffff, 0xffff, 0xffff, 0x0046, 0x009f, 0xffff, 0x0151, 0xffff,
+    0xffff, 0x0051, 0xffff, 0x0103, 0xffff, 0x0003, 0xffff, 0x005c,
+    0xffff, 0x010e, 0xffff, 0x000e, 0x0067, 0xffff, 0xffff, 0x0119,
+    0xffff, 0x0019, 0x0072, 0x00cb, 0xffff, 0xffff, 0x017d, 0x0024,
+    0x007d, 0x00d6, 0xffff, 0xffff, 0xffff, 0x002f, 0x0088, 0x00e1,
+    0x013a, 0xffff, 0xffff, 0x003a, 0x0093, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0045, 0x009e, 0x00f7, 0x0150, 0xffff, 0xffff, 0x0050,
+    0xffff, 0x0102, 0x015b, 0x0002, 0xffff, 0x005b, 0x00b4, 0x010d,
+    0xffff, 0x000d, 0x0066, 0xffff, 0xffff, 0x0118, 0x0171, 0x0018,
+    0x0071, 0xffff, 0xffff, 0xffff, 0x017c, 0x0023, 0x007c, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x002e, 0x0087, 0xffff, 0x0139, 0xffff,
+    0xffff, 0x0039, 0x0092, 0x00eb, 0x0144, 0xffff, 0xffff, 0x0044,
+    0x009d, 0x00f6, 0xffff, 0xffff, 0xffff, 0x004f, 0x00a8, 0xffff,
+    0x015a, 0x0001, 0xffff, 0x005a, 0xffff, 0x010c, 0x0165, 0x000c,
+    0x0065, 0xffff, 0xffff, 0xffff, 0x0170, 0x0017, 0x0070, 0x00c9,
+    0xffff, 0xffff, 0x017b, 0x0022, 0x007b, 0x00d4, 0xffff, 0xffff,
+    0xffff, 0x002d, 0x0086, 0x00df, 0xffff, 0xffff, 0xffff, 0x0038,
+    0x0091, 0xffff, 0x0143, 0xffff, 0xffff, 0x0043, 0x009c, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x004e, 0x00a7, 0xffff, 0x0159, 0xffff};
+
+static const unsigned char utf8map_870_values[512] = {
+    0x00, 0xe8, 0x00, 0x00, 0xfd, 0x0b, 0x84, 0x00,
+    0x00, 0x00, 0x54, 0x32, 0x96, 0x00, 0x00, 0x00,
+    0xb7, 0x4f, 0xa9, 0xee, 0x00, 0x00, 0x00, 0x6b,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x30, 0x51,
+    0x9a, 0x00, 0x00, 0xc2, 0x3b, 0xcb, 0x00, 0x00,
+    0x00, 0xd4, 0x00, 0x00, 0xae, 0x00, 0x00, 0xe7,
+    0x00, 0x00, 0xb0, 0x25, 0x83, 0x00, 0x70, 0x00,
+    0x74, 0x3d, 0x95, 0x68, 0x00, 0x00, 0xb9, 0x40,
+    0xa8, 0x00, 0x64, 0x00, 0x00, 0x4e, 0x24, 0xad,
+    0x00, 0x00, 0x00, 0xf6, 0x1b, 0x00, 0xba, 0x00,
+    0x00, 0xc1, 0x3a, 0xce, 0x00, 0x00, 0x00, 0xd3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x90, 0x00,
+    0x56, 0x05, 0x82, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x94, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa7, 0x00,
+    0x00, 0x00, 0x00, 0x5c, 0x23, 0xfc, 0x00, 0x00,
+    0x00, 0xf5, 0x0a, 0x48, 0x00, 0x00, 0x00, 0x7c,
+    0x39, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x9f, 0x8d,
+    0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x9c, 0x16,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x13, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0xa6, 0x00, 0x9e, 0x00,
+    0x00, 0x5d, 0x22, 0x00, 0x00, 0x00, 0x00, 0xf4,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0x00, 0xdc, 0xcd, 0x00,
+    0x00, 0xe4, 0x00, 0x49, 0xbc, 0x2f, 0x79, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x92, 0x63, 0x00, 0x00,
+    0x00, 0x1d, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x4d,
+    0x21, 0xfe, 0x00, 0x00, 0x00, 0xf3, 0x2c, 0x00,
+    0x57, 0x00, 0x00, 0x6e, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0xc9, 0x00, 0x00, 0xed, 0x00, 0x00, 0xe3,
+    0xca, 0x69, 0x8f, 0x2e, 0x00, 0x6d, 0x9d, 0x8c,
+    0x00, 0x11, 0x91, 0x00, 0x00, 0x00, 0x00, 0x1c,
+    0xa4, 0x72, 0xb6, 0x00, 0x00, 0x7d, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x2b, 0x43, 0x77, 0x00,
+    0x00, 0x7e, 0x36, 0x00, 0x8b, 0x00, 0x00, 0xc8,
+    0x00, 0xde, 0x00, 0x00, 0x00, 0xe2, 0x00, 0xa0,
+    0x76, 0x2d, 0x00, 0x5f, 0x00, 0xac, 0x00, 0x10,
+    0x89, 0x42, 0x00, 0xdf, 0x00, 0x27, 0xa3, 0x75,
+    0x80, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xf1, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x4c,
+    0x35, 0xb3, 0xab, 0x00, 0x00, 0xc7, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0xd9, 0x00, 0xb1, 0x00, 0x37,
+    0x00, 0x5a, 0x00, 0xea, 0x00, 0x0f, 0x88, 0x65,
+    0x00, 0xda, 0x00, 0x3f, 0xa2, 0x00, 0x00, 0xb7,
+    0x00, 0x6c, 0xa1, 0xbf, 0x00, 0x00, 0x00, 0xf0,
+    0x29, 0x62, 0x00, 0x00, 0x00, 0x5e, 0x34, 0x55,
+    0x00, 0x00, 0x00, 0xc6, 0xff, 0x00, 0xcf, 0x00,
+    0x00, 0xd8, 0x00, 0x46, 0x00, 0x03, 0x00, 0xe0,
+    0x00, 0xfa, 0x00, 0x0e, 0x87, 0x00, 0x00, 0x52,
+    0x00, 0x19, 0x99, 0x73, 0x00, 0x00, 0xb9, 0x5b,
+    0xd0, 0xec, 0x00, 0x00, 0x00, 0x61, 0x28, 0x45,
+    0x58, 0x00, 0x00, 0x7a, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0xc5, 0x3e, 0xe1, 0xef, 0x00, 0x00, 0xd7,
+    0x00, 0x44, 0x8a, 0x02, 0x00, 0x4a, 0xbe, 0x47,
+    0x00, 0x0d, 0x86, 0x00, 0x00, 0x72, 0xdb, 0x18,
+    0x98, 0x00, 0x00, 0x00, 0xb2, 0x7b, 0x6a, 0x00,
+    0x00, 0x00, 0x00, 0x4b, 0x17, 0x00, 0x78, 0x00,
+    0x00, 0xf9, 0x1a, 0x53, 0x9b, 0x00, 0x00, 0xc4,
+    0x14, 0xcc, 0x00, 0x00, 0x00, 0xd6, 0xbd, 0x00,
+    0xaa, 0x01, 0x00, 0xe9, 0x00, 0x67, 0xdd, 0x0c,
+    0x85, 0x00, 0x00, 0x00, 0xfb, 0x26, 0x97, 0x71,
+    0x00, 0x00, 0xb4, 0x7f, 0xc0, 0xeb, 0x00, 0x00,
+    0x00, 0x60, 0x06, 0x59, 0x00, 0x00, 0x00, 0xf8,
+    0x31, 0x00, 0xbb, 0x00, 0x00, 0xc3, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xd5, 0xb5, 0x00, 0x8e, 0x00};
+
+/* Map 905 (ISO-8859-3) */
+
+static unsigned char const charmap_905_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0xfc, 0xec, 0xb9, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xaf, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x68, 0xdc, 0xb6, 0x5f, 0x6d,
+    0xda, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x48, 0x8f, 0xb3, 0xcc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0x80, 0xb1, 0x9f, 0x8e, 0xba, 0xb5,
+    0xbd, 0x5b, 0x7c, 0x5a, 0xbc, 0xca, 0xae, 0xb4,
+    0x90, 0x8a, 0xea, 0xfa, 0xbe, 0xa0, 0x9a, 0xb0,
+    0x9d, 0x79, 0x6a, 0xd0, 0x9c, 0xb8, 0x9e, 0xb2,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0xab, 0x4a,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x46, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x7b, 0xbf,
+    0xbb, 0xfd, 0xfe, 0xfb, 0x7f, 0xad, 0xac, 0x59,
+    0x44, 0x45, 0x42, 0xdf, 0x43, 0x47, 0x8b, 0xc0,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0xb7, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xa1, 0xe1,
+    0x9b, 0xdd, 0xde, 0xdb, 0xe0, 0x8d, 0x8c, 0x70};
+
+static unsigned char const charmap_905_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xd0, 0xe5,
+    0x7b, 0xf1, 0xc7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xab, 0xa9, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0x5b, 0xd1, 0xba, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xff, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xb9, 0x3a, 0xd6, 0xaa, 0x27, 0x3d, 0xdc,
+    0xa2, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xb1, 0xe6, 0xfe, 0xfd, 0xa5, 0x7c,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xb6, 0xf8, 0xbc, 0xb8, 0xbe, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xc6, 0xde, 0xdd, 0xae, 0x40,
+    0xb7, 0xa3, 0xbf, 0x7d, 0xaf, 0xa7, 0x5d, 0xf0,
+    0xbd, 0x24, 0xa6, 0xd8, 0xac, 0xa8, 0xb4, 0xd7,
+    0xe7, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xf5,
+    0xbb, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x60, 0xfb, 0x5c, 0xf9, 0xfa, 0xe3,
+    0xfc, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x23, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x22, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_905_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc4, 0x8b, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc4, 0x9e, 0},
+    {2, 0xc4, 0xb0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc4, 0x8a, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc5, 0x9f, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xcb, 0x99, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc4, 0xb1, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x9e, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xcb, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc4, 0xa7, 0},
+    {2, 0xc4, 0x89, 0},
+    {2, 0xc5, 0x9d, 0},
+    {2, 0xc5, 0xad, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc4, 0xa5, 0},
+    {2, 0xc4, 0x9d, 0},
+    {2, 0xc4, 0xb5, 0},
+    {2, 0xc2, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc4, 0xa6, 0},
+    {2, 0xc4, 0x88, 0},
+    {2, 0xc5, 0x9c, 0},
+    {2, 0xc5, 0xac, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc5, 0xbc, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc5, 0xbb, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x5d, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xbd, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc4, 0xa4, 0},
+    {2, 0xc4, 0x9c, 0},
+    {2, 0xc4, 0xb4, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa7, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc4, 0xa1, 0},
+    {2, 0xc4, 0x9f, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc4, 0xa0, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_905_keys[512] = {
+    0x0000, 0xffff, 0x00c7, 0x005b, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x004a, 0xffff, 0xffff, 0xffff, 0xffff, 0x0039, 0xffff, 0x016c,
+    0xffff, 0x0094, 0x0028, 0xffff, 0xffff, 0x00ef, 0x0083, 0x0017,
+    0xffff, 0xffff, 0xffff, 0x0072, 0x0006, 0xffff, 0x02d8, 0x00cd,
+    0x0061, 0xffff, 0xffff, 0xffff, 0xffff, 0x0050, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x003f, 0xffff, 0xffff, 0x009a, 0x002e, 0xffff,
+    0xffff, 0xffff, 0x0089, 0x001d, 0xffff, 0xffff, 0x00e4, 0x0078,
+    0x000c, 0xffff, 0xffff, 0x00d3, 0x0067, 0xffff, 0xffff, 0xffff,
+    0x00c2, 0x0056, 0xffff, 0xffff, 0x011d, 0xffff, 0x0045, 0xffff,
+    0xffff, 0xffff, 0x00a0, 0x0034, 0xffff, 0xffff, 0x00fb, 0x008f,
+    0x0023, 0xffff, 0x00ea, 0xffff, 0x007e, 0x0012, 0xffff, 0x00d9,
+    0x006d, 0xffff, 0x0001, 0x0134, 0x00c8, 0x005c, 0xffff, 0xffff,
+    0xffff, 0x00b7, 0x004b, 0xffff, 0xffff, 0xffff, 0xffff, 0x003a,
+    0xffff, 0x016d, 0xffff, 0x0095, 0x0029, 0xffff, 0x015c, 0xffff,
+    0x0084, 0x0018, 0xffff, 0xffff, 0x00df, 0x0073, 0x0007, 0xffff,
+    0x02d9, 0x00ce, 0x0062, 0xffff, 0xffff, 0xffff, 0x00bd, 0x0051,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0040, 0xffff, 0xffff, 0x009b,
+    0xffff, 0x002f, 0xffff, 0x00f6, 0x008a, 0x001e, 0xffff, 0xffff,
+    0xffff, 0x0079, 0x000d, 0xffff, 0xffff, 0x00d4, 0x0068, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0057, 0xffff, 0xffff, 0x011e, 0x00b2,
+    0x0046, 0xffff, 0xffff, 0xffff, 0xffff, 0x0035, 0xffff, 0xffff,
+    0x00fc, 0x0090, 0x0024, 0xffff, 0xffff, 0x00eb, 0x007f, 0x0013,
+    0xffff, 0x00da, 0xffff, 0x006e, 0x0002, 0x0135, 0x00c9, 0x005d,
+    0xffff, 0xffff, 0x0124, 0x00b8, 0x004c, 0xffff, 0xffff, 0xffff,
+    0x00a7, 0x003b, 0xffff, 0xffff, 0xffff, 0x0096, 0x002a, 0xffff,
+    0x015d, 0x00f1, 0x0085, 0x0019, 0xffff, 0xffff, 0x00e0, 0x0074,
+    0x0008, 0xffff, 0xffff, 0x00cf, 0x0063, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0052, 0xffff, 0xffff, 0xffff, 0x00ad, 0x0041, 0xffff,
+    0x0108, 0x009c, 0xffff, 0x0030, 0xffff, 0x00f7, 0x008b, 0x001f,
+    0xffff, 0xffff, 0xffff, 0x007a, 0x000e, 0xffff, 0xffff, 0xffff,
+    0x0069, 0xffff, 0xffff, 0x0130, 0x00c4, 0x0058, 0xffff, 0xffff,
+    0x011f, 0x00b3, 0x0047, 0xffff, 0xffff, 0xffff, 0xffff, 0x0036,
+    0xffff, 0xffff, 0xffff, 0x0091, 0x0025, 0xffff, 0xffff, 0x00ec,
+    0x0080, 0x0014, 0xffff, 0x00db, 0xffff, 0x006f, 0x0003, 0xffff,
+    0x00ca, 0xffff, 0x005e, 0xffff, 0x0125, 0xffff, 0x004d, 0xffff,
+    0xffff, 0xffff, 0x00a8, 0x003c, 0xffff, 0xffff, 0xffff, 0x0097,
+    0x002b, 0xffff, 0x015e, 0x00f2, 0x0086, 0x001a, 0xffff, 0xffff,
+    0x00e1, 0x0075, 0x0009, 0xffff, 0xffff, 0xffff, 0x0064, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0053, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0042, 0xffff, 0x0109, 0xffff, 0x009d, 0x0031, 0xffff, 0xffff,
+    0x008c, 0xffff, 0x0020, 0xffff, 0x00e7, 0x007b, 0x000f, 0xffff,
+    0xffff, 0x00d6, 0x006a, 0xffff, 0xffff, 0x0131, 0xffff, 0x0059,
+    0xffff, 0xffff, 0x0120, 0x00b4, 0x0048, 0xffff, 0x017b, 0xffff,
+    0x00a3, 0x0037, 0xffff, 0xffff, 0xffff, 0x0092, 0x0026, 0xffff,
+    0xffff, 0x00ed, 0x0081, 0x0015, 0xffff, 0xffff, 0x00dc, 0x0070,
+    0x0004, 0xffff, 0x00cb, 0xffff, 0x005f, 0xffff, 0x0126, 0xffff,
+    0x004e, 0xffff, 0xffff, 0xffff, 0xffff, 0x003d, 0xffff, 0xffff,
+    0xffff, 0x0098, 0x002c, 0xffff, 0x015f, 0x00f3, 0x0087, 0x001b,
+    0xffff, 0xffff, 0x00e2, 0x0076, 0x000a, 0xffff, 0xffff, 0x00d1,
+    0x0065, 0xffff, 0xffff, 0xffff, 0x00c0, 0x0054, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0043, 0xffff, 0x010a, 0xffff, 0x009e, 0x0032,
+    0xffff, 0x00f9, 0xffff, 0x008d, 0x0021, 0xffff, 0x00e8, 0x007c,
+    0xffff, 0x0010, 0xffff, 0x00d7, 0x006b, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x005a, 0xffff, 0xffff, 0x0121, 0x00b5, 0x0049, 0xffff,
+    0x017c, 0xffff, 0x00a4, 0x0038, 0xffff, 0xffff, 0xffff, 0x0093,
+    0x0027, 0xffff, 0xffff, 0x00ee, 0x0082, 0x0016, 0xffff, 0xffff,
+    0xffff, 0x0071, 0x0005, 0xffff, 0xffff, 0x00cc, 0x0060, 0xffff,
+    0x0127, 0xffff, 0xffff, 0x004f, 0xffff, 0xffff, 0xffff, 0x003e,
+    0xffff, 0xffff, 0xffff, 0x0099, 0x002d, 0xffff, 0xffff, 0x00f4,
+    0x0088, 0x001c, 0xffff, 0xffff, 0xffff, 0x0077, 0x000b, 0xffff,
+    0xffff, 0x00d2, 0x0066, 0xffff, 0xffff, 0xffff, 0x00c1, 0x0055,
+    0xffff, 0xffff, 0x011c, 0x00b0, 0x0044, 0xffff, 0xffff, 0x010b,
+    0x009f, 0x0033, 0xffff, 0x00fa, 0xffff, 0x008e, 0x0022, 0xffff,
+    0x00e9, 0x007d, 0xffff, 0x0011, 0xffff, 0xffff, 0x006c, 0xffff};
+
+static const unsigned char utf8map_905_values[512] = {
+    0x00, 0x00, 0x4a, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xad,
+    0x00, 0x34, 0x4d, 0x00, 0x00, 0x57, 0x23, 0x26,
+    0x00, 0x00, 0x00, 0x99, 0x2e, 0x00, 0x80, 0x75,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00,
+    0x00, 0x00, 0x6f, 0x00, 0x00, 0x3a, 0x4b, 0x00,
+    0x00, 0x00, 0x29, 0x1d, 0x00, 0x00, 0x43, 0xa7,
+    0x0c, 0x00, 0x00, 0xee, 0x87, 0x00, 0x00, 0x00,
+    0x62, 0xe5, 0x00, 0x00, 0x9b, 0x00, 0xc5, 0x00,
+    0x00, 0x00, 0x41, 0xf4, 0x00, 0x00, 0xdb, 0x1b,
+    0xec, 0x00, 0x52, 0x00, 0xcc, 0x12, 0x00, 0xfd,
+    0x94, 0x00, 0x01, 0xbc, 0x74, 0xdc, 0x00, 0x00,
+    0x00, 0xb0, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x7a,
+    0x00, 0x8d, 0x00, 0x35, 0x5d, 0x00, 0xac, 0x00,
+    0x24, 0x18, 0x00, 0x00, 0x59, 0xa2, 0x2f, 0x00,
+    0x70, 0x76, 0x82, 0x00, 0x00, 0x00, 0xb8, 0xd8,
+    0x00, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x3b,
+    0x00, 0x61, 0x00, 0xa1, 0x2a, 0x1e, 0x00, 0x00,
+    0x00, 0xa8, 0x0d, 0x00, 0x00, 0xeb, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x5a, 0xea,
+    0xc6, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00,
+    0xe0, 0x30, 0xb9, 0x00, 0x00, 0x53, 0x07, 0x13,
+    0x00, 0xfe, 0x00, 0x95, 0x02, 0x9c, 0x71, 0xb6,
+    0x00, 0x00, 0xba, 0x9d, 0xd3, 0x00, 0x00, 0x00,
+    0xb5, 0x5e, 0x00, 0x00, 0x00, 0x36, 0x5c, 0x00,
+    0x8c, 0x49, 0x15, 0x19, 0x00, 0x00, 0x44, 0xa3,
+    0x16, 0x00, 0x00, 0x77, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0xd9, 0x00, 0x00, 0x00, 0xca, 0xc1, 0x00,
+    0xab, 0x04, 0x00, 0xf0, 0x00, 0xe1, 0x2b, 0x1f,
+    0x00, 0x00, 0x00, 0xa9, 0x0e, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x5b, 0x63, 0xe7, 0x00, 0x00,
+    0xd0, 0xfa, 0xc7, 0x00, 0x00, 0x00, 0x00, 0xf6,
+    0x00, 0x00, 0x00, 0x31, 0x6c, 0x00, 0x00, 0x58,
+    0x20, 0x3c, 0x00, 0xfb, 0x00, 0x96, 0x03, 0x00,
+    0x72, 0x00, 0x5f, 0x00, 0x9a, 0x00, 0xd4, 0x00,
+    0x00, 0x00, 0xbd, 0x4c, 0x00, 0x00, 0x00, 0x08,
+    0x4e, 0x00, 0x7c, 0xcd, 0x06, 0x3f, 0x00, 0x00,
+    0x45, 0xa4, 0x05, 0x00, 0x00, 0x00, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00,
+    0xc2, 0x00, 0x8b, 0x00, 0x14, 0xf1, 0x00, 0x00,
+    0x2c, 0x00, 0x40, 0x00, 0xc0, 0x48, 0x0f, 0x00,
+    0x00, 0x7b, 0x91, 0x00, 0x00, 0x79, 0x00, 0xe8,
+    0x00, 0x00, 0xef, 0xbe, 0xc8, 0x00, 0xb4, 0x00,
+    0xb1, 0xf7, 0x00, 0x00, 0x00, 0x1a, 0x50, 0x00,
+    0x00, 0x55, 0x21, 0x3d, 0x00, 0x00, 0x7f, 0x97,
+    0x37, 0x00, 0x73, 0x00, 0x6d, 0x00, 0xaa, 0x00,
+    0xd5, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0x00, 0x38, 0x6b, 0x00, 0x6a, 0xce, 0x17, 0x27,
+    0x00, 0x00, 0x42, 0xa5, 0x25, 0x00, 0x00, 0x69,
+    0x85, 0x00, 0x00, 0x00, 0x64, 0xe3, 0x00, 0x00,
+    0x00, 0x00, 0xc3, 0x00, 0x67, 0x00, 0x3e, 0xf2,
+    0x00, 0xdd, 0x00, 0x09, 0x4f, 0x00, 0x54, 0x8f,
+    0x00, 0x10, 0x00, 0xbf, 0x92, 0x00, 0x00, 0x00,
+    0x00, 0xe9, 0x00, 0x00, 0xcf, 0xa0, 0xc9, 0x00,
+    0xb2, 0x00, 0x9f, 0xf8, 0x00, 0x00, 0x00, 0x33,
+    0x7d, 0x00, 0x00, 0x56, 0x22, 0x32, 0x00, 0x00,
+    0x00, 0x98, 0x2d, 0x00, 0x00, 0x78, 0xda, 0x00,
+    0x8a, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x6e,
+    0x00, 0x00, 0x00, 0x39, 0x60, 0x00, 0x00, 0xcb,
+    0x28, 0x1c, 0x00, 0x00, 0x00, 0xa6, 0x0b, 0x00,
+    0x00, 0xed, 0x86, 0x00, 0x00, 0x00, 0x65, 0xe4,
+    0x00, 0x00, 0xbb, 0x90, 0xc4, 0x00, 0x00, 0x47,
+    0xff, 0xf3, 0x00, 0xde, 0x00, 0x0a, 0xfc, 0x00,
+    0x51, 0xb3, 0x00, 0x11, 0x00, 0x00, 0x93, 0x00};
+
+/* Map 880 (ISO-8859-5) */
+
+static unsigned char const charmap_880_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x64, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xa1, 0x45, 0x73, 0x79, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0xc0, 0x63, 0x59, 0x62, 0xd0, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x70, 0x71, 0x72, 0x41, 0x74, 0x75,
+    0xb9, 0xba, 0xed, 0xbf, 0xbc, 0xbd, 0xec, 0xfa,
+    0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xda, 0xdb, 0xdc,
+    0xde, 0xdf, 0xea, 0xeb, 0xbe, 0xca, 0xbb, 0xfe,
+    0xfb, 0xfd, 0x57, 0xef, 0xee, 0xfc, 0xb8, 0xdd,
+    0x77, 0x78, 0xaf, 0x8d, 0x8a, 0x8b, 0xae, 0xb2,
+    0x8f, 0x90, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xaa, 0xab, 0xac, 0xad, 0x8c, 0x8e, 0x80, 0xb6,
+    0xb3, 0xb5, 0xb7, 0xb1, 0xb0, 0xb4, 0x76, 0xa0,
+    0x58, 0x44, 0x42, 0x43, 0x6a, 0x46, 0x47, 0x48,
+    0x49, 0x51, 0x52, 0x53, 0x54, 0xe1, 0x55, 0x56};
+
+static unsigned char const charmap_880_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xad, 0xf2, 0xf3, 0xf1, 0x7c, 0xf5, 0xf6,
+    0xf7, 0xf8, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xf9, 0xfa, 0xfb, 0xfc, 0xfe, 0xff, 0xca,
+    0xf0, 0xa2, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xa3, 0xa1, 0x60, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xf4, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xaa, 0xab, 0xac, 0x7d, 0xae, 0xaf, 0xee, 0xd0,
+    0xd1, 0x7e, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xe6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xd4, 0xd5, 0xe4, 0xd3, 0xe5, 0xd8,
+    0xd9, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xef, 0x7b, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xe0, 0xe1, 0xe2, 0xe3, 0xd6, 0xd2,
+    0xec, 0xeb, 0xd7, 0xe8, 0xed, 0xe9, 0xe7, 0xea,
+    0xce, 0xb0, 0xb1, 0xc6, 0xb4, 0xb5, 0xc4, 0xb3,
+    0xa0, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xc5, 0xb8, 0xb9, 0xba, 0xbb, 0xbc,
+    0xa4, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xbd, 0xbe, 0xbf, 0xcf, 0xc0, 0xc1,
+    0x5c, 0xfd, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xc2, 0xc3, 0xb6, 0xb2, 0xcc, 0xcb,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb7, 0xc8, 0xcd, 0xc9, 0xc7, 0x9f};
+
+static const unsigned char utf8map_880_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xd1, 0x92, 0},
+    {2, 0xd1, 0x93, 0},
+    {2, 0xd1, 0x91, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xd1, 0x95, 0},
+    {2, 0xd1, 0x96, 0},
+    {2, 0xd1, 0x97, 0},
+    {2, 0xd1, 0x98, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xd1, 0x99, 0},
+    {2, 0xd1, 0x9a, 0},
+    {2, 0xd1, 0x9b, 0},
+    {2, 0xd1, 0x9c, 0},
+    {2, 0xd1, 0x9e, 0},
+    {2, 0xd1, 0x9f, 0},
+    {2, 0xd0, 0xaa, 0},
+    {3, 0xe2, 0x84, 0x96},
+    {2, 0xd0, 0x82, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xd0, 0x83, 0},
+    {2, 0xd0, 0x81, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xd0, 0x85, 0},
+    {2, 0xd0, 0x86, 0},
+    {2, 0xd0, 0x87, 0},
+    {2, 0xd0, 0x88, 0},
+    {2, 0xd0, 0x89, 0},
+    {2, 0xd1, 0x94, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xd0, 0x8a, 0},
+    {2, 0xd0, 0x8b, 0},
+    {2, 0xd0, 0x8c, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xd0, 0x8e, 0},
+    {2, 0xd0, 0x8f, 0},
+    {2, 0xd1, 0x8e, 0},
+    {2, 0xd0, 0xb0, 0},
+    {2, 0xd0, 0xb1, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xd1, 0x86, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xd0, 0xb4, 0},
+    {2, 0xd0, 0xb5, 0},
+    {2, 0xd1, 0x84, 0},
+    {2, 0xd0, 0xb3, 0},
+    {2, 0xd1, 0x85, 0},
+    {2, 0xd0, 0xb8, 0},
+    {2, 0xd0, 0xb9, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xd0, 0xba, 0},
+    {2, 0xd0, 0xbb, 0},
+    {2, 0xd0, 0xbc, 0},
+    {2, 0xd0, 0xbd, 0},
+    {2, 0xd0, 0xbe, 0},
+    {2, 0xd0, 0xbf, 0},
+    {2, 0xd1, 0x8f, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xd1, 0x80, 0},
+    {2, 0xd1, 0x81, 0},
+    {2, 0xd1, 0x82, 0},
+    {2, 0xd1, 0x83, 0},
+    {2, 0xd0, 0xb6, 0},
+    {2, 0xd0, 0xb2, 0},
+    {2, 0xd1, 0x8c, 0},
+    {2, 0xd1, 0x8b, 0},
+    {2, 0xd0, 0xb7, 0},
+    {2, 0xd1, 0x88, 0},
+    {2, 0xd1, 0x8d, 0},
+    {2, 0xd1, 0x89, 0},
+    {2, 0xd1, 0x87, 0},
+    {2, 0xd1, 0x8a, 0},
+    {2, 0xd0, 0xae, 0},
+    {2, 0xd0, 0x90, 0},
+    {2, 0xd0, 0x91, 0},
+    {2, 0xd0, 0xa6, 0},
+    {2, 0xd0, 0x94, 0},
+    {2, 0xd0, 0x95, 0},
+    {2, 0xd0, 0xa4, 0},
+    {2, 0xd0, 0x93, 0},
+    {2, 0xc2, 0xa0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xd0, 0xa5, 0},
+    {2, 0xd0, 0x98, 0},
+    {2, 0xd0, 0x99, 0},
+    {2, 0xd0, 0x9a, 0},
+    {2, 0xd0, 0x9b, 0},
+    {2, 0xd0, 0x9c, 0},
+    {2, 0xd0, 0x84, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xd0, 0x9d, 0},
+    {2, 0xd0, 0x9e, 0},
+    {2, 0xd0, 0x9f, 0},
+    {2, 0xd0, 0xaf, 0},
+    {2, 0xd0, 0xa0, 0},
+    {2, 0xd0, 0xa1, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xd0, 0xa2, 0},
+    {2, 0xd0, 0xa3, 0},
+    {2, 0xd0, 0x96, 0},
+    {2, 0xd0, 0x92, 0},
+    {2, 0xd0, 0xac, 0},
+    {2, 0xd0, 0xab, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xd0, 0x97, 0},
+    {2, 0xd0, 0xa8, 0},
+    {2, 0xd0, 0xad, 0},
+    {2, 0xd0, 0xa9, 0},
+    {2, 0xd0, 0xa7, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_880_keys[512] = {
+    0x0000, 0x040e, 0x0029, 0x0437, 0xffff, 0x0052, 0xffff, 0x007b,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0016, 0xffff, 0x0424,
+    0x003f, 0x044d, 0x0068, 0xffff, 0xffff, 0x0091, 0xffff, 0xffff,
+    0xffff, 0x0003, 0x0411, 0x002c, 0x043a, 0xffff, 0x0055, 0xffff,
+    0x007e, 0xffff, 0xffff, 0x00a7, 0xffff, 0xffff, 0x0019, 0xffff,
+    0x0427, 0x0042, 0xffff, 0xffff, 0x006b, 0xffff, 0x0094, 0xffff,
+    0xffff, 0xffff, 0x0006, 0x0414, 0x002f, 0xffff, 0x043d, 0x0058,
+    0xffff, 0x0081, 0xffff, 0xffff, 0xffff, 0xffff, 0x0401, 0xffff,
+    0x001c, 0x042a, 0x0045, 0x0453, 0xffff, 0x006e, 0xffff, 0x0097,
+    0xffff, 0xffff, 0xffff, 0x0009, 0x0417, 0x0032, 0xffff, 0x0440,
+    0x005b, 0xffff, 0xffff, 0x0084, 0xffff, 0x00ad, 0xffff, 0xffff,
+    0x0404, 0x001f, 0x042d, 0x0048, 0xffff, 0x0456, 0x0071, 0xffff,
+    0x009a, 0xffff, 0xffff, 0xffff, 0x000c, 0x041a, 0xffff, 0x0035,
+    0x0443, 0x005e, 0xffff, 0xffff, 0x0087, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0407, 0x0022, 0x0430, 0x004b, 0xffff, 0x0459, 0x0074,
+    0xffff, 0xffff, 0x009d, 0xffff, 0xffff, 0x000f, 0xffff, 0x041d,
+    0x0038, 0x0446, 0x0061, 0xffff, 0xffff, 0x008a, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x040a, 0x0025, 0x0433, 0xffff, 0x004e, 0x045c,
+    0x0077, 0xffff, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0012, 0xffff,
+    0x0420, 0x003b, 0x0449, 0x0064, 0xffff, 0xffff, 0x008d, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0028, 0xffff, 0x0436, 0x0051,
+    0x045f, 0x007a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0015, 0x0423, 0x003e, 0x044c, 0xffff, 0x0067, 0xffff, 0x0090,
+    0xffff, 0xffff, 0xffff, 0x0002, 0x0410, 0x002b, 0xffff, 0x0439,
+    0x0054, 0xffff, 0x007d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0018, 0x0426, 0x0041, 0xffff, 0x044f, 0x006a, 0x2116,
+    0x0093, 0xffff, 0xffff, 0xffff, 0x0005, 0x0413, 0xffff, 0x002e,
+    0x043c, 0x0057, 0xffff, 0xffff, 0x0080, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x001b, 0x0429, 0x0044, 0xffff, 0x0452, 0x006d,
+    0xffff, 0x0096, 0xffff, 0xffff, 0xffff, 0x0008, 0xffff, 0x0416,
+    0x0031, 0x043f, 0x005a, 0xffff, 0xffff, 0x0083, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0403, 0x001e, 0x042c, 0xffff, 0x0047, 0x0455,
+    0x0070, 0xffff, 0xffff, 0x0099, 0xffff, 0xffff, 0x000b, 0xffff,
+    0x0419, 0x0034, 0x0442, 0x005d, 0xffff, 0xffff, 0x0086, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0406, 0x0021, 0xffff, 0x042f, 0x004a,
+    0x0458, 0x0073, 0xffff, 0xffff, 0x009c, 0xffff, 0xffff, 0xffff,
+    0x000e, 0x041c, 0x0037, 0x0445, 0xffff, 0x0060, 0xffff, 0x0089,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0409, 0x0024, 0xffff, 0x0432,
+    0x004d, 0x045b, 0x0076, 0xffff, 0xffff, 0x009f, 0xffff, 0xffff,
+    0xffff, 0x0011, 0x041f, 0x003a, 0xffff, 0x0448, 0x0063, 0xffff,
+    0x008c, 0xffff, 0xffff, 0xffff, 0xffff, 0x040c, 0xffff, 0x0027,
+    0x0435, 0x0050, 0x045e, 0xffff, 0x0079, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0014, 0x0422, 0x003d, 0xffff, 0x044b, 0x0066,
+    0xffff, 0x008f, 0xffff, 0xffff, 0xffff, 0x0001, 0xffff, 0x040f,
+    0x002a, 0x0438, 0x0053, 0xffff, 0xffff, 0x007c, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0017, 0x0425, 0xffff, 0x0040, 0x044e,
+    0x0069, 0xffff, 0xffff, 0x0092, 0xffff, 0xffff, 0x0004, 0xffff,
+    0x0412, 0x002d, 0x043b, 0x0056, 0xffff, 0xffff, 0x007f, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x001a, 0x0428, 0xffff, 0x0043,
+    0x0451, 0x006c, 0xffff, 0xffff, 0x0095, 0xffff, 0xffff, 0xffff,
+    0x0007, 0x0415, 0x0030, 0x043e, 0xffff, 0x0059, 0xffff, 0x0082,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0402, 0x001d, 0xffff, 0x042b,
+    0x0046, 0x0454, 0x006f, 0xffff, 0xffff, 0x0098, 0xffff, 0xffff,
+    0xffff, 0x000a, 0x0418, 0x0033, 0x0441, 0xffff, 0x005c, 0xffff,
+    0x0085, 0xffff, 0xffff, 0xffff, 0xffff, 0x0405, 0xffff, 0x0020,
+    0x042e, 0x0049, 0x0457, 0xffff, 0x0072, 0xffff, 0x009b, 0xffff,
+    0xffff, 0xffff, 0x000d, 0x041b, 0x0036, 0xffff, 0x0444, 0x005f,
+    0xffff, 0x0088, 0xffff, 0xffff, 0xffff, 0xffff, 0x0408, 0xffff,
+    0x0023, 0x0431, 0x004c, 0x045a, 0xffff, 0x0075, 0xffff, 0x009e,
+    0xffff, 0xffff, 0xffff, 0x0010, 0x041e, 0xffff, 0x0039, 0x0447,
+    0x0062, 0xffff, 0xffff, 0x008b, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x040b, 0x0026, 0x0434, 0x004f, 0xffff, 0xffff, 0x0078, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0013, 0x0421, 0xffff, 0x003c,
+    0x044a, 0x0065, 0xffff, 0xffff, 0x008e, 0xffff, 0xffff, 0xffff};
+
+static const unsigned char utf8map_880_values[512] = {
+    0x00, 0x74, 0x5d, 0xb2, 0x00, 0xd9, 0x00, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0xbe,
+    0x6f, 0xb4, 0x88, 0x00, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x03, 0xba, 0x6b, 0x9a, 0x00, 0xe4, 0x00,
+    0x79, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x19, 0x00,
+    0xfe, 0xc2, 0x00, 0x00, 0x92, 0x00, 0x34, 0x00,
+    0x00, 0x00, 0x2e, 0xbc, 0x61, 0x00, 0x9d, 0xe7,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00,
+    0x1c, 0x57, 0xc5, 0x43, 0x00, 0x95, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x05, 0xfa, 0xf2, 0x00, 0xaa,
+    0x4a, 0x00, 0x00, 0x24, 0x00, 0x41, 0x00, 0x00,
+    0xd0, 0x1f, 0xfc, 0xc8, 0x00, 0x47, 0x98, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0x0c, 0xcd, 0x00, 0xf5,
+    0xad, 0x5f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x67, 0x7f, 0x77, 0xd2, 0x00, 0x51, 0xa3,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x0f, 0x00, 0xda,
+    0xf8, 0x80, 0x81, 0x00, 0x00, 0x2a, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x6c, 0x8d, 0x00, 0xd5, 0x54,
+    0xa6, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x12, 0x00,
+    0xde, 0x5e, 0xb5, 0x84, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0xae, 0xd8,
+    0x56, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3d, 0xeb, 0x6e, 0xb0, 0x00, 0x87, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x02, 0xb9, 0x4e, 0x00, 0x90,
+    0xe3, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xbb, 0xc1, 0x00, 0xa0, 0x91, 0x58,
+    0x33, 0x00, 0x00, 0x00, 0x2d, 0xbf, 0x00, 0x4b,
+    0x9c, 0xe6, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0xfd, 0xc4, 0x00, 0x42, 0x94,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0x16, 0x00, 0xec,
+    0xf1, 0x9f, 0xe9, 0x00, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x00, 0x62, 0x1e, 0xee, 0x00, 0xc7, 0x46,
+    0x97, 0x00, 0x00, 0x39, 0x00, 0x00, 0x0b, 0x00,
+    0xcc, 0xf4, 0xac, 0x5a, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x4f, 0x00, 0xdd, 0xd1,
+    0x49, 0xa2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0e, 0xcf, 0xf7, 0x8e, 0x00, 0x64, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x5b, 0x00, 0xaf,
+    0xd4, 0x53, 0xa5, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0x00, 0x11, 0xdc, 0x7a, 0x00, 0xb3, 0x83, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x7d,
+    0x8b, 0xd7, 0x55, 0x00, 0xa8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0xea, 0x7e, 0x00, 0xb1, 0x86,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75,
+    0x5c, 0x8f, 0xe2, 0x00, 0x00, 0x45, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0xca, 0x00, 0x7c, 0x76,
+    0x89, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x37, 0x00,
+    0xed, 0x60, 0x9b, 0xe5, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xfb, 0x00, 0xc3,
+    0x44, 0x93, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+    0x2f, 0xbd, 0xf0, 0x9e, 0x00, 0xe8, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0xef,
+    0xc6, 0x6a, 0x96, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x25, 0xcb, 0xf3, 0xab, 0x00, 0xe0, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x40,
+    0xb8, 0xc9, 0x48, 0x00, 0x99, 0x00, 0x3b, 0x00,
+    0x00, 0x00, 0x0d, 0xce, 0xf6, 0x00, 0x8c, 0x6d,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
+    0x7b, 0x78, 0xd3, 0x52, 0x00, 0xa4, 0x00, 0x3e,
+    0x00, 0x00, 0x00, 0x10, 0xdb, 0x00, 0xf9, 0xb6,
+    0x82, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0x50, 0x8a, 0xd6, 0x00, 0x00, 0xa7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0xdf, 0x00, 0x4c,
+    0xb7, 0x85, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00};
+
+/* Map 420 (ISO-8859-6) */
+
+static unsigned char const charmap_420_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x64, 0x8a, 0xcd, 0x9b, 0x6d,
+    0x68, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x53, 0x4f, 0xcc, 0xcb, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xa1, 0x59, 0x48, 0x4a, 0x66, 0x9d, 0x78,
+    0xac, 0xe0, 0xaa, 0xe1, 0x79, 0xca, 0xae, 0x54,
+    0xb0, 0xa0, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc0, 0xbc, 0x57, 0xbe, 0xd0,
+    0x6a, 0x46, 0x47, 0x49, 0x52, 0x45, 0x55, 0x56,
+    0x58, 0x62, 0x63, 0x65, 0x67, 0x69, 0x71, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x80, 0x8b, 0x8d, 0x8f,
+    0x90, 0x9a, 0x9e, 0xdb, 0xea, 0xdd, 0xde, 0xdf,
+    0x44, 0xab, 0xad, 0xaf, 0xb1, 0xbb, 0xbd, 0xbf,
+    0xcf, 0xda, 0xdc, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x51, 0x42, 0x70, 0x8e, 0x5f, 0x43, 0x8c, 0x9c,
+    0xce, 0x72, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x9f};
+
+static unsigned char const charmap_420_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xf1, 0xf5, 0xe0, 0xc5, 0xc1, 0xc2,
+    0xa3, 0xc3, 0xa4, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xf0, 0xc4, 0x7b, 0xaf, 0xc6, 0xc7, 0xbd,
+    0xc8, 0xa2, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xf4,
+    0x2d, 0x2f, 0xc9, 0xca, 0x5b, 0xcb, 0xa5, 0xcc,
+    0x60, 0xcd, 0xc0, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf2, 0xce, 0xf9, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3,
+    0xa7, 0xac, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd4, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x5c, 0xd5, 0xf6, 0xd6, 0xf3, 0xd7,
+    0xd8, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xd9, 0x5e, 0xf7, 0xa6, 0xda, 0xff,
+    0xb1, 0xa1, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xaa, 0xe1, 0xa8, 0xe2, 0xae, 0xe3,
+    0xb0, 0xe4, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xe5, 0xbc, 0xe6, 0xbe, 0xe7,
+    0xbb, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0x7e, 0x7d, 0x5d, 0xf8, 0xe8,
+    0xbf, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xe9, 0xdb, 0xea, 0xdd, 0xde, 0xdf,
+    0xa9, 0xab, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xdc, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x9f};
+
+static const unsigned char utf8map_420_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xd9, 0x91, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x80, 0},
+    {2, 0xd8, 0xa5, 0},
+    {2, 0xd8, 0xa1, 0},
+    {2, 0xd8, 0xa2, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xa3, 0},
+    {2, 0xc2, 0xa4, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xd9, 0x90, 0},
+    {2, 0xd8, 0xa4, 0},
+    {1, 0x7b, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xa6, 0},
+    {2, 0xd8, 0xa7, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xa8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xd8, 0xa9, 0},
+    {2, 0xd8, 0xaa, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xd8, 0xab, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xac, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xd8, 0xad, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xd9, 0x92, 0},
+    {2, 0xd8, 0xae, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xaf, 0},
+    {2, 0xd8, 0xb0, 0},
+    {2, 0xd8, 0xb1, 0},
+    {2, 0xd8, 0xb2, 0},
+    {2, 0xd8, 0xb3, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0x8c, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xd8, 0xb4, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xd8, 0xb5, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xb6, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xb7, 0},
+    {2, 0xd8, 0xb8, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xd8, 0xb9, 0},
+    {1, 0x5e, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd8, 0xba, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x81, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x82, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x83, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x84, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x85, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x86, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x87, 0},
+    {2, 0xd8, 0x9b, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x5d, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x88, 0},
+    {2, 0xd8, 0x9f, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xd9, 0x89, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x8a, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd9, 0x8b, 0},
+    {2, 0xd9, 0x8c, 0},
+    {2, 0xd9, 0x8d, 0},
+    {2, 0xd9, 0x8e, 0},
+    {2, 0xd9, 0x8f, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_420_keys[512] = {
+    0x0000, 0x0067, 0x062a, 0xffff, 0xffff, 0x005c, 0xffff, 0x061f,
+    0xffff, 0xffff, 0x0051, 0xffff, 0xffff, 0xffff, 0xffff, 0x0046,
+    0x00ad, 0xffff, 0xffff, 0xffff, 0x003b, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0030, 0x0097, 0xffff, 0xffff, 0xffff, 0x0025, 0x008c,
+    0x064f, 0xffff, 0xffff, 0x001a, 0x0081, 0x0644, 0xffff, 0x000f,
+    0xffff, 0x0076, 0x0639, 0xffff, 0x0004, 0x006b, 0x062e, 0xffff,
+    0xffff, 0xffff, 0x0060, 0x0623, 0xffff, 0xffff, 0xffff, 0x0055,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x004a, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x003f, 0xffff, 0xffff, 0xffff, 0xffff, 0x0034, 0x009b,
+    0xffff, 0xffff, 0xffff, 0x0029, 0x0090, 0xffff, 0xffff, 0x001e,
+    0x0085, 0xffff, 0x0648, 0xffff, 0x0013, 0x007a, 0xffff, 0xffff,
+    0xffff, 0x0008, 0x006f, 0x0632, 0xffff, 0xffff, 0xffff, 0x0064,
+    0x0627, 0xffff, 0xffff, 0xffff, 0x0059, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x004e, 0xffff, 0xffff, 0xffff, 0xffff, 0x0043, 0xffff,
+    0xffff, 0xffff, 0x0038, 0xffff, 0x009f, 0xffff, 0xffff, 0x002d,
+    0x0094, 0xffff, 0xffff, 0xffff, 0x0022, 0x0089, 0x064c, 0xffff,
+    0xffff, 0x0017, 0x007e, 0x0641, 0xffff, 0xffff, 0x000c, 0x0073,
+    0x0636, 0xffff, 0xffff, 0x0001, 0x0068, 0x062b, 0xffff, 0xffff,
+    0xffff, 0x005d, 0xffff, 0xffff, 0xffff, 0xffff, 0x0052, 0xffff,
+    0xffff, 0xffff, 0x0047, 0xffff, 0xffff, 0xffff, 0xffff, 0x003c,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0031, 0x0098, 0xffff, 0xffff,
+    0xffff, 0x0026, 0x008d, 0x0650, 0xffff, 0xffff, 0x001b, 0x0082,
+    0x0645, 0xffff, 0xffff, 0x0010, 0x0077, 0x063a, 0xffff, 0x0005,
+    0xffff, 0x006c, 0x062f, 0xffff, 0xffff, 0x0061, 0xffff, 0x0624,
+    0xffff, 0xffff, 0x0056, 0xffff, 0xffff, 0xffff, 0xffff, 0x004b,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0040, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0035, 0x009c, 0xffff, 0xffff, 0xffff, 0x002a, 0x0091,
+    0xffff, 0xffff, 0xffff, 0x001f, 0x0086, 0x0649, 0xffff, 0x0014,
+    0xffff, 0x007b, 0xffff, 0xffff, 0x0009, 0x0070, 0x0633, 0xffff,
+    0xffff, 0xffff, 0x0065, 0x0628, 0xffff, 0xffff, 0xffff, 0x005a,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x004f, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0044, 0xffff, 0xffff, 0xffff, 0xffff, 0x0039, 0x00a0,
+    0xffff, 0xffff, 0x002e, 0xffff, 0x0095, 0xffff, 0xffff, 0x0023,
+    0x008a, 0xffff, 0x064d, 0xffff, 0x0018, 0x007f, 0x0642, 0xffff,
+    0xffff, 0x000d, 0x0074, 0x0637, 0xffff, 0xffff, 0x0002, 0x0069,
+    0x062c, 0xffff, 0xffff, 0xffff, 0x005e, 0x0621, 0xffff, 0xffff,
+    0xffff, 0x0053, 0xffff, 0xffff, 0xffff, 0xffff, 0x0048, 0xffff,
+    0xffff, 0xffff, 0x003d, 0xffff, 0x00a4, 0xffff, 0xffff, 0x0032,
+    0x0099, 0xffff, 0xffff, 0xffff, 0x0027, 0x008e, 0x0651, 0xffff,
+    0xffff, 0x001c, 0x0083, 0x0646, 0xffff, 0xffff, 0x0011, 0x0078,
+    0xffff, 0xffff, 0xffff, 0x0006, 0x006d, 0x0630, 0xffff, 0xffff,
+    0xffff, 0x0062, 0x0625, 0xffff, 0xffff, 0x0057, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x004c, 0xffff, 0xffff, 0xffff, 0xffff, 0x0041,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0036, 0x009d, 0xffff, 0xffff,
+    0xffff, 0x002b, 0x0092, 0xffff, 0xffff, 0xffff, 0x0020, 0x0087,
+    0x064a, 0xffff, 0xffff, 0x0015, 0x007c, 0xffff, 0xffff, 0x000a,
+    0xffff, 0x0071, 0x0634, 0xffff, 0xffff, 0x0066, 0xffff, 0x0629,
+    0xffff, 0xffff, 0x005b, 0xffff, 0xffff, 0xffff, 0xffff, 0x0050,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0045, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x003a, 0xffff, 0xffff, 0xffff, 0xffff, 0x002f, 0x0096,
+    0xffff, 0xffff, 0xffff, 0x0024, 0x008b, 0x064e, 0xffff, 0x0019,
+    0x0080, 0xffff, 0x0643, 0xffff, 0x000e, 0x0075, 0x0638, 0xffff,
+    0xffff, 0x0003, 0x006a, 0x062d, 0xffff, 0xffff, 0xffff, 0x005f,
+    0x0622, 0xffff, 0xffff, 0xffff, 0x0054, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0049, 0x060c, 0xffff, 0xffff, 0xffff, 0x003e, 0xffff,
+    0xffff, 0xffff, 0x0033, 0xffff, 0x009a, 0xffff, 0xffff, 0x0028,
+    0x008f, 0xffff, 0x0652, 0xffff, 0x001d, 0x0084, 0x0647, 0xffff,
+    0xffff, 0x0012, 0x0079, 0xffff, 0xffff, 0xffff, 0x0007, 0x006e,
+    0x0631, 0xffff, 0xffff, 0xffff, 0x0063, 0x0626, 0xffff, 0xffff,
+    0xffff, 0x0058, 0x061b, 0xffff, 0xffff, 0xffff, 0x004d, 0xffff,
+    0xffff, 0xffff, 0x0042, 0xffff, 0xffff, 0xffff, 0xffff, 0x0037,
+    0x009e, 0xffff, 0xffff, 0xffff, 0x002c, 0x0093, 0xffff, 0xffff,
+    0xffff, 0x0021, 0x0088, 0x064b, 0xffff, 0xffff, 0x0016, 0x007d,
+    0x0640, 0xffff, 0xffff, 0x000b, 0x0072, 0x0635, 0xffff, 0xffff};
+
+static const unsigned char utf8map_420_values[512] = {
+    0x00, 0x87, 0x63, 0x00, 0x00, 0x8a, 0x00, 0xd0,
+    0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xc6,
+    0xca, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0x08, 0x00, 0x00, 0x00, 0x6c, 0x2c,
+    0xef, 0x00, 0x00, 0x3f, 0x21, 0xb1, 0x00, 0x0f,
+    0x00, 0xa5, 0x9a, 0x00, 0x37, 0x92, 0x71, 0x00,
+    0x00, 0x00, 0x68, 0x49, 0x00, 0x00, 0x00, 0xe4,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x3b,
+    0x00, 0x00, 0x00, 0x5d, 0x30, 0x00, 0x00, 0x1e,
+    0x15, 0x00, 0xcf, 0x00, 0x13, 0xa9, 0x00, 0x00,
+    0x00, 0x16, 0x96, 0x76, 0x00, 0x00, 0x00, 0x84,
+    0x56, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+    0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00,
+    0x00, 0x00, 0xf8, 0x00, 0xff, 0x00, 0x00, 0x60,
+    0x34, 0x00, 0x00, 0x00, 0x7f, 0x29, 0xec, 0x00,
+    0x00, 0x26, 0xcb, 0xab, 0x00, 0x00, 0x0c, 0xa2,
+    0x8d, 0x00, 0x00, 0x01, 0x88, 0x65, 0x00, 0x00,
+    0x00, 0xcd, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00,
+    0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0xf1, 0x38, 0x00, 0x00,
+    0x00, 0x50, 0x09, 0x51, 0x00, 0x00, 0x27, 0x22,
+    0xbb, 0x00, 0x00, 0x10, 0xa6, 0x9e, 0x00, 0x2d,
+    0x00, 0x93, 0x73, 0x00, 0x00, 0x81, 0x00, 0x52,
+    0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xd2,
+    0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+    0x00, 0xf5, 0x04, 0x00, 0x00, 0x00, 0x5c, 0x31,
+    0x00, 0x00, 0x00, 0x1f, 0x06, 0xda, 0x00, 0x3c,
+    0x00, 0x53, 0x00, 0x00, 0x05, 0x97, 0x77, 0x00,
+    0x00, 0x00, 0x85, 0x58, 0x00, 0x00, 0x00, 0xe9,
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+    0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x41,
+    0x00, 0x00, 0x4b, 0x00, 0x35, 0x00, 0x00, 0x7b,
+    0x2a, 0x00, 0xed, 0x00, 0x18, 0x07, 0xad, 0x00,
+    0x00, 0x0d, 0xa3, 0x8f, 0x00, 0x00, 0x02, 0x89,
+    0x67, 0x00, 0x00, 0x00, 0x9b, 0x46, 0x00, 0x00,
+    0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x4a, 0x00, 0x00, 0xf2,
+    0x39, 0x00, 0x00, 0x00, 0x7d, 0x0a, 0x42, 0x00,
+    0x00, 0x1c, 0x23, 0xbd, 0x00, 0x00, 0x11, 0xa7,
+    0x00, 0x00, 0x00, 0x2e, 0x94, 0x74, 0x00, 0x00,
+    0x00, 0x82, 0x45, 0x00, 0x00, 0xe6, 0x00, 0x00,
+    0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x00, 0xc1,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x14, 0x00, 0x00,
+    0x00, 0x4e, 0x1a, 0x00, 0x00, 0x00, 0x40, 0x17,
+    0xdc, 0x00, 0x00, 0x3d, 0x4f, 0x00, 0x00, 0x25,
+    0x00, 0x98, 0x80, 0x00, 0x00, 0x86, 0x00, 0x62,
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0xd7,
+    0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x61, 0x36,
+    0x00, 0x00, 0x00, 0x5b, 0x2b, 0xee, 0x00, 0x19,
+    0x20, 0x00, 0xaf, 0x00, 0x0e, 0xa4, 0x90, 0x00,
+    0x00, 0x03, 0x91, 0x69, 0x00, 0x00, 0x00, 0x6d,
+    0x47, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+    0x00, 0xc9, 0x79, 0x00, 0x00, 0x00, 0x6e, 0x00,
+    0x00, 0x00, 0xf3, 0x00, 0x3a, 0x00, 0x00, 0x4d,
+    0x1b, 0x00, 0x70, 0x00, 0x1d, 0x24, 0xbf, 0x00,
+    0x00, 0x12, 0xa8, 0x00, 0x00, 0x00, 0x2f, 0x95,
+    0x75, 0x00, 0x00, 0x00, 0x83, 0x55, 0x00, 0x00,
+    0x00, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0xd4, 0x00,
+    0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x00, 0xf7,
+    0x3e, 0x00, 0x00, 0x00, 0x6b, 0x33, 0x00, 0x00,
+    0x00, 0x5a, 0x28, 0xeb, 0x00, 0x00, 0x32, 0xcc,
+    0x44, 0x00, 0x00, 0x0b, 0x99, 0x8b, 0x00, 0x00};
+
+/* Map 875 (ISO-8859-7) */
+
+static unsigned char const charmap_875_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0xdc, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0xfd, 0xe1, 0xde, 0xb0, 0xce, 0xfc, 0xdf, 0xeb,
+    0x70, 0xfb, 0xed, 0xee, 0xef, 0xca, 0x6a, 0xcf,
+    0x90, 0xda, 0xea, 0xfa, 0xa0, 0x80, 0x71, 0xdd,
+    0x72, 0x73, 0x75, 0xfe, 0x76, 0xdb, 0x77, 0x78,
+    0xb4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x74, 0x59, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0xb1, 0xb2, 0xb3, 0xb5,
+    0xb8, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x9a,
+    0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xaa, 0xab, 0xac,
+    0xad, 0xae, 0xba, 0xaf, 0xbb, 0xbc, 0xbd, 0xbe,
+    0xbf, 0xcb, 0xcc, 0xcd, 0xb6, 0xb7, 0xb9, 0xec};
+
+static unsigned char const charmap_875_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0,
+    0xd1, 0xd3, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+    0xda, 0xdb, 0xae, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xa8, 0xb6, 0xb8, 0xb9, 0xd2, 0xba, 0xbc, 0xbe,
+    0xbf, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xb5, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec,
+    0xb4, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf3,
+    0xa3, 0xdc, 0xdd, 0xde, 0xc0, 0xdf, 0xfc, 0xfd,
+    0xe0, 0xfe, 0xf2, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf9, 0xfa, 0xfb, 0xa4, 0xaf,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb1, 0xbd, 0x7c, 0xb7, 0xa2, 0xa6,
+    0x5c, 0xa1, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xa7, 0xff, 0xaa, 0xab, 0xac,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xa9, 0xa5, 0xa0, 0xbb, 0x9f};
+
+static const unsigned char utf8map_875_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xce, 0x91, 0},
+    {2, 0xce, 0x92, 0},
+    {2, 0xce, 0x93, 0},
+    {2, 0xce, 0x94, 0},
+    {2, 0xce, 0x95, 0},
+    {2, 0xce, 0x96, 0},
+    {2, 0xce, 0x97, 0},
+    {2, 0xce, 0x98, 0},
+    {2, 0xce, 0x99, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xce, 0x9a, 0},
+    {2, 0xce, 0x9b, 0},
+    {2, 0xce, 0x9c, 0},
+    {2, 0xce, 0x9d, 0},
+    {2, 0xce, 0x9e, 0},
+    {2, 0xce, 0x9f, 0},
+    {2, 0xce, 0xa0, 0},
+    {2, 0xce, 0xa1, 0},
+    {2, 0xce, 0xa3, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xce, 0xa4, 0},
+    {2, 0xce, 0xa5, 0},
+    {2, 0xce, 0xa6, 0},
+    {2, 0xce, 0xa7, 0},
+    {2, 0xce, 0xa8, 0},
+    {2, 0xce, 0xa9, 0},
+    {2, 0xce, 0xaa, 0},
+    {2, 0xce, 0xab, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xce, 0x86, 0},
+    {2, 0xce, 0x88, 0},
+    {2, 0xce, 0x89, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xce, 0x8a, 0},
+    {2, 0xce, 0x8c, 0},
+    {2, 0xce, 0x8e, 0},
+    {2, 0xce, 0x8f, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xce, 0x85, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xce, 0xb1, 0},
+    {2, 0xce, 0xb2, 0},
+    {2, 0xce, 0xb3, 0},
+    {2, 0xce, 0xb4, 0},
+    {2, 0xce, 0xb5, 0},
+    {2, 0xce, 0xb6, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xce, 0xb7, 0},
+    {2, 0xce, 0xb8, 0},
+    {2, 0xce, 0xb9, 0},
+    {2, 0xce, 0xba, 0},
+    {2, 0xce, 0xbb, 0},
+    {2, 0xce, 0xbc, 0},
+    {2, 0xce, 0x84, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xce, 0xbd, 0},
+    {2, 0xce, 0xbe, 0},
+    {2, 0xce, 0xbf, 0},
+    {2, 0xcf, 0x80, 0},
+    {2, 0xcf, 0x81, 0},
+    {2, 0xcf, 0x83, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xce, 0xac, 0},
+    {2, 0xce, 0xad, 0},
+    {2, 0xce, 0xae, 0},
+    {2, 0xce, 0x90, 0},
+    {2, 0xce, 0xaf, 0},
+    {2, 0xcf, 0x8c, 0},
+    {2, 0xcf, 0x8d, 0},
+    {2, 0xce, 0xb0, 0},
+    {2, 0xcf, 0x8e, 0},
+    {2, 0xcf, 0x82, 0},
+    {2, 0xcf, 0x84, 0},
+    {2, 0xcf, 0x85, 0},
+    {2, 0xcf, 0x86, 0},
+    {2, 0xcf, 0x87, 0},
+    {2, 0xcf, 0x88, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xcf, 0x89, 0},
+    {2, 0xcf, 0x8a, 0},
+    {2, 0xcf, 0x8b, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {3, 0xe2, 0x80, 0x95},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xbd, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x5c, 0, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc2, 0xa7, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xcd, 0xba, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc2, 0xa9, 0},
+    {3, 0xe2, 0x82, 0xaf},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_875_keys[512] = {
+    0x0000, 0x03b9, 0x038a, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ab,
+    0x007c, 0x004d, 0x001e, 0xffff, 0x03a8, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x009a, 0x006b, 0x003c, 0x000d, 0x03c6, 0x0397,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0089, 0x005a, 0x002b,
+    0xffff, 0x03b5, 0x0386, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a7,
+    0x0078, 0x0049, 0xffff, 0x001a, 0xffff, 0x03a4, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0096, 0x0067, 0x0038, 0x0009, 0x03c2,
+    0x0393, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0085, 0x0056,
+    0x0027, 0xffff, 0x03b1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00a3, 0x0074, 0x0045, 0x0016, 0xffff, 0x03a0, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0092, 0x0063, 0xffff, 0x0034, 0x0005,
+    0x03be, 0x038f, 0x20ac, 0xffff, 0xffff, 0xffff, 0x00b0, 0x0081,
+    0x0052, 0x0023, 0xffff, 0x03ad, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x009f, 0x0070, 0x0041, 0x0012, 0x03cb, 0x039c, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00bd, 0x008e, 0x005f, 0x0030, 0x0001,
+    0x03ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ac, 0xffff,
+    0x007d, 0x004e, 0x001f, 0xffff, 0x03a9, 0x037a, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x009b, 0x006c, 0x003d, 0x000e, 0x03c7, 0x0398,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x008a, 0x005b, 0x002c,
+    0xffff, 0x03b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a8,
+    0x0079, 0x004a, 0x001b, 0xffff, 0x03a5, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0097, 0x0068, 0x0039, 0x000a, 0x03c3,
+    0x0394, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0086, 0x0057,
+    0x0028, 0xffff, 0x03b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0075, 0x0046, 0x0017, 0xffff, 0x03a1, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0093, 0x0064, 0x0035, 0x0006, 0x03bf,
+    0x0390, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b1, 0x0082,
+    0x0053, 0x0024, 0xffff, 0x03ae, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00a0, 0x0071, 0x0042, 0x0013, 0x03cc, 0x039d, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x008f, 0x0060, 0x0031, 0x0002,
+    0x03bb, 0x038c, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ad, 0x007e,
+    0x004f, 0x0020, 0xffff, 0x03aa, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x009c, 0x006d, 0x003e, 0x000f, 0x03c8, 0x0399,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x008b, 0x005c, 0x002d,
+    0xffff, 0x03b7, 0x0388, 0xffff, 0xffff, 0xffff, 0x2018, 0x00a9,
+    0x007a, 0x004b, 0x001c, 0xffff, 0x03a6, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0098, 0x0069, 0x003a, 0x000b, 0x03c4, 0x0395,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0087, 0x0058,
+    0x0029, 0xffff, 0x03b3, 0x0384, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0047, 0x0018, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0094, 0x0065, 0x0036, 0x0007, 0x03c0,
+    0x0391, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b2, 0x0083, 0x0054,
+    0x0025, 0xffff, 0x03af, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0072, 0x0043, 0x0014, 0x03cd, 0x039e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0090, 0x0061, 0x0032, 0x0003,
+    0x03bc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0050, 0x0021, 0xffff, 0x03ab, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x009d, 0x006e, 0x003f, 0x0010, 0x03c9, 0xffff, 0x039a,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00bb, 0x008c, 0x005d, 0x002e,
+    0xffff, 0x03b8, 0x0389, 0xffff, 0xffff, 0xffff, 0x2019, 0xffff,
+    0x007b, 0x004c, 0x001d, 0xffff, 0x03a7, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0099, 0x006a, 0x003b, 0x000c, 0x03c5, 0x0396,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00b7, 0x0088, 0x0059, 0x002a,
+    0xffff, 0xffff, 0x03b4, 0x0385, 0xffff, 0xffff, 0xffff, 0x2015,
+    0x00a6, 0x0077, 0x0048, 0x0019, 0xffff, 0x03a3, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0095, 0x0066, 0x0037, 0x0008, 0x03c1,
+    0x0392, 0x20af, 0xffff, 0xffff, 0xffff, 0x00b3, 0x0084, 0x0055,
+    0x0026, 0xffff, 0x03b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0073, 0x0044, 0x0015, 0xffff, 0x03ce, 0x039f, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0091, 0x0062, 0x0033, 0x0004,
+    0x03bd, 0x038e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0080,
+    0x0051, 0x0022, 0xffff, 0x03ac, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x009e, 0x006f, 0x0040, 0x0011, 0x03ca, 0x039b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x008d, 0x005e, 0x002f, 0xffff};
+
+static const unsigned char utf8map_875_values[512] = {
+    0x00, 0x9c, 0x75, 0x00, 0x00, 0x00, 0x00, 0xee,
+    0xdc, 0xd4, 0x1e, 0x00, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3a, 0x92, 0x4c, 0x0d, 0xbd, 0x47,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xe9, 0x4e,
+    0x00, 0x8e, 0x71, 0x00, 0x00, 0x00, 0x00, 0xeb,
+    0xa7, 0xc9, 0x00, 0x3f, 0x00, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x87, 0xf8, 0x05, 0xba,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe5,
+    0x7d, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0xa3, 0xc5, 0x32, 0x00, 0x57, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0x83, 0x00, 0xf4, 0x2d,
+    0xab, 0x78, 0xce, 0x00, 0x00, 0x00, 0x90, 0x21,
+    0xd9, 0x7b, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x97, 0xc1, 0x12, 0xcd, 0x53, 0x00,
+    0x00, 0x00, 0x00, 0xdb, 0x0a, 0x6d, 0xf0, 0x01,
+    0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00,
+    0xd0, 0xd5, 0x1f, 0x00, 0x67, 0xed, 0x00, 0x00,
+    0x00, 0x00, 0x3b, 0x93, 0x7e, 0x0e, 0xbe, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x4a, 0x6b,
+    0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xa8, 0xd1, 0x27, 0x00, 0x63, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x88, 0xf9, 0x25, 0xaf,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe6,
+    0x4d, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa4, 0xc6, 0x26, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x84, 0xf5, 0x2e, 0xac,
+    0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x22,
+    0xe2, 0x5b, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0x98, 0xc2, 0x13, 0xb6, 0x54, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x79, 0xf1, 0x02,
+    0x9e, 0x76, 0x00, 0x00, 0x00, 0x00, 0xca, 0xa1,
+    0xd6, 0x40, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x94, 0x6e, 0x0f, 0xbf, 0x49,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe0, 0x60,
+    0x00, 0x9a, 0x72, 0x00, 0x00, 0x00, 0xe1, 0xfb,
+    0xa9, 0xd2, 0x1c, 0x00, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x89, 0x7a, 0x0b, 0xbb, 0x45,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xe7,
+    0x5d, 0x00, 0x8c, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0xc7, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x34, 0x85, 0xf6, 0x2f, 0xad,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0xea, 0x23, 0xe3,
+    0x6c, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0xc3, 0x3c, 0xb7, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x81, 0xf2, 0x03,
+    0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xd7, 0x4f, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x95, 0x6f, 0x10, 0xcb, 0x00, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x2c, 0x5a, 0x4b,
+    0x00, 0x9b, 0x73, 0x00, 0x00, 0x00, 0xde, 0x00,
+    0xc0, 0xd3, 0x1d, 0x00, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x39, 0x91, 0x5e, 0x0c, 0xbc, 0x46,
+    0x00, 0x00, 0x00, 0x00, 0xdd, 0x28, 0xe8, 0x5c,
+    0x00, 0x00, 0x8d, 0x80, 0x00, 0x00, 0x00, 0xcf,
+    0xdf, 0xa6, 0xc8, 0x19, 0x00, 0x59, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0x86, 0xf7, 0x16, 0xae,
+    0x42, 0xfc, 0x00, 0x00, 0x00, 0xfa, 0x24, 0xe4,
+    0x50, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa2, 0xc4, 0x3d, 0x00, 0xb9, 0x56, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x82, 0xf3, 0x37,
+    0xaa, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xd8, 0x7f, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3e, 0x96, 0x7c, 0x11, 0xcc, 0x52, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x61, 0x00};
+
+/* Map 424 (ISO-8859-8) */
+
+static unsigned char const charmap_424_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xba, 0xe0, 0xbb, 0xb0, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x74, 0x9e, 0x4a, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0xbf, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x78, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0xe1, 0x8b, 0xb7, 0xb8, 0xb9, 0xaa,
+    0x8e, 0xab, 0xac, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x9b, 0x77, 0xad, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x8f, 0x73, 0x8c, 0x8d, 0xae, 0x72, 0x80, 0x9c,
+    0x70, 0x76, 0x9a, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x71, 0xfb, 0xfc, 0xfd, 0xfe, 0x75};
+
+static unsigned char const charmap_424_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xa2, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xd8, 0xfa, 0xd5, 0xd1, 0xa0, 0xff, 0xd9, 0xc9,
+    0xb1, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xd2, 0xd3, 0xc0, 0xd0,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xda, 0xc8, 0xd7, 0xb8, 0xa1, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xbf, 0xc1, 0xc2, 0xca, 0xd4, 0xae,
+    0x5e, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5b, 0x5d, 0xaf, 0xa8, 0xb4, 0xaa,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0x5c, 0xba, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xfb, 0xfc, 0xfd, 0xfe, 0x9f};
+
+static const unsigned char utf8map_424_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xd7, 0x90, 0},
+    {2, 0xd7, 0x91, 0},
+    {2, 0xd7, 0x92, 0},
+    {2, 0xd7, 0x93, 0},
+    {2, 0xd7, 0x94, 0},
+    {2, 0xd7, 0x95, 0},
+    {2, 0xd7, 0x96, 0},
+    {2, 0xd7, 0x97, 0},
+    {2, 0xd7, 0x98, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xd7, 0x99, 0},
+    {2, 0xd7, 0x9a, 0},
+    {2, 0xd7, 0x9b, 0},
+    {2, 0xd7, 0x9c, 0},
+    {2, 0xd7, 0x9d, 0},
+    {2, 0xd7, 0x9e, 0},
+    {2, 0xd7, 0x9f, 0},
+    {2, 0xd7, 0xa0, 0},
+    {2, 0xd7, 0xa1, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xd7, 0xa2, 0},
+    {2, 0xd7, 0xa3, 0},
+    {2, 0xd7, 0xa4, 0},
+    {2, 0xd7, 0xa5, 0},
+    {2, 0xd7, 0xa6, 0},
+    {2, 0xd7, 0xa7, 0},
+    {2, 0xd7, 0xa8, 0},
+    {2, 0xd7, 0xa9, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd7, 0xaa, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x97},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x8e},
+    {3, 0xe2, 0x80, 0x8f},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_424_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0x00ac, 0xffff, 0x006f, 0x0032,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0064, 0x0027,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0096, 0xffff, 0x0059,
+    0x001c, 0x2017, 0x05e5, 0xffff, 0xffff, 0xffff, 0x008b, 0x004e,
+    0xffff, 0x0011, 0xffff, 0x05da, 0xffff, 0x00bd, 0xffff, 0x0080,
+    0x0043, 0x0006, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b2, 0x0075,
+    0xffff, 0x0038, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a7,
+    0x006a, 0x002d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x009c,
+    0xffff, 0x005f, 0x0022, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0091, 0x0054, 0xffff, 0x0017, 0x05e0, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0086, 0x0049, 0x000c, 0xffff, 0x05d5, 0xffff, 0xffff,
+    0x00b8, 0x007b, 0xffff, 0x003e, 0x0001, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00ad, 0x0070, 0x0033, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00a2, 0x0065, 0xffff, 0x0028, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0097, 0x005a, 0x001d, 0xffff, 0x05e6, 0xffff,
+    0xffff, 0xffff, 0x008c, 0xffff, 0x004f, 0x0012, 0xffff, 0x05db,
+    0xffff, 0xffff, 0x00be, 0x0081, 0x0044, 0xffff, 0x0007, 0xffff,
+    0x05d0, 0xffff, 0x00b3, 0xffff, 0x0076, 0x0039, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00a8, 0x006b, 0xffff, 0x002e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x009d, 0x0060, 0x0023, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0092, 0xffff, 0x0055, 0x0018,
+    0xffff, 0x05e1, 0xffff, 0xffff, 0xffff, 0x0087, 0x004a, 0x000d,
+    0xffff, 0x05d6, 0xffff, 0xffff, 0x00b9, 0xffff, 0x007c, 0x003f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ae, 0x0071, 0x0034,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a3, 0xffff, 0x0066,
+    0x0029, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0098, 0x005b,
+    0xffff, 0x001e, 0xffff, 0x05e7, 0xffff, 0xffff, 0xffff, 0x008d,
+    0x0050, 0x0013, 0x200e, 0x05dc, 0xffff, 0xffff, 0xffff, 0x0082,
+    0xffff, 0x0045, 0x0008, 0xffff, 0x05d1, 0xffff, 0xffff, 0x00b4,
+    0x0077, 0x003a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a9,
+    0xffff, 0x006c, 0x002f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x009e, 0x0061, 0xffff, 0x0024, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0093, 0x0056, 0x0019, 0xffff, 0x05e2, 0xffff, 0xffff,
+    0xffff, 0x0088, 0x004b, 0xffff, 0x000e, 0xffff, 0x05d7, 0x00f7,
+    0xffff, 0xffff, 0x007d, 0x0040, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00af, 0x0072, 0xffff, 0x0035, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x00a4, 0x0067, 0x002a, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0099, 0xffff, 0x005c, 0x001f, 0xffff, 0x05e8,
+    0xffff, 0xffff, 0xffff, 0x008e, 0x0051, 0xffff, 0x0014, 0x200f,
+    0x05dd, 0xffff, 0xffff, 0xffff, 0x0083, 0x0046, 0x0009, 0xffff,
+    0x05d2, 0xffff, 0xffff, 0x00b5, 0x0078, 0xffff, 0x003b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x006d, 0x0030, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x009f, 0xffff, 0x0062, 0x0025,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0094, 0x0057, 0x001a,
+    0xffff, 0x05e3, 0xffff, 0xffff, 0xffff, 0x0089, 0xffff, 0x004c,
+    0x000f, 0xffff, 0x05d8, 0xffff, 0xffff, 0x00bb, 0x007e, 0x0041,
+    0xffff, 0x0004, 0xffff, 0xffff, 0xffff, 0x00b0, 0xffff, 0x0073,
+    0x0036, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a5, 0x0068,
+    0xffff, 0x002b, 0xffff, 0xffff, 0xffff, 0x00d7, 0xffff, 0x009a,
+    0x005d, 0x0020, 0xffff, 0x05e9, 0xffff, 0xffff, 0xffff, 0x008f,
+    0xffff, 0x0052, 0x0015, 0xffff, 0x05de, 0xffff, 0xffff, 0xffff,
+    0x0084, 0x0047, 0xffff, 0x000a, 0x05d3, 0xffff, 0xffff, 0x00b6,
+    0xffff, 0x0079, 0x003c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00ab, 0x006e, 0xffff, 0x0031, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00a0, 0x0063, 0x0026, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0095, 0x0058, 0xffff, 0x001b, 0xffff, 0x05e4, 0xffff,
+    0xffff, 0xffff, 0x008a, 0x004d, 0x0010, 0xffff, 0x05d9, 0xffff,
+    0xffff, 0x00bc, 0x007f, 0xffff, 0x0042, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x00b1, 0x0074, 0x0037, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x00a6, 0xffff, 0x0069, 0x002c, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x009b, 0x005e, 0xffff, 0x0021, 0x05ea,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0090, 0x0053, 0x0016, 0xffff,
+    0x05df, 0xffff, 0xffff, 0xffff, 0x0085, 0xffff, 0x0048, 0x000b,
+    0xffff, 0x05d4, 0xffff, 0xffff, 0x00b7, 0x007a, 0x003d, 0xffff};
+
+static const unsigned char utf8map_424_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x96, 0xf2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x7d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0xe8,
+    0x1c, 0xdf, 0x65, 0x00, 0x00, 0x00, 0x2b, 0xd5,
+    0x00, 0x11, 0x00, 0x52, 0x00, 0xb8, 0x00, 0x20,
+    0xc3, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xea, 0xa4,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5,
+    0x91, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xe3, 0x00, 0x26, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xc9, 0x0c, 0x00, 0x46, 0x00, 0x00,
+    0x9d, 0xc0, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xca, 0x97, 0xf3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4a, 0x85, 0x00, 0x4d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xe9, 0x1d, 0x00, 0x66, 0x00,
+    0x00, 0x00, 0x2c, 0x00, 0xd6, 0x12, 0x00, 0x53,
+    0x00, 0x00, 0xb9, 0x21, 0xc4, 0x00, 0x2f, 0x00,
+    0x41, 0x00, 0xfa, 0x00, 0xa5, 0xf9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbd, 0x92, 0x00, 0x4b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x79, 0x7b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0xe4, 0x18,
+    0x00, 0x59, 0x00, 0x00, 0x00, 0x17, 0xd1, 0x0d,
+    0x00, 0x47, 0x00, 0x00, 0xda, 0x00, 0x4f, 0x6f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x98, 0xf4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x86,
+    0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xba,
+    0x00, 0x1e, 0x00, 0x67, 0x00, 0x00, 0x00, 0x09,
+    0xd7, 0x13, 0xfd, 0x54, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0xc5, 0x16, 0x00, 0x42, 0x00, 0x00, 0xbe,
+    0xa6, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4,
+    0x00, 0x93, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3e, 0x81, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0xe5, 0x19, 0x00, 0x62, 0x00, 0x00,
+    0x00, 0x28, 0xd2, 0x00, 0x0e, 0x00, 0x48, 0xe1,
+    0x00, 0x00, 0xd0, 0x7c, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xbc, 0x99, 0x00, 0xf5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9f, 0x87, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x39, 0x00, 0xe0, 0x1f, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x0a, 0xd8, 0x00, 0x3c, 0xfe,
+    0x55, 0x00, 0x00, 0x00, 0x23, 0xc6, 0x05, 0x00,
+    0x43, 0x00, 0x00, 0xa0, 0xa7, 0x00, 0x5e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x82, 0x6c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe6, 0x3f,
+    0x00, 0x63, 0x00, 0x00, 0x00, 0x29, 0x00, 0xd3,
+    0x0f, 0x00, 0x49, 0x00, 0x00, 0x8b, 0xa1, 0xc1,
+    0x00, 0x37, 0x00, 0x00, 0x00, 0x90, 0x00, 0xa2,
+    0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x88,
+    0x00, 0x4e, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x3a,
+    0xbb, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0xd9, 0x3d, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x24, 0xc7, 0x00, 0x25, 0x44, 0x00, 0x00, 0xb6,
+    0x00, 0xa8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8a, 0x95, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x74, 0x83, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x35, 0xe7, 0x00, 0x27, 0x00, 0x64, 0x00,
+    0x00, 0x00, 0x2a, 0xd4, 0x10, 0x00, 0x51, 0x00,
+    0x00, 0xb7, 0x07, 0x00, 0xc2, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0xa3, 0xf7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6a, 0x00, 0x89, 0x6b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3b, 0xb0, 0x00, 0x5a, 0x71,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xe2, 0x32, 0x00,
+    0x57, 0x00, 0x00, 0x00, 0x15, 0x00, 0xc8, 0x0b,
+    0x00, 0x45, 0x00, 0x00, 0xb3, 0xa9, 0x7e, 0x00};
+
+/* Map 1026 (ISO-8859-9) */
+
+static unsigned char const charmap_1026_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0xfc, 0xec, 0xad, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xae, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x68, 0xdc, 0xac, 0x5f, 0x6d,
+    0x8d, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x48, 0xbb, 0x8c, 0xcc, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x8e, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0x9d,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x52, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x4a,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x5a, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x7b, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0x7f, 0x5b, 0x7c, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xc0,
+    0x54, 0x51, 0x57, 0x53, 0x58, 0x55, 0x56, 0xbc,
+    0xd0, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xa1, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xe0, 0x79, 0x6a, 0xdf};
+
+static unsigned char const charmap_1026_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0x7b, 0xf1, 0xc7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xb8, 0xeb, 0xe8, 0xed, 0xee, 0xea,
+    0xec, 0xdf, 0xd0, 0xdd, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0x5b, 0xd1, 0xfe, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xfd, 0x3a, 0xd6, 0xde, 0x27, 0x3d, 0xdc,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0x7d, 0x60, 0xa6, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xaf, 0xc6, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0x5d, 0x24, 0x40, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xef, 0xa8, 0xb4, 0xd7,
+    0xe7, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xf5,
+    0xf0, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x5c, 0xf9, 0xfa, 0xff,
+    0xfc, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x23, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x22, 0xd9, 0xda, 0x9f};
+
+static const unsigned char utf8map_1026_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0x9c, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0x86, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0x97, 0},
+    {2, 0xc2, 0x8d, 0},
+    {2, 0xc2, 0x8e, 0},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc2, 0x9d, 0},
+    {2, 0xc2, 0x85, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0x87, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {2, 0xc2, 0x92, 0},
+    {2, 0xc2, 0x8f, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0x80, 0},
+    {2, 0xc2, 0x81, 0},
+    {2, 0xc2, 0x82, 0},
+    {2, 0xc2, 0x83, 0},
+    {2, 0xc2, 0x84, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc2, 0x88, 0},
+    {2, 0xc2, 0x89, 0},
+    {2, 0xc2, 0x8a, 0},
+    {2, 0xc2, 0x8b, 0},
+    {2, 0xc2, 0x8c, 0},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc2, 0x90, 0},
+    {2, 0xc2, 0x91, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0x93, 0},
+    {2, 0xc2, 0x94, 0},
+    {2, 0xc2, 0x95, 0},
+    {2, 0xc2, 0x96, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0x98, 0},
+    {2, 0xc2, 0x99, 0},
+    {2, 0xc2, 0x9a, 0},
+    {2, 0xc2, 0x9b, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {2, 0xc2, 0x9e, 0},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc4, 0x9e, 0},
+    {2, 0xc4, 0xb0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc5, 0x9f, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc4, 0xb1, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x9e, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa7, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc4, 0x9f, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc2, 0x9f, 0}};
+
+static const Tn5250Uint16 utf8map_1026_keys[512] = {
+    0x0000, 0xffff, 0x00c7, 0x005b, 0xffff, 0xffff, 0xffff, 0x00b6,
+    0x004a, 0xffff, 0xffff, 0xffff, 0x00a5, 0x0039, 0xffff, 0xffff,
+    0xffff, 0x0094, 0x0028, 0xffff, 0xffff, 0x00ef, 0x0083, 0x0017,
+    0xffff, 0xffff, 0xffff, 0x0072, 0x0006, 0xffff, 0xffff, 0x00cd,
+    0x0061, 0xffff, 0xffff, 0xffff, 0x00bc, 0x0050, 0xffff, 0xffff,
+    0x00ab, 0xffff, 0x003f, 0xffff, 0xffff, 0x009a, 0x002e, 0xffff,
+    0xffff, 0x00f5, 0x0089, 0x001d, 0xffff, 0xffff, 0x00e4, 0x0078,
+    0x000c, 0xffff, 0xffff, 0x00d3, 0x0067, 0xffff, 0xffff, 0xffff,
+    0x00c2, 0x0056, 0xffff, 0xffff, 0xffff, 0x00b1, 0x0045, 0xffff,
+    0xffff, 0xffff, 0x00a0, 0x0034, 0xffff, 0xffff, 0x00fb, 0x008f,
+    0x0023, 0xffff, 0x00ea, 0xffff, 0x007e, 0x0012, 0xffff, 0x00d9,
+    0x006d, 0xffff, 0x0001, 0xffff, 0x00c8, 0x005c, 0xffff, 0xffff,
+    0xffff, 0x00b7, 0x004b, 0xffff, 0xffff, 0xffff, 0x00a6, 0x003a,
+    0xffff, 0xffff, 0xffff, 0x0095, 0x0029, 0xffff, 0xffff, 0xffff,
+    0x0084, 0x0018, 0xffff, 0xffff, 0x00df, 0x0073, 0x0007, 0xffff,
+    0xffff, 0x00ce, 0x0062, 0xffff, 0xffff, 0xffff, 0x00bd, 0x0051,
+    0xffff, 0xffff, 0x00ac, 0xffff, 0x0040, 0xffff, 0xffff, 0x009b,
+    0xffff, 0x002f, 0xffff, 0x00f6, 0x008a, 0x001e, 0xffff, 0xffff,
+    0x00e5, 0x0079, 0x000d, 0xffff, 0xffff, 0x00d4, 0x0068, 0xffff,
+    0xffff, 0xffff, 0x00c3, 0x0057, 0xffff, 0xffff, 0x011e, 0x00b2,
+    0x0046, 0xffff, 0xffff, 0xffff, 0x00a1, 0x0035, 0xffff, 0xffff,
+    0x00fc, 0x0090, 0x0024, 0xffff, 0xffff, 0x00eb, 0x007f, 0x0013,
+    0xffff, 0x00da, 0xffff, 0x006e, 0x0002, 0xffff, 0x00c9, 0x005d,
+    0xffff, 0xffff, 0xffff, 0x00b8, 0x004c, 0xffff, 0xffff, 0xffff,
+    0x00a7, 0x003b, 0xffff, 0xffff, 0xffff, 0x0096, 0x002a, 0xffff,
+    0xffff, 0x00f1, 0x0085, 0x0019, 0xffff, 0xffff, 0x00e0, 0x0074,
+    0x0008, 0xffff, 0xffff, 0x00cf, 0x0063, 0xffff, 0xffff, 0xffff,
+    0x00be, 0x0052, 0xffff, 0xffff, 0xffff, 0x00ad, 0x0041, 0xffff,
+    0xffff, 0x009c, 0xffff, 0x0030, 0xffff, 0x00f7, 0x008b, 0x001f,
+    0xffff, 0xffff, 0x00e6, 0x007a, 0x000e, 0xffff, 0xffff, 0x00d5,
+    0x0069, 0xffff, 0xffff, 0x0130, 0x00c4, 0x0058, 0xffff, 0xffff,
+    0x011f, 0x00b3, 0x0047, 0xffff, 0xffff, 0xffff, 0x00a2, 0x0036,
+    0xffff, 0xffff, 0xffff, 0x0091, 0x0025, 0xffff, 0xffff, 0x00ec,
+    0x0080, 0x0014, 0xffff, 0x00db, 0xffff, 0x006f, 0x0003, 0xffff,
+    0x00ca, 0xffff, 0x005e, 0xffff, 0xffff, 0x00b9, 0x004d, 0xffff,
+    0xffff, 0xffff, 0x00a8, 0x003c, 0xffff, 0xffff, 0xffff, 0x0097,
+    0x002b, 0xffff, 0x015e, 0x00f2, 0x0086, 0x001a, 0xffff, 0xffff,
+    0x00e1, 0x0075, 0x0009, 0xffff, 0xffff, 0xffff, 0x0064, 0xffff,
+    0xffff, 0xffff, 0x00bf, 0x0053, 0xffff, 0xffff, 0xffff, 0x00ae,
+    0x0042, 0xffff, 0xffff, 0xffff, 0x009d, 0x0031, 0xffff, 0x00f8,
+    0x008c, 0xffff, 0x0020, 0xffff, 0x00e7, 0x007b, 0x000f, 0xffff,
+    0xffff, 0x00d6, 0x006a, 0xffff, 0xffff, 0x0131, 0x00c5, 0x0059,
+    0xffff, 0xffff, 0xffff, 0x00b4, 0x0048, 0xffff, 0xffff, 0xffff,
+    0x00a3, 0x0037, 0xffff, 0xffff, 0xffff, 0x0092, 0x0026, 0xffff,
+    0xffff, 0x00ed, 0x0081, 0x0015, 0xffff, 0xffff, 0x00dc, 0x0070,
+    0x0004, 0xffff, 0x00cb, 0xffff, 0x005f, 0xffff, 0xffff, 0x00ba,
+    0x004e, 0xffff, 0xffff, 0xffff, 0x00a9, 0x003d, 0xffff, 0xffff,
+    0xffff, 0x0098, 0x002c, 0xffff, 0x015f, 0x00f3, 0x0087, 0x001b,
+    0xffff, 0xffff, 0x00e2, 0x0076, 0x000a, 0xffff, 0xffff, 0x00d1,
+    0x0065, 0xffff, 0xffff, 0xffff, 0x00c0, 0x0054, 0xffff, 0xffff,
+    0xffff, 0x00af, 0x0043, 0xffff, 0xffff, 0xffff, 0x009e, 0x0032,
+    0xffff, 0x00f9, 0xffff, 0x008d, 0x0021, 0xffff, 0x00e8, 0x007c,
+    0xffff, 0x0010, 0xffff, 0x00d7, 0x006b, 0xffff, 0xffff, 0xffff,
+    0x00c6, 0x005a, 0xffff, 0xffff, 0xffff, 0x00b5, 0x0049, 0xffff,
+    0xffff, 0xffff, 0x00a4, 0x0038, 0xffff, 0xffff, 0x00ff, 0x0093,
+    0x0027, 0xffff, 0xffff, 0x00ee, 0x0082, 0x0016, 0xffff, 0xffff,
+    0xffff, 0x0071, 0x0005, 0xffff, 0xffff, 0x00cc, 0x0060, 0xffff,
+    0xffff, 0x00bb, 0xffff, 0x004f, 0xffff, 0xffff, 0x00aa, 0x003e,
+    0xffff, 0xffff, 0xffff, 0x0099, 0x002d, 0xffff, 0xffff, 0x00f4,
+    0x0088, 0x001c, 0xffff, 0xffff, 0x00e3, 0x0077, 0x000b, 0xffff,
+    0xffff, 0x00d2, 0x0066, 0xffff, 0xffff, 0xffff, 0x00c1, 0x0055,
+    0xffff, 0xffff, 0xffff, 0x00b0, 0x0044, 0xffff, 0xffff, 0xffff,
+    0x009f, 0x0033, 0xffff, 0x00fa, 0xffff, 0x008e, 0x0022, 0xffff,
+    0x00e9, 0x007d, 0xffff, 0x0011, 0xffff, 0x00d8, 0x006c, 0xffff};
+
+static const unsigned char utf8map_1026_values[512] = {
+    0x00, 0x00, 0x4a, 0x68, 0x00, 0x00, 0x00, 0xb6,
+    0xd1, 0x00, 0x00, 0x00, 0xb2, 0xf9, 0x00, 0x00,
+    0x00, 0x34, 0x4d, 0x00, 0x00, 0xbc, 0x23, 0x26,
+    0x00, 0x00, 0x00, 0x99, 0x2e, 0x00, 0x00, 0x75,
+    0x81, 0x00, 0x00, 0x00, 0xb7, 0xd7, 0x00, 0x00,
+    0x8a, 0x00, 0x6f, 0x00, 0x00, 0x3a, 0x4b, 0x00,
+    0x00, 0xcf, 0x29, 0x1d, 0x00, 0x00, 0x43, 0xa7,
+    0x0c, 0x00, 0x00, 0xee, 0x87, 0x00, 0x00, 0x00,
+    0x62, 0xe5, 0x00, 0x00, 0x00, 0x8f, 0xc5, 0x00,
+    0x00, 0x00, 0x41, 0xf4, 0x00, 0x00, 0xdb, 0x1b,
+    0xec, 0x00, 0x57, 0x00, 0xcc, 0x12, 0x00, 0xfd,
+    0x94, 0x00, 0x01, 0x00, 0x74, 0xdc, 0x00, 0x00,
+    0x00, 0xb3, 0xd2, 0x00, 0x00, 0x00, 0x8e, 0x7a,
+    0x00, 0x00, 0x00, 0x35, 0x5d, 0x00, 0x00, 0x00,
+    0x24, 0x18, 0x00, 0x00, 0x59, 0xa2, 0x2f, 0x00,
+    0x00, 0x76, 0x82, 0x00, 0x00, 0x00, 0xb8, 0xd8,
+    0x00, 0x00, 0xba, 0x00, 0xae, 0x00, 0x00, 0x3b,
+    0x00, 0x61, 0x00, 0xa1, 0x2a, 0x1e, 0x00, 0x00,
+    0x47, 0xa8, 0x0d, 0x00, 0x00, 0xeb, 0x88, 0x00,
+    0x00, 0x00, 0x66, 0xe6, 0x00, 0x00, 0x5a, 0xea,
+    0xc6, 0x00, 0x00, 0x00, 0xaa, 0xf5, 0x00, 0x00,
+    0xe0, 0x30, 0xad, 0x00, 0x00, 0x53, 0x07, 0x13,
+    0x00, 0xfe, 0x00, 0x95, 0x02, 0x00, 0x71, 0xac,
+    0x00, 0x00, 0x00, 0x52, 0xd3, 0x00, 0x00, 0x00,
+    0xb5, 0x5e, 0x00, 0x00, 0x00, 0x36, 0x5c, 0x00,
+    0x00, 0x49, 0x15, 0x19, 0x00, 0x00, 0x44, 0xa3,
+    0x16, 0x00, 0x00, 0x77, 0x83, 0x00, 0x00, 0x00,
+    0xb9, 0xd9, 0x00, 0x00, 0x00, 0xca, 0xc1, 0x00,
+    0x00, 0x04, 0x00, 0xf0, 0x00, 0xe1, 0x2b, 0x1f,
+    0x00, 0x00, 0x9c, 0xa9, 0x0e, 0x00, 0x00, 0xef,
+    0x89, 0x00, 0x00, 0x5b, 0x63, 0xe7, 0x00, 0x00,
+    0xd0, 0xfa, 0xc7, 0x00, 0x00, 0x00, 0xb0, 0xf6,
+    0x00, 0x00, 0x00, 0x31, 0x6c, 0x00, 0x00, 0x58,
+    0x20, 0x3c, 0x00, 0xfb, 0x00, 0x96, 0x03, 0x00,
+    0x72, 0x00, 0x5f, 0x00, 0x00, 0xda, 0xd4, 0x00,
+    0x00, 0x00, 0xbd, 0x4c, 0x00, 0x00, 0x00, 0x08,
+    0x4e, 0x00, 0x7c, 0xcd, 0x06, 0x3f, 0x00, 0x00,
+    0x45, 0xa4, 0x05, 0x00, 0x00, 0x00, 0x84, 0x00,
+    0x00, 0x00, 0xab, 0xe2, 0x00, 0x00, 0x00, 0xaf,
+    0xc2, 0x00, 0x00, 0x00, 0x14, 0xf1, 0x00, 0x70,
+    0x2c, 0x00, 0x40, 0x00, 0xc0, 0x48, 0x0f, 0x00,
+    0x00, 0x7b, 0x91, 0x00, 0x00, 0x79, 0x67, 0xe8,
+    0x00, 0x00, 0x00, 0xbe, 0xc8, 0x00, 0x00, 0x00,
+    0xb1, 0xf7, 0x00, 0x00, 0x00, 0x1a, 0x50, 0x00,
+    0x00, 0x55, 0x21, 0x3d, 0x00, 0x00, 0x7f, 0x97,
+    0x37, 0x00, 0x73, 0x00, 0x6d, 0x00, 0x00, 0x9b,
+    0xd5, 0x00, 0x00, 0x00, 0xb4, 0x7e, 0x00, 0x00,
+    0x00, 0x38, 0x6b, 0x00, 0x6a, 0xce, 0x17, 0x27,
+    0x00, 0x00, 0x42, 0xa5, 0x25, 0x00, 0x00, 0x69,
+    0x85, 0x00, 0x00, 0x00, 0x64, 0xe3, 0x00, 0x00,
+    0x00, 0x9d, 0xc3, 0x00, 0x00, 0x00, 0x3e, 0xf2,
+    0x00, 0xdd, 0x00, 0x09, 0x4f, 0x00, 0x54, 0xbb,
+    0x00, 0x10, 0x00, 0xbf, 0x92, 0x00, 0x00, 0x00,
+    0x9e, 0xe9, 0x00, 0x00, 0x00, 0xa0, 0xc9, 0x00,
+    0x00, 0x00, 0x9f, 0xf8, 0x00, 0x00, 0xdf, 0x33,
+    0x7d, 0x00, 0x00, 0x56, 0x22, 0x32, 0x00, 0x00,
+    0x00, 0x98, 0x2d, 0x00, 0x00, 0x78, 0x8d, 0x00,
+    0x00, 0x8b, 0x00, 0xd6, 0x00, 0x00, 0x9a, 0x6e,
+    0x00, 0x00, 0x00, 0x39, 0x60, 0x00, 0x00, 0xcb,
+    0x28, 0x1c, 0x00, 0x00, 0x46, 0xa6, 0x0b, 0x00,
+    0x00, 0xed, 0x86, 0x00, 0x00, 0x00, 0x65, 0xe4,
+    0x00, 0x00, 0x00, 0x90, 0xc4, 0x00, 0x00, 0x00,
+    0xff, 0xf3, 0x00, 0xde, 0x00, 0x0a, 0xfc, 0x00,
+    0x51, 0x8c, 0x00, 0x11, 0x00, 0x80, 0x93, 0x00};
+
+/* Map 290 (JIS_X0201) */
+
+static unsigned char const charmap_290_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0xe0, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xda, 0x5b, 0xb9, 0x9b, 0x6d,
+    0x79, 0xb2, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0xdb, 0xdd, 0x5f, 0xcb, 0xb5,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0xdc, 0xb8, 0xb3, 0x4f, 0xde, 0xa1, 0x07,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x15, 0x06, 0x17,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x09, 0x0a, 0x1b,
+    0x30, 0x31, 0x1a, 0x33, 0x34, 0x35, 0x36, 0x08,
+    0x38, 0x39, 0x3a, 0x3b, 0x04, 0x14, 0x3e, 0xff,
+    0xa0, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x58, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8c, 0x8d, 0x8e, 0x8f, 0x90,
+    0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+    0x99, 0x9a, 0x9d, 0x9e, 0x9f, 0xa2, 0xa3, 0xa4,
+    0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xac, 0xad,
+    0xae, 0xaf, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xb4, 0xe1, 0x80, 0xb7, 0x8b, 0xab, 0x57, 0xb0,
+    0x59, 0xb1, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xdf, 0xc0, 0x4a, 0xcd, 0xce, 0xcf, 0xd0, 0x9c,
+    0xb6, 0xca, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xcc};
+
+static unsigned char const charmap_290_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9c, 0x09, 0x86, 0x7f,
+    0x97, 0x8d, 0x8e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9d, 0x85, 0x08, 0x87,
+    0x18, 0x19, 0x92, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x0a, 0x17, 0x1b,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x05, 0x06, 0x07,
+    0x90, 0x91, 0x16, 0x93, 0x94, 0x95, 0x96, 0x04,
+    0x98, 0x99, 0x9a, 0x9b, 0x14, 0x15, 0x9e, 0x1a,
+    0x20, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xf2, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xe6,
+    0xb0, 0xe8, 0x21, 0x5c, 0x2a, 0x29, 0x3b, 0x6d,
+    0x2d, 0x2f, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xe2, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xe4, 0xbb, 0xbc, 0xbd, 0xbe,
+    0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+    0xc7, 0xc8, 0xc9, 0x5e, 0xf7, 0xca, 0xcb, 0xcc,
+    0xa0, 0x7e, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2,
+    0xd3, 0xd4, 0xd5, 0xe5, 0xd6, 0xd7, 0xd8, 0xd9,
+    0xe7, 0xe9, 0x61, 0x7b, 0xe0, 0x6f, 0xf8, 0xe3,
+    0x7a, 0x5d, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xf1, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xf9, 0x6e, 0xff, 0xf3, 0xf4, 0xf5,
+    0xf6, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x5b, 0x6b, 0x79, 0x6c, 0x7d, 0xf0,
+    0x24, 0xe1, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x9f};
+
+static const unsigned char utf8map_290_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x09, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x08, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x04, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {3, 0xef, 0xbd, 0xa1},
+    {3, 0xef, 0xbd, 0xa2},
+    {3, 0xef, 0xbd, 0xa3},
+    {3, 0xef, 0xbd, 0xa4},
+    {3, 0xef, 0xbd, 0xa5},
+    {3, 0xef, 0xbd, 0xa6},
+    {3, 0xef, 0xbd, 0xa7},
+    {3, 0xef, 0xbd, 0xa8},
+    {3, 0xef, 0xbd, 0xa9},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {3, 0xef, 0xbd, 0xaa},
+    {3, 0xef, 0xbd, 0xab},
+    {3, 0xef, 0xbd, 0xac},
+    {3, 0xef, 0xbd, 0xad},
+    {3, 0xef, 0xbd, 0xae},
+    {3, 0xef, 0xbd, 0xaf},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbd, 0xb0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x21, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbd, 0xb1},
+    {3, 0xef, 0xbd, 0xb2},
+    {3, 0xef, 0xbd, 0xb3},
+    {3, 0xef, 0xbd, 0xb4},
+    {3, 0xef, 0xbd, 0xb5},
+    {3, 0xef, 0xbd, 0xb6},
+    {3, 0xef, 0xbd, 0xb7},
+    {3, 0xef, 0xbd, 0xb8},
+    {3, 0xef, 0xbd, 0xb9},
+    {3, 0xef, 0xbd, 0xba},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbd, 0xbb},
+    {3, 0xef, 0xbd, 0xbc},
+    {3, 0xef, 0xbd, 0xbd},
+    {3, 0xef, 0xbd, 0xbe},
+    {3, 0xef, 0xbd, 0xbf},
+    {3, 0xef, 0xbe, 0x80},
+    {3, 0xef, 0xbe, 0x81},
+    {3, 0xef, 0xbe, 0x82},
+    {3, 0xef, 0xbe, 0x83},
+    {3, 0xef, 0xbe, 0x84},
+    {3, 0xef, 0xbe, 0x85},
+    {3, 0xef, 0xbe, 0x86},
+    {3, 0xef, 0xbe, 0x87},
+    {3, 0xef, 0xbe, 0x88},
+    {3, 0xef, 0xbe, 0x89},
+    {1, 0x5e, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbe, 0x8a},
+    {3, 0xef, 0xbe, 0x8b},
+    {3, 0xef, 0xbe, 0x8c},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xbe},
+    {3, 0xef, 0xbe, 0x8d},
+    {3, 0xef, 0xbe, 0x8e},
+    {3, 0xef, 0xbe, 0x8f},
+    {3, 0xef, 0xbe, 0x90},
+    {3, 0xef, 0xbe, 0x91},
+    {3, 0xef, 0xbe, 0x92},
+    {3, 0xef, 0xbe, 0x93},
+    {3, 0xef, 0xbe, 0x94},
+    {3, 0xef, 0xbe, 0x95},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbe, 0x96},
+    {3, 0xef, 0xbe, 0x97},
+    {3, 0xef, 0xbe, 0x98},
+    {3, 0xef, 0xbe, 0x99},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x61, 0, 0},
+    {1, 0x7b, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x6f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7a, 0, 0},
+    {1, 0x5d, 0, 0},
+    {3, 0xef, 0xbe, 0x9a},
+    {3, 0xef, 0xbe, 0x9b},
+    {3, 0xef, 0xbe, 0x9c},
+    {3, 0xef, 0xbe, 0x9d},
+    {3, 0xef, 0xbe, 0x9e},
+    {3, 0xef, 0xbe, 0x9f},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x6e, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x7d, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x24, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd}};
+
+static const Tn5250Uint16 utf8map_290_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff9d,
+    0xff96, 0xffff, 0xff8f, 0xff88, 0xffff, 0xff81, 0xff7a, 0xffff,
+    0xff73, 0xffff, 0xff6c, 0xff65, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00a5, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007b, 0xffff, 0x0074,
+    0xffff, 0x006d, 0x0066, 0xffff, 0x005f, 0x0058, 0xffff, 0x0051,
+    0x004a, 0xffff, 0x0043, 0x003c, 0xffff, 0x0035, 0x002e, 0xffff,
+    0x0027, 0xffff, 0x0020, 0x0019, 0xffff, 0x0012, 0x000b, 0xffff,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xff9a, 0xff93, 0xffff, 0xff8c, 0xff85, 0xffff, 0xff7e,
+    0xff77, 0xffff, 0xff70, 0xff69, 0xffff, 0xff62, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007f, 0x0078,
+    0xffff, 0x0071, 0x006a, 0xffff, 0x0063, 0xffff, 0xffff, 0x0055,
+    0xffff, 0x004e, 0x0047, 0xffff, 0x0040, 0x0039, 0xffff, 0x0032,
+    0x002b, 0xffff, 0x0024, 0x001d, 0xffff, 0x0016, 0x000f, 0xffff,
+    0x0008, 0xffff, 0x0001, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xff9e, 0xff97, 0xffff, 0xff90, 0xff89, 0xffff, 0xff82,
+    0xffff, 0xff7b, 0xff74, 0xffff, 0xff6d, 0xff66, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007c,
+    0xffff, 0x0075, 0xffff, 0x006e, 0x0067, 0xffff, 0x0060, 0x0059,
+    0xffff, 0x0052, 0x004b, 0xffff, 0x0044, 0x003d, 0xffff, 0x0036,
+    0xffff, 0x002f, 0x0028, 0xffff, 0x0021, 0x001a, 0xffff, 0x0013,
+    0x000c, 0xffff, 0x0005, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xff9b, 0xff94, 0xffff, 0xff8d, 0xff86,
+    0xffff, 0xff7f, 0xff78, 0xffff, 0xff71, 0xff6a, 0xffff, 0xff63,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0079, 0xffff, 0x0072, 0x006b, 0xffff, 0x0064, 0x005d,
+    0xffff, 0x0056, 0xffff, 0x004f, 0x0048, 0xffff, 0x0041, 0x003a,
+    0xffff, 0x0033, 0x002c, 0xffff, 0x0025, 0x001e, 0xffff, 0x0017,
+    0xffff, 0x0010, 0x0009, 0xffff, 0x0002, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xff9f, 0xff98, 0xffff, 0xff91, 0xff8a,
+    0xffff, 0xff83, 0xffff, 0xff7c, 0xff75, 0xffff, 0xff6e, 0xff67,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x007d, 0x0076, 0xffff, 0x006f, 0x0068, 0xffff,
+    0x0061, 0x005a, 0xffff, 0x0053, 0x004c, 0xffff, 0x0045, 0x003e,
+    0xffff, 0x0037, 0xffff, 0x0030, 0x0029, 0xffff, 0x0022, 0x001b,
+    0xffff, 0x0014, 0x000d, 0xffff, 0x0006, 0xffff, 0xffff, 0xffff,
+    0x203e, 0xffff, 0xffff, 0xffff, 0xffff, 0xff9c, 0xff95, 0xffff,
+    0xff8e, 0xff87, 0xffff, 0xff80, 0xff79, 0xffff, 0xff72, 0xff6b,
+    0xffff, 0xff64, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x007a, 0xffff, 0x0073, 0x006c, 0xffff,
+    0x0065, 0xffff, 0x005e, 0x0057, 0xffff, 0x0050, 0x0049, 0xffff,
+    0x0042, 0x003b, 0xffff, 0x0034, 0x002d, 0xffff, 0x0026, 0x001f,
+    0xffff, 0x0018, 0xffff, 0x0011, 0x000a, 0xffff, 0x0003, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff99, 0xffff,
+    0xff92, 0xffff, 0xff8b, 0xff84, 0xffff, 0xff7d, 0xff76, 0xffff,
+    0xff6f, 0xff68, 0xffff, 0xff61, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0xffff, 0x0070,
+    0x0069, 0xffff, 0x0062, 0x005b, 0xffff, 0x0054, 0x004d, 0xffff,
+    0x0046, 0xffff, 0x003f, 0x0038, 0xffff, 0x0031, 0x002a, 0xffff,
+    0x0023, 0x001c, 0xffff, 0x0015, 0x000e, 0xffff, 0x0007, 0xffff};
+
+static const unsigned char utf8map_290_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd,
+    0xac, 0x00, 0xa4, 0x99, 0x00, 0x92, 0x8a, 0x00,
+    0x83, 0x00, 0x53, 0x45, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x74,
+    0x00, 0x5f, 0x66, 0x00, 0x6d, 0xe7, 0x00, 0xd8,
+    0xd1, 0x00, 0xc3, 0x4c, 0x00, 0xf5, 0x4b, 0x00,
+    0x7d, 0x00, 0x40, 0x19, 0x00, 0x12, 0x0b, 0x00,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0xa8, 0x00, 0x9f, 0x96, 0x00, 0x8f,
+    0x87, 0x00, 0x58, 0x49, 0x00, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78,
+    0x00, 0x71, 0x6a, 0x00, 0x63, 0x00, 0x00, 0xe4,
+    0x00, 0xd5, 0xc7, 0x00, 0x7c, 0xf9, 0x00, 0xf2,
+    0x4e, 0x00, 0xe0, 0x1d, 0x00, 0x32, 0x0f, 0x00,
+    0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xbe, 0xad, 0x00, 0xa5, 0x9a, 0x00, 0x93,
+    0x00, 0x8c, 0x84, 0x00, 0x54, 0x46, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+    0x00, 0x75, 0x00, 0xcb, 0x67, 0x00, 0x79, 0xe8,
+    0x00, 0xd9, 0xd2, 0x00, 0xc4, 0x7e, 0x00, 0xf6,
+    0x00, 0x61, 0x4d, 0x00, 0x5a, 0x3f, 0x00, 0x13,
+    0x0c, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbb, 0xa9, 0x00, 0xa2, 0x97,
+    0x00, 0x90, 0x88, 0x00, 0x81, 0x51, 0x00, 0x43,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdc, 0x00, 0x72, 0xdb, 0x00, 0x64, 0xb9,
+    0x00, 0xe5, 0x00, 0xd6, 0xc8, 0x00, 0xc1, 0x7a,
+    0x00, 0xf3, 0x6b, 0x00, 0x6c, 0x1e, 0x00, 0x26,
+    0x00, 0x10, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xa6, 0x9d,
+    0x00, 0x94, 0x00, 0x8d, 0x85, 0x00, 0x55, 0x47,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xde, 0x76, 0x00, 0xb5, 0x68, 0x00,
+    0xb2, 0xe9, 0x00, 0xe2, 0xd3, 0x00, 0xc5, 0x6e,
+    0x00, 0xf7, 0x00, 0xf0, 0x5d, 0x00, 0x7f, 0x27,
+    0x00, 0x3c, 0x0d, 0x00, 0x2e, 0x00, 0x00, 0x00,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xaa, 0x00,
+    0xa3, 0x98, 0x00, 0x91, 0x89, 0x00, 0x82, 0x52,
+    0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb8, 0x00, 0x73, 0xdd, 0x00,
+    0x65, 0x00, 0x9b, 0xe6, 0x00, 0xd7, 0xc9, 0x00,
+    0xc2, 0x5e, 0x00, 0xf4, 0x60, 0x00, 0x50, 0x1f,
+    0x00, 0x18, 0x00, 0x11, 0x25, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x00,
+    0xa7, 0x00, 0x9e, 0x95, 0x00, 0x8e, 0x86, 0x00,
+    0x56, 0x48, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x70,
+    0x69, 0x00, 0x62, 0xda, 0x00, 0xe3, 0xd4, 0x00,
+    0xc6, 0x00, 0x6f, 0xf8, 0x00, 0xf1, 0x5c, 0x00,
+    0x7b, 0x1c, 0x00, 0x3d, 0x0e, 0x00, 0x2f, 0x00};
+
+/* Map win37 (WINDOWS-1252) */
+
+static unsigned char const charmap_win37_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xba, 0xe0, 0xbb, 0xb0, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xa1, 0x07,
+    0x21, 0x22, 0x28, 0x2a, 0x23, 0x36, 0x06, 0x04,
+    0x14, 0x34, 0x17, 0x29, 0x30, 0x33, 0x3a, 0x20,
+    0x3b, 0x35, 0x2c, 0x0a, 0x1b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0x15, 0x24, 0x2b, 0x09, 0xff, 0x08,
+    0x41, 0xaa, 0x4a, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win37_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9a, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x94, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8f, 0x80, 0x81, 0x84, 0x9b, 0x0a, 0x17, 0x1b,
+    0x82, 0x8b, 0x83, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x89, 0x91, 0x85, 0x04,
+    0x97, 0x99, 0x8e, 0x90, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xa2, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0x5e, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5b, 0x5d, 0xaf, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win37_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x82, 0xac},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win37_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win37_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xa1, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0x4f, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x5a, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0xb0, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x7c, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xd0, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0x4a, 0x00, 0x00, 0x00, 0xc0, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x21,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0xbb,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0xba,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win256 (WINDOWS-1252) */
+
+static unsigned char const charmap_win256_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0xbb, 0xd0, 0xa1, 0x07,
+    0x29, 0x22, 0x28, 0xb4, 0x23, 0x36, 0x06, 0xe1,
+    0x14, 0x24, 0xbf, 0x20, 0x30, 0x33, 0x2a, 0x21,
+    0x34, 0x35, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0x15, 0x1b, 0x2b, 0x09, 0xff, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0x3a, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xb3,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xbc,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0x17,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0x04,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win256_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xf7, 0x09, 0x86, 0x7f,
+    0x9f, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9a, 0x08, 0xd7,
+    0x18, 0x19, 0x96, 0x9b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8b, 0x8f, 0x81, 0x84, 0x89, 0x0a, 0x17, 0x1b,
+    0x82, 0x80, 0x8e, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x91, 0x85, 0x04,
+    0x97, 0x99, 0xa9, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xaf, 0x83, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xb7, 0xa8, 0xb4, 0x8a,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0x87, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win256_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0xb0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc5, 0xbd, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc2, 0xa9, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win256_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win256_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xa1, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0x17, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xbc, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0xb4, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x7c, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xd0, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xb3, 0xb0, 0x00, 0x00, 0x00, 0xc0, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x29,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x5a,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0x04, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x4a,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win273 (WINDOWS-1252) */
+
+static unsigned char const charmap_win273_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xb5, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x63, 0xec, 0xfc, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x43, 0xbb, 0xdc, 0x59, 0x07,
+    0x1b, 0x22, 0x28, 0x24, 0x06, 0x20, 0x23, 0x04,
+    0x14, 0x21, 0x17, 0x35, 0x30, 0x33, 0x3a, 0x2a,
+    0x34, 0x36, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0xff, 0x29, 0x2b, 0x09, 0x15, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0xcc, 0x7c,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x4a, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xe0, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0x5a, 0xad, 0xae, 0xa1,
+    0x44, 0x45, 0x42, 0x46, 0xc0, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0x6a, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xd0, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win273_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x84, 0x7f,
+    0x9f, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9e, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x80, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x85, 0x89, 0x81, 0x86, 0x83, 0x0a, 0x17, 0x1b,
+    0x82, 0x9b, 0x8f, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x8b, 0x91, 0x04,
+    0x97, 0x99, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0x7b, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xc4, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0x7e, 0xdc, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0x5b, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0xa7, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xdf, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0x40, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xa6, 0xf2, 0xf3, 0xf5,
+    0xfc, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7d, 0xf9, 0xfa, 0xff,
+    0xd6, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x5c, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x5d, 0xd9, 0xda, 0x9a};
+
+static const unsigned char utf8map_win273_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc5, 0xbe, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x82, 0xac},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xa0},
+    {2, 0xc6, 0x92, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xe2, 0x80, 0x98},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x84, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xa1, 0}};
+
+static const Tn5250Uint16 utf8map_win273_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win273_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0x7c,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0x59, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x23, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0xc0, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x4a, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xec, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x24, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x00, 0x00, 0x00, 0x6a, 0x51, 0x5a, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0xb5, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0xcc, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xdc, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xe0, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x43, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x1b,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0xa1, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0xfc,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x20, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x63,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win277 (WINDOWS-1252) */
+
+static unsigned char const charmap_win277_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x4a, 0x67, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x80, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x9e, 0xe0, 0x9f, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x9c, 0xbb, 0x47, 0xdc, 0x07,
+    0x20, 0x22, 0x28, 0x2a, 0x2b, 0x36, 0x06, 0x24,
+    0x1b, 0x23, 0x17, 0x08, 0x30, 0x33, 0x3a, 0x21,
+    0x34, 0x38, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x35,
+    0x31, 0x39, 0x15, 0x14, 0xff, 0x09, 0x04, 0x29,
+    0x41, 0xaa, 0xb0, 0xb1, 0x5a, 0xb2, 0x70, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x5b, 0x7b, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x7c, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0xd0, 0xc0, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x6a, 0xdd, 0xde, 0xdb, 0xa1, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win277_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x9e, 0x09, 0x86, 0x7f,
+    0x8b, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9b, 0x9a, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x88, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x80, 0x8f, 0x81, 0x89, 0x87, 0x0a, 0x17, 0x1b,
+    0x82, 0x9f, 0x83, 0x84, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x97, 0x85, 0x04,
+    0x91, 0x99, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0x7d,
+    0xe7, 0xf1, 0x23, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa4, 0xc5, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0x24,
+    0xc7, 0xd1, 0xf8, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xa6, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0xc6, 0xd8, 0x27, 0x3d, 0x22,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0x7b, 0xb8, 0x5b, 0x5d,
+    0xb5, 0xfc, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe6, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0xe5, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7e, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9c};
+
+static const unsigned char utf8map_win277_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc5, 0xbe, 0},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xcb, 0x86, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc5, 0xb8, 0},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb8, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc2, 0xb8, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa6, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0x93, 0}};
+
+static const Tn5250Uint16 utf8map_win277_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win277_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0xc0, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xdc, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x4a, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2b, 0x00, 0x00, 0x00, 0xa1, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x7b, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0xff, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x80, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x70, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x67,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x35,
+    0x00, 0x00, 0xdf, 0xcd, 0xd0, 0x00, 0x7c, 0x73,
+    0xb9, 0x8f, 0x5a, 0x00, 0x00, 0x00, 0x47, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x9c, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x20,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x5b, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x9f,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x9e,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win278 (WINDOWS-1252) */
+
+static unsigned char const charmap_win278_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x63, 0x67, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xec, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xb5, 0xe0, 0x9f, 0x5f, 0x6d,
+    0x51, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x43, 0xbb, 0x47, 0xdc, 0x07,
+    0x09, 0x22, 0x28, 0x23, 0x06, 0x04, 0x2a, 0x24,
+    0x1b, 0x35, 0x17, 0x21, 0x30, 0x33, 0x3a, 0x20,
+    0x34, 0x36, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0x15, 0x14, 0x2b, 0x08, 0xff, 0x29,
+    0x41, 0xaa, 0xb0, 0xb1, 0x5a, 0xb2, 0xcc, 0x4a,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x7b, 0x5b, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x7c, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0xc0, 0xd0, 0x9c, 0x48,
+    0x54, 0x79, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0x6a, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xa1, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win278_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x85, 0x09, 0x84, 0x7f,
+    0x9d, 0x80, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9b, 0x9a, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x88, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8f, 0x8b, 0x81, 0x83, 0x87, 0x0a, 0x17, 0x1b,
+    0x82, 0x9f, 0x86, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x89, 0x91, 0x04,
+    0x97, 0x99, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0x7b, 0xe0, 0xe1, 0xe3, 0x7d,
+    0xe7, 0xf1, 0xa7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x60, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa4, 0xc5, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0x23, 0xc0, 0xc1, 0xc3, 0x24,
+    0xc7, 0xd1, 0xf6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xe9, 0x3a, 0xc4, 0xd6, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0x5d,
+    0xb5, 0xfc, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0x5b, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xa6, 0xf2, 0xf3, 0xf5,
+    0xe5, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x7e, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x40, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win278_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x7f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x82, 0xac},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xcb, 0x86, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0x98},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x96, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win278_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win278_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0x4a,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xdc, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x63, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x2a, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0xc0, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0xa1, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x51, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x7b, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x23, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x00, 0x00, 0x00, 0x6a, 0x79, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0xec, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0xcc, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x67,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0xd0, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x5a, 0x00, 0x00, 0x00, 0x47, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0x7c, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x43, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x09,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x5b, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x9f,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x04, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0xb5,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win280 (WINDOWS-1252) */
+
+static unsigned char const charmap_win280_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0xb1, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xb5, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x90, 0x48, 0x51, 0x5f, 0x6d,
+    0xdd, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x44, 0xbb, 0x54, 0x58, 0x07,
+    0x29, 0x22, 0x28, 0x2a, 0x15, 0x20, 0x06, 0x04,
+    0x14, 0x34, 0x17, 0x36, 0x30, 0x33, 0x3a, 0x23,
+    0x24, 0x08, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x09, 0x21, 0xff, 0x2b, 0x39, 0x1b, 0x35,
+    0x41, 0xaa, 0xb0, 0x7b, 0x9f, 0xb2, 0xcd, 0x7c,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x4a, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0xc0, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xe0,
+    0xd0, 0x5a, 0x52, 0x53, 0xa1, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0x6a, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0x79, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win280_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x91, 0x99, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x84, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x9e, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x85, 0x9a, 0x81, 0x8f, 0x90, 0x0a, 0x17, 0x1b,
+    0x82, 0x80, 0x83, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x89, 0x9f, 0x8b, 0x04,
+    0x97, 0x9d, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0x7b, 0xe1, 0xe3, 0xe5,
+    0x5c, 0xf1, 0xb0, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x5d, 0xea, 0xeb, 0x7d, 0xed, 0xee, 0xef,
+    0x7e, 0xdf, 0xe9, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf2, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xf9, 0x3a, 0xa3, 0xa7, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0x5b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xec, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x23, 0xa5, 0xb7, 0xa9, 0x40, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0xe0, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xa6, 0xf3, 0xf5,
+    0xe8, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0x60, 0xfa, 0xff,
+    0xe7, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9b};
+
+static const unsigned char utf8map_win280_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x84, 0xa2},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xc5, 0xbe, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {2, 0xc5, 0xa1, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb2, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xb9, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xac, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa8, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {3, 0xe2, 0x80, 0xba}};
+
+static const Tn5250Uint16 utf8map_win280_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win280_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0xd0, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0x7c,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0x58, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0xb1, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x4a, 0x7b, 0x00,
+    0x09, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0xdd, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0xc0,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0x48, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xcc, 0x5a, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0xb5, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0xe0, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0xcd, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0x6a, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0x54, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x44, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x29,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x79, 0xa1, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x51,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x20, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x90,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win284 (WINDOWS-1252) */
+
+static unsigned char const charmap_win284_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0xbb, 0x7f, 0x69, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0xba, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xbd, 0x07,
+    0x29, 0x22, 0x28, 0x2a, 0x24, 0x36, 0x06, 0x04,
+    0x14, 0x23, 0x17, 0x21, 0x30, 0x33, 0x3a, 0x20,
+    0x34, 0x31, 0x2c, 0x0a, 0x1b, 0x3e, 0x1a, 0x38,
+    0x35, 0x39, 0x09, 0x3b, 0x2b, 0x15, 0xff, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x49, 0xb5,
+    0xa1, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x7b, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x6a, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win284_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x9a, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9d, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x94, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8f, 0x8b, 0x81, 0x89, 0x84, 0x0a, 0x17, 0x1b,
+    0x82, 0x80, 0x83, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x91, 0x16, 0x8d, 0x90, 0x98, 0x85, 0x04,
+    0x97, 0x99, 0x8e, 0x9b, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xa6, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0x23, 0xf1, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0xd1, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0xa8, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5e, 0x21, 0xaf, 0x7e, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win284_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {2, 0xc5, 0xa1, 0},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xcb, 0x9c, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x21, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win284_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win284_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xbd, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x69, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x6a,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0x4f, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0xbb, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0xba, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x7b, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xa1, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x7c, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x49, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xd0, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x35, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0xc0, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x29,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x5a,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x4a,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win285 (WINDOWS-1252) */
+
+static unsigned char const charmap_win285_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x4a, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xb1, 0xe0, 0xbb, 0xba, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xbc, 0x07,
+    0x21, 0x22, 0x28, 0x2a, 0x23, 0x36, 0x06, 0x04,
+    0x14, 0x24, 0x17, 0x29, 0x30, 0x33, 0x3a, 0x20,
+    0x34, 0x35, 0x2c, 0x0a, 0x1b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0xa1, 0x3b, 0x2b, 0x09, 0xff, 0x08,
+    0x41, 0xaa, 0xb0, 0x5b, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0x5f, 0xca, 0xaf, 0x15,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win285_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0xaf, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x94, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8f, 0x80, 0x81, 0x84, 0x89, 0x0a, 0x17, 0x1b,
+    0x82, 0x8b, 0x83, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x91, 0x85, 0x04,
+    0x97, 0x99, 0x8e, 0x9b, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x24, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x21, 0xa3, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x9a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x5b, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5e, 0x5d, 0x7e, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win285_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x82, 0xac},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0xb0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x21, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win285_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win285_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xbc, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0x5b, 0x00,
+    0x39, 0x00, 0x4f, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x5a, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0xba, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x7c, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x4a,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xd0, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0x15, 0xb0, 0x00, 0x00, 0x00, 0xc0, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x21,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0xbb,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0xb1,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win297 (WINDOWS-1252) */
+
+static unsigned char const charmap_win297_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0xb1, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x44, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x90, 0x48, 0xb5, 0x5f, 0x6d,
+    0xa0, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x51, 0xbb, 0x54, 0xbd, 0x07,
+    0x2a, 0x22, 0x28, 0x20, 0x36, 0x09, 0x06, 0x04,
+    0x14, 0x34, 0x17, 0x21, 0x30, 0x33, 0x3a, 0x23,
+    0x24, 0x39, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x35, 0x29, 0xff, 0x2b, 0x15, 0x1b, 0x08,
+    0x41, 0xaa, 0xb0, 0x7b, 0x9f, 0xb2, 0xdd, 0x5a,
+    0xa1, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x4a, 0x8f, 0xea, 0xfa, 0xbe, 0x79, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x7c, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xe0,
+    0xd0, 0xc0, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0x6a, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win297_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x85, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9d, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x9e, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x83, 0x8b, 0x81, 0x8f, 0x90, 0x0a, 0x17, 0x1b,
+    0x82, 0x9a, 0x80, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x89, 0x99, 0x84, 0x04,
+    0x97, 0x91, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0x40, 0xe1, 0xe3, 0xe5,
+    0x5c, 0xf1, 0xb0, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x7b, 0xea, 0xeb, 0x7d, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xa7, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xf9, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xb5, 0x3a, 0xa3, 0xe0, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0x5b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0x60, 0xa8, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0x23, 0xa5, 0xb7, 0xa9, 0x5d, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0x7e, 0xb4, 0xd7,
+    0xe9, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0xe8, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xa6, 0xfa, 0xff,
+    0xe7, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9b};
+
+static const unsigned char utf8map_win297_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xc5, 0xbe, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc5, 0xa1, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x84, 0xa2},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x80, 0x98},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc3, 0xb9, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc3, 0xa0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa9, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa8, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {3, 0xe2, 0x80, 0xba}};
+
+static const Tn5250Uint16 utf8map_win297_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win297_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0xd0, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0x5a,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xbd, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0xb1, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x4a, 0x7b, 0x00,
+    0x35, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0xa0, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x7c,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0x48, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x20, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0xcc, 0xc0, 0xfc, 0x00,
+    0x77, 0x62, 0x79, 0xa1, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x44, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0xe0, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0xdd, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0x54, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x51, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x2a,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6a, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0xb5,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x09, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x90,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win500 (WINDOWS-1252) */
+
+static unsigned char const charmap_win500_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0xbb, 0xd0, 0xa1, 0x07,
+    0x29, 0x22, 0x28, 0x2a, 0x23, 0x36, 0x06, 0x04,
+    0x14, 0x24, 0x17, 0x20, 0x30, 0x33, 0x3a, 0x21,
+    0x34, 0x35, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0x15, 0x1b, 0x2b, 0x09, 0xff, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0xac, 0x69, 0xed, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xae, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x8c, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x8e, 0xdf};
+
+static unsigned char const charmap_win500_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x9a, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x9b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x8b, 0x8f, 0x81, 0x84, 0x89, 0x0a, 0x17, 0x1b,
+    0x82, 0x80, 0x83, 0x9c, 0x92, 0x05, 0x06, 0x07,
+    0x8c, 0x98, 0x16, 0x8d, 0x90, 0x91, 0x85, 0x04,
+    0x97, 0x99, 0x8e, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0xf0, 0xfd, 0xfe, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0xb8, 0xc6, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0xd0, 0xdd, 0xde, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xf2, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0xd6, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win500_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0xb0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x92, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc3, 0xb0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc3, 0xbe, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {2, 0xc3, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc3, 0x9e, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc5, 0xbe, 0}};
+
+static const Tn5250Uint16 utf8map_win500_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win500_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xbe, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0x9c, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xa1, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x8e, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x79, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x9e, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0x5f, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xae,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xe0, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x2a, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xcc, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0x7c, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0xd0, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x8c, 0x46, 0xec, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0xc0, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0x29,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x5a,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x36, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0xac, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0x4a,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win871 (WINDOWS-1252) */
+
+static unsigned char const charmap_win871_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xac, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xae, 0xbe, 0x9e, 0xec, 0x6d,
+    0x8c, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x8e, 0xbb, 0x9c, 0xcc, 0x07,
+    0xff, 0x22, 0x28, 0x3a, 0x24, 0x15, 0x06, 0x04,
+    0x14, 0x2a, 0x17, 0x2b, 0x09, 0x33, 0x23, 0x3b,
+    0x34, 0x35, 0x2c, 0x0a, 0x21, 0x3e, 0x1a, 0x38,
+    0x31, 0x39, 0x36, 0x20, 0x1b, 0x30, 0x29, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0xbc,
+    0x90, 0x8f, 0xea, 0xfa, 0xe0, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x5a, 0x68,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x7c, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x5f, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0xfc, 0xad, 0xc0, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0xd0, 0x48,
+    0x54, 0x51, 0x52, 0x53, 0x58, 0x55, 0x56, 0x57,
+    0x79, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xa1, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xdc, 0x8d, 0x4a, 0xdf};
+
+static unsigned char const charmap_win871_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x8c, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x88, 0x85, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x9c, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x9b, 0x94, 0x81, 0x8e, 0x84, 0x0a, 0x17, 0x1b,
+    0x82, 0x9e, 0x89, 0x8b, 0x92, 0x05, 0x06, 0x07,
+    0x9d, 0x98, 0x16, 0x8d, 0x90, 0x91, 0x9a, 0x04,
+    0x97, 0x99, 0x83, 0x8f, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0xe7, 0xf1, 0xfe, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xe8, 0xed, 0xee, 0xef,
+    0xec, 0xdf, 0xc6, 0x24, 0x2a, 0x29, 0x3b, 0xd6,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0xc7, 0xd1, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xf0, 0x3a, 0x23, 0xd0, 0x27, 0x3d, 0x22,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0x60, 0xfd, 0x7b, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0x7d, 0xb8, 0x5d, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0x40, 0xdd, 0x5b, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0xaf, 0xa8, 0x5c, 0xd7,
+    0xde, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xf5,
+    0xe6, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0xfc, 0xf9, 0xfa, 0xff,
+    0xb4, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x5e, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0xdc, 0xd9, 0xda, 0x80};
+
+static const unsigned char utf8map_win871_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {2, 0xc5, 0x92, 0},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xc5, 0x93, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xe2, 0x80, 0x9d},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc5, 0xbd, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc5, 0xbe, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x98},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0xbe, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc3, 0xaa, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc3, 0x86, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc3, 0xb0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x90, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xbd, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc2, 0xb8, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc3, 0x9d, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0x9e, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc3, 0xa6, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {3, 0xe2, 0x82, 0xac}};
+
+static const Tn5250Uint16 utf8map_win871_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00f5, 0x00e8, 0x00db, 0x00ce, 0xffff, 0x00c1, 0x00b4, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0073, 0x0066, 0x0059, 0xffff,
+    0x004c, 0x003f, 0x0032, 0x0025, 0xffff, 0x0018, 0x000b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2022, 0xffff, 0xffff, 0xffff, 0xffff, 0x00f3,
+    0xffff, 0x00e6, 0x00d9, 0x00cc, 0x00bf, 0x00b2, 0xffff, 0x00a5,
+    0xffff, 0xffff, 0x007e, 0xffff, 0x0071, 0x0064, 0x0057, 0x004a,
+    0xffff, 0x003d, 0x0030, 0x0023, 0x0016, 0x0009, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x203a,
+    0xffff, 0x2020, 0xffff, 0x2013, 0xffff, 0xffff, 0x00fe, 0x00f1,
+    0x00e4, 0x00d7, 0xffff, 0x00ca, 0x00bd, 0x00b0, 0x00a3, 0xffff,
+    0x2122, 0xffff, 0x007c, 0x006f, 0x0062, 0xffff, 0x0055, 0x0048,
+    0x003b, 0x002e, 0xffff, 0x0021, 0x0014, 0x0007, 0xffff, 0xffff,
+    0xffff, 0x017e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201e, 0xffff, 0xffff, 0xffff, 0x00fc, 0x00ef, 0xffff,
+    0x00e2, 0x00d5, 0x00c8, 0x00bb, 0xffff, 0x00ae, 0x00a1, 0xffff,
+    0xffff, 0xffff, 0x007a, 0x006d, 0x0060, 0x0053, 0x0046, 0xffff,
+    0x0039, 0x002c, 0x001f, 0x0012, 0xffff, 0x0005, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201c, 0xffff, 0xffff, 0xffff, 0x00fa, 0x00ed, 0x00e0,
+    0xffff, 0x00d3, 0x00c6, 0x00b9, 0x00ac, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0078, 0x006b, 0xffff, 0x005e, 0x0051, 0x0044, 0x0037,
+    0x002a, 0xffff, 0x001d, 0x0010, 0x0003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0160, 0x0153, 0xffff, 0xffff, 0xffff,
+    0x201a, 0xffff, 0xffff, 0xffff, 0x00f8, 0xffff, 0x00eb, 0x00de,
+    0x00d1, 0x00c4, 0xffff, 0x00b7, 0x00aa, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0076, 0x0069, 0x005c, 0x004f, 0xffff, 0x0042, 0x0035,
+    0x0028, 0x001b, 0x000e, 0xffff, 0x0001, 0x0192, 0xffff, 0xffff,
+    0x0178, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0xffff, 0x00f6, 0x00e9, 0x00dc, 0xffff,
+    0x00cf, 0x00c2, 0x00b5, 0x00a8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0074, 0x0067, 0xffff, 0x005a, 0x004d, 0x0040, 0x0033, 0xffff,
+    0x0026, 0x0019, 0x000c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2030, 0xffff, 0x02c6,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00f4, 0x00e7, 0x00da, 0x00cd,
+    0x00c0, 0xffff, 0x00b3, 0x00a6, 0xffff, 0xffff, 0xffff, 0x007f,
+    0x0072, 0x0065, 0x0058, 0x004b, 0xffff, 0x003e, 0x0031, 0x0024,
+    0x0017, 0xffff, 0x000a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x2014,
+    0xffff, 0xffff, 0x00ff, 0x00f2, 0x00e5, 0xffff, 0x00d8, 0x00cb,
+    0x00be, 0x00b1, 0x00a4, 0xffff, 0xffff, 0xffff, 0x007d, 0x0070,
+    0xffff, 0x0063, 0x0056, 0x0049, 0x003c, 0xffff, 0x002f, 0x0022,
+    0x0015, 0x0008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x2039, 0x02dc, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00fd, 0xffff, 0x00f0, 0x00e3, 0x00d6, 0x00c9, 0xffff,
+    0x00bc, 0x00af, 0x00a2, 0xffff, 0xffff, 0xffff, 0x007b, 0x006e,
+    0x0061, 0x0054, 0xffff, 0x0047, 0x003a, 0x002d, 0x0020, 0x20ac,
+    0x0013, 0x0006, 0xffff, 0xffff, 0xffff, 0x017d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d, 0xffff, 0xffff,
+    0xffff, 0x00fb, 0x00ee, 0x00e1, 0xffff, 0x00d4, 0x00c7, 0x00ba,
+    0x00ad, 0xffff, 0x00a0, 0xffff, 0xffff, 0x0079, 0xffff, 0x006c,
+    0x005f, 0x0052, 0x0045, 0x0038, 0xffff, 0x002b, 0x001e, 0x0011,
+    0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0161,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00f9, 0x00ec, 0x00df, 0x00d2, 0xffff, 0x00c5, 0x00b8,
+    0x00ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x0077, 0x006a, 0x005d,
+    0xffff, 0x0050, 0x0043, 0x0036, 0x0029, 0x001c, 0xffff, 0x000f,
+    0x0002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0152, 0xffff, 0xffff, 0x2026, 0x2019, 0xffff, 0xffff, 0xffff,
+    0x00f7, 0x00ea, 0xffff, 0x00dd, 0x00d0, 0x00c3, 0x00b6, 0xffff,
+    0x00a9, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0068, 0x005b,
+    0x004e, 0x0041, 0xffff, 0x0034, 0x0027, 0x001a, 0x000d, 0xffff};
+
+static const unsigned char utf8map_win871_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x54, 0xfb, 0x76, 0x00, 0x65, 0xe0, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x86, 0xe8, 0x00,
+    0xd3, 0x6f, 0xf2, 0x6c, 0x00, 0x18, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xce,
+    0x00, 0xd0, 0xfd, 0x78, 0xab, 0xea, 0x00, 0xb2,
+    0x00, 0x00, 0xcc, 0x00, 0x98, 0x84, 0xe6, 0xd1,
+    0x00, 0x7e, 0xf0, 0x7b, 0x32, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x4a, 0x49,
+    0x43, 0xbf, 0x00, 0x72, 0xb8, 0x90, 0xb1, 0x00,
+    0x39, 0x00, 0xbb, 0x96, 0x82, 0x00, 0xe4, 0xc8,
+    0x5e, 0x4b, 0x00, 0x4f, 0x3c, 0x2f, 0x00, 0x00,
+    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0xdc, 0x57, 0x00,
+    0x42, 0xef, 0x74, 0x8b, 0x00, 0xaf, 0xaa, 0x00,
+    0x00, 0x00, 0xa9, 0x94, 0x8c, 0xe2, 0xc6, 0x00,
+    0xf9, 0x6b, 0x1f, 0x12, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0x55, 0x44,
+    0x00, 0xee, 0x5a, 0xda, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x92, 0x00, 0xec, 0xd8, 0xc4, 0xf7,
+    0x5c, 0x00, 0x1d, 0x10, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x1b, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x70, 0x00, 0x53, 0xc0,
+    0x69, 0x63, 0x00, 0xb3, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x89, 0xbe, 0xd6, 0x00, 0xc2, 0xf5,
+    0x4d, 0x27, 0x0e, 0x00, 0x01, 0x3a, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xa1, 0x51, 0xfc, 0x00,
+    0x77, 0x62, 0xa0, 0xbd, 0x00, 0x00, 0x00, 0x00,
+    0xa3, 0x87, 0x00, 0xe9, 0xd4, 0xac, 0xf3, 0x00,
+    0x50, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x48, 0xfe, 0x75,
+    0x64, 0x00, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x07,
+    0x99, 0x85, 0xe7, 0xd2, 0x00, 0x6e, 0xf1, 0x5b,
+    0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0xdf, 0xcd, 0x47, 0x00, 0x80, 0x73,
+    0xb9, 0x8f, 0x9f, 0x00, 0x00, 0x00, 0x9c, 0x97,
+    0x00, 0x83, 0xe5, 0xc9, 0x4c, 0x00, 0x61, 0x7f,
+    0x3d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2b, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0x00, 0x79, 0x46, 0x5f, 0x71, 0x00,
+    0xb7, 0xbc, 0xb0, 0x00, 0x00, 0x00, 0x8e, 0x95,
+    0x81, 0xe3, 0x00, 0xc7, 0x7a, 0x60, 0x40, 0xff,
+    0x13, 0x2e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0xdb, 0x56, 0x45, 0x00, 0xeb, 0x68, 0x9b,
+    0xca, 0x00, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x93,
+    0x6d, 0xd9, 0xc5, 0xf8, 0x00, 0x4e, 0x1e, 0x11,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xdd, 0x58, 0x59, 0xed, 0x00, 0x67, 0x9d,
+    0x8a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x91, 0x9e,
+    0x00, 0xd7, 0xc3, 0xf6, 0x5d, 0x1c, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x15, 0x2c, 0x00, 0x00, 0x00,
+    0xe1, 0x52, 0x00, 0xad, 0x7c, 0x66, 0xb6, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x88, 0xae,
+    0xd5, 0xc1, 0x00, 0xf4, 0x7d, 0x3f, 0x0d, 0x00};
+
+/* Map win870 (WINDOWS-1250) */
+
+static unsigned char const charmap_win870_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x6a, 0xd0, 0xa1, 0x07,
+    0x34, 0x22, 0x62, 0x44, 0x09, 0x38, 0x66, 0x56,
+    0x21, 0x39, 0xbc, 0x08, 0xaa, 0xfd, 0xb8, 0xb9,
+    0x17, 0x20, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x15,
+    0xaf, 0x72, 0x9c, 0x31, 0x8a, 0xdd, 0xb6, 0xb7,
+    0x41, 0x70, 0x80, 0xba, 0x9f, 0xb1, 0xb3, 0xb5,
+    0xbd, 0x3a, 0x30, 0x06, 0x1b, 0xca, 0x29, 0xb4,
+    0x90, 0x76, 0x9e, 0x9a, 0xbe, 0x04, 0xb6, 0xb0,
+    0x9d, 0xa0, 0x8f, 0x24, 0x77, 0x64, 0x57, 0xb2,
+    0xed, 0x65, 0x42, 0x23, 0x63, 0x78, 0x69, 0x68,
+    0x67, 0x71, 0x72, 0x73, 0xda, 0x75, 0x33, 0xfa,
+    0xac, 0xbb, 0xab, 0xee, 0xeb, 0xef, 0xec, 0xbf,
+    0xae, 0x74, 0xfe, 0xfb, 0xfc, 0xad, 0x35, 0x59,
+    0xcd, 0x45, 0x28, 0x46, 0x43, 0x58, 0x49, 0x48,
+    0x47, 0x51, 0x52, 0x53, 0xdf, 0x55, 0x14, 0xea,
+    0x8c, 0x9b, 0x8b, 0xce, 0xcb, 0xcf, 0xcc, 0xe1,
+    0x8e, 0x54, 0xde, 0xdb, 0xdc, 0x8d, 0x36, 0xff};
+
+static unsigned char const charmap_win870_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xb5, 0x09, 0xab, 0x7f,
+    0x8b, 0x84, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0xee, 0x97, 0x08, 0x90,
+    0x18, 0x19, 0x96, 0xac, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x91, 0x88, 0x81, 0xc3, 0xbb, 0x0a, 0x17, 0x1b,
+    0xe2, 0xae, 0xca, 0xea, 0x92, 0x05, 0x06, 0x07,
+    0xaa, 0x9b, 0x16, 0xce, 0x80, 0xde, 0xfe, 0x04,
+    0x85, 0x89, 0xa9, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xc2, 0xe4, 0x83, 0xe1, 0xe3, 0xe8,
+    0xe7, 0xe6, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xea, 0xeb, 0xf9, 0xed, 0x87, 0xbe,
+    0xe5, 0xdf, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0x82, 0xc4, 0xbd, 0xc1, 0x86, 0xc8,
+    0xc7, 0xc6, 0x7c, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xa1, 0xc9, 0xca, 0xcb, 0xd9, 0xcd, 0xb1, 0xbc,
+    0xc5, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xa2, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x9c, 0xf2, 0xf0, 0xfd, 0xf8, 0xba,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xb3, 0xf1, 0x9a, 0xb8, 0xb2, 0xa4,
+    0xb9, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0x8c, 0xd2, 0xd0, 0xdd, 0xd8, 0x98,
+    0xb7, 0xa5, 0xbf, 0xa6, 0xaf, 0xa7, 0x9e, 0x9f,
+    0x8e, 0x8f, 0xa3, 0xd1, 0x8a, 0xa8, 0xb4, 0xd7,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0xf6, 0xe0, 0xf3, 0xf5,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xcc, 0xfb, 0xfc, 0x9d, 0xfa, 0xec,
+    0x5c, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xef, 0xd4, 0xd6, 0xc0, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xcf, 0xdb, 0xdc, 0x8d, 0xda, 0xff};
+
+static const unsigned char utf8map_win870_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {1, 0x7f, 0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc3, 0xae, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {1, 0x08, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc4, 0x82, 0},
+    {2, 0xc2, 0xbb, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc4, 0x98, 0},
+    {2, 0xc4, 0x99, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc5, 0x9e, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x16, 0, 0},
+    {2, 0xc3, 0x8e, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc5, 0xa2, 0},
+    {2, 0xc5, 0xa3, 0},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {3, 0xe2, 0x80, 0xb0},
+    {2, 0xc2, 0xa9, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0xa4, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc4, 0x83, 0},
+    {2, 0xc4, 0x8d, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xc4, 0x87, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc4, 0x99, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc5, 0xaf, 0},
+    {2, 0xc3, 0xad, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {2, 0xc4, 0xbe, 0},
+    {2, 0xc4, 0xba, 0},
+    {2, 0xc3, 0x9f, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xcb, 0x9d, 0},
+    {2, 0xc3, 0x81, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {2, 0xc4, 0x8c, 0},
+    {2, 0xc3, 0x87, 0},
+    {2, 0xc4, 0x86, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xcb, 0x87, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc4, 0x98, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc5, 0xae, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc4, 0xbd, 0},
+    {2, 0xc4, 0xb9, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xcb, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc5, 0x9b, 0},
+    {2, 0xc5, 0x88, 0},
+    {2, 0xc4, 0x91, 0},
+    {2, 0xc3, 0xbd, 0},
+    {2, 0xc5, 0x99, 0},
+    {2, 0xc5, 0x9f, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc5, 0x82, 0},
+    {2, 0xc5, 0x84, 0},
+    {2, 0xc5, 0xa1, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xcb, 0x9b, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc4, 0x85, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc5, 0x9a, 0},
+    {2, 0xc5, 0x87, 0},
+    {2, 0xc4, 0x90, 0},
+    {2, 0xc3, 0x9d, 0},
+    {2, 0xc5, 0x98, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc4, 0x84, 0},
+    {2, 0xc5, 0xbc, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc5, 0xbb, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc5, 0xbe, 0},
+    {2, 0xc5, 0xba, 0},
+    {2, 0xc5, 0xbd, 0},
+    {2, 0xc5, 0xb9, 0},
+    {2, 0xc5, 0x81, 0},
+    {2, 0xc5, 0x83, 0},
+    {2, 0xc5, 0xa0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xc3, 0xb6, 0},
+    {2, 0xc5, 0x95, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc5, 0x91, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc4, 0x9a, 0},
+    {2, 0xc5, 0xb1, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc5, 0xa5, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc4, 0x9b, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc4, 0x8f, 0},
+    {2, 0xc3, 0x94, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x94, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc5, 0x90, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc4, 0x8e, 0},
+    {2, 0xc5, 0xb0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc5, 0xa4, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xcb, 0x99, 0}};
+
+static const Tn5250Uint16 utf8map_win870_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0x004f, 0xffff, 0x011b, 0xffff, 0x0021,
+    0xffff, 0xffff, 0x00ed, 0x0070, 0xffff, 0xffff, 0xffff, 0x0042,
+    0xffff, 0x010e, 0xffff, 0xffff, 0x0014, 0xffff, 0xffff, 0x0063,
+    0x2021, 0xffff, 0xffff, 0xffff, 0x0035, 0x017e, 0x02c7, 0xffff,
+    0x0007, 0x0150, 0x00d3, 0xffff, 0x0056, 0x2014, 0xffff, 0xffff,
+    0x0028, 0x0171, 0x00f4, 0x0077, 0xffff, 0xffff, 0x0143, 0xffff,
+    0x0049, 0xffff, 0x02db, 0xffff, 0x001b, 0x0164, 0x2122, 0x00e7,
+    0x006a, 0xffff, 0xffff, 0xffff, 0x003c, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x000e, 0xffff, 0x00da, 0x005d, 0xffff, 0xffff, 0xffff,
+    0x00ac, 0x002f, 0xffff, 0xffff, 0x007e, 0x0001, 0xffff, 0x00cd,
+    0xffff, 0x0050, 0xffff, 0xffff, 0xffff, 0x0022, 0xffff, 0x00ee,
+    0x20ac, 0x0071, 0xffff, 0x013d, 0xffff, 0x0043, 0xffff, 0x010f,
+    0xffff, 0xffff, 0x0015, 0x015e, 0x00e1, 0x0064, 0x2022, 0xffff,
+    0xffff, 0x0036, 0xffff, 0xffff, 0x0102, 0xffff, 0x0008, 0x0151,
+    0x00d4, 0x0057, 0xffff, 0xffff, 0xffff, 0x00a6, 0x0029, 0xffff,
+    0xffff, 0x0078, 0xffff, 0x0144, 0xffff, 0x00c7, 0x004a, 0xffff,
+    0xffff, 0xffff, 0x001c, 0x0165, 0xffff, 0xffff, 0x006b, 0xffff,
+    0xffff, 0xffff, 0x003d, 0xffff, 0xffff, 0xffff, 0xffff, 0x000f,
+    0x0158, 0xffff, 0x005e, 0x201c, 0xffff, 0x00ad, 0xffff, 0x0030,
+    0x0179, 0x00fc, 0x007f, 0x0002, 0xffff, 0x00ce, 0x0051, 0xffff,
+    0xffff, 0xffff, 0x00a0, 0x0023, 0xffff, 0xffff, 0x0072, 0x2030,
+    0xffff, 0x013e, 0x00c1, 0x0044, 0xffff, 0x0110, 0xffff, 0x0016,
+    0x015f, 0xffff, 0x00e2, 0x0065, 0xffff, 0xffff, 0x00b4, 0x0037,
+    0xffff, 0x0103, 0xffff, 0xffff, 0x0009, 0xffff, 0xffff, 0x0058,
+    0xffff, 0xffff, 0xffff, 0x00a7, 0x002a, 0xffff, 0x00f6, 0x0079,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x004b, 0xffff, 0x02dd, 0xffff,
+    0x001d, 0xffff, 0x00e9, 0x006c, 0xffff, 0xffff, 0xffff, 0x00bb,
+    0x003e, 0xffff, 0xffff, 0xffff, 0xffff, 0x0010, 0x0159, 0x00dc,
+    0x005f, 0x201d, 0xffff, 0x00ae, 0x0031, 0x017a, 0xffff, 0x00fd,
+    0xffff, 0x0003, 0xffff, 0xffff, 0x0052, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0024, 0xffff, 0xffff, 0x0073, 0xffff, 0xffff, 0xffff,
+    0x00c2, 0x0045, 0xffff, 0x0111, 0xffff, 0x0017, 0x0160, 0xffff,
+    0xffff, 0x0066, 0xffff, 0xffff, 0x00b5, 0x0038, 0xffff, 0x0104,
+    0xffff, 0xffff, 0x000a, 0xffff, 0x00d6, 0x0059, 0xffff, 0xffff,
+    0x00a8, 0xffff, 0x002b, 0xffff, 0x00f7, 0x007a, 0xffff, 0xffff,
+    0x00c9, 0x004c, 0xffff, 0xffff, 0x0118, 0xffff, 0x001e, 0xffff,
+    0xffff, 0x006d, 0xffff, 0x0139, 0xffff, 0xffff, 0x003f, 0xffff,
+    0xffff, 0xffff, 0x0011, 0x015a, 0xffff, 0x00dd, 0x0060, 0x201e,
+    0xffff, 0xffff, 0x0032, 0x017b, 0xffff, 0xffff, 0xffff, 0x0004,
+    0xffff, 0xffff, 0x0053, 0xffff, 0xffff, 0xffff, 0xffff, 0x0025,
+    0x016e, 0xffff, 0x0074, 0xffff, 0xffff, 0xffff, 0xffff, 0x0046,
+    0x02d8, 0xffff, 0xffff, 0x0018, 0x0161, 0x00e4, 0x0067, 0xffff,
+    0xffff, 0xffff, 0x00b6, 0x0039, 0xffff, 0x0105, 0xffff, 0x000b,
+    0x0154, 0xffff, 0x00d7, 0x005a, 0x2018, 0xffff, 0x00a9, 0x002c,
+    0xffff, 0xffff, 0xffff, 0x007b, 0x2039, 0x0147, 0xffff, 0x004d,
+    0xffff, 0x0119, 0xffff, 0xffff, 0x001f, 0xffff, 0x00eb, 0x006e,
+    0xffff, 0x013a, 0xffff, 0xffff, 0x0040, 0xffff, 0x010c, 0xffff,
+    0x0012, 0x015b, 0xffff, 0xffff, 0x0061, 0xffff, 0xffff, 0x00b0,
+    0x0033, 0x017c, 0xffff, 0xffff, 0xffff, 0x0005, 0xffff, 0xffff,
+    0x0054, 0xffff, 0xffff, 0xffff, 0x0026, 0x016f, 0xffff, 0xffff,
+    0x0075, 0xffff, 0x0141, 0x00c4, 0x0047, 0xffff, 0x02d9, 0xffff,
+    0xffff, 0x0019, 0x0162, 0xffff, 0x0068, 0x2026, 0xffff, 0xffff,
+    0x00b7, 0x003a, 0xffff, 0x0106, 0xffff, 0x000c, 0x0155, 0xffff,
+    0xffff, 0x005b, 0x2019, 0xffff, 0xffff, 0x002d, 0xffff, 0xffff,
+    0xffff, 0x007c, 0x203a, 0x0148, 0x00cb, 0x004e, 0xffff, 0x011a,
+    0xffff, 0xffff, 0x0020, 0xffff, 0xffff, 0x006f, 0xffff, 0xffff,
+    0xffff, 0x0041, 0xffff, 0xffff, 0x010d, 0xffff, 0x0013, 0xffff,
+    0x00df, 0x0062, 0x2020, 0xffff, 0xffff, 0x00b1, 0x0034, 0x017d,
+    0xffff, 0xffff, 0x0006, 0xffff, 0xffff, 0xffff, 0x0055, 0x2013,
+    0xffff, 0x00a4, 0x0027, 0x0170, 0x00f3, 0xffff, 0x0076, 0xffff,
+    0x0142, 0xffff, 0x0048, 0xffff, 0xffff, 0xffff, 0xffff, 0x001a,
+    0x0163, 0xffff, 0x0069, 0xffff, 0xffff, 0x00b8, 0xffff, 0x003b,
+    0xffff, 0x0107, 0xffff, 0x000d, 0xffff, 0xffff, 0x005c, 0x201a,
+    0xffff, 0xffff, 0x00ab, 0x002e, 0xffff, 0x00fa, 0x007d, 0xffff};
+
+static const unsigned char utf8map_win870_values[512] = {
+    0x00, 0x00, 0x00, 0xd6, 0x00, 0xdf, 0x00, 0x4f,
+    0x00, 0x00, 0x55, 0x97, 0x00, 0x00, 0x00, 0xc2,
+    0x00, 0xfa, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x83,
+    0x56, 0x00, 0x00, 0x00, 0xf5, 0xb6, 0x70, 0x00,
+    0x2f, 0xef, 0xee, 0x00, 0xe5, 0x15, 0x00, 0x00,
+    0x4d, 0xdb, 0xcb, 0xa6, 0x00, 0x00, 0xbb, 0x00,
+    0xc9, 0x00, 0x9e, 0x00, 0x27, 0xfd, 0x72, 0x48,
+    0x91, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00,
+    0x1b, 0x61, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x75,
+    0x00, 0xd7, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x14,
+    0x34, 0x98, 0x00, 0x77, 0x00, 0xc3, 0x00, 0xea,
+    0x00, 0x00, 0x3d, 0x30, 0x45, 0x84, 0x3e, 0x00,
+    0x00, 0xf6, 0x00, 0x00, 0x23, 0x00, 0x16, 0xcf,
+    0xeb, 0xe6, 0x00, 0x00, 0x00, 0xb3, 0x5d, 0x00,
+    0x00, 0xa7, 0x00, 0x9b, 0x00, 0x68, 0xd1, 0x00,
+    0x00, 0x00, 0x1c, 0xdd, 0x00, 0x00, 0x92, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0xae, 0x00, 0x5f, 0x0a, 0x00, 0xca, 0x00, 0xf0,
+    0xb9, 0xdc, 0x07, 0x02, 0x00, 0x33, 0xd8, 0x00,
+    0x00, 0x00, 0x41, 0x7b, 0x00, 0x00, 0x99, 0x39,
+    0x00, 0x57, 0x65, 0xc4, 0x00, 0xac, 0x00, 0x32,
+    0x8f, 0x00, 0x28, 0x85, 0x00, 0x00, 0xbe, 0xf7,
+    0x00, 0x46, 0x00, 0x00, 0x05, 0x00, 0x00, 0xe7,
+    0x00, 0x00, 0x00, 0xb5, 0x5c, 0x00, 0xcc, 0xa8,
+    0x00, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x64, 0x00,
+    0x1d, 0x00, 0x51, 0x93, 0x00, 0x00, 0x00, 0x24,
+    0x6e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8e, 0xfc,
+    0x6d, 0x3b, 0x00, 0x29, 0xf1, 0xb7, 0x00, 0x8d,
+    0x00, 0x03, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00,
+    0x00, 0x5b, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+    0x42, 0xc5, 0x00, 0x8c, 0x00, 0x26, 0xbc, 0x00,
+    0x00, 0x86, 0x00, 0x00, 0x04, 0xf8, 0x00, 0xb1,
+    0x00, 0x00, 0x25, 0x00, 0xec, 0xe8, 0x00, 0x00,
+    0xbd, 0x00, 0x4e, 0x00, 0xe1, 0xa9, 0x00, 0x00,
+    0x71, 0xd3, 0x00, 0x00, 0x72, 0x00, 0x1e, 0x00,
+    0x00, 0x94, 0x00, 0x78, 0x00, 0x00, 0x6f, 0x00,
+    0x00, 0x00, 0x11, 0xaa, 0x00, 0xad, 0x79, 0x09,
+    0x00, 0x00, 0xf2, 0xb4, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x6c,
+    0x74, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0xc6,
+    0x80, 0x00, 0x00, 0x18, 0x9c, 0x43, 0x87, 0x00,
+    0x00, 0x00, 0xb6, 0xf9, 0x00, 0xa0, 0x00, 0x0b,
+    0xed, 0x00, 0xbf, 0xe9, 0x20, 0x00, 0x3a, 0x6b,
+    0x00, 0x00, 0x00, 0xc0, 0x08, 0xab, 0x00, 0xd4,
+    0x00, 0x52, 0x00, 0x00, 0x1f, 0x00, 0x53, 0x95,
+    0x00, 0x58, 0x00, 0x00, 0x7c, 0x00, 0x67, 0x00,
+    0x12, 0x8a, 0x00, 0x00, 0x81, 0x00, 0x00, 0x90,
+    0xf3, 0xb2, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00,
+    0xe3, 0x00, 0x00, 0x00, 0x50, 0x54, 0x00, 0x00,
+    0xa4, 0x00, 0xba, 0x63, 0xc7, 0x00, 0xff, 0x00,
+    0x00, 0x19, 0x35, 0x00, 0x88, 0x38, 0x00, 0x00,
+    0xb0, 0x7a, 0x00, 0x69, 0x00, 0x0c, 0xcd, 0x00,
+    0x00, 0x4a, 0x2c, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x6a, 0x31, 0x8b, 0x73, 0xd5, 0x00, 0xda,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x96, 0x00, 0x00,
+    0x00, 0xc1, 0x00, 0x00, 0x47, 0x00, 0x13, 0x00,
+    0x59, 0x82, 0x66, 0x00, 0x00, 0x76, 0xf4, 0xb8,
+    0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xe4, 0x1a,
+    0x00, 0x9f, 0x7d, 0xfb, 0xce, 0x00, 0xa5, 0x00,
+    0x9a, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0x36, 0x00, 0x89, 0x00, 0x00, 0x9d, 0x00, 0x5e,
+    0x00, 0x49, 0x00, 0x0d, 0x00, 0x00, 0xe0, 0x62,
+    0x00, 0x00, 0x06, 0x4b, 0x00, 0xde, 0xd0, 0x00};
+
+/* Map win905 (WINDOWS-1254) */
+
+static unsigned char const charmap_win905_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0xfc, 0xec, 0xb9, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xaf, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x68, 0xdc, 0xb6, 0x5f, 0x6d,
+    0xda, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x48, 0x8f, 0xb3, 0xcc, 0x07,
+    0x80, 0x2a, 0x28, 0x22, 0x58, 0x41, 0x66, 0x67,
+    0x39, 0x47, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x1b,
+    0xb7, 0x09, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x70,
+    0x31, 0xad, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x08,
+    0x15, 0x36, 0x34, 0xb1, 0x9f, 0x33, 0xcf, 0xb5,
+    0xbd, 0x3a, 0xaa, 0xab, 0xac, 0xca, 0xae, 0x20,
+    0x90, 0x21, 0xea, 0xfa, 0xbe, 0xa0, 0x29, 0xb0,
+    0x52, 0x24, 0xba, 0xbb, 0xbc, 0xb8, 0xb4, 0x17,
+    0x64, 0x65, 0x62, 0x06, 0x63, 0x04, 0x46, 0x4a,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x5a, 0x69, 0xed, 0xee, 0xeb, 0x2b, 0x7b, 0xbf,
+    0x30, 0xfd, 0xfe, 0xfb, 0x7f, 0x5b, 0x7c, 0x59,
+    0x44, 0x45, 0x42, 0xdf, 0x43, 0x14, 0x57, 0xc0,
+    0x54, 0x51, 0xb2, 0x53, 0x23, 0x55, 0x56, 0xef,
+    0xd0, 0x49, 0xcd, 0xce, 0xcb, 0x35, 0xa1, 0xe1,
+    0x38, 0xdd, 0xde, 0xdb, 0xe0, 0x79, 0x6a, 0xff};
+
+static unsigned char const charmap_win905_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xc5, 0x09, 0xc3, 0x7f,
+    0x9f, 0x91, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0xe5, 0xa0, 0x08, 0xbf,
+    0x18, 0x19, 0x96, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0xaf, 0xb1, 0x83, 0xec, 0xb9, 0x0a, 0x17, 0x1b,
+    0x82, 0xb6, 0x81, 0xd5, 0x92, 0x05, 0x06, 0x07,
+    0xd8, 0x98, 0x16, 0xa5, 0xa2, 0xf5, 0xa1, 0x04,
+    0xf8, 0x88, 0xa9, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0x85, 0xe2, 0xe4, 0xe0, 0xe1, 0xc6, 0x89,
+    0x7b, 0xf1, 0xc7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xb8, 0xeb, 0xe8, 0xed, 0xee, 0xe6,
+    0x84, 0xdf, 0xd0, 0xdd, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0x86, 0x87,
+    0x5b, 0xd1, 0xfe, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0x97, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xfd, 0x3a, 0xd6, 0xde, 0x27, 0x3d, 0xdc,
+    0x80, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x7c,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xaa, 0xab, 0xac, 0x99, 0xae, 0x40,
+    0xb7, 0xa3, 0xea, 0x7d, 0xbe, 0xa7, 0x5d, 0x90,
+    0xbd, 0x24, 0xba, 0xbb, 0xbc, 0xa8, 0xb4, 0xd7,
+    0xe7, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xa6,
+    0xf0, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x60, 0xfb, 0x5c, 0xf9, 0xfa, 0xe3,
+    0xfc, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x23, 0xd2, 0xd3, 0xef,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x22, 0xd9, 0xda, 0xff};
+
+static const unsigned char utf8map_win905_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc3, 0x83, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xc3, 0xa5, 0},
+    {2, 0xc2, 0xa0, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc2, 0xbf, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc3, 0xac, 0},
+    {2, 0xc2, 0xb9, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc2, 0xb6, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc3, 0x95, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xc3, 0x98, 0},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc2, 0xa1, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xc2, 0xa9, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0x86, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc3, 0xa6, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc4, 0x9e, 0},
+    {2, 0xc4, 0xb0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc5, 0x9f, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc4, 0xb1, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x9e, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xc5, 0x92, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc5, 0xa1, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xac, 0},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc3, 0xaa, 0},
+    {1, 0x7d, 0, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x5d, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xbd, 0},
+    {1, 0x24, 0, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa7, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc4, 0x9f, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0xaf, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {2, 0xc3, 0xbf, 0}};
+
+static const Tn5250Uint16 utf8map_win905_keys[512] = {
+    0x0000, 0x0049, 0xffff, 0x00db, 0x2030, 0xffff, 0xffff, 0x000c,
+    0x0055, 0xffff, 0x00e7, 0xffff, 0x0130, 0xffff, 0x0018, 0x0061,
+    0x00aa, 0xffff, 0x00f3, 0xffff, 0xffff, 0x0024, 0x006d, 0xffff,
+    0x00b6, 0x00ff, 0xffff, 0xffff, 0x0030, 0xffff, 0x0079, 0x00c2,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x003c, 0xffff, 0x00ce, 0xffff,
+    0x0160, 0xffff, 0xffff, 0x0048, 0xffff, 0x00da, 0xffff, 0xffff,
+    0xffff, 0x000b, 0x0054, 0xffff, 0x00e6, 0xffff, 0xffff, 0x0178,
+    0x0017, 0x0060, 0x00a9, 0xffff, 0x00f2, 0xffff, 0xffff, 0x0023,
+    0x006c, 0x2122, 0x00b5, 0xffff, 0xffff, 0xffff, 0x002f, 0xffff,
+    0x0078, 0x00c1, 0xffff, 0x0153, 0xffff, 0xffff, 0x003b, 0xffff,
+    0x00cd, 0x2022, 0xffff, 0x015f, 0xffff, 0x0047, 0xffff, 0x00d9,
+    0xffff, 0xffff, 0xffff, 0x000a, 0x0053, 0xffff, 0xffff, 0x00e5,
+    0x203a, 0xffff, 0x0016, 0x005f, 0xffff, 0x00a8, 0x00f1, 0xffff,
+    0xffff, 0x0022, 0x006b, 0xffff, 0x00b4, 0xffff, 0xffff, 0xffff,
+    0x002e, 0xffff, 0x0077, 0x00c0, 0xffff, 0x0152, 0xffff, 0xffff,
+    0x003a, 0xffff, 0x00cc, 0x2021, 0xffff, 0x015e, 0xffff, 0x0046,
+    0xffff, 0x00d8, 0xffff, 0xffff, 0xffff, 0x0009, 0x0052, 0xffff,
+    0xffff, 0x00e4, 0x2039, 0xffff, 0x0015, 0x005e, 0xffff, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0x0021, 0xffff, 0x006a, 0x00b3, 0x00fc,
+    0xffff, 0xffff, 0xffff, 0x002d, 0x0076, 0x00bf, 0x2014, 0xffff,
+    0xffff, 0xffff, 0x0039, 0xffff, 0x00cb, 0x2020, 0xffff, 0xffff,
+    0xffff, 0x0045, 0xffff, 0x00d7, 0xffff, 0xffff, 0xffff, 0x0008,
+    0x0051, 0xffff, 0xffff, 0x00e3, 0xffff, 0xffff, 0x0014, 0x005d,
+    0xffff, 0x00a6, 0x00ef, 0xffff, 0xffff, 0x0020, 0xffff, 0x0069,
+    0x00b2, 0x00fb, 0xffff, 0xffff, 0xffff, 0x002c, 0x0075, 0x00be,
+    0x2013, 0xffff, 0xffff, 0xffff, 0x0038, 0xffff, 0x00ca, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0044, 0xffff, 0x00d6, 0xffff, 0x011f,
+    0xffff, 0x0007, 0x0050, 0xffff, 0xffff, 0x00e2, 0xffff, 0xffff,
+    0x0013, 0x005c, 0xffff, 0x00a5, 0x00ee, 0xffff, 0xffff, 0x001f,
+    0xffff, 0x0068, 0x00b1, 0x00fa, 0xffff, 0xffff, 0xffff, 0x002b,
+    0x0074, 0x00bd, 0xffff, 0xffff, 0xffff, 0xffff, 0x0037, 0xffff,
+    0x00c9, 0xffff, 0x201e, 0xffff, 0xffff, 0x0043, 0xffff, 0xffff,
+    0x00d5, 0x011e, 0xffff, 0x0006, 0x004f, 0xffff, 0xffff, 0x00e1,
+    0xffff, 0xffff, 0x0012, 0xffff, 0x005b, 0x00a4, 0x00ed, 0xffff,
+    0xffff, 0xffff, 0x001e, 0x0067, 0x00b0, 0x00f9, 0xffff, 0xffff,
+    0xffff, 0x002a, 0x0073, 0x00bc, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0036, 0x007f, 0x00c8, 0xffff, 0x201d, 0xffff, 0xffff, 0x0042,
+    0xffff, 0xffff, 0x00d4, 0xffff, 0xffff, 0x0005, 0x004e, 0xffff,
+    0xffff, 0x00e0, 0xffff, 0xffff, 0x0011, 0xffff, 0x005a, 0x00a3,
+    0x00ec, 0xffff, 0xffff, 0xffff, 0x001d, 0x0066, 0x00af, 0x00f8,
+    0xffff, 0xffff, 0xffff, 0x0029, 0x0072, 0x00bb, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0035, 0x007e, 0x00c7, 0xffff, 0x201c, 0xffff,
+    0xffff, 0x0041, 0xffff, 0xffff, 0x00d3, 0x02c6, 0xffff, 0x0004,
+    0x004d, 0xffff, 0xffff, 0x00df, 0xffff, 0xffff, 0x0010, 0xffff,
+    0x0059, 0x00a2, 0x00eb, 0xffff, 0xffff, 0xffff, 0x001c, 0x0065,
+    0x00ae, 0x00f7, 0xffff, 0xffff, 0xffff, 0x0028, 0x0071, 0x00ba,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0034, 0x007d, 0xffff, 0x00c6,
+    0xffff, 0xffff, 0xffff, 0x0040, 0xffff, 0xffff, 0x00d2, 0xffff,
+    0xffff, 0x0003, 0xffff, 0x004c, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x000f, 0x0058, 0x00a1, 0x00ea, 0xffff, 0xffff, 0xffff,
+    0x001b, 0x0064, 0x00ad, 0x00f6, 0xffff, 0xffff, 0xffff, 0x0027,
+    0x0070, 0x00b9, 0xffff, 0xffff, 0xffff, 0xffff, 0x0033, 0x007c,
+    0xffff, 0x00c5, 0x201a, 0xffff, 0x20ac, 0x003f, 0xffff, 0xffff,
+    0x00d1, 0x2026, 0xffff, 0x0002, 0xffff, 0x004b, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x000e, 0x0057, 0x00a0, 0x00e9, 0xffff,
+    0x02dc, 0xffff, 0x001a, 0x0063, 0x00ac, 0x00f5, 0xffff, 0xffff,
+    0xffff, 0x0026, 0x006f, 0x00b8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0032, 0x007b, 0xffff, 0x00c4, 0x2019, 0xffff, 0xffff, 0x003e,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0001, 0xffff, 0x004a,
+    0xffff, 0x00dc, 0xffff, 0xffff, 0xffff, 0x000d, 0x0056, 0xffff,
+    0x00e8, 0xffff, 0x0131, 0xffff, 0x0019, 0x0062, 0x00ab, 0xffff,
+    0x00f4, 0xffff, 0xffff, 0x0025, 0x006e, 0xffff, 0x00b7, 0xffff,
+    0xffff, 0x0192, 0x0031, 0xffff, 0x007a, 0x00c3, 0x2018, 0xffff,
+    0xffff, 0xffff, 0x003d, 0xffff, 0x00cf, 0xffff, 0x0161, 0xffff};
+
+static const unsigned char utf8map_win905_values[512] = {
+    0x00, 0xc9, 0x00, 0xfb, 0x47, 0x00, 0x00, 0x0c,
+    0xe4, 0x00, 0xc0, 0x00, 0x5b, 0x00, 0x18, 0x81,
+    0xaa, 0x00, 0xce, 0x00, 0x00, 0xb9, 0x94, 0x00,
+    0x29, 0xff, 0x00, 0x00, 0xf0, 0x00, 0xa8, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x76, 0x00,
+    0x8a, 0x00, 0x00, 0xc8, 0x00, 0xfe, 0x00, 0x00,
+    0x00, 0x0b, 0xe3, 0x00, 0x57, 0x00, 0x00, 0x08,
+    0x26, 0xda, 0x3a, 0x00, 0xcd, 0x00, 0x00, 0xec,
+    0x93, 0xad, 0xa0, 0x00, 0x00, 0x00, 0x61, 0x00,
+    0xa7, 0x65, 0x00, 0x9c, 0x00, 0x00, 0x5e, 0x00,
+    0x75, 0x3e, 0x00, 0x6a, 0x00, 0xc7, 0x00, 0xfd,
+    0x00, 0x00, 0x00, 0x25, 0xe2, 0x00, 0x00, 0x14,
+    0x9b, 0x00, 0x32, 0x6d, 0x00, 0xbd, 0x49, 0x00,
+    0x00, 0xfc, 0x92, 0x00, 0xbe, 0x00, 0x00, 0x00,
+    0x4b, 0x00, 0xa6, 0x64, 0x00, 0x8c, 0x00, 0x00,
+    0x7a, 0x00, 0x78, 0x67, 0x00, 0x7c, 0x00, 0xc6,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0xd9, 0x00,
+    0x00, 0x43, 0x8b, 0x00, 0x3d, 0x5f, 0x00, 0xb5,
+    0x00, 0x00, 0x00, 0x4f, 0x00, 0x91, 0xfa, 0xe0,
+    0x00, 0x00, 0x00, 0x60, 0xa5, 0x17, 0x70, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x73, 0x66, 0x00, 0x00,
+    0x00, 0xc5, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x16,
+    0xd8, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x3c, 0xb6,
+    0x00, 0xcf, 0xef, 0x00, 0x00, 0x40, 0x00, 0x89,
+    0xea, 0xdb, 0x00, 0x00, 0x00, 0x6b, 0xa4, 0xb4,
+    0x1a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0xc4, 0x00, 0x7b, 0x00, 0xd0,
+    0x00, 0x2f, 0xd7, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0x13, 0xdc, 0x00, 0x33, 0x56, 0x00, 0x00, 0x1f,
+    0x00, 0x88, 0x21, 0xde, 0x00, 0x00, 0x00, 0x4e,
+    0xa3, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x00,
+    0x71, 0x00, 0x58, 0x00, 0x00, 0xc3, 0x00, 0x00,
+    0x2b, 0x5a, 0x00, 0x2e, 0xd6, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x12, 0x00, 0x68, 0x9f, 0x55, 0x00,
+    0x00, 0x00, 0x1e, 0x87, 0x90, 0xdd, 0x00, 0x00,
+    0x00, 0x5c, 0xa2, 0xbc, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0x07, 0x74, 0x00, 0x3b, 0x00, 0x00, 0xc2,
+    0x00, 0x00, 0xeb, 0x00, 0x00, 0x2d, 0xd5, 0x00,
+    0x00, 0x44, 0x00, 0x00, 0x11, 0x00, 0xe9, 0xb1,
+    0x23, 0x00, 0x00, 0x00, 0x1d, 0x86, 0x20, 0x38,
+    0x00, 0x00, 0x00, 0x5d, 0x99, 0xbb, 0x00, 0x00,
+    0x00, 0x00, 0xf5, 0xcc, 0x4a, 0x00, 0x0a, 0x00,
+    0x00, 0xc1, 0x00, 0x00, 0xee, 0x39, 0x00, 0x37,
+    0xd4, 0x00, 0x00, 0x59, 0x00, 0x00, 0x10, 0x00,
+    0xe8, 0x34, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x85,
+    0xae, 0xe1, 0x00, 0x00, 0x00, 0x4d, 0x98, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0xb3, 0x00, 0x46,
+    0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xed, 0x00,
+    0x00, 0x03, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xe7, 0x36, 0xb2, 0x00, 0x00, 0x00,
+    0x27, 0x84, 0xca, 0xa1, 0x00, 0x00, 0x00, 0x7d,
+    0x97, 0x24, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x8f,
+    0x00, 0x04, 0x28, 0x00, 0x80, 0x6f, 0x00, 0x00,
+    0x69, 0x41, 0x00, 0x02, 0x00, 0xd2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0xe6, 0x15, 0x51, 0x00,
+    0x31, 0x00, 0x3f, 0x83, 0xac, 0x35, 0x00, 0x00,
+    0x00, 0x50, 0x96, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x00, 0x63, 0x2c, 0x00, 0x00, 0x6e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd1,
+    0x00, 0x7f, 0x00, 0x00, 0x00, 0x0d, 0xe5, 0x00,
+    0x54, 0x00, 0x79, 0x00, 0x19, 0x82, 0xab, 0x00,
+    0xcb, 0x00, 0x00, 0x6c, 0x95, 0x00, 0xb0, 0x00,
+    0x00, 0x22, 0xf1, 0x00, 0xa9, 0x06, 0x09, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x77, 0x00, 0x9a, 0x00};
+
+/* Map win880 (WINDOWS-1251) */
+
+static unsigned char const charmap_win880_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x09, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x23, 0x20, 0x1b, 0x15, 0x07,
+    0x59, 0x62, 0x22, 0x43, 0x64, 0x45, 0xc0, 0xd0,
+    0x74, 0x55, 0x69, 0x79, 0x70, 0x72, 0x71, 0x75,
+    0x42, 0x2a, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0x34,
+    0x35, 0x29, 0x51, 0x14, 0x52, 0x54, 0x53, 0x56,
+    0xff, 0xa1, 0x73, 0x68, 0xe1, 0x17, 0x6a, 0x36,
+    0x63, 0x3a, 0x30, 0x31, 0x08, 0x33, 0x2b, 0x67,
+    0x24, 0x06, 0x66, 0x47, 0x28, 0x39, 0x04, 0x38,
+    0x44, 0x58, 0x41, 0x21, 0x49, 0x65, 0x46, 0x48,
+    0xb9, 0xba, 0xed, 0xbf, 0xbc, 0xbd, 0xec, 0xfa,
+    0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xda, 0xdb, 0xdc,
+    0xde, 0xdf, 0xea, 0xeb, 0xbe, 0xca, 0xbb, 0xfe,
+    0xfb, 0xfd, 0x57, 0xef, 0xee, 0xfc, 0xb8, 0xdd,
+    0x77, 0x78, 0xaf, 0x8d, 0x8a, 0x8b, 0xae, 0xb2,
+    0x8f, 0x90, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xaa, 0xab, 0xac, 0xad, 0x8c, 0x8e, 0x80, 0xb6,
+    0xb3, 0xb5, 0xb7, 0xb1, 0xb0, 0xb4, 0x76, 0xa0};
+
+static unsigned char const charmap_win880_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xb6, 0x09, 0xb1, 0x7f,
+    0xac, 0x60, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9b, 0x7e, 0x08, 0xa5,
+    0x18, 0x19, 0x96, 0x7d, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x7c, 0xbb, 0x82, 0x7b, 0xb0, 0x0a, 0x17, 0x1b,
+    0xb4, 0x99, 0x91, 0xae, 0x92, 0x05, 0x06, 0x07,
+    0xaa, 0xab, 0x16, 0xad, 0x97, 0x98, 0xa7, 0x04,
+    0xb7, 0xb5, 0xa9, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xba, 0x90, 0x83, 0xb8, 0x85, 0xbe, 0xb3,
+    0xbf, 0xbc, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0x9a, 0x9c, 0x9e, 0x9d, 0x89, 0x9f, 0xda,
+    0xb9, 0x80, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0x81, 0xa8, 0x84, 0xbd, 0xb2, 0xaf,
+    0xa3, 0x8a, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0x8c, 0x8e, 0x8d, 0xa2, 0x88, 0x8f, 0xfe, 0xe0,
+    0xe1, 0x8b, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xf6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xe4, 0xe5, 0xf4, 0xe3, 0xf5, 0xe8,
+    0xe9, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xff, 0xa1, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xf0, 0xf1, 0xf2, 0xf3, 0xe6, 0xe2,
+    0xfc, 0xfb, 0xe7, 0xf8, 0xfd, 0xf9, 0xf7, 0xfa,
+    0xde, 0xc0, 0xc1, 0xd6, 0xc4, 0xc5, 0xd4, 0xc3,
+    0x86, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xd5, 0xc8, 0xc9, 0xca, 0xcb, 0xcc,
+    0x87, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xcd, 0xce, 0xcf, 0xdf, 0xd0, 0xd1,
+    0x5c, 0xa4, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xd2, 0xd3, 0xc6, 0xc2, 0xdc, 0xdb,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xc7, 0xd8, 0xdd, 0xd9, 0xd7, 0xa0};
+
+static const unsigned char utf8map_win880_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0xb6, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x60, 0, 0},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {1, 0x7e, 0, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xd2, 0x90, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {1, 0x7d, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {1, 0x7c, 0, 0},
+    {2, 0xc2, 0xbb, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {1, 0x7b, 0, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xd2, 0x91, 0},
+    {3, 0xe2, 0x84, 0xa2},
+    {3, 0xe2, 0x80, 0x98},
+    {2, 0xc2, 0xae, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xd0, 0x84, 0},
+    {2, 0xc2, 0xab, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa7, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc2, 0xa9, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xd1, 0x94, 0},
+    {2, 0xd1, 0x92, 0},
+    {2, 0xd1, 0x93, 0},
+    {2, 0xd1, 0x91, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {2, 0xd1, 0x95, 0},
+    {2, 0xd1, 0x96, 0},
+    {2, 0xd1, 0x97, 0},
+    {2, 0xd1, 0x98, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xd1, 0x99, 0},
+    {2, 0xd1, 0x9a, 0},
+    {2, 0xd1, 0x9b, 0},
+    {2, 0xd1, 0x9c, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {2, 0xd1, 0x9f, 0},
+    {2, 0xd0, 0xaa, 0},
+    {3, 0xe2, 0x84, 0x96},
+    {2, 0xd0, 0x82, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xd0, 0x83, 0},
+    {2, 0xd0, 0x81, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {2, 0xd0, 0x85, 0},
+    {2, 0xd0, 0x86, 0},
+    {2, 0xd0, 0x87, 0},
+    {2, 0xd0, 0x88, 0},
+    {2, 0xd0, 0x89, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xd0, 0x8a, 0},
+    {2, 0xd0, 0x8b, 0},
+    {2, 0xd0, 0x8c, 0},
+    {2, 0xd1, 0x9e, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xd0, 0x8f, 0},
+    {2, 0xd1, 0x8e, 0},
+    {2, 0xd0, 0xb0, 0},
+    {2, 0xd0, 0xb1, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xd1, 0x86, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xd0, 0xb4, 0},
+    {2, 0xd0, 0xb5, 0},
+    {2, 0xd1, 0x84, 0},
+    {2, 0xd0, 0xb3, 0},
+    {2, 0xd1, 0x85, 0},
+    {2, 0xd0, 0xb8, 0},
+    {2, 0xd0, 0xb9, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xd0, 0xba, 0},
+    {2, 0xd0, 0xbb, 0},
+    {2, 0xd0, 0xbc, 0},
+    {2, 0xd0, 0xbd, 0},
+    {2, 0xd0, 0xbe, 0},
+    {2, 0xd0, 0xbf, 0},
+    {2, 0xd1, 0x8f, 0},
+    {2, 0xd0, 0x8e, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xd1, 0x80, 0},
+    {2, 0xd1, 0x81, 0},
+    {2, 0xd1, 0x82, 0},
+    {2, 0xd1, 0x83, 0},
+    {2, 0xd0, 0xb6, 0},
+    {2, 0xd0, 0xb2, 0},
+    {2, 0xd1, 0x8c, 0},
+    {2, 0xd1, 0x8b, 0},
+    {2, 0xd0, 0xb7, 0},
+    {2, 0xd1, 0x88, 0},
+    {2, 0xd1, 0x8d, 0},
+    {2, 0xd1, 0x89, 0},
+    {2, 0xd1, 0x87, 0},
+    {2, 0xd1, 0x8a, 0},
+    {2, 0xd0, 0xae, 0},
+    {2, 0xd0, 0x90, 0},
+    {2, 0xd0, 0x91, 0},
+    {2, 0xd0, 0xa6, 0},
+    {2, 0xd0, 0x94, 0},
+    {2, 0xd0, 0x95, 0},
+    {2, 0xd0, 0xa4, 0},
+    {2, 0xd0, 0x93, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xd0, 0xa5, 0},
+    {2, 0xd0, 0x98, 0},
+    {2, 0xd0, 0x99, 0},
+    {2, 0xd0, 0x9a, 0},
+    {2, 0xd0, 0x9b, 0},
+    {2, 0xd0, 0x9c, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xd0, 0x9d, 0},
+    {2, 0xd0, 0x9e, 0},
+    {2, 0xd0, 0x9f, 0},
+    {2, 0xd0, 0xaf, 0},
+    {2, 0xd0, 0xa0, 0},
+    {2, 0xd0, 0xa1, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc2, 0xa4, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xd0, 0xa2, 0},
+    {2, 0xd0, 0xa3, 0},
+    {2, 0xd0, 0x96, 0},
+    {2, 0xd0, 0x92, 0},
+    {2, 0xd0, 0xac, 0},
+    {2, 0xd0, 0xab, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xd0, 0x97, 0},
+    {2, 0xd0, 0xa8, 0},
+    {2, 0xd0, 0xad, 0},
+    {2, 0xd0, 0xa9, 0},
+    {2, 0xd0, 0xa7, 0},
+    {2, 0xc2, 0xa0, 0}};
+
+static const Tn5250Uint16 utf8map_win880_keys[512] = {
+    0x0000, 0x0415, 0x0005, 0x041a, 0x000a, 0xffff, 0x041f, 0x000f,
+    0x0424, 0x0014, 0xffff, 0x0429, 0x0019, 0x042e, 0x001e, 0x0433,
+    0xffff, 0x0023, 0x0438, 0x0028, 0x043d, 0xffff, 0x002d, 0x0442,
+    0x0032, 0x0447, 0xffff, 0x0037, 0x044c, 0x003c, 0x0451, 0x0041,
+    0xffff, 0x0456, 0x0046, 0x045b, 0x004b, 0xffff, 0xffff, 0x0050,
+    0xffff, 0x0055, 0x201a, 0xffff, 0x005a, 0xffff, 0x005f, 0xffff,
+    0xffff, 0x0064, 0xffff, 0x0069, 0xffff, 0xffff, 0x006e, 0xffff,
+    0x0073, 0xffff, 0x0078, 0xffff, 0xffff, 0x007d, 0xffff, 0xffff,
+    0x2116, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a0, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0404,
+    0xffff, 0x0409, 0xffff, 0xffff, 0x040e, 0xffff, 0x0413, 0x0003,
+    0xffff, 0x0418, 0x0008, 0x041d, 0x000d, 0xffff, 0x0422, 0x0012,
+    0x0427, 0x0017, 0x042c, 0xffff, 0x001c, 0x0431, 0x0021, 0x0436,
+    0xffff, 0x0026, 0x043b, 0x002b, 0x0440, 0x0030, 0xffff, 0x0445,
+    0x0035, 0x044a, 0x003a, 0xffff, 0x044f, 0x003f, 0x0454, 0x0044,
+    0xffff, 0x0459, 0x0049, 0x045e, 0x004e, 0x2013, 0xffff, 0x0053,
+    0x2018, 0x0058, 0x201d, 0xffff, 0x005d, 0x2022, 0x0062, 0xffff,
+    0x0067, 0xffff, 0xffff, 0x006c, 0xffff, 0x0071, 0xffff, 0xffff,
+    0x0076, 0xffff, 0x007b, 0xffff, 0x0490, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00ad, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x00b7, 0xffff, 0xffff, 0xffff, 0x0402, 0xffff, 0xffff, 0x0407,
+    0xffff, 0x040c, 0xffff, 0xffff, 0x0411, 0x0001, 0x0416, 0x0006,
+    0xffff, 0x041b, 0x000b, 0x0420, 0x0010, 0x0425, 0xffff, 0x0015,
+    0x042a, 0x001a, 0x042f, 0xffff, 0x001f, 0x0434, 0x0024, 0x0439,
+    0x0029, 0xffff, 0x043e, 0x002e, 0x0443, 0x0033, 0xffff, 0x0448,
+    0x0038, 0x044d, 0x003d, 0xffff, 0x0452, 0x0042, 0x0457, 0x0047,
+    0x045c, 0xffff, 0x004c, 0xffff, 0x0051, 0xffff, 0xffff, 0x0056,
+    0xffff, 0x005b, 0x2020, 0x0060, 0xffff, 0xffff, 0x0065, 0xffff,
+    0x006a, 0xffff, 0xffff, 0x006f, 0xffff, 0x0074, 0x2039, 0xffff,
+    0x0079, 0xffff, 0x007e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a6, 0xffff,
+    0x00ab, 0xffff, 0xffff, 0x00b0, 0xffff, 0x00b5, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0405, 0xffff, 0xffff, 0x040a,
+    0xffff, 0x040f, 0xffff, 0x0414, 0xffff, 0x0004, 0x0419, 0x0009,
+    0x041e, 0xffff, 0x000e, 0x0423, 0x0013, 0x0428, 0x0018, 0x20ac,
+    0x042d, 0x001d, 0x0432, 0x0022, 0xffff, 0x0437, 0x0027, 0x043c,
+    0x002c, 0xffff, 0x0441, 0x0031, 0x0446, 0x0036, 0x044b, 0xffff,
+    0x003b, 0xffff, 0x0040, 0x0455, 0xffff, 0x0045, 0x045a, 0x004a,
+    0x045f, 0xffff, 0x004f, 0x2014, 0x0054, 0x2019, 0x0059, 0x201e,
+    0xffff, 0x005e, 0xffff, 0x0063, 0xffff, 0xffff, 0x0068, 0xffff,
+    0x006d, 0xffff, 0xffff, 0x0072, 0xffff, 0x0077, 0xffff, 0xffff,
+    0x007c, 0x0491, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00a4, 0xffff, 0xffff, 0x00a9, 0xffff,
+    0x00ae, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0403, 0xffff, 0x0408, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0412, 0x0002, 0x0417, 0xffff, 0x0007, 0x041c, 0x000c,
+    0x0421, 0x0011, 0xffff, 0x0426, 0x0016, 0x042b, 0x001b, 0xffff,
+    0x0430, 0x0020, 0x0435, 0x0025, 0xffff, 0x043a, 0x002a, 0x043f,
+    0x002f, 0x0444, 0xffff, 0x0034, 0x0449, 0x0039, 0x044e, 0xffff,
+    0x003e, 0x0453, 0x0043, 0x0458, 0x0048, 0xffff, 0xffff, 0x004d,
+    0xffff, 0x0052, 0xffff, 0xffff, 0x0057, 0x201c, 0x005c, 0x2021,
+    0xffff, 0x0061, 0x2026, 0x0066, 0xffff, 0xffff, 0x006b, 0x2030,
+    0x0070, 0xffff, 0xffff, 0x0075, 0x203a, 0x007a, 0xffff, 0x007f,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2122,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00a7, 0xffff, 0xffff, 0x00ac, 0xffff,
+    0x00b1, 0xffff, 0x00b6, 0xffff, 0xffff, 0x00bb, 0xffff, 0x0401,
+    0xffff, 0x0406, 0xffff, 0xffff, 0x040b, 0xffff, 0x0410, 0xffff};
+
+static const unsigned char utf8map_win880_values[512] = {
+    0x00, 0xbd, 0x2d, 0xcd, 0x25, 0x00, 0xdc, 0x0f,
+    0xbe, 0x3c, 0x00, 0xfd, 0x19, 0xb8, 0x1e, 0x8d,
+    0x00, 0x7b, 0x8f, 0x4d, 0x9d, 0x00, 0x60, 0xac,
+    0xf2, 0xb6, 0x00, 0xf7, 0xb0, 0x4c, 0x44, 0xc1,
+    0x00, 0x47, 0xc6, 0x53, 0xd2, 0x00, 0x00, 0xd7,
+    0x00, 0xe4, 0x22, 0x00, 0xe9, 0x00, 0x6d, 0x00,
+    0x00, 0x84, 0x00, 0x89, 0x00, 0x00, 0x95, 0x00,
+    0xa2, 0x00, 0xa7, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x69, 0x00, 0x00, 0xa1, 0x00, 0xbf, 0x03,
+    0x00, 0xcb, 0x16, 0xda, 0x0d, 0x00, 0xea, 0x12,
+    0xfe, 0x26, 0xee, 0x00, 0x1c, 0x78, 0x4f, 0xae,
+    0x00, 0x50, 0x9b, 0x4e, 0xaa, 0xf0, 0x00, 0x8e,
+    0xf5, 0xb7, 0x7a, 0x00, 0xa0, 0x6f, 0x41, 0xc4,
+    0x00, 0x51, 0xc9, 0x73, 0xd5, 0x1a, 0x00, 0xe2,
+    0x2a, 0xe7, 0x3b, 0x00, 0x5a, 0x3e, 0x82, 0x00,
+    0x87, 0x00, 0x00, 0x93, 0x00, 0x98, 0x00, 0x00,
+    0xa5, 0x00, 0x23, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x67,
+    0x00, 0x72, 0x00, 0x00, 0xba, 0x01, 0xec, 0x2e,
+    0x00, 0xce, 0x0b, 0xde, 0x10, 0xca, 0x00, 0x3d,
+    0x57, 0x3f, 0xdd, 0x00, 0x1f, 0x8a, 0x5b, 0x90,
+    0x5d, 0x00, 0x9e, 0x4b, 0xad, 0xf3, 0x00, 0xb3,
+    0xf8, 0xb4, 0x7e, 0x00, 0x42, 0xc2, 0x48, 0xc7,
+    0x54, 0x00, 0xd3, 0x00, 0xd8, 0x00, 0x00, 0xe5,
+    0x00, 0x4a, 0xc0, 0x09, 0x00, 0x00, 0x85, 0x00,
+    0x91, 0x00, 0x00, 0x96, 0x00, 0xa3, 0x79, 0x00,
+    0xa8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x00,
+    0x31, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x70,
+    0x00, 0x75, 0x00, 0xbc, 0x00, 0x37, 0xcc, 0x05,
+    0xdb, 0x00, 0x0e, 0xeb, 0x13, 0xfb, 0x18, 0x74,
+    0xfc, 0x1d, 0xaf, 0x7f, 0x00, 0xb2, 0x7d, 0x9c,
+    0x6b, 0x00, 0xab, 0xf1, 0x80, 0xf6, 0xb1, 0x00,
+    0x5e, 0x00, 0x7c, 0x46, 0x00, 0xc5, 0x52, 0xd1,
+    0x56, 0x00, 0xd6, 0x34, 0xe3, 0x2c, 0xe8, 0x64,
+    0x00, 0x5f, 0x00, 0x83, 0x00, 0x00, 0x88, 0x00,
+    0x94, 0x00, 0x00, 0x99, 0x00, 0xa6, 0x00, 0x00,
+    0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x3a, 0x00,
+    0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x62, 0x00, 0x68, 0x00, 0x00, 0x00,
+    0x00, 0xed, 0x02, 0xfa, 0x00, 0x2f, 0xcf, 0x0c,
+    0xdf, 0x11, 0x00, 0xbb, 0x32, 0xef, 0x27, 0x00,
+    0x77, 0x40, 0x8b, 0x6c, 0x00, 0x9a, 0x5c, 0x9f,
+    0x61, 0x8c, 0x00, 0xf4, 0xb5, 0xf9, 0x76, 0x00,
+    0x6e, 0x43, 0xc3, 0x49, 0xc8, 0x00, 0x00, 0xd4,
+    0x00, 0xd9, 0x00, 0x00, 0xe6, 0x0a, 0xe0, 0xd0,
+    0x00, 0x81, 0x45, 0x86, 0x00, 0x00, 0x92, 0x55,
+    0x97, 0x00, 0x00, 0xa4, 0x14, 0xa9, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x08, 0x00,
+    0x06, 0x00, 0x04, 0x00, 0x00, 0x21, 0x00, 0x63,
+    0x00, 0x66, 0x00, 0x00, 0x71, 0x00, 0xb9, 0x00};
+
+/* Map win420 (WINDOWS-1256) */
+
+static unsigned char const charmap_win420_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x24, 0x2a, 0x29, 0x3b, 0x6d,
+    0x09, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x23, 0x4f, 0x1b, 0x15, 0x07,
+    0x45, 0xdf, 0xb2, 0xea, 0x64, 0xb4, 0x66, 0xb8,
+    0xeb, 0xed, 0xee, 0x9c, 0xef, 0xfb, 0xfc, 0xfd,
+    0xfe, 0x14, 0x2c, 0x0a, 0xac, 0x3e, 0x1a, 0x70,
+    0xc0, 0x72, 0xd0, 0x9b, 0x46, 0x47, 0x49, 0x9f,
+    0x41, 0x52, 0x22, 0xbe, 0xe1, 0x55, 0x6a, 0x78,
+    0x56, 0x3a, 0x58, 0x2b, 0x5f, 0xca, 0xae, 0x51,
+    0xb0, 0xdd, 0x62, 0x63, 0x65, 0xb5, 0xb6, 0xb7,
+    0x67, 0xb9, 0x69, 0xde, 0x71, 0x73, 0x74, 0x75,
+    0xbc, 0x76, 0x35, 0x43, 0x77, 0x80, 0x8b, 0x9d,
+    0x48, 0x06, 0x20, 0xcb, 0x8d, 0x8f, 0xce, 0xa0,
+    0x4a, 0x9a, 0x9e, 0x44, 0x28, 0xab, 0xad, 0xe0,
+    0xaf, 0x04, 0x79, 0xdb, 0x57, 0xb1, 0xbb, 0xbd,
+    0x17, 0xbf, 0x53, 0x54, 0xcf, 0xda, 0xdc, 0xaa,
+    0x59, 0x21, 0xb3, 0x68, 0xec, 0xba, 0x8a, 0x8c,
+    0x30, 0x31, 0x08, 0x33, 0x34, 0x42, 0x36, 0xa1,
+    0x38, 0x39, 0xfa, 0xcc, 0x8e, 0xcd, 0x90, 0xff};
+
+static unsigned char const charmap_win420_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xd9, 0x09, 0xc9, 0x7f,
+    0xf2, 0x60, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x91, 0x7e, 0x08, 0xe0,
+    0x18, 0x19, 0x96, 0x7d, 0x1c, 0x1d, 0x1e, 0x1f,
+    0xca, 0xe9, 0xa2, 0x7b, 0x5b, 0x0a, 0x17, 0x1b,
+    0xd4, 0x5d, 0x5c, 0xab, 0x92, 0x05, 0x06, 0x07,
+    0xf0, 0xf1, 0x16, 0xf3, 0xf4, 0xc2, 0xf6, 0x04,
+    0xf8, 0xf9, 0xa9, 0x5e, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xf5, 0xc3, 0xd3, 0x80, 0x9c, 0x9d,
+    0xc8, 0x9e, 0xd0, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xaf, 0xa1, 0xe2, 0xe3, 0xa5, 0xa8, 0xdc,
+    0xaa, 0xe8, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xb2, 0xb3, 0x84, 0xb4, 0x86, 0xb8,
+    0xeb, 0xba, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0x97, 0xbc, 0x99, 0xbd, 0xbe, 0xbf, 0xc1, 0xc4,
+    0xa7, 0xda, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xc5, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xee, 0xc6, 0xef, 0xcc, 0xfc, 0xcd,
+    0xfe, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xd1, 0x9b, 0x8b, 0xc7, 0xd2, 0x9f,
+    0xcf, 0xf7, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xe7, 0xd5, 0x94, 0xd6, 0xae, 0xd8,
+    0xb0, 0xdd, 0x82, 0xea, 0x85, 0xb5, 0xb6, 0xb7,
+    0x87, 0xb9, 0xed, 0xde, 0xc0, 0xdf, 0xa3, 0xe1,
+    0x98, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xcb, 0xfb, 0xfd, 0xce, 0xe4,
+    0x9a, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xe5, 0xdb, 0xe6, 0xb1, 0xbb, 0x81,
+    0xd7, 0xa4, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0x83, 0x88, 0xec, 0x89, 0x8a, 0x8c,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xfa, 0x8d, 0x8e, 0x8f, 0x90, 0xff};
+
+static const unsigned char utf8map_win420_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xd8, 0xb8, 0},
+    {1, 0x09, 0, 0},
+    {2, 0xd8, 0xa9, 0},
+    {1, 0x7f, 0, 0},
+    {2, 0xd9, 0x8d, 0},
+    {1, 0x60, 0, 0},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {1, 0x7e, 0, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xc3, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {1, 0x7d, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xd8, 0xaa, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {2, 0xd8, 0xb4, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xd9, 0x8b, 0},
+    {2, 0xd9, 0x8c, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xd9, 0x8e, 0},
+    {2, 0xc3, 0xb4, 0},
+    {2, 0xd8, 0xa2, 0},
+    {2, 0xd9, 0x90, 0},
+    {1, 0x04, 0, 0},
+    {2, 0xd9, 0x91, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc2, 0xa9, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xd9, 0x8f, 0},
+    {2, 0xd8, 0xa3, 0},
+    {2, 0xd8, 0xb3, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x8c},
+    {2, 0xd8, 0xa8, 0},
+    {3, 0xe2, 0x80, 0x8d},
+    {2, 0xd8, 0xb0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xd8, 0x8c, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xd9, 0x85, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xd9, 0x80, 0},
+    {2, 0xda, 0xbe, 0},
+    {2, 0xc3, 0xa8, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc2, 0xb3, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {2, 0xc2, 0xb4, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xd8, 0x9b, 0},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {2, 0xc2, 0xbc, 0},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xd8, 0x9f, 0},
+    {2, 0xd8, 0xa1, 0},
+    {2, 0xd8, 0xa4, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xd8, 0xb9, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xd8, 0xa5, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xd8, 0xa6, 0},
+    {2, 0xc3, 0xaf, 0},
+    {2, 0xd8, 0xac, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xd8, 0xad, 0},
+    {3, 0xe2, 0x80, 0x8f},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xd8, 0xb1, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xd8, 0xa7, 0},
+    {2, 0xd8, 0xb2, 0},
+    {2, 0xda, 0xba, 0},
+    {2, 0xd8, 0xaf, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc3, 0xa7, 0},
+    {2, 0xd8, 0xb5, 0},
+    {3, 0xe2, 0x80, 0x9d},
+    {2, 0xd8, 0xb6, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xd8, 0xb7, 0},
+    {2, 0xc2, 0xb0, 0},
+    {2, 0xd9, 0x81, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {2, 0xc3, 0xaa, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xb7, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xd9, 0x8a, 0},
+    {2, 0xd9, 0x82, 0},
+    {2, 0xdb, 0x81, 0},
+    {2, 0xd9, 0x83, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xd9, 0x84, 0},
+    {2, 0xda, 0xa9, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xd8, 0xab, 0},
+    {2, 0xc3, 0xbb, 0},
+    {3, 0xe2, 0x80, 0x8e},
+    {2, 0xd8, 0xae, 0},
+    {2, 0xd9, 0x86, 0},
+    {2, 0xda, 0x91, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xd9, 0x87, 0},
+    {2, 0xd8, 0xba, 0},
+    {2, 0xd9, 0x88, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xbb, 0},
+    {2, 0xd9, 0xbe, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc2, 0xa4, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xcb, 0x86, 0},
+    {2, 0xd9, 0x89, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {2, 0xd9, 0xb9, 0},
+    {2, 0xc5, 0x92, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xd9, 0x92, 0},
+    {2, 0xda, 0x86, 0},
+    {2, 0xda, 0x98, 0},
+    {2, 0xda, 0x88, 0},
+    {2, 0xda, 0xaf, 0},
+    {2, 0xdb, 0x92, 0}};
+
+static const Tn5250Uint16 utf8map_win420_keys[512] = {
+    0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a3, 0x0646, 0xffff,
+    0x0627, 0x0065, 0xffff, 0x0046, 0xffff, 0x0027, 0xffff, 0x0008,
+    0xffff, 0x00e9, 0xffff, 0xffff, 0x2018, 0x00ab, 0x064e, 0xffff,
+    0x062f, 0x006d, 0xffff, 0x004e, 0xffff, 0x002f, 0x06d2, 0x0010,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x2020, 0x00b3, 0xffff, 0xffff,
+    0x0637, 0x0075, 0xffff, 0x0056, 0xffff, 0x0037, 0xffff, 0x0018,
+    0xffff, 0x00f9, 0xffff, 0xffff, 0xffff, 0x00bb, 0xffff, 0xffff,
+    0xffff, 0x007d, 0xffff, 0x005e, 0x20ac, 0x003f, 0xffff, 0x0020,
+    0xffff, 0x0001, 0xffff, 0x00e2, 0x2030, 0xffff, 0xffff, 0x00a4,
+    0x0647, 0xffff, 0x0628, 0x0066, 0xffff, 0x0047, 0xffff, 0x0028,
+    0xffff, 0x0009, 0xffff, 0x00ea, 0xffff, 0xffff, 0x2019, 0x00ac,
+    0x064f, 0xffff, 0x0630, 0x006e, 0xffff, 0x004f, 0xffff, 0x0030,
+    0xffff, 0x0011, 0xffff, 0xffff, 0xffff, 0xffff, 0x2021, 0x00b4,
+    0xffff, 0xffff, 0x0638, 0x0076, 0xffff, 0x0057, 0xffff, 0x0038,
+    0xffff, 0x0019, 0xffff, 0xffff, 0xffff, 0xffff, 0x067e, 0x00bc,
+    0xffff, 0xffff, 0x0640, 0x007e, 0x0621, 0x005f, 0xffff, 0x0040,
+    0xffff, 0x0021, 0xffff, 0x0002, 0xffff, 0xffff, 0x0686, 0xffff,
+    0xffff, 0x00a5, 0x0648, 0xffff, 0x0629, 0x0067, 0xffff, 0x0048,
+    0xffff, 0x0029, 0xffff, 0x000a, 0xffff, 0x00eb, 0x2039, 0xffff,
+    0x201a, 0x00ad, 0x0650, 0xffff, 0x0631, 0x006f, 0xffff, 0x0050,
+    0xffff, 0x0031, 0xffff, 0x0012, 0xffff, 0xffff, 0xffff, 0x2122,
+    0x2022, 0x00b5, 0xffff, 0xffff, 0x0639, 0x0077, 0xffff, 0x0058,
+    0xffff, 0x0039, 0xffff, 0x001a, 0xffff, 0x00fb, 0xffff, 0xffff,
+    0xffff, 0x00bd, 0xffff, 0xffff, 0x0641, 0x007f, 0x0622, 0x0060,
+    0xffff, 0x0041, 0xffff, 0x0022, 0xffff, 0x0003, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2013, 0x00a6, 0x0649, 0xffff, 0x062a, 0x0068,
+    0xffff, 0x0049, 0xffff, 0x002a, 0xffff, 0x000b, 0xffff, 0xffff,
+    0x203a, 0xffff, 0xffff, 0x00ae, 0x0651, 0xffff, 0x0632, 0x0070,
+    0xffff, 0x0051, 0xffff, 0x0032, 0xffff, 0x0013, 0xffff, 0x00f4,
+    0xffff, 0xffff, 0xffff, 0x00b6, 0xffff, 0xffff, 0x063a, 0x0078,
+    0x061b, 0x0059, 0xffff, 0x003a, 0xffff, 0x001b, 0x06be, 0x00fc,
+    0xffff, 0xffff, 0xffff, 0x00be, 0x200c, 0xffff, 0x0642, 0xffff,
+    0x0623, 0x0061, 0xffff, 0x0042, 0xffff, 0x0023, 0xffff, 0x0004,
+    0xffff, 0x02c6, 0x0688, 0xffff, 0x2014, 0x00a7, 0x064a, 0xffff,
+    0x062b, 0x0069, 0x060c, 0x004a, 0xffff, 0x002b, 0xffff, 0x000c,
+    0x06af, 0xffff, 0xffff, 0xffff, 0x201c, 0x00af, 0x0652, 0xffff,
+    0x0633, 0x0071, 0x0152, 0x0052, 0xffff, 0x0033, 0xffff, 0x0014,
+    0xffff, 0xffff, 0x0698, 0xffff, 0x0679, 0x00b7, 0xffff, 0xffff,
+    0xffff, 0x0079, 0xffff, 0x005a, 0xffff, 0x003b, 0xffff, 0x001c,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x200d, 0x00a0,
+    0x0643, 0xffff, 0x0624, 0x0062, 0xffff, 0x0043, 0xffff, 0x0024,
+    0xffff, 0x0005, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00a8,
+    0x064b, 0xffff, 0x062c, 0x006a, 0xffff, 0x004b, 0xffff, 0x002c,
+    0xffff, 0x000d, 0xffff, 0x00ee, 0x0691, 0xffff, 0x201d, 0x00b0,
+    0xffff, 0xffff, 0x0634, 0x0072, 0x0153, 0x0053, 0xffff, 0x0034,
+    0xffff, 0x0015, 0xffff, 0xffff, 0xffff, 0x00d7, 0xffff, 0x00b8,
+    0xffff, 0xffff, 0xffff, 0x007a, 0xffff, 0x005b, 0xffff, 0x003c,
+    0xffff, 0x001d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x200e, 0xffff, 0x0644, 0xffff, 0x0625, 0x0063, 0xffff, 0x0044,
+    0xffff, 0x0025, 0xffff, 0x0006, 0x06a9, 0x00e7, 0xffff, 0xffff,
+    0xffff, 0x00a9, 0x064c, 0xffff, 0x062d, 0x006b, 0xffff, 0x004c,
+    0xffff, 0x002d, 0xffff, 0x000e, 0xffff, 0x00ef, 0xffff, 0xffff,
+    0x201e, 0x00b1, 0x0192, 0xffff, 0x0635, 0x0073, 0xffff, 0x0054,
+    0xffff, 0x0035, 0xffff, 0x0016, 0xffff, 0x00f7, 0xffff, 0xffff,
+    0x2026, 0x00b9, 0xffff, 0xffff, 0xffff, 0x007b, 0xffff, 0x005c,
+    0xffff, 0x003d, 0xffff, 0x001e, 0x06c1, 0xffff, 0xffff, 0x00e0,
+    0xffff, 0xffff, 0x200f, 0x00a2, 0x0645, 0xffff, 0x0626, 0x0064,
+    0xffff, 0x0045, 0xffff, 0x0026, 0xffff, 0x0007, 0xffff, 0x00e8,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x064d, 0xffff, 0x062e, 0x006c,
+    0xffff, 0x004d, 0xffff, 0x002e, 0xffff, 0x000f, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00b2, 0xffff, 0xffff, 0x0636, 0x0074,
+    0xffff, 0x0055, 0xffff, 0x0036, 0xffff, 0x0017, 0x06ba, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007c,
+    0x061f, 0x005d, 0xffff, 0x003e, 0xffff, 0x001f, 0xffff, 0xffff};
+
+static const unsigned char utf8map_win420_values[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xcf, 0x00,
+    0x9d, 0x85, 0x00, 0xc6, 0x00, 0x7d, 0x00, 0x16,
+    0x00, 0x21, 0x00, 0x00, 0x14, 0x2b, 0x33, 0x00,
+    0xa0, 0x94, 0x00, 0xd5, 0x00, 0x61, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x63, 0x00, 0x00,
+    0xaf, 0xa4, 0x00, 0xe5, 0x00, 0xf7, 0x00, 0x18,
+    0x00, 0x39, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00,
+    0x00, 0x1b, 0x00, 0x3b, 0x45, 0x6f, 0x00, 0x40,
+    0x00, 0x01, 0x00, 0x53, 0xed, 0x00, 0x00, 0xe1,
+    0xda, 0x00, 0x48, 0x86, 0x00, 0xc7, 0x00, 0x4d,
+    0x00, 0x05, 0x00, 0xb3, 0x00, 0x00, 0x2c, 0x5f,
+    0x42, 0x00, 0x4a, 0x95, 0x00, 0xd6, 0x00, 0xf0,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x65,
+    0x00, 0x00, 0x04, 0xa5, 0x00, 0xe6, 0x00, 0xf8,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x71,
+    0x00, 0x00, 0x57, 0x15, 0x76, 0x6d, 0x00, 0x7c,
+    0x00, 0x5a, 0x00, 0x02, 0x00, 0x00, 0xfb, 0x00,
+    0x00, 0x55, 0xdc, 0x00, 0x06, 0x87, 0x00, 0xc8,
+    0x00, 0x5d, 0x00, 0x25, 0x00, 0x68, 0x9c, 0x00,
+    0xb2, 0xca, 0x36, 0x00, 0x9a, 0x96, 0x00, 0xd7,
+    0x00, 0xf1, 0x00, 0x12, 0x00, 0x00, 0x00, 0x72,
+    0x3e, 0xb5, 0x00, 0x00, 0x79, 0xa6, 0x00, 0xe7,
+    0x00, 0xf9, 0x00, 0x3f, 0x00, 0xcc, 0x00, 0x00,
+    0x00, 0x73, 0x00, 0x00, 0xb1, 0x07, 0x35, 0x09,
+    0x00, 0xc1, 0x00, 0x7f, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x6a, 0xec, 0x00, 0x20, 0x88,
+    0x00, 0xc9, 0x00, 0x5c, 0x00, 0x0b, 0x00, 0x00,
+    0x9b, 0x00, 0x00, 0xae, 0x38, 0x00, 0x9e, 0x97,
+    0x00, 0xd8, 0x00, 0xf2, 0x00, 0x13, 0x00, 0x34,
+    0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0xdb, 0xa7,
+    0x69, 0xe8, 0x00, 0x7a, 0x00, 0x27, 0x58, 0x8e,
+    0x00, 0x00, 0x00, 0x74, 0x47, 0x00, 0xbb, 0x00,
+    0x43, 0x81, 0x00, 0xc2, 0x00, 0x7b, 0x00, 0x37,
+    0x00, 0xeb, 0xfd, 0x00, 0x70, 0x78, 0xba, 0x00,
+    0xcb, 0x89, 0x52, 0xd1, 0x00, 0x4e, 0x00, 0x0c,
+    0xfe, 0x00, 0x00, 0x00, 0x0a, 0x51, 0xfa, 0x00,
+    0x44, 0x98, 0xef, 0xd9, 0x00, 0xf3, 0x00, 0x3c,
+    0x00, 0x00, 0xfc, 0x00, 0xee, 0xb7, 0x00, 0x00,
+    0x00, 0xa8, 0x00, 0xe9, 0x00, 0x5e, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x41,
+    0xbd, 0x00, 0x77, 0x82, 0x00, 0xc3, 0x00, 0x5b,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+    0x30, 0x00, 0x8d, 0x91, 0x00, 0xd2, 0x00, 0x6b,
+    0x00, 0x0d, 0x00, 0x8a, 0xd0, 0x00, 0xac, 0xb0,
+    0x00, 0x00, 0x28, 0x99, 0x46, 0xe2, 0x00, 0xf4,
+    0x00, 0x3d, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x67,
+    0x00, 0x00, 0x00, 0xa9, 0x00, 0x24, 0x00, 0x4c,
+    0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0x00, 0xbf, 0x00, 0x80, 0x83, 0x00, 0xc4,
+    0x00, 0x6c, 0x00, 0x2e, 0xc0, 0xaa, 0x00, 0x00,
+    0x00, 0x3a, 0x31, 0x00, 0x8f, 0x92, 0x00, 0xd3,
+    0x00, 0x60, 0x00, 0x0e, 0x00, 0x8c, 0x00, 0x00,
+    0x64, 0xdd, 0xea, 0x00, 0xab, 0xa2, 0x00, 0xe3,
+    0x00, 0xf5, 0x00, 0x32, 0x00, 0xa1, 0x00, 0x00,
+    0xb4, 0xb9, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2a,
+    0x00, 0x7e, 0x00, 0x1e, 0xbc, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x90, 0x22, 0x54, 0x00, 0x8b, 0x84,
+    0x00, 0xc5, 0x00, 0x50, 0x00, 0x2f, 0x00, 0x59,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xce, 0x93,
+    0x00, 0xd4, 0x00, 0x4b, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0xad, 0xa3,
+    0x00, 0xe4, 0x00, 0xf6, 0x00, 0x26, 0x9f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+    0x75, 0x29, 0x00, 0x6e, 0x00, 0x1f, 0x00, 0x00};
+
+/* Map win875 (WINDOWS-1253) */
+
+static unsigned char const charmap_win875_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x4a, 0xe0, 0x5a, 0x5f, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x20, 0xd0, 0xa1, 0x07,
+    0x15, 0x22, 0x28, 0x2b, 0x21, 0x17, 0x30, 0x39,
+    0xdc, 0x36, 0xe1, 0x2c, 0x3a, 0x6a, 0x33, 0x1b,
+    0x74, 0xce, 0xde, 0x0a, 0x3b, 0x3e, 0x1a, 0x09,
+    0x34, 0x2a, 0x24, 0x14, 0x29, 0xfd, 0x38, 0xec,
+    0xa0, 0x80, 0x71, 0xb0, 0x08, 0x35, 0xdf, 0xeb,
+    0x70, 0xfb, 0xed, 0xee, 0xef, 0xca, 0x31, 0xcf,
+    0x90, 0xda, 0xea, 0xfa, 0x23, 0x04, 0xfc, 0xdd,
+    0x72, 0x73, 0x75, 0xfe, 0x76, 0xdb, 0x77, 0x78,
+    0xb4, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x06, 0x59, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0xb1, 0xb2, 0xb3, 0xb5,
+    0xb8, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x9a,
+    0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xaa, 0xab, 0xac,
+    0xad, 0xae, 0xba, 0xaf, 0xbb, 0xbc, 0xbd, 0xbe,
+    0xbf, 0xcb, 0xcc, 0xcd, 0xb6, 0xb7, 0xb9, 0xff};
+
+static unsigned char const charmap_win875_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0xb5, 0x09, 0xd2, 0x7f,
+    0xa4, 0x97, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x9b, 0x80, 0x08, 0x85,
+    0x18, 0x19, 0x96, 0x8f, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x7c, 0x84, 0x81, 0xb4, 0x9a, 0x0a, 0x17, 0x1b,
+    0x82, 0x9c, 0x99, 0x83, 0x8b, 0x05, 0x06, 0x07,
+    0x86, 0xae, 0x16, 0x8e, 0x98, 0xa5, 0x89, 0x04,
+    0x9e, 0x87, 0x8c, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0x5b, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0,
+    0xd1, 0xd3, 0x5d, 0x24, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+    0xda, 0xdb, 0x8d, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xa8, 0xa2, 0xb8, 0xb9, 0x90, 0xba, 0xbc, 0xbe,
+    0xbf, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0xa1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec,
+    0xa0, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf3,
+    0xa3, 0xdc, 0xdd, 0xde, 0xc0, 0xdf, 0xfc, 0xfd,
+    0xe0, 0xfe, 0xf2, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf9, 0xfa, 0xfb, 0x91, 0xaf,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb1, 0xbd, 0x88, 0xb7, 0x92, 0xa6,
+    0x5c, 0x8a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xa7, 0x9f, 0xaa, 0xab, 0xac,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xa9, 0xb6, 0x9d, 0xbb, 0xff};
+
+static const unsigned char utf8map_win875_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x09, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x7f, 0, 0},
+    {2, 0xc2, 0xa4, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xe2, 0x82, 0xac},
+    {1, 0x08, 0, 0},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {1, 0x7c, 0, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xce, 0x84, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x16, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa5, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {1, 0x04, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xa1},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xce, 0x91, 0},
+    {2, 0xce, 0x92, 0},
+    {2, 0xce, 0x93, 0},
+    {2, 0xce, 0x94, 0},
+    {2, 0xce, 0x95, 0},
+    {2, 0xce, 0x96, 0},
+    {2, 0xce, 0x97, 0},
+    {2, 0xce, 0x98, 0},
+    {2, 0xce, 0x99, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xce, 0x9a, 0},
+    {2, 0xce, 0x9b, 0},
+    {2, 0xce, 0x9c, 0},
+    {2, 0xce, 0x9d, 0},
+    {2, 0xce, 0x9e, 0},
+    {2, 0xce, 0x9f, 0},
+    {2, 0xce, 0xa0, 0},
+    {2, 0xce, 0xa1, 0},
+    {2, 0xce, 0xa3, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xce, 0xa4, 0},
+    {2, 0xce, 0xa5, 0},
+    {2, 0xce, 0xa6, 0},
+    {2, 0xce, 0xa7, 0},
+    {2, 0xce, 0xa8, 0},
+    {2, 0xce, 0xa9, 0},
+    {2, 0xce, 0xaa, 0},
+    {2, 0xce, 0xab, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xce, 0x86, 0},
+    {2, 0xce, 0x88, 0},
+    {2, 0xce, 0x89, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xce, 0x8a, 0},
+    {2, 0xce, 0x8c, 0},
+    {2, 0xce, 0x8e, 0},
+    {2, 0xce, 0x8f, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xce, 0x85, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xce, 0xb1, 0},
+    {2, 0xce, 0xb2, 0},
+    {2, 0xce, 0xb3, 0},
+    {2, 0xce, 0xb4, 0},
+    {2, 0xce, 0xb5, 0},
+    {2, 0xce, 0xb6, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xce, 0xb7, 0},
+    {2, 0xce, 0xb8, 0},
+    {2, 0xce, 0xb9, 0},
+    {2, 0xce, 0xba, 0},
+    {2, 0xce, 0xbb, 0},
+    {2, 0xce, 0xbc, 0},
+    {2, 0xc2, 0xa0, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xce, 0xbd, 0},
+    {2, 0xce, 0xbe, 0},
+    {2, 0xce, 0xbf, 0},
+    {2, 0xcf, 0x80, 0},
+    {2, 0xcf, 0x81, 0},
+    {2, 0xcf, 0x83, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xce, 0xac, 0},
+    {2, 0xce, 0xad, 0},
+    {2, 0xce, 0xae, 0},
+    {2, 0xce, 0x90, 0},
+    {2, 0xce, 0xaf, 0},
+    {2, 0xcf, 0x8c, 0},
+    {2, 0xcf, 0x8d, 0},
+    {2, 0xce, 0xb0, 0},
+    {2, 0xcf, 0x8e, 0},
+    {2, 0xcf, 0x82, 0},
+    {2, 0xcf, 0x84, 0},
+    {2, 0xcf, 0x85, 0},
+    {2, 0xcf, 0x86, 0},
+    {2, 0xcf, 0x87, 0},
+    {2, 0xcf, 0x88, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xcf, 0x89, 0},
+    {2, 0xcf, 0x8a, 0},
+    {2, 0xcf, 0x8b, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0x95},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xbd, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb7, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x5c, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc2, 0xa7, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xb6, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xbb, 0},
+    {3, 0xef, 0xbf, 0xbd}};
+
+static const Tn5250Uint16 utf8map_win875_keys[512] = {
+    0x0000, 0x001c, 0x0038, 0x0054, 0x0070, 0xffff, 0x00a8, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2020, 0xffff, 0xffff,
+    0x039f, 0x03bb, 0x20ac, 0x0019, 0x0035, 0x0051, 0x006d, 0xffff,
+    0x00a5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x201d,
+    0x2039, 0xffff, 0x039c, 0x03b8, 0xffff, 0x0016, 0x0032, 0x004e,
+    0x006a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x201a, 0xffff, 0xffff, 0x0399, 0x03b5, 0xffff, 0x0013,
+    0x002f, 0x004b, 0x0067, 0xffff, 0xffff, 0x00bb, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0396, 0x03b2,
+    0x03ce, 0x0010, 0x002c, 0x0048, 0x0064, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2014, 0x2030, 0xffff,
+    0x0393, 0x03af, 0x03cb, 0x000d, 0x0029, 0x0045, 0xffff, 0x0061,
+    0x007d, 0xffff, 0x00b5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0390, 0x03ac, 0x03c8, 0x000a, 0x0026,
+    0x0042, 0x005e, 0x007a, 0xffff, 0x00b2, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0192, 0xffff, 0x03a9, 0x03c5,
+    0x0007, 0x0023, 0x003f, 0x005b, 0x0077, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x038a,
+    0x03a6, 0x03c2, 0x0004, 0x0020, 0x003c, 0x0058, 0x0074, 0xffff,
+    0x00ac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x03a3, 0x03bf, 0x0001, 0x001d, 0x0039, 0x0055,
+    0x0071, 0xffff, 0x00a9, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x2021, 0xffff, 0x0384, 0x03a0, 0x03bc, 0xffff, 0x001a,
+    0x0036, 0x0052, 0x006e, 0xffff, 0xffff, 0x00a6, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x201e, 0x203a, 0xffff, 0x039d, 0x03b9,
+    0xffff, 0x0017, 0xffff, 0x0033, 0x004f, 0x006b, 0xffff, 0x00a3,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x039a, 0x03b6, 0xffff, 0x0014, 0x0030, 0x004c, 0x0068,
+    0xffff, 0x00a0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2018, 0xffff, 0xffff, 0x0397, 0x03b3, 0xffff, 0x0011, 0x002d,
+    0x0049, 0x0065, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x2015, 0xffff, 0xffff, 0x0394, 0x03b0, 0x03cc,
+    0x000e, 0x002a, 0x0046, 0x0062, 0x007e, 0xffff, 0x00b6, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0391,
+    0x03ad, 0x03c9, 0x000b, 0x0027, 0x0043, 0x005f, 0x007b, 0xffff,
+    0x00b3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x038e, 0x03aa, 0x03c6, 0x0008, 0x0024, 0x0040, 0x005c,
+    0xffff, 0x0078, 0xffff, 0x00b0, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x03a7, 0x03c3, 0x0005,
+    0x0021, 0x003d, 0x0059, 0x0075, 0xffff, 0x00ad, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0388, 0x03a4,
+    0x03c0, 0x0002, 0x001e, 0x003a, 0x0056, 0x0072, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2022, 0xffff,
+    0x0385, 0x03a1, 0x03bd, 0xffff, 0x001b, 0x0037, 0x0053, 0x006f,
+    0xffff, 0x00a7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x039e, 0x03ba, 0xffff, 0x0018, 0x0034,
+    0x0050, 0x006c, 0xffff, 0x00a4, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x201c, 0xffff, 0xffff, 0x039b, 0x03b7, 0xffff,
+    0x0015, 0x0031, 0x004d, 0x0069, 0xffff, 0xffff, 0xffff, 0x00bd,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x2019, 0xffff, 0xffff, 0x0398,
+    0x03b4, 0xffff, 0x0012, 0x002e, 0xffff, 0x004a, 0x0066, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0395, 0x03b1, 0x03cd, 0x000f, 0x002b, 0x0047,
+    0x0063, 0x007f, 0xffff, 0x00b7, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x2013, 0xffff, 0xffff, 0x0392, 0x03ae, 0x03ca, 0x000c,
+    0x0028, 0x0044, 0x0060, 0x007c, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x038f, 0x03ab,
+    0x03c7, 0x0009, 0x0025, 0x0041, 0x005d, 0x0079, 0xffff, 0x00b1,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x038c, 0x03a8, 0x03c4, 0x0006, 0x0022, 0x003e, 0x005a, 0x0076,
+    0xffff, 0x00ae, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x2026, 0xffff, 0x0389, 0x03a5, 0x03c1, 0x0003, 0x001f, 0x003b,
+    0x0057, 0x0073, 0x2122, 0xffff, 0x00ab, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0386, 0xffff, 0xffff, 0x03be};
+
+static const unsigned char utf8map_win875_values[512] = {
+    0x00, 0x1c, 0xf8, 0xe3, 0x97, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x56, 0x9e, 0x15, 0x19, 0xf5, 0xd8, 0x94, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+    0x2c, 0x00, 0x53, 0x9b, 0x00, 0x32, 0xf2, 0xd5,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x49, 0x8e, 0x00, 0x13,
+    0x61, 0xd2, 0x87, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x8b,
+    0xb9, 0x10, 0x6b, 0xc8, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x36, 0x00,
+    0x43, 0xb5, 0xcd, 0x0d, 0x5d, 0xc5, 0x00, 0x81,
+    0xd0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb4, 0xb1, 0xbf, 0x25, 0x50,
+    0xc2, 0x5f, 0xa9, 0x00, 0xea, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x67, 0xbc,
+    0x2f, 0x7b, 0x6f, 0x4a, 0xa6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75,
+    0x64, 0xba, 0x37, 0x40, 0x4c, 0xe7, 0xa3, 0x00,
+    0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x59, 0xac, 0x01, 0x1d, 0xf9, 0xe4,
+    0x98, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x39, 0x00, 0x23, 0x57, 0x9f, 0x00, 0x3f,
+    0xf6, 0xd9, 0x95, 0x00, 0x00, 0xdf, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x21, 0x14, 0x00, 0x54, 0x9c,
+    0x00, 0x26, 0x00, 0xf3, 0xd6, 0x92, 0x00, 0xb0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x51, 0x8f, 0x00, 0x3c, 0xf0, 0xd3, 0x88,
+    0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xce, 0x00, 0x00, 0x47, 0x8c, 0x00, 0x11, 0x60,
+    0xc9, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xcf, 0x00, 0x00, 0x44, 0xb8, 0xb6,
+    0x0e, 0x5c, 0xc6, 0x82, 0xa1, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0xb2, 0xcb, 0x0b, 0x7d, 0xc3, 0x6d, 0xc0, 0x00,
+    0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x77, 0x68, 0xbd, 0x16, 0x5b, 0x7c, 0xe0,
+    0x00, 0xa7, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xaf, 0x2d,
+    0x4f, 0x7e, 0xe8, 0xa4, 0x00, 0xca, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x62,
+    0xad, 0x02, 0x1e, 0x7a, 0xe5, 0x99, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00,
+    0x80, 0x58, 0xaa, 0x00, 0x27, 0xf7, 0xe2, 0x96,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x9d, 0x00, 0x18, 0xf4,
+    0xd7, 0x93, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x00, 0x52, 0x9a, 0x00,
+    0x3d, 0xf1, 0xd4, 0x89, 0x00, 0x00, 0x00, 0xdb,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x48,
+    0x8d, 0x00, 0x12, 0x4b, 0x00, 0xd1, 0x86, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x45, 0x8a, 0xb7, 0x0f, 0x4e, 0xc7,
+    0x83, 0x07, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x00, 0x42, 0xb3, 0xcc, 0x0c,
+    0x4d, 0xc4, 0x79, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x69,
+    0xbe, 0x05, 0x6c, 0xc1, 0x5a, 0xa8, 0x00, 0xda,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x66, 0xbb, 0x2e, 0x7f, 0x6e, 0xe9, 0xa5,
+    0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x73, 0x63, 0xae, 0x03, 0x1f, 0x5e,
+    0xe6, 0xa2, 0x2a, 0x00, 0xee, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0xab};
+
+/* Map win424 (WINDOWS-1255) */
+
+static unsigned char const charmap_win424_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xba, 0xe0, 0xbb, 0xb0, 0x6d,
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xa1, 0x07,
+    0x80, 0x22, 0x08, 0x33, 0x34, 0x35, 0x36, 0x04,
+    0x38, 0x39, 0xab, 0x29, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x3b, 0x77, 0x2c, 0x0a, 0xac, 0x3e, 0x1a, 0x70,
+    0xae, 0x72, 0x9a, 0x9b, 0x9c, 0x09, 0x9e, 0x75,
+    0x74, 0x15, 0x4a, 0xb1, 0x9f, 0xb2, 0x6a, 0xb5,
+    0xbd, 0xb4, 0xbf, 0x8a, 0x5f, 0xca, 0xaf, 0xbc,
+    0x90, 0x78, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x9d, 0xda, 0xe1, 0x8b, 0xb7, 0xb8, 0xb9, 0xaa,
+    0x23, 0x2a, 0x24, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x30, 0x31, 0xad, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x1b, 0x73, 0x06, 0x14, 0x28, 0x2b, 0x20, 0x17,
+    0x21, 0x76, 0x3a, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x71, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+
+static unsigned char const charmap_win424_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0xd2, 0x7f,
+    0x82, 0x9d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0xd3, 0xa1, 0x08, 0xd7,
+    0x18, 0x19, 0x96, 0xd0, 0x1c, 0x1d, 0x1e, 0x1f,
+    0xd6, 0xd8, 0x81, 0xc0, 0xc2, 0x0a, 0x17, 0x1b,
+    0xd4, 0x8b, 0xc1, 0xd5, 0x92, 0x05, 0x06, 0x07,
+    0xc8, 0xc9, 0x16, 0x83, 0x84, 0x85, 0x86, 0x04,
+    0x88, 0x89, 0xda, 0x90, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xa2, 0x2e, 0x3c, 0x28, 0x2b, 0x7c,
+    0x26, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0x21, 0x24, 0x2a, 0x29, 0x3b, 0xac,
+    0x2d, 0x2f, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xa6, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0x97, 0xfa, 0x99, 0xd1, 0xa0, 0x9f, 0xd9, 0x91,
+    0xb1, 0x60, 0x3a, 0x23, 0x40, 0x27, 0x3d, 0x22,
+    0x80, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0x8c, 0x8d, 0x8e, 0x8f,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0x9a, 0x9b, 0x9c, 0xb8, 0x9e, 0xa4,
+    0xb5, 0x7e, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xbf, 0x8a, 0x94, 0xca, 0x98, 0xae,
+    0x5e, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0x5b, 0x5d, 0xaf, 0xa8, 0xb4, 0xaa,
+    0x7b, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x7d, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0x5c, 0xba, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+
+static const unsigned char utf8map_win424_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {2, 0xd7, 0x82, 0},
+    {1, 0x7f, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {2, 0xd7, 0x83, 0},
+    {2, 0xc2, 0xa1, 0},
+    {1, 0x08, 0, 0},
+    {2, 0xd7, 0xb3, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xd7, 0x80, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd7, 0xb4, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xd6, 0xb0, 0},
+    {2, 0xd6, 0xb2, 0},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xd6, 0xb1, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {2, 0xd6, 0xb8, 0},
+    {2, 0xd6, 0xb9, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc6, 0x92, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {3, 0xe2, 0x80, 0xa6},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x04, 0, 0},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa2, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x7c, 0, 0},
+    {1, 0x26, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x21, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xa6, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x84, 0xa2},
+    {2, 0xd7, 0x81, 0},
+    {2, 0xc2, 0xa0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x98},
+    {2, 0xc2, 0xb1, 0},
+    {1, 0x60, 0, 0},
+    {1, 0x3a, 0, 0},
+    {1, 0x23, 0, 0},
+    {1, 0x40, 0, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {1, 0x22, 0, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc2, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x82, 0xaa},
+    {2, 0xc2, 0xb5, 0},
+    {1, 0x7e, 0, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xbf, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9d},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xcb, 0x9c, 0},
+    {2, 0xc2, 0xae, 0},
+    {1, 0x5e, 0, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {1, 0x5b, 0, 0},
+    {1, 0x5d, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {1, 0x7b, 0, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xd6, 0xbb, 0},
+    {2, 0xd6, 0xbc, 0},
+    {2, 0xd6, 0xbd, 0},
+    {2, 0xd6, 0xbe, 0},
+    {2, 0xd6, 0xbf, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xd6, 0xb3, 0},
+    {2, 0xd6, 0xb4, 0},
+    {2, 0xd6, 0xb5, 0},
+    {2, 0xd6, 0xb6, 0},
+    {2, 0xd6, 0xb7, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x8e},
+    {3, 0xe2, 0x80, 0x8f},
+    {3, 0xef, 0xbf, 0xbd}};
+
+static const Tn5250Uint16 utf8map_win424_keys[512] = {
+    0x0000, 0x006b, 0xffff, 0xffff, 0xffff, 0x0041, 0xffff, 0x00ac,
+    0xffff, 0x0017, 0xffff, 0xffff, 0xffff, 0xffff, 0x05c3, 0x0058,
+    0xffff, 0xffff, 0xffff, 0x002e, 0xffff, 0xffff, 0xffff, 0x0004,
+    0xffff, 0x006f, 0xffff, 0xffff, 0x05b0, 0x0045, 0xffff, 0x00b0,
+    0xffff, 0x001b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x005c,
+    0xffff, 0xffff, 0xffff, 0x0032, 0xffff, 0xffff, 0xffff, 0x0008,
+    0xffff, 0x0073, 0xffff, 0xffff, 0x05b4, 0x0049, 0xffff, 0x00b4,
+    0xffff, 0x001f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0060,
+    0xffff, 0xffff, 0xffff, 0x0036, 0xffff, 0x00a1, 0x203a, 0x000c,
+    0xffff, 0x0077, 0xffff, 0xffff, 0x05b8, 0x004d, 0xffff, 0x00b8,
+    0xffff, 0x0023, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0064,
+    0xffff, 0xffff, 0xffff, 0x003a, 0xffff, 0x00a5, 0xffff, 0x0010,
+    0xffff, 0x007b, 0x2014, 0xffff, 0x05bc, 0x0051, 0xffff, 0x00bc,
+    0xffff, 0x0027, 0x0192, 0xffff, 0xffff, 0xffff, 0xffff, 0x0068,
+    0xffff, 0xffff, 0xffff, 0x003e, 0xffff, 0x00a9, 0xffff, 0x0014,
+    0xffff, 0x007f, 0x2018, 0xffff, 0x05c0, 0x0055, 0xffff, 0xffff,
+    0xffff, 0x002b, 0xffff, 0xffff, 0xffff, 0x0001, 0xffff, 0x006c,
+    0xffff, 0x00d7, 0xffff, 0x0042, 0xffff, 0x00ad, 0xffff, 0x0018,
+    0xffff, 0xffff, 0x201c, 0xffff, 0xffff, 0x0059, 0xffff, 0xffff,
+    0xffff, 0x002f, 0xffff, 0xffff, 0xffff, 0x0005, 0xffff, 0x0070,
+    0xffff, 0xffff, 0x05b1, 0x0046, 0xffff, 0x00b1, 0xffff, 0x001c,
+    0xffff, 0xffff, 0x2020, 0xffff, 0xffff, 0x005d, 0xffff, 0xffff,
+    0xffff, 0x0033, 0xffff, 0xffff, 0xffff, 0x0009, 0xffff, 0x0074,
+    0xffff, 0xffff, 0x05b5, 0x004a, 0xffff, 0x00b5, 0xffff, 0x0020,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0061, 0xffff, 0xffff,
+    0xffff, 0x0037, 0xffff, 0x00a2, 0xffff, 0x000d, 0xffff, 0x0078,
+    0xffff, 0xffff, 0x05b9, 0x004e, 0xffff, 0x00b9, 0xffff, 0x0024,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0065, 0xffff, 0xffff,
+    0xffff, 0x003b, 0xffff, 0x00a6, 0xffff, 0x0011, 0x20aa, 0x007c,
+    0xffff, 0xffff, 0x05bd, 0x0052, 0xffff, 0x00bd, 0xffff, 0x0028,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0069, 0xffff, 0xffff,
+    0xffff, 0x003f, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff,
+    0x2019, 0xffff, 0x05c1, 0x0056, 0xffff, 0xffff, 0xffff, 0x002c,
+    0xffff, 0xffff, 0x2030, 0x0002, 0xffff, 0x006d, 0xffff, 0xffff,
+    0xffff, 0x0043, 0xffff, 0x00ae, 0xffff, 0x0019, 0xffff, 0xffff,
+    0x201d, 0xffff, 0xffff, 0x005a, 0xffff, 0xffff, 0xffff, 0x0030,
+    0xffff, 0xffff, 0xffff, 0x0006, 0xffff, 0x0071, 0x02dc, 0xffff,
+    0x05b2, 0x0047, 0xffff, 0x00b2, 0xffff, 0x001d, 0x05f3, 0xffff,
+    0x2021, 0xffff, 0xffff, 0x005e, 0xffff, 0xffff, 0xffff, 0x0034,
+    0xffff, 0xffff, 0xffff, 0x000a, 0xffff, 0x0075, 0x200e, 0xffff,
+    0x05b6, 0x004b, 0xffff, 0x00b6, 0xffff, 0x0021, 0xffff, 0xffff,
+    0xffff, 0x00f7, 0xffff, 0x0062, 0xffff, 0xffff, 0xffff, 0x0038,
+    0xffff, 0x00a3, 0xffff, 0x000e, 0xffff, 0x0079, 0xffff, 0xffff,
+    0xffff, 0x004f, 0xffff, 0xffff, 0xffff, 0x0025, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0066, 0xffff, 0xffff, 0xffff, 0x003c,
+    0xffff, 0x00a7, 0xffff, 0x0012, 0xffff, 0x007d, 0xffff, 0xffff,
+    0x05be, 0x0053, 0xffff, 0x00be, 0xffff, 0x0029, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x006a, 0xffff, 0xffff, 0xffff, 0x0040,
+    0xffff, 0x00ab, 0xffff, 0x0016, 0xffff, 0xffff, 0x201a, 0xffff,
+    0x05c2, 0x0057, 0xffff, 0xffff, 0xffff, 0x002d, 0xffff, 0xffff,
+    0xffff, 0x0003, 0xffff, 0x006e, 0xffff, 0xffff, 0xffff, 0x0044,
+    0xffff, 0x00af, 0xffff, 0x001a, 0xffff, 0xffff, 0x201e, 0xffff,
+    0xffff, 0x005b, 0x02c6, 0xffff, 0xffff, 0x0031, 0xffff, 0xffff,
+    0xffff, 0x0007, 0xffff, 0x0072, 0xffff, 0xffff, 0x05b3, 0x0048,
+    0xffff, 0x00b3, 0xffff, 0x001e, 0x05f4, 0x2122, 0x2022, 0xffff,
+    0xffff, 0x005f, 0xffff, 0xffff, 0xffff, 0x0035, 0xffff, 0x00a0,
+    0x2039, 0x000b, 0xffff, 0x0076, 0x200f, 0xffff, 0x05b7, 0x004c,
+    0xffff, 0x00b7, 0xffff, 0x0022, 0xffff, 0xffff, 0x2026, 0xffff,
+    0xffff, 0x0063, 0xffff, 0xffff, 0xffff, 0x0039, 0xffff, 0xffff,
+    0xffff, 0x000f, 0xffff, 0x007a, 0x2013, 0xffff, 0x05bb, 0x0050,
+    0xffff, 0x00bb, 0xffff, 0x0026, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0067, 0xffff, 0xffff, 0xffff, 0x003d, 0xffff, 0x00a8,
+    0xffff, 0x0013, 0x20ac, 0x007e, 0xffff, 0xffff, 0x05bf, 0x0054,
+    0xffff, 0x00bf, 0xffff, 0x002a, 0xffff, 0xffff, 0xffff, 0xffff};
+
+static const unsigned char utf8map_win424_values[512] = {
+    0x00, 0x92, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x5f,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe7,
+    0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x96, 0x00, 0x00, 0x23, 0xc5, 0x00, 0x90,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0xa2, 0x00, 0x00, 0xec, 0xc9, 0x00, 0xbe,
+    0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
+    0x00, 0x00, 0x00, 0xf6, 0x00, 0x15, 0x9b, 0x0c,
+    0x00, 0xa6, 0x00, 0x00, 0x30, 0xd4, 0x00, 0x9d,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+    0x00, 0x00, 0x00, 0x7a, 0x00, 0xb2, 0x00, 0x10,
+    0x00, 0xc0, 0x70, 0x00, 0xcc, 0xd8, 0x00, 0xb7,
+    0x00, 0x7d, 0x33, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x6e, 0x00, 0xb4, 0x00, 0x3c,
+    0x00, 0x07, 0x77, 0x00, 0x1b, 0xe4, 0x00, 0x00,
+    0x00, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93,
+    0x00, 0xbf, 0x00, 0xc2, 0x00, 0xca, 0x00, 0x18,
+    0x00, 0x00, 0x0a, 0x00, 0x00, 0xe8, 0x00, 0x00,
+    0x00, 0x61, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x97,
+    0x00, 0x00, 0x2a, 0xc6, 0x00, 0x78, 0x00, 0x1c,
+    0x00, 0x00, 0x36, 0x00, 0x00, 0xbb, 0x00, 0x00,
+    0x00, 0xf3, 0x00, 0x00, 0x00, 0x05, 0x00, 0xa3,
+    0x00, 0x00, 0xed, 0xd1, 0x00, 0xa0, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x00, 0xf7, 0x00, 0x4a, 0x00, 0x0d, 0x00, 0xa7,
+    0x00, 0x00, 0x31, 0xd5, 0x00, 0xda, 0x00, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00,
+    0x00, 0x5e, 0x00, 0x6a, 0x00, 0x11, 0x9f, 0x4f,
+    0x00, 0x00, 0xcd, 0xd9, 0x00, 0xb8, 0x00, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00,
+    0x00, 0x6f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00,
+    0x2c, 0x00, 0x73, 0xe5, 0x00, 0x00, 0x00, 0x6b,
+    0x00, 0x00, 0x39, 0x02, 0x00, 0x94, 0x00, 0x00,
+    0x00, 0xc3, 0x00, 0xaf, 0x00, 0x19, 0x00, 0x00,
+    0xac, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xf0,
+    0x00, 0x00, 0x00, 0x2e, 0x00, 0x98, 0xae, 0x00,
+    0x24, 0xc7, 0x00, 0xea, 0x00, 0x1d, 0x17, 0x00,
+    0x04, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0xa4, 0xfd, 0x00,
+    0xee, 0xd2, 0x00, 0xb6, 0x00, 0x5a, 0x00, 0x00,
+    0x00, 0xe1, 0x00, 0x82, 0x00, 0x00, 0x00, 0xf8,
+    0x00, 0xb1, 0x00, 0x0e, 0x00, 0xa8, 0x00, 0x00,
+    0x00, 0xd6, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x4c,
+    0x00, 0xb5, 0x00, 0x12, 0x00, 0xd0, 0x00, 0x00,
+    0xce, 0xe2, 0x00, 0xb9, 0x00, 0x5d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x7c,
+    0x00, 0x8a, 0x00, 0x32, 0x00, 0x00, 0x08, 0x00,
+    0x06, 0xe6, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x95, 0x00, 0x00, 0x00, 0xc4,
+    0x00, 0xbc, 0x00, 0x3f, 0x00, 0x00, 0x34, 0x00,
+    0x00, 0xba, 0x38, 0x00, 0x00, 0xf1, 0x00, 0x00,
+    0x00, 0x2f, 0x00, 0x99, 0x00, 0x00, 0xeb, 0xc8,
+    0x00, 0xfa, 0x00, 0x1e, 0x21, 0x72, 0x3e, 0x00,
+    0x00, 0x6d, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x74,
+    0x29, 0x0b, 0x00, 0xa5, 0xfe, 0x00, 0xef, 0xd3,
+    0x00, 0xb3, 0x00, 0x7f, 0x00, 0x00, 0x35, 0x00,
+    0x00, 0x83, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0xa9, 0x1a, 0x00, 0xcb, 0xd7,
+    0x00, 0x8b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xbd,
+    0x00, 0x13, 0x80, 0xa1, 0x00, 0x00, 0xcf, 0xe3,
+    0x00, 0xaa, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00};
+
+/* Map win1026 (WINDOWS-1254) */
+
+static unsigned char const charmap_win1026_to_remote[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x37, 0x2d, 0x2e, 0x2f,
+    0x16, 0x05, 0x25, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x3c, 0x3d, 0x32, 0x26,
+    0x18, 0x19, 0x3f, 0x27, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x40, 0x4f, 0xfc, 0xec, 0xad, 0x6c, 0x50, 0x7d,
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,
+    0xae, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0x68, 0xdc, 0xac, 0x5f, 0x6d,
+    0x8d, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0x48, 0xbb, 0x8c, 0xcc, 0x07,
+    0x30, 0x2a, 0x28, 0x22, 0x58, 0x15, 0x06, 0x04,
+    0x39, 0x14, 0x17, 0x38, 0x1b, 0x09, 0x35, 0x21,
+    0x34, 0x3a, 0x2c, 0x0a, 0x3b, 0x3e, 0x1a, 0xbc,
+    0x31, 0x24, 0x36, 0x29, 0x57, 0x9d, 0xff, 0x08,
+    0x41, 0xaa, 0xb0, 0xb1, 0x9f, 0xb2, 0x8e, 0xb5,
+    0xbd, 0xb4, 0x9a, 0x8a, 0xba, 0xca, 0xaf, 0x20,
+    0x90, 0x8f, 0xea, 0xfa, 0xbe, 0xa0, 0xb6, 0xb3,
+    0x52, 0xda, 0x9b, 0x8b, 0xb7, 0xb8, 0xb9, 0xab,
+    0x64, 0x65, 0x62, 0x66, 0x63, 0x67, 0x9e, 0x4a,
+    0x74, 0x71, 0x72, 0x73, 0x78, 0x75, 0x76, 0x77,
+    0x5a, 0x69, 0xed, 0xee, 0xeb, 0xef, 0x7b, 0xbf,
+    0x80, 0xfd, 0xfe, 0xfb, 0x7f, 0x5b, 0x7c, 0x59,
+    0x44, 0x45, 0x42, 0x46, 0x43, 0x47, 0x9c, 0xc0,
+    0x54, 0x51, 0x33, 0x53, 0x23, 0x55, 0x56, 0x2b,
+    0xd0, 0x49, 0xcd, 0xce, 0xcb, 0xcf, 0xa1, 0xe1,
+    0x70, 0xdd, 0xde, 0xdb, 0xe0, 0x79, 0x6a, 0xdf};
+
+static unsigned char const charmap_win1026_to_local[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x87, 0x09, 0x86, 0x7f,
+    0x9f, 0x8d, 0x93, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x89, 0x85, 0x08, 0x8a,
+    0x18, 0x19, 0x96, 0x8c, 0x1c, 0x1d, 0x1e, 0x1f,
+    0xaf, 0x8f, 0x83, 0xec, 0x99, 0x0a, 0x17, 0x1b,
+    0x82, 0x9b, 0x81, 0xef, 0x92, 0x05, 0x06, 0x07,
+    0x80, 0x98, 0x16, 0xea, 0x90, 0x8e, 0x9a, 0x04,
+    0x8b, 0x88, 0x91, 0x94, 0x14, 0x15, 0x95, 0x1a,
+    0x20, 0xa0, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe5,
+    0x7b, 0xf1, 0xc7, 0x2e, 0x3c, 0x28, 0x2b, 0x21,
+    0x26, 0xe9, 0xb8, 0xeb, 0xe8, 0xed, 0xee, 0x9c,
+    0x84, 0xdf, 0xd0, 0xdd, 0x2a, 0x29, 0x3b, 0x5e,
+    0x2d, 0x2f, 0xc2, 0xc4, 0xc0, 0xc1, 0xc3, 0xc5,
+    0x5b, 0xd1, 0xfe, 0x2c, 0x25, 0x5f, 0x3e, 0x3f,
+    0xf8, 0xc9, 0xca, 0xcb, 0xc8, 0xcd, 0xce, 0xcf,
+    0xcc, 0xfd, 0x3a, 0xd6, 0xde, 0x27, 0x3d, 0xdc,
+    0xd8, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0xab, 0xbb, 0x7d, 0x60, 0xa6, 0xb1,
+    0xb0, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0xaa, 0xba, 0xe6, 0x9d, 0xc6, 0xa4,
+    0xb5, 0xf6, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xa1, 0xbf, 0x5d, 0x24, 0x40, 0xae,
+    0xa2, 0xa3, 0xa5, 0xb7, 0xa9, 0xa7, 0xb6, 0xbc,
+    0xbd, 0xbe, 0xac, 0x7c, 0x97, 0xa8, 0xb4, 0xd7,
+    0xe7, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0xad, 0xf4, 0x7e, 0xf2, 0xf3, 0xf5,
+    0xf0, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0xb9, 0xfb, 0x5c, 0xf9, 0xfa, 0xff,
+    0xfc, 0xf7, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb2, 0xd4, 0x23, 0xd2, 0xd3, 0xd5,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0xb3, 0xdb, 0x22, 0xd9, 0xda, 0x9e};
+
+static const unsigned char utf8map_win1026_out[256][4] = {
+    {1, 0x20, 0, 0},
+    {1, 0x01, 0, 0},
+    {1, 0x02, 0, 0},
+    {1, 0x03, 0, 0},
+    {3, 0xe2, 0x80, 0xa1},
+    {1, 0x09, 0, 0},
+    {3, 0xe2, 0x80, 0xa0},
+    {1, 0x7f, 0, 0},
+    {2, 0xc5, 0xb8, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xe2, 0x80, 0x9c},
+    {1, 0x0b, 0, 0},
+    {1, 0x0c, 0, 0},
+    {1, 0x0d, 0, 0},
+    {1, 0x0e, 0, 0},
+    {1, 0x0f, 0, 0},
+    {1, 0x10, 0, 0},
+    {1, 0x11, 0, 0},
+    {1, 0x12, 0, 0},
+    {1, 0x13, 0, 0},
+    {3, 0xe2, 0x80, 0xb0},
+    {3, 0xe2, 0x80, 0xa6},
+    {1, 0x08, 0, 0},
+    {2, 0xc5, 0xa0, 0},
+    {1, 0x18, 0, 0},
+    {1, 0x19, 0, 0},
+    {3, 0xe2, 0x80, 0x93},
+    {2, 0xc5, 0x92, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x1d, 0, 0},
+    {1, 0x1e, 0, 0},
+    {1, 0x1f, 0, 0},
+    {2, 0xc2, 0xaf, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc6, 0x92, 0},
+    {2, 0xc3, 0xac, 0},
+    {3, 0xe2, 0x84, 0xa2},
+    {1, 0x0a, 0, 0},
+    {1, 0x17, 0, 0},
+    {1, 0x1b, 0, 0},
+    {3, 0xe2, 0x80, 0x9a},
+    {3, 0xe2, 0x80, 0xba},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc3, 0xaf, 0},
+    {3, 0xe2, 0x80, 0x99},
+    {1, 0x05, 0, 0},
+    {1, 0x06, 0, 0},
+    {1, 0x07, 0, 0},
+    {3, 0xe2, 0x82, 0xac},
+    {2, 0xcb, 0x9c, 0},
+    {1, 0x16, 0, 0},
+    {2, 0xc3, 0xaa, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc5, 0xa1, 0},
+    {1, 0x04, 0, 0},
+    {3, 0xe2, 0x80, 0xb9},
+    {2, 0xcb, 0x86, 0},
+    {3, 0xe2, 0x80, 0x98},
+    {3, 0xe2, 0x80, 0x9d},
+    {1, 0x14, 0, 0},
+    {1, 0x15, 0, 0},
+    {3, 0xe2, 0x80, 0xa2},
+    {1, 0x1a, 0, 0},
+    {1, 0x20, 0, 0},
+    {2, 0xc2, 0xa0, 0},
+    {2, 0xc3, 0xa2, 0},
+    {2, 0xc3, 0xa4, 0},
+    {2, 0xc3, 0xa0, 0},
+    {2, 0xc3, 0xa1, 0},
+    {2, 0xc3, 0xa3, 0},
+    {2, 0xc3, 0xa5, 0},
+    {1, 0x7b, 0, 0},
+    {2, 0xc3, 0xb1, 0},
+    {2, 0xc3, 0x87, 0},
+    {1, 0x2e, 0, 0},
+    {1, 0x3c, 0, 0},
+    {1, 0x28, 0, 0},
+    {1, 0x2b, 0, 0},
+    {1, 0x21, 0, 0},
+    {1, 0x26, 0, 0},
+    {2, 0xc3, 0xa9, 0},
+    {2, 0xc2, 0xb8, 0},
+    {2, 0xc3, 0xab, 0},
+    {2, 0xc3, 0xa8, 0},
+    {2, 0xc3, 0xad, 0},
+    {2, 0xc3, 0xae, 0},
+    {2, 0xc5, 0x93, 0},
+    {3, 0xe2, 0x80, 0x9e},
+    {2, 0xc3, 0x9f, 0},
+    {2, 0xc4, 0x9e, 0},
+    {2, 0xc4, 0xb0, 0},
+    {1, 0x2a, 0, 0},
+    {1, 0x29, 0, 0},
+    {1, 0x3b, 0, 0},
+    {1, 0x5e, 0, 0},
+    {1, 0x2d, 0, 0},
+    {1, 0x2f, 0, 0},
+    {2, 0xc3, 0x82, 0},
+    {2, 0xc3, 0x84, 0},
+    {2, 0xc3, 0x80, 0},
+    {2, 0xc3, 0x81, 0},
+    {2, 0xc3, 0x83, 0},
+    {2, 0xc3, 0x85, 0},
+    {1, 0x5b, 0, 0},
+    {2, 0xc3, 0x91, 0},
+    {2, 0xc5, 0x9f, 0},
+    {1, 0x2c, 0, 0},
+    {1, 0x25, 0, 0},
+    {1, 0x5f, 0, 0},
+    {1, 0x3e, 0, 0},
+    {1, 0x3f, 0, 0},
+    {2, 0xc3, 0xb8, 0},
+    {2, 0xc3, 0x89, 0},
+    {2, 0xc3, 0x8a, 0},
+    {2, 0xc3, 0x8b, 0},
+    {2, 0xc3, 0x88, 0},
+    {2, 0xc3, 0x8d, 0},
+    {2, 0xc3, 0x8e, 0},
+    {2, 0xc3, 0x8f, 0},
+    {2, 0xc3, 0x8c, 0},
+    {2, 0xc4, 0xb1, 0},
+    {1, 0x3a, 0, 0},
+    {2, 0xc3, 0x96, 0},
+    {2, 0xc5, 0x9e, 0},
+    {1, 0x27, 0, 0},
+    {1, 0x3d, 0, 0},
+    {2, 0xc3, 0x9c, 0},
+    {2, 0xc3, 0x98, 0},
+    {1, 0x61, 0, 0},
+    {1, 0x62, 0, 0},
+    {1, 0x63, 0, 0},
+    {1, 0x64, 0, 0},
+    {1, 0x65, 0, 0},
+    {1, 0x66, 0, 0},
+    {1, 0x67, 0, 0},
+    {1, 0x68, 0, 0},
+    {1, 0x69, 0, 0},
+    {2, 0xc2, 0xab, 0},
+    {2, 0xc2, 0xbb, 0},
+    {1, 0x7d, 0, 0},
+    {1, 0x60, 0, 0},
+    {2, 0xc2, 0xa6, 0},
+    {2, 0xc2, 0xb1, 0},
+    {2, 0xc2, 0xb0, 0},
+    {1, 0x6a, 0, 0},
+    {1, 0x6b, 0, 0},
+    {1, 0x6c, 0, 0},
+    {1, 0x6d, 0, 0},
+    {1, 0x6e, 0, 0},
+    {1, 0x6f, 0, 0},
+    {1, 0x70, 0, 0},
+    {1, 0x71, 0, 0},
+    {1, 0x72, 0, 0},
+    {2, 0xc2, 0xaa, 0},
+    {2, 0xc2, 0xba, 0},
+    {2, 0xc3, 0xa6, 0},
+    {3, 0xef, 0xbf, 0xbd},
+    {2, 0xc3, 0x86, 0},
+    {2, 0xc2, 0xa4, 0},
+    {2, 0xc2, 0xb5, 0},
+    {2, 0xc3, 0xb6, 0},
+    {1, 0x73, 0, 0},
+    {1, 0x74, 0, 0},
+    {1, 0x75, 0, 0},
+    {1, 0x76, 0, 0},
+    {1, 0x77, 0, 0},
+    {1, 0x78, 0, 0},
+    {1, 0x79, 0, 0},
+    {1, 0x7a, 0, 0},
+    {2, 0xc2, 0xa1, 0},
+    {2, 0xc2, 0xbf, 0},
+    {1, 0x5d, 0, 0},
+    {1, 0x24, 0, 0},
+    {1, 0x40, 0, 0},
+    {2, 0xc2, 0xae, 0},
+    {2, 0xc2, 0xa2, 0},
+    {2, 0xc2, 0xa3, 0},
+    {2, 0xc2, 0xa5, 0},
+    {2, 0xc2, 0xb7, 0},
+    {2, 0xc2, 0xa9, 0},
+    {2, 0xc2, 0xa7, 0},
+    {2, 0xc2, 0xb6, 0},
+    {2, 0xc2, 0xbc, 0},
+    {2, 0xc2, 0xbd, 0},
+    {2, 0xc2, 0xbe, 0},
+    {2, 0xc2, 0xac, 0},
+    {1, 0x7c, 0, 0},
+    {3, 0xe2, 0x80, 0x94},
+    {2, 0xc2, 0xa8, 0},
+    {2, 0xc2, 0xb4, 0},
+    {2, 0xc3, 0x97, 0},
+    {2, 0xc3, 0xa7, 0},
+    {1, 0x41, 0, 0},
+    {1, 0x42, 0, 0},
+    {1, 0x43, 0, 0},
+    {1, 0x44, 0, 0},
+    {1, 0x45, 0, 0},
+    {1, 0x46, 0, 0},
+    {1, 0x47, 0, 0},
+    {1, 0x48, 0, 0},
+    {1, 0x49, 0, 0},
+    {2, 0xc2, 0xad, 0},
+    {2, 0xc3, 0xb4, 0},
+    {1, 0x7e, 0, 0},
+    {2, 0xc3, 0xb2, 0},
+    {2, 0xc3, 0xb3, 0},
+    {2, 0xc3, 0xb5, 0},
+    {2, 0xc4, 0x9f, 0},
+    {1, 0x4a, 0, 0},
+    {1, 0x4b, 0, 0},
+    {1, 0x4c, 0, 0},
+    {1, 0x4d, 0, 0},
+    {1, 0x4e, 0, 0},
+    {1, 0x4f, 0, 0},
+    {1, 0x50, 0, 0},
+    {1, 0x51, 0, 0},
+    {1, 0x52, 0, 0},
+    {2, 0xc2, 0xb9, 0},
+    {2, 0xc3, 0xbb, 0},
+    {1, 0x5c, 0, 0},
+    {2, 0xc3, 0xb9, 0},
+    {2, 0xc3, 0xba, 0},
+    {2, 0xc3, 0xbf, 0},
+    {2, 0xc3, 0xbc, 0},
+    {2, 0xc3, 0xb7, 0},
+    {1, 0x53, 0, 0},
+    {1, 0x54, 0, 0},
+    {1, 0x55, 0, 0},
+    {1, 0x56, 0, 0},
+    {1, 0x57, 0, 0},
+    {1, 0x58, 0, 0},
+    {1, 0x59, 0, 0},
+    {1, 0x5a, 0, 0},
+    {2, 0xc2, 0xb2, 0},
+    {2, 0xc3, 0x94, 0},
+    {1, 0x23, 0, 0},
+    {2, 0xc3, 0x92, 0},
+    {2, 0xc3, 0x93, 0},
+    {2, 0xc3, 0x95, 0},
+    {1, 0x30, 0, 0},
+    {1, 0x31, 0, 0},
+    {1, 0x32, 0, 0},
+    {1, 0x33, 0, 0},
+    {1, 0x34, 0, 0},
+    {1, 0x35, 0, 0},
+    {1, 0x36, 0, 0},
+    {1, 0x37, 0, 0},
+    {1, 0x38, 0, 0},
+    {1, 0x39, 0, 0},
+    {2, 0xc2, 0xb3, 0},
+    {2, 0xc3, 0x9b, 0},
+    {1, 0x22, 0, 0},
+    {2, 0xc3, 0x99, 0},
+    {2, 0xc3, 0x9a, 0},
+    {3, 0xef, 0xbf, 0xbd}};
+
+static const Tn5250Uint16 utf8map_win1026_keys[512] = {
+    0x0000, 0x0049, 0xffff, 0x00db, 0x2030, 0xffff, 0xffff, 0x000c,
+    0x0055, 0xffff, 0x00e7, 0xffff, 0x0130, 0xffff, 0x0018, 0x0061,
+    0x00aa, 0xffff, 0x00f3, 0xffff, 0xffff, 0x0024, 0x006d, 0xffff,
+    0x00b6, 0x00ff, 0xffff, 0xffff, 0x0030, 0xffff, 0x0079, 0x00c2,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x003c, 0xffff, 0x00ce, 0xffff,
+    0x0160, 0xffff, 0xffff, 0x0048, 0xffff, 0x00da, 0xffff, 0xffff,
+    0xffff, 0x000b, 0x0054, 0xffff, 0x00e6, 0xffff, 0xffff, 0x0178,
+    0x0017, 0x0060, 0x00a9, 0xffff, 0x00f2, 0xffff, 0xffff, 0x0023,
+    0x006c, 0x2122, 0x00b5, 0xffff, 0xffff, 0xffff, 0x002f, 0xffff,
+    0x0078, 0x00c1, 0xffff, 0x0153, 0xffff, 0xffff, 0x003b, 0xffff,
+    0x00cd, 0x2022, 0xffff, 0x015f, 0xffff, 0x0047, 0xffff, 0x00d9,
+    0xffff, 0xffff, 0xffff, 0x000a, 0x0053, 0xffff, 0xffff, 0x00e5,
+    0x203a, 0xffff, 0x0016, 0x005f, 0xffff, 0x00a8, 0x00f1, 0xffff,
+    0xffff, 0x0022, 0x006b, 0xffff, 0x00b4, 0xffff, 0xffff, 0xffff,
+    0x002e, 0xffff, 0x0077, 0x00c0, 0xffff, 0x0152, 0xffff, 0xffff,
+    0x003a, 0xffff, 0x00cc, 0x2021, 0xffff, 0x015e, 0xffff, 0x0046,
+    0xffff, 0x00d8, 0xffff, 0xffff, 0xffff, 0x0009, 0x0052, 0xffff,
+    0xffff, 0x00e4, 0x2039, 0xffff, 0x0015, 0x005e, 0xffff, 0x00a7,
+    0xffff, 0xffff, 0xffff, 0x0021, 0xffff, 0x006a, 0x00b3, 0x00fc,
+    0xffff, 0xffff, 0xffff, 0x002d, 0x0076, 0x00bf, 0x2014, 0xffff,
+    0xffff, 0xffff, 0x0039, 0xffff, 0x00cb, 0x2020, 0xffff, 0xffff,
+    0xffff, 0x0045, 0xffff, 0x00d7, 0xffff, 0xffff, 0xffff, 0x0008,
+    0x0051, 0xffff, 0xffff, 0x00e3, 0xffff, 0xffff, 0x0014, 0x005d,
+    0xffff, 0x00a6, 0x00ef, 0xffff, 0xffff, 0x0020, 0xffff, 0x0069,
+    0x00b2, 0x00fb, 0xffff, 0xffff, 0xffff, 0x002c, 0x0075, 0x00be,
+    0x2013, 0xffff, 0xffff, 0xffff, 0x0038, 0xffff, 0x00ca, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0044, 0xffff, 0x00d6, 0xffff, 0x011f,
+    0xffff, 0x0007, 0x0050, 0xffff, 0xffff, 0x00e2, 0xffff, 0xffff,
+    0x0013, 0x005c, 0xffff, 0x00a5, 0x00ee, 0xffff, 0xffff, 0x001f,
+    0xffff, 0x0068, 0x00b1, 0x00fa, 0xffff, 0xffff, 0xffff, 0x002b,
+    0x0074, 0x00bd, 0xffff, 0xffff, 0xffff, 0xffff, 0x0037, 0xffff,
+    0x00c9, 0xffff, 0x201e, 0xffff, 0xffff, 0x0043, 0xffff, 0xffff,
+    0x00d5, 0x011e, 0xffff, 0x0006, 0x004f, 0xffff, 0xffff, 0x00e1,
+    0xffff, 0xffff, 0x0012, 0xffff, 0x005b, 0x00a4, 0x00ed, 0xffff,
+    0xffff, 0xffff, 0x001e, 0x0067, 0x00b0, 0x00f9, 0xffff, 0xffff,
+    0xffff, 0x002a, 0x0073, 0x00bc, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0036, 0x007f, 0x00c8, 0xffff, 0x201d, 0xffff, 0xffff, 0x0042,
+    0xffff, 0xffff, 0x00d4, 0xffff, 0xffff, 0x0005, 0x004e, 0xffff,
+    0xffff, 0x00e0, 0xffff, 0xffff, 0x0011, 0xffff, 0x005a, 0x00a3,
+    0x00ec, 0xffff, 0xffff, 0xffff, 0x001d, 0x0066, 0x00af, 0x00f8,
+    0xffff, 0xffff, 0xffff, 0x0029, 0x0072, 0x00bb, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0035, 0x007e, 0x00c7, 0xffff, 0x201c, 0xffff,
+    0xffff, 0x0041, 0xffff, 0xffff, 0x00d3, 0x02c6, 0xffff, 0x0004,
+    0x004d, 0xffff, 0xffff, 0x00df, 0xffff, 0xffff, 0x0010, 0xffff,
+    0x0059, 0x00a2, 0x00eb, 0xffff, 0xffff, 0xffff, 0x001c, 0x0065,
+    0x00ae, 0x00f7, 0xffff, 0xffff, 0xffff, 0x0028, 0x0071, 0x00ba,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0034, 0x007d, 0xffff, 0x00c6,
+    0xffff, 0xffff, 0xffff, 0x0040, 0xffff, 0xffff, 0x00d2, 0xffff,
+    0xffff, 0x0003, 0xffff, 0x004c, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x000f, 0x0058, 0x00a1, 0x00ea, 0xffff, 0xffff, 0xffff,
+    0x001b, 0x0064, 0x00ad, 0x00f6, 0xffff, 0xffff, 0xffff, 0x0027,
+    0x0070, 0x00b9, 0xffff, 0xffff, 0xffff, 0xffff, 0x0033, 0x007c,
+    0xffff, 0x00c5, 0x201a, 0xffff, 0x20ac, 0x003f, 0xffff, 0xffff,
+    0x00d1, 0x2026, 0xffff, 0x0002, 0xffff, 0x004b, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x000e, 0x0057, 0x00a0, 0x00e9, 0xffff,
+    0x02dc, 0xffff, 0x001a, 0x0063, 0x00ac, 0x00f5, 0xffff, 0xffff,
+    0xffff, 0x0026, 0x006f, 0x00b8, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0032, 0x007b, 0xffff, 0x00c4, 0x2019, 0xffff, 0xffff, 0x003e,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0001, 0xffff, 0x004a,
+    0xffff, 0x00dc, 0xffff, 0xffff, 0xffff, 0x000d, 0x0056, 0xffff,
+    0x00e8, 0xffff, 0x0131, 0xffff, 0x0019, 0x0062, 0x00ab, 0xffff,
+    0x00f4, 0xffff, 0xffff, 0x0025, 0x006e, 0xffff, 0x00b7, 0xffff,
+    0xffff, 0x0192, 0x0031, 0xffff, 0x007a, 0x00c3, 0x2018, 0xffff,
+    0xffff, 0xffff, 0x003d, 0xffff, 0x00cf, 0xffff, 0x0161, 0xffff};
+
+static const unsigned char utf8map_win1026_values[512] = {
+    0x00, 0xc9, 0x00, 0xfb, 0x14, 0x00, 0x00, 0x0c,
+    0xe4, 0x00, 0xc0, 0x00, 0x5b, 0x00, 0x18, 0x81,
+    0x9a, 0x00, 0xce, 0x00, 0x00, 0xad, 0x94, 0x00,
+    0xb6, 0xdf, 0x00, 0x00, 0xf0, 0x00, 0xa8, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x76, 0x00,
+    0x17, 0x00, 0x00, 0xc8, 0x00, 0xfe, 0x00, 0x00,
+    0x00, 0x0b, 0xe3, 0x00, 0x9c, 0x00, 0x00, 0x08,
+    0x26, 0x8d, 0xb4, 0x00, 0xcd, 0x00, 0x00, 0xec,
+    0x93, 0x24, 0xa0, 0x00, 0x00, 0x00, 0x61, 0x00,
+    0xa7, 0x65, 0x00, 0x57, 0x00, 0x00, 0x5e, 0x00,
+    0x75, 0x3e, 0x00, 0x6a, 0x00, 0xc7, 0x00, 0xfd,
+    0x00, 0x00, 0x00, 0x25, 0xe2, 0x00, 0x00, 0x47,
+    0x29, 0x00, 0x32, 0x6d, 0x00, 0xbd, 0x49, 0x00,
+    0x00, 0xfc, 0x92, 0x00, 0xbe, 0x00, 0x00, 0x00,
+    0x4b, 0x00, 0xa6, 0x64, 0x00, 0x1b, 0x00, 0x00,
+    0x7a, 0x00, 0x78, 0x04, 0x00, 0x7c, 0x00, 0xc6,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0xd9, 0x00,
+    0x00, 0x43, 0x38, 0x00, 0x3d, 0x5f, 0x00, 0xb5,
+    0x00, 0x00, 0x00, 0x4f, 0x00, 0x91, 0xfa, 0xe0,
+    0x00, 0x00, 0x00, 0x60, 0xa5, 0xab, 0xbc, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x73, 0x06, 0x00, 0x00,
+    0x00, 0xc5, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x16,
+    0xd8, 0x00, 0x00, 0x46, 0x00, 0x00, 0x3c, 0xac,
+    0x00, 0x8e, 0x2b, 0x00, 0x00, 0x40, 0x00, 0x89,
+    0xea, 0xdb, 0x00, 0x00, 0x00, 0x6b, 0xa4, 0xb9,
+    0x1a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0xc4, 0x00, 0x7b, 0x00, 0xd0,
+    0x00, 0x2f, 0xd7, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0x13, 0xdc, 0x00, 0xb2, 0x56, 0x00, 0x00, 0x1f,
+    0x00, 0x88, 0x8f, 0xde, 0x00, 0x00, 0x00, 0x4e,
+    0xa3, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x00,
+    0x71, 0x00, 0x58, 0x00, 0x00, 0xc3, 0x00, 0x00,
+    0xef, 0x5a, 0x00, 0x2e, 0xd6, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x12, 0x00, 0x68, 0x9f, 0x55, 0x00,
+    0x00, 0x00, 0x1e, 0x87, 0x90, 0xdd, 0x00, 0x00,
+    0x00, 0x5c, 0xa2, 0xb7, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0x07, 0x74, 0x00, 0x3b, 0x00, 0x00, 0xc2,
+    0x00, 0x00, 0xeb, 0x00, 0x00, 0x2d, 0xd5, 0x00,
+    0x00, 0x44, 0x00, 0x00, 0x11, 0x00, 0xe9, 0xb1,
+    0x23, 0x00, 0x00, 0x00, 0x1d, 0x86, 0x20, 0x70,
+    0x00, 0x00, 0x00, 0x5d, 0x99, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0xf5, 0xcc, 0x4a, 0x00, 0x0a, 0x00,
+    0x00, 0xc1, 0x00, 0x00, 0xee, 0x39, 0x00, 0x37,
+    0xd4, 0x00, 0x00, 0x59, 0x00, 0x00, 0x10, 0x00,
+    0xe8, 0xb0, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x85,
+    0xaf, 0xe1, 0x00, 0x00, 0x00, 0x4d, 0x98, 0x9b,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x8c, 0x00, 0x9e,
+    0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0xed, 0x00,
+    0x00, 0x03, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xe7, 0xaa, 0x33, 0x00, 0x00, 0x00,
+    0x27, 0x84, 0xca, 0xa1, 0x00, 0x00, 0x00, 0x7d,
+    0x97, 0xda, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xbb,
+    0x00, 0x67, 0x28, 0x00, 0x30, 0x6f, 0x00, 0x00,
+    0x69, 0x15, 0x00, 0x02, 0x00, 0xd2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0xe6, 0x41, 0x51, 0x00,
+    0x31, 0x00, 0x3f, 0x83, 0xba, 0xcf, 0x00, 0x00,
+    0x00, 0x50, 0x96, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x00, 0x63, 0x2c, 0x00, 0x00, 0x6e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd1,
+    0x00, 0x7f, 0x00, 0x00, 0x00, 0x0d, 0xe5, 0x00,
+    0x54, 0x00, 0x79, 0x00, 0x19, 0x82, 0x8a, 0x00,
+    0xcb, 0x00, 0x00, 0x6c, 0x95, 0x00, 0xb3, 0x00,
+    0x00, 0x22, 0xf1, 0x00, 0xa9, 0x66, 0x3a, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x77, 0x00, 0x36, 0x00};
+
+/* This is the translation-map index which is looked up in utility.c
+ */
+
+const Tn5250CharMap tn5250_transmaps[] = {
+    {"37", charmap_37_to_remote, charmap_37_to_local},
+    {"256", charmap_256_to_remote, charmap_256_to_local},
+    {"273", charmap_273_to_remote, charmap_273_to_local},
+    {"277", charmap_277_to_remote, charmap_277_to_local},
+    {"278", charmap_278_to_remote, charmap_278_to_local},
+    {"280", charmap_280_to_remote, charmap_280_to_local},
+    {"284", charmap_284_to_remote, charmap_284_to_local},
+    {"285", charmap_285_to_remote, charmap_285_to_local},
+    {"297", charmap_297_to_remote, charmap_297_to_local},
+    {"500", charmap_500_to_remote, charmap_500_to_local},
+    {"871", charmap_871_to_remote, charmap_871_to_local},
+    {"870", charmap_870_to_remote, charmap_870_to_local},
+    {"905", charmap_905_to_remote, charmap_905_to_local},
+    {"880", charmap_880_to_remote, charmap_880_to_local},
+    {"420", charmap_420_to_remote, charmap_420_to_local},
+    {"875", charmap_875_to_remote, charmap_875_to_local},
+    {"424", charmap_424_to_remote, charmap_424_to_local},
+    {"1026", charmap_1026_to_remote, charmap_1026_to_local},
+    {"290", charmap_290_to_remote, charmap_290_to_local},
+    {"win37", charmap_win37_to_remote, charmap_win37_to_local},
+    {"win256", charmap_win256_to_remote, charmap_win256_to_local},
+    {"win273", charmap_win273_to_remote, charmap_win273_to_local},
+    {"win277", charmap_win277_to_remote, charmap_win277_to_local},
+    {"win278", charmap_win278_to_remote, charmap_win278_to_local},
+    {"win280", charmap_win280_to_remote, charmap_win280_to_local},
+    {"win284", charmap_win284_to_remote, charmap_win284_to_local},
+    {"win285", charmap_win285_to_remote, charmap_win285_to_local},
+    {"win297", charmap_win297_to_remote, charmap_win297_to_local},
+    {"win500", charmap_win500_to_remote, charmap_win500_to_local},
+    {"win871", charmap_win871_to_remote, charmap_win871_to_local},
+    {"win870", charmap_win870_to_remote, charmap_win870_to_local},
+    {"win905", charmap_win905_to_remote, charmap_win905_to_local},
+    {"win880", charmap_win880_to_remote, charmap_win880_to_local},
+    {"win420", charmap_win420_to_remote, charmap_win420_to_local},
+    {"win875", charmap_win875_to_remote, charmap_win875_to_local},
+    {"win424", charmap_win424_to_remote, charmap_win424_to_local},
+    {"win1026", charmap_win1026_to_remote, charmap_win1026_to_local},
+    {NULL, NULL, NULL}};
+
+static const Tn5250Utf8Map tn5250_utf8maps[] = {
+    {utf8map_37_out, utf8map_37_keys, utf8map_37_values, 0x5498ee97UL, 23},
+    {utf8map_256_out, utf8map_256_keys, utf8map_256_values, 0x5498ee97UL, 23},
+    {utf8map_273_out, utf8map_273_keys, utf8map_273_values, 0x5498ee97UL, 23},
+    {utf8map_277_out, utf8map_277_keys, utf8map_277_values, 0x5498ee97UL, 23},
+    {utf8map_278_out, utf8map_278_keys, utf8map_278_values, 0x5498ee97UL, 23},
+    {utf8map_280_out, utf8map_280_keys, utf8map_280_values, 0x5498ee97UL, 23},
+    {utf8map_284_out, utf8map_284_keys, utf8map_284_values, 0x5498ee97UL, 23},
+    {utf8map_285_out, utf8map_285_keys, utf8map_285_values, 0x5498ee97UL, 23},
+    {utf8map_297_out, utf8map_297_keys, utf8map_297_values, 0x5498ee97UL, 23},
+    {utf8map_500_out, utf8map_500_keys, utf8map_500_values, 0x5498ee97UL, 23},
+    {utf8map_871_out, utf8map_871_keys, utf8map_871_values, 0x5498ee97UL, 23},
+    {utf8map_870_out, utf8map_870_keys, utf8map_870_values, 0xe8fea883UL, 23},
+    {utf8map_905_out, utf8map_905_keys, utf8map_905_values, 0x2d082e05UL, 23},
+    {utf8map_880_out, utf8map_880_keys, utf8map_880_values, 0xaedc2671UL, 23},
+    {utf8map_420_out, utf8map_420_keys, utf8map_420_values, 0x4598ffedUL, 23},
+    {utf8map_875_out, utf8map_875_keys, utf8map_875_values, 0x3be76dd9UL, 23},
+    {utf8map_424_out, utf8map_424_keys, utf8map_424_values, 0x2e273a6fUL, 23},
+    {utf8map_1026_out, utf8map_1026_keys, utf8map_1026_values, 0x2d082e05UL, 23},
+    {utf8map_290_out, utf8map_290_keys, utf8map_290_values, 0x490841cdUL, 23},
+    {utf8map_win37_out, utf8map_win37_keys, utf8map_win37_values, 0x761b4c87UL, 23},
+    {utf8map_win256_out, utf8map_win256_keys, utf8map_win256_values, 0x761b4c87UL, 23},
+    {utf8map_win273_out, utf8map_win273_keys, utf8map_win273_values, 0x761b4c87UL, 23},
+    {utf8map_win277_out, utf8map_win277_keys, utf8map_win277_values, 0x761b4c87UL, 23},
+    {utf8map_win278_out, utf8map_win278_keys, utf8map_win278_values, 0x761b4c87UL, 23},
+    {utf8map_win280_out, utf8map_win280_keys, utf8map_win280_values, 0x761b4c87UL, 23},
+    {utf8map_win284_out, utf8map_win284_keys, utf8map_win284_values, 0x761b4c87UL, 23},
+    {utf8map_win285_out, utf8map_win285_keys, utf8map_win285_values, 0x761b4c87UL, 23},
+    {utf8map_win297_out, utf8map_win297_keys, utf8map_win297_values, 0x761b4c87UL, 23},
+    {utf8map_win500_out, utf8map_win500_keys, utf8map_win500_values, 0x761b4c87UL, 23},
+    {utf8map_win871_out, utf8map_win871_keys, utf8map_win871_values, 0x761b4c87UL, 23},
+    {utf8map_win870_out, utf8map_win870_keys, utf8map_win870_values, 0x26e84309UL, 23},
+    {utf8map_win905_out, utf8map_win905_keys, utf8map_win905_values, 0xeaf7a03dUL, 23},
+    {utf8map_win880_out, utf8map_win880_keys, utf8map_win880_values, 0x66a544c1UL, 23},
+    {utf8map_win420_out, utf8map_win420_keys, utf8map_win420_values, 0x20ff93c1UL, 23},
+    {utf8map_win875_out, utf8map_win875_keys, utf8map_win875_values, 0x524de645UL, 23},
+    {utf8map_win424_out, utf8map_win424_keys, utf8map_win424_values, 0x42ffaa67UL, 23},
+    {utf8map_win1026_out, utf8map_win1026_keys, utf8map_win1026_values, 0xeaf7a03dUL, 23},
+    {NULL, NULL, NULL, 0, 0}};
+
+/* Perfect hash over the map names: slot to tn5250_transmaps index. */
+
+#define TN5250_CHARMAP_HASH_SEED 0xfb5ac517UL
+#define TN5250_CHARMAP_HASH_BITS 8
+#define TN5250_CHARMAP_NONE      0xff
+
+static const unsigned char tn5250_charmap_slots[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x07, 0x06, 0xff, 0x04, 0xff,
+    0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x02, 0xff, 0xff, 0x01, 0x03, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0x0e,
+    0xff, 0x15, 0xff, 0x10, 0xff, 0x16, 0x17, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1a, 0x19, 0x1b, 0xff, 0xff,
+    0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x21, 0xff,
+    0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x13, 0xff, 0x12, 0xff, 0xff, 0x08, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x22, 0xff, 0xff, 0x1e, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0f, 0xff, 0xff, 0x0b, 0x0a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
@@ -26,7 +26,10 @@ static void tn5250_config_str_destroy(Tn5250ConfigStr* This);
 static Tn5250ConfigStr* tn5250_config_str_new(const char* name,
                                               const char* value);
 static Tn5250ConfigStr* tn5250_config_get_str(Tn5250Config* This,
-                                              const char* name);
+                                              const char* name,
+                                              unsigned long hash);
+static unsigned long tn5250_config_hash(const char* name);
+static void tn5250_config_rehash(Tn5250Config* This);
 static void tn5250_config_replace_vars(char* buf, int maxlen);
 static void tn5250_config_replacedata(const char* from, const char* to,
                                       char* line, int maxlen);
@@ -70,6 +73,9 @@ static Tn5250ConfigStr* tn5250_config_str_new(const char* name,
     }
     strcpy(This->value, value);
 
+    This->chain = NULL;
+    This->int_cached = 0;
+    This->bool_cached = 0;
     return This;
 }
 
@@ -83,6 +89,14 @@ Tn5250Config* tn5250_config_new() {
 
     This->ref = 1;
     This->vars = NULL;
+    This->count = 0;
+    This->bucket_count = TN5250_CONFIG_BUCKETS;
+    This->buckets = tn5250_new(Tn5250ConfigStr*, This->bucket_count);
+    if (This->buckets == NULL) {
+        free(This);
+        return NULL;
+    }
+    memset(This->buckets, 0, This->bucket_count * sizeof(Tn5250ConfigStr*));
 
     return This;
 }
@@ -104,6 +118,7 @@ void tn5250_config_unref(Tn5250Config* This) {
                 iter = next;
             } while (iter != This->vars);
         }
+        free(This->buckets);
         free(This);
     }
     return;
@@ -134,7 +149,9 @@ int tn5250_config_load(Tn5250Config* This, const char* filename) {
             *strchr(buf, '\n') = '\0';
         }
 
-        tn5250_config_replace_vars(buf, sizeof(buf));
+        if (strchr(buf, '$') != NULL) {
+            tn5250_config_replace_vars(buf, sizeof(buf));
+        }
 
         scan = buf;
         while (*scan && isspace(*scan)) {
@@ -468,43 +485,77 @@ int tn5250_config_parse_argv(Tn5250Config* This, int argc, char** argv) {
 }
 
 const char* tn5250_config_get(Tn5250Config* This, const char* name) {
-    Tn5250ConfigStr* str = tn5250_config_get_str(This, name);
+    Tn5250ConfigStr* str =
+        tn5250_config_get_str(This, name, tn5250_config_hash(name));
     return (str == NULL ? NULL : str->value);
 }
 
+/*
+ *    The boolean and integer values are parsed the first time they are
+ *    asked for and kept with the variable until it is set again.
+ */
 int tn5250_config_get_bool(Tn5250Config* This, const char* name) {
-    const char* v = tn5250_config_get(This, name);
-    return (v == NULL ? 0
-                      : !(!strcmp(v, "off") || !strcmp(v, "no") ||
-                          !strcmp(v, "0") || !strcmp(v, "false")));
+    Tn5250ConfigStr* str =
+        tn5250_config_get_str(This, name, tn5250_config_hash(name));
+    const char* v;
+
+    if (str == NULL) {
+        return 0;
+    }
+    if (!str->bool_cached) {
+        v = str->value;
+        str->bool_value = !(!strcmp(v, "off") || !strcmp(v, "no") ||
+                            !strcmp(v, "0") || !strcmp(v, "false"));
+        str->bool_cached = 1;
+    }
+    return str->bool_value;
 }
 
 int tn5250_config_get_int(Tn5250Config* This, const char* name) {
-    const char* v = tn5250_config_get(This, name);
+    Tn5250ConfigStr* str =
+        tn5250_config_get_str(This, name, tn5250_config_hash(name));
 
-    if (v == NULL) {
+    if (str == NULL) {
         return 0;
     }
-    else {
-        return (atoi(v));
+    if (!str->int_cached) {
+        str->int_value = atoi(str->value);
+        str->int_cached = 1;
     }
+    return str->int_value;
 }
 
 void tn5250_config_set(Tn5250Config* This, const char* name,
                        const char* value) {
-    Tn5250ConfigStr* str = tn5250_config_get_str(This, name);
+    unsigned long hash = tn5250_config_hash(name);
+    Tn5250ConfigStr* str = tn5250_config_get_str(This, name, hash);
+    Tn5250ConfigStr** bucket;
 
     if (str != NULL) {
         if (str->value != NULL) {
+            if (strcmp(str->value, value) == 0) {
+                return;
+            }
             free(str->value);
         }
         str->value = (char*)malloc(strlen(value) + 1);
         TN5250_ASSERT(str->value != NULL);
         strcpy(str->value, value);
+        str->int_cached = 0;
+        str->bool_cached = 0;
         return;
     }
 
     str = tn5250_config_str_new(name, value);
+    TN5250_ASSERT(str != NULL);
+    str->hash = hash;
+    bucket = &This->buckets[hash & (This->bucket_count - 1)];
+    str->chain = *bucket;
+    *bucket = str;
+    if (++This->count > This->bucket_count) {
+        tn5250_config_rehash(This);
+    }
+
     if (This->vars == NULL) {
         This->vars = str->next = str->prev = str;
     }
@@ -517,12 +568,20 @@ void tn5250_config_set(Tn5250Config* This, const char* name,
 }
 
 void tn5250_config_unset(Tn5250Config* This, const char* name) {
+    unsigned long hash = tn5250_config_hash(name);
     Tn5250ConfigStr* str;
+    Tn5250ConfigStr** link;
 
-    if ((str = tn5250_config_get_str(This, name)) == NULL) {
+    if ((str = tn5250_config_get_str(This, name, hash)) == NULL) {
         return; /* Not found */
     }
 
+    for (link = &This->buckets[hash & (This->bucket_count - 1)];
+         *link != str; link = &(*link)->chain) {
+    }
+    *link = str->chain;
+    This->count--;
+
     if (This->vars == str) {
         This->vars = This->vars->next;
     }
@@ -538,41 +597,81 @@ void tn5250_config_unset(Tn5250Config* This, const char* name) {
 
 /*
  *    Copy variables prefixed with `prefix' to variables without `prefix'.
+ *    Variables added while we are doing so go on the end of the list, so
+ *    we stop at the one which was last when we started.
  */
 void tn5250_config_promote(Tn5250Config* This, const char* prefix) {
-    Tn5250ConfigStr* iter;
+    Tn5250ConfigStr *iter, *last;
+    size_t len = strlen(prefix);
+
     if ((iter = This->vars) == NULL) {
         return;
     }
-    do {
-        if (strlen(prefix) <= strlen(iter->name) + 2 &&
-            !memcmp(iter->name, prefix, strlen(prefix)) &&
-            iter->name[strlen(prefix)] == '.') {
-            tn5250_config_set(This, iter->name + strlen(prefix) + 1,
-                              iter->value);
+    last = This->vars->prev;
+    while (1) {
+        if (!strncmp(iter->name, prefix, len) && iter->name[len] == '.') {
+            tn5250_config_set(This, iter->name + len + 1, iter->value);
+        }
+        if (iter == last) {
+            break;
         }
         iter = iter->next;
-    } while (iter != This->vars);
+    }
 }
 
+/*
+ *    Look a variable up by name; ``hash'' is tn5250_config_hash (name).
+ */
 static Tn5250ConfigStr* tn5250_config_get_str(Tn5250Config* This,
-                                              const char* name) {
+                                              const char* name,
+                                              unsigned long hash) {
     Tn5250ConfigStr* iter;
 
-    if ((iter = This->vars) == NULL) {
-        return NULL; /* No vars */
-    }
-
-    do {
-        if (!strcmp(iter->name, name)) {
+    for (iter = This->buckets[hash & (This->bucket_count - 1)]; iter != NULL;
+         iter = iter->chain) {
+        if (iter->hash == hash && !strcmp(iter->name, name)) {
             return iter;
         }
-        iter = iter->next;
-    } while (iter != This->vars);
-
+    }
     return NULL; /* Not found */
 }
 
+/*
+ *    FNV-1a hash of a variable name.
+ */
+static unsigned long tn5250_config_hash(const char* name) {
+    unsigned long h = 2166136261UL;
+
+    while (*name != '\0') {
+        h = ((h ^ (unsigned char)*name++) * 16777619UL) & 0xffffffffUL;
+    }
+    return h;
+}
+
+/*
+ *    Double the number of hash buckets.
+ */
+static void tn5250_config_rehash(Tn5250Config* This) {
+    Tn5250ConfigStr **buckets, *iter, *next;
+    unsigned long count = This->bucket_count * 2, i;
+
+    buckets = tn5250_new(Tn5250ConfigStr*, count);
+    if (buckets == NULL) {
+        return; /* Carry on with longer chains. */
+    }
+    memset(buckets, 0, count * sizeof(Tn5250ConfigStr*));
+    for (i = 0; i < This->bucket_count; i++) {
+        for (iter = This->buckets[i]; iter != NULL; iter = next) {
+            next = iter->chain;
+            iter->chain = buckets[iter->hash & (count - 1)];
+            buckets[iter->hash & (count - 1)] = iter;
+        }
+    }
+    free(This->buckets);
+    This->buckets = buckets;
+    This->bucket_count = count;
+}
+
 /****f* lib5250/tn5250_config_replace_vars
  * NAME
  *    tn5250_config_replace_vars
@@ -24,21 +24,52 @@
 extern "C" {
 #endif
 
+/* Initial number of hash buckets in a Tn5250Config; always a power of
+ * two. */
+#define TN5250_CONFIG_BUCKETS 64
+
 struct _Tn5250ConfigStr {
-    struct _Tn5250ConfigStr* next;
+    struct _Tn5250ConfigStr* next; /* In the order they were first set */
     struct _Tn5250ConfigStr* prev;
+    struct _Tn5250ConfigStr* chain; /* Next in the same hash bucket */
+    unsigned long hash;
     char* name;
     char* value;
+
+    /* The value as tn5250_config_get_int and tn5250_config_get_bool
+     * last parsed it. */
+    int int_value;
+    int bool_value;
+    unsigned int int_cached : 1;
+    unsigned int bool_cached : 1;
 };
 
 typedef struct _Tn5250ConfigStr Tn5250ConfigStr;
 
+/****s* lib5250/Tn5250Config
+ * NAME
+ *    Tn5250Config
+ * SYNOPSIS
+ *    Tn5250Config *config = tn5250_config_new ();
+ *    tn5250_config_load_default (config);
+ *    host = tn5250_config_get (config, "host");
+ * DESCRIPTION
+ *    Configuration variables.  Each name is stored once, in a hash table
+ *    keyed on the name, and the variables are also kept in a list in the
+ *    order they were first set, starting at ``vars'', for walking
+ *    through them.
+ * SOURCE
+ */
 struct _Tn5250Config {
     int ref;
     Tn5250ConfigStr* vars;
+    Tn5250ConfigStr** buckets;
+    unsigned long bucket_count;
+    unsigned long count;
 };
 
 typedef struct _Tn5250Config Tn5250Config;
+/*******/
 
 extern Tn5250Config* tn5250_config_new(void);
 extern Tn5250Config* tn5250_config_ref(Tn5250Config* This);
@@ -34,6 +34,28 @@
     }
 #endif
 
+/* Number of fields in each block of field storage. */
+#define TN5250_DBUFFER_FIELD_BLOCK 64
+
+/* The serial number given to the next display buffer made. */
+static unsigned long tn5250_dbuffer_next_serial = 1;
+
+static void tn5250_dbuffer_grow_field_table(Tn5250DBuffer* This, int n);
+static Tn5250Field* tn5250_dbuffer_field_slot(Tn5250DBuffer* This);
+static void tn5250_dbuffer_enter_field(Tn5250DBuffer* This, Tn5250Field* field,
+                                       int adopted);
+static void tn5250_dbuffer_free_fields(Tn5250DBuffer* This);
+static void tn5250_dbuffer_link_field_table(Tn5250DBuffer* This);
+static void tn5250_dbuffer_build_field_links(Tn5250DBuffer* This);
+static void tn5250_dbuffer_init_text(Tn5250DBuffer* This);
+static void tn5250_dbuffer_free_text(Tn5250DBuffer* This);
+static void tn5250_dbuffer_blank_row(Tn5250DBuffer* This, unsigned char* dst,
+                                     int y);
+static void tn5250_dbuffer_init_planes(Tn5250DBuffer* This);
+static void tn5250_dbuffer_free_planes(Tn5250DBuffer* This);
+static void tn5250_dbuffer_resolve_planes(Tn5250DBuffer* This);
+static void tn5250_dbuffer_release_data(Tn5250DBuffer* This);
+
 /****f* lib5250/tn5250_dbuffer_new
  * NAME
  *    tn5250_dbuffer_new
@@ -54,6 +76,7 @@ Tn5250DBuffer* tn5250_dbuffer_new(int width, int height) {
 
     This->w = width;
     This->h = height;
+    This->serial = tn5250_dbuffer_next_serial++;
     This->cx = This->cy = 0;
     This->tcx = This->tcy = 0;
     This->next = This->prev = NULL;
@@ -73,11 +96,47 @@ Tn5250DBuffer* tn5250_dbuffer_new(int width, int height) {
 
     This->script_slot = NULL;
 
+    This->field_table = NULL;
+    This->field_table_alloc = 0;
+    This->field_blocks = NULL;
+    This->field_block_count = 0;
+    This->field_block_used = 0;
+    This->field_adopted = NULL;
+    This->field_next_input = NULL;
+    This->field_prev_input = NULL;
+    This->field_links_valid = 0;
+
+    This->data_refs = NULL;
     This->data = tn5250_new(unsigned char, width* height);
     if (This->data == NULL) {
         free(This);
         return NULL;
     }
+    This->field_map = tn5250_new(int, width* height);
+    if (This->field_map == NULL) {
+        free(This->data);
+        free(This);
+        return NULL;
+    }
+    This->dirty_rows = tn5250_new(unsigned char, (height + 7) / 8);
+    if (This->dirty_rows == NULL) {
+        free(This->field_map);
+        free(This->data);
+        free(This);
+        return NULL;
+    }
+    This->row_generation = tn5250_new(unsigned long, height);
+    if (This->row_generation == NULL) {
+        free(This->dirty_rows);
+        free(This->field_map);
+        free(This->data);
+        free(This);
+        return NULL;
+    }
+    This->generation = 0;
+    tn5250_dbuffer_init_text(This);
+    tn5250_dbuffer_init_planes(This);
+    This->snapshot = NULL;
 
     tn5250_dbuffer_clear(This);
     return This;
@@ -92,10 +151,14 @@ Tn5250DBuffer* tn5250_dbuffer_new(int width, int height) {
  *    Tn5250DBuffer *      dsp        -
  * DESCRIPTION
  *    Allocates a new display buffer and copies the contents of the old
- *    one.
+ *    one.  Only the character data and field map are copy-on-write: they
+ *    are not copied until one of the buffers is written to.  The format
+ *    table, windows and header are copied here, so a copy still costs
+ *    time in proportion to the number of fields and windows.
  *****/
 Tn5250DBuffer* tn5250_dbuffer_copy(Tn5250DBuffer* dsp) {
     Tn5250DBuffer* This = tn5250_new(Tn5250DBuffer, 1);
+    int i;
 
     if (This == NULL) {
         return NULL;
@@ -105,18 +168,74 @@ Tn5250DBuffer* tn5250_dbuffer_copy(Tn5250DBuffer* dsp) {
 
     This->w = dsp->w;
     This->h = dsp->h;
+    This->serial = tn5250_dbuffer_next_serial++;
     This->cx = dsp->cx;
     This->cy = dsp->cy;
     This->tcx = dsp->tcx;
     This->tcy = dsp->tcy;
-    This->data = tn5250_new(unsigned char, dsp->w * dsp->h);
-    if (This->data == NULL) {
+    This->dirty_rows = tn5250_new(unsigned char, (dsp->h + 7) / 8);
+    if (This->dirty_rows == NULL) {
         free(This);
         return NULL;
     }
-    memcpy(This->data, dsp->data, dsp->w * dsp->h);
+    This->row_generation = tn5250_new(unsigned long, dsp->h);
+    if (This->row_generation == NULL) {
+        free(This->dirty_rows);
+        free(This);
+        return NULL;
+    }
+
+    /* The character data and field map are shared with the original
+     * until one of the two buffers writes to them. */
+    if (dsp->data_refs == NULL) {
+        dsp->data_refs = tn5250_new(int, 1);
+        TN5250_ASSERT(dsp->data_refs != NULL);
+        *dsp->data_refs = 1;
+    }
+    (*dsp->data_refs)++;
+    This->data_refs = dsp->data_refs;
+    This->data = dsp->data;
+    This->field_map = dsp->field_map;
+    This->generation = dsp->generation;
+    tn5250_dbuffer_init_text(This);
+    tn5250_dbuffer_init_planes(This);
+    This->snapshot = NULL;
+    tn5250_dbuffer_mark_all_dirty(This);
+
+    This->field_count = dsp->field_count;
+    This->entry_field_count = dsp->entry_field_count;
+    This->window_count = dsp->window_count;
+    This->scrollbar_count = 0;
+    This->menubar_count = 0;
+    This->scrollbar_list = NULL;
+    This->menubar_list = NULL;
+    This->master_mdt = dsp->master_mdt;
+    This->script_slot = NULL;
+    This->next = This->prev = NULL;
 
-    This->field_list = tn5250_field_list_copy(dsp->field_list);
+    /* The copied fields all go into the new buffer's blocks; only the
+     * links, back pointers and script slots need fixing up. */
+    This->field_list = NULL;
+    This->field_table = NULL;
+    This->field_table_alloc = 0;
+    This->field_blocks = NULL;
+    This->field_block_count = 0;
+    This->field_block_used = 0;
+    This->field_adopted = NULL;
+    This->field_next_input = NULL;
+    This->field_prev_input = NULL;
+    This->field_links_valid = 0;
+    if (dsp->field_count > 0) {
+        tn5250_dbuffer_grow_field_table(This, dsp->field_count);
+        for (i = 0; i < dsp->field_count; i++) {
+            This->field_table[i] = tn5250_dbuffer_field_slot(This);
+            memcpy(This->field_table[i], dsp->field_table[i],
+                   sizeof(Tn5250Field));
+            This->field_table[i]->script_slot = NULL;
+            This->field_adopted[i] = 0;
+        }
+        tn5250_dbuffer_link_field_table(This);
+    }
     This->window_list = tn5250_window_list_copy(dsp->window_list);
     This->header_length = dsp->header_length;
     if (dsp->header_data != NULL) {
@@ -142,11 +261,30 @@ Tn5250DBuffer* tn5250_dbuffer_copy(Tn5250DBuffer* dsp) {
  *    Free a display buffer and destroy all sub-structures.
  *****/
 void tn5250_dbuffer_destroy(Tn5250DBuffer* This) {
-    free(This->data);
+    int i;
+
+    tn5250_dbuffer_release_data(This);
+    free(This->dirty_rows);
+    free(This->row_generation);
+    tn5250_dbuffer_free_text(This);
+    tn5250_dbuffer_free_planes(This);
+    if (This->snapshot != NULL) {
+        tn5250_snapshot_unref(This->snapshot);
+    }
+    tn5250_dbuffer_free_fields(This);
+    for (i = 0; i < This->field_block_count; i++) {
+        free(This->field_blocks[i]);
+    }
+    if (This->field_table != NULL) {
+        free(This->field_table);
+        free(This->field_adopted);
+        free(This->field_next_input);
+        free(This->field_prev_input);
+    }
+    free(This->field_blocks);
     if (This->header_data != NULL) {
         free(This->header_data);
     }
-    (void)tn5250_field_list_destroy(This->field_list);
     (void)tn5250_window_list_destroy(This->window_list);
     free(This);
     return;
@@ -327,13 +465,58 @@ send_data_done:
  *    Tn5250Field *        field      -
  * DESCRIPTION
  *    Return a pointer into the display buffer data where the specified
- *    field begins.
+ *    field begins.  Callers write through this pointer, so the rows the
+ *    field covers are marked dirty.  Use tn5250_dbuffer_field_data_const
+ *    to only look at the field.
  *****/
 unsigned char* tn5250_dbuffer_field_data(Tn5250DBuffer* This,
                                          Tn5250Field* field) {
+    unsigned char* data;
+
+    data = tn5250_dbuffer_writable_data(This, tn5250_field_start_row(field),
+                                        tn5250_field_end_row(field));
+    return &data[field->start_row * This->w + field->start_col];
+}
+
+/****f* lib5250/tn5250_dbuffer_field_data_const
+ * NAME
+ *    tn5250_dbuffer_field_data_const
+ * SYNOPSIS
+ *    ret = tn5250_dbuffer_field_data_const (This, field);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250Field *        field      -
+ * DESCRIPTION
+ *    Like tn5250_dbuffer_field_data, but for reading only: the data stays
+ *    shared with any snapshot and no rows are marked dirty.
+ *****/
+const unsigned char* tn5250_dbuffer_field_data_const(Tn5250DBuffer* This,
+                                                     Tn5250Field* field) {
     return &This->data[field->start_row * This->w + field->start_col];
 }
 
+/****f* lib5250/tn5250_dbuffer_writable_data
+ * NAME
+ *    tn5250_dbuffer_writable_data
+ * SYNOPSIS
+ *    data = tn5250_dbuffer_writable_data (This, top, bot);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  top        - First row to be written.
+ *    int                  bot        - Last row to be written.
+ * DESCRIPTION
+ *    Return the character data, indexed by y * width + x, ready to have
+ *    rows ``top'' through ``bot'' written to.  The data is unshared from
+ *    any copy first and those rows are marked dirty.  Everything outside
+ *    this file that stores into the character data must go through here.
+ *****/
+unsigned char* tn5250_dbuffer_writable_data(Tn5250DBuffer* This, int top,
+                                            int bot) {
+    tn5250_dbuffer_own_data(This);
+    tn5250_dbuffer_mark_dirty_rows(This, top, bot);
+    return This->data;
+}
+
 /****f* lib5250/tn5250_dbuffer_set_size
  * NAME
  *    tn5250_dbuffer_set_size
@@ -350,10 +533,30 @@ void tn5250_dbuffer_set_size(Tn5250DBuffer* This, int rows, int cols) {
     This->w = cols;
     This->h = rows;
 
-    free(This->data);
+    tn5250_dbuffer_release_data(This);
     This->data = tn5250_new(unsigned char, rows* cols);
     TN5250_ASSERT(This->data != NULL);
 
+    This->field_map = tn5250_new(int, rows* cols);
+    TN5250_ASSERT(This->field_map != NULL);
+
+    free(This->dirty_rows);
+    This->dirty_rows = tn5250_new(unsigned char, (rows + 7) / 8);
+    TN5250_ASSERT(This->dirty_rows != NULL);
+
+    free(This->row_generation);
+    This->row_generation = tn5250_new(unsigned long, rows);
+    TN5250_ASSERT(This->row_generation != NULL);
+
+    tn5250_dbuffer_free_text(This);
+    tn5250_dbuffer_init_text(This);
+    tn5250_dbuffer_free_planes(This);
+    tn5250_dbuffer_init_planes(This);
+    if (This->snapshot != NULL) {
+        tn5250_snapshot_unref(This->snapshot);
+        This->snapshot = NULL;
+    }
+
     tn5250_dbuffer_clear(This);
     return;
 }
@@ -391,7 +594,9 @@ void tn5250_dbuffer_cursor_set(Tn5250DBuffer* This, int y, int x) {
  *    DOCUMENT ME!!!
  *****/
 void tn5250_dbuffer_clear(Tn5250DBuffer* This) {
+    tn5250_dbuffer_own_data(This);
     memset(This->data, 0, This->w * This->h);
+    tn5250_dbuffer_mark_all_dirty(This);
     This->cx = This->cy = 0;
     tn5250_dbuffer_clear_table(This);
     return;
@@ -406,12 +611,83 @@ void tn5250_dbuffer_clear(Tn5250DBuffer* This) {
  *    Tn5250DBuffer *      This       -
  *    Tn5250Field *        field      -
  * DESCRIPTION
- *    DOCUMENT ME!!!
+ *    Append a field made with tn5250_field_new to the format table and
+ *    enter it into the position-to-field map.  The display buffer takes
+ *    over the field and frees it when the table is cleared.
  *****/
 void tn5250_dbuffer_add_field(Tn5250DBuffer* This, Tn5250Field* field) {
+    tn5250_dbuffer_enter_field(This, field, 1);
+}
+
+/****f* lib5250/tn5250_dbuffer_add_field_copy
+ * NAME
+ *    tn5250_dbuffer_add_field_copy
+ * SYNOPSIS
+ *    ret = tn5250_dbuffer_add_field_copy (This, field);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250Field *        field      -
+ * DESCRIPTION
+ *    Append a copy of a field to the format table and enter it into the
+ *    position-to-field map.  The copy is kept in the display buffer's own
+ *    field storage, so there is no allocation per field; the one passed
+ *    in is left alone and still belongs to the caller.  Returns the copy.
+ *****/
+Tn5250Field* tn5250_dbuffer_add_field_copy(Tn5250DBuffer* This,
+                                           Tn5250Field* field) {
+    Tn5250Field* slot = tn5250_dbuffer_field_slot(This);
+
+    memcpy(slot, field, sizeof(Tn5250Field));
+    slot->script_slot = NULL;
+    tn5250_dbuffer_enter_field(This, slot, 0);
+    return slot;
+}
+
+/*
+ *    Give a field the next id, link it onto the end of the format table
+ *    and fill in its cells in the position-to-field map.  ``adopted'' says
+ *    whether the field was allocated on its own and so has to be freed
+ *    when the table is cleared.
+ */
+static void tn5250_dbuffer_enter_field(Tn5250DBuffer* This, Tn5250Field* field,
+                                       int adopted) {
+    int pos, end;
+
+    if (This->field_count == This->field_table_alloc) {
+        tn5250_dbuffer_grow_field_table(This, This->field_count + 1);
+    }
     field->id = This->field_count++;
     field->table = This;
-    This->field_list = tn5250_field_list_add(This->field_list, field);
+    This->field_table[field->id] = field;
+    This->field_adopted[field->id] = (unsigned char)adopted;
+    if (field->id == 0) {
+        field->next = field->prev = field;
+        This->field_list = field;
+    }
+    else {
+        field->next = This->field_list;
+        field->prev = This->field_list->prev;
+        field->prev->next = field;
+        This->field_list->prev = field;
+    }
+
+    /* Where fields overlap, the earlier one wins, just as it did when
+     * we walked the list. */
+    pos = tn5250_field_start_pos(field);
+    end = tn5250_field_end_pos(field);
+    if (pos < 0) {
+        pos = 0;
+    }
+    if (end >= This->w * This->h) {
+        end = This->w * This->h - 1;
+    }
+    tn5250_dbuffer_own_data(This);
+    for (; pos <= end; pos++) {
+        if (This->field_map[pos] < 0) {
+            This->field_map[pos] = field->id;
+        }
+    }
+    This->field_links_valid = 0;
 
     if ((!tn5250_field_is_continued_middle(field)) &&
         (!tn5250_field_is_continued_last(field))) {
@@ -421,7 +697,6 @@ void tn5250_dbuffer_add_field(Tn5250DBuffer* This, Tn5250Field* field) {
 
     TN5250_LOG(("adding field: field->id: %d, field->entry_id: %d\n", field->id,
                 field->entry_id));
-    return;
 }
 
 /****f* lib5250/tn5250_dbuffer_clear_table
@@ -436,7 +711,11 @@ void tn5250_dbuffer_add_field(Tn5250DBuffer* This, Tn5250Field* field) {
  *****/
 void tn5250_dbuffer_clear_table(Tn5250DBuffer* This) {
     TN5250_LOG(("tn5250_dbuffer_clear_table() entered.\n"));
-    This->field_list = tn5250_field_list_destroy(This->field_list);
+    tn5250_dbuffer_free_fields(This);
+    This->field_list = NULL;
+    tn5250_dbuffer_own_data(This);
+    memset(This->field_map, 0xff, This->w * This->h * sizeof(int));
+    This->field_links_valid = 0;
     /* Comment this for now since the table is cleared just after we have
      * received a Create Window Structured Field command.  We don't really
      * want to blow away our newly created window.
@@ -449,6 +728,7 @@ void tn5250_dbuffer_clear_table(Tn5250DBuffer* This) {
      */
     This->field_count = 0;
     This->entry_field_count = 0;
+    This->field_block_used = 0;
     /*
        This->window_count = 0;
        This->scrollbar_count = 0;
@@ -472,19 +752,198 @@ void tn5250_dbuffer_clear_table(Tn5250DBuffer* This) {
  *    int                  y          -
  *    int                  x          -
  * DESCRIPTION
- *    DOCUMENT ME!!!
+ *    Return the field which contains the position at row ``y'', column
+ *    ``x'', or NULL if there is none.  This is a lookup in the
+ *    position-to-field map.
  *****/
 Tn5250Field* tn5250_dbuffer_field_yx(Tn5250DBuffer* This, int y, int x) {
-    Tn5250Field* iter;
-    if ((iter = This->field_list) != NULL) {
-        do {
-            if (tn5250_field_hit_test(iter, y, x)) {
-                return iter;
-            }
-            iter = iter->next;
-        } while (iter != This->field_list);
+    int id;
+
+    if (y < 0 || y >= This->h || x < 0 || x >= This->w) {
+        return NULL;
     }
-    return NULL;
+    if ((id = This->field_map[y * This->w + x]) < 0) {
+        return NULL;
+    }
+    return This->field_table[id];
+}
+
+/****f* lib5250/tn5250_dbuffer_field_by_id
+ * NAME
+ *    tn5250_dbuffer_field_by_id
+ * SYNOPSIS
+ *    field = tn5250_dbuffer_field_by_id (This, id);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  id         - The field's id.
+ * DESCRIPTION
+ *    Return the field with the specified id, or NULL if there is no such
+ *    field in the format table.
+ *****/
+Tn5250Field* tn5250_dbuffer_field_by_id(Tn5250DBuffer* This, int id) {
+    if (id < 0 || id >= This->field_count) {
+        return NULL;
+    }
+    return This->field_table[id];
+}
+
+/****f* lib5250/tn5250_dbuffer_next_non_bypass
+ * NAME
+ *    tn5250_dbuffer_next_non_bypass
+ * SYNOPSIS
+ *    next = tn5250_dbuffer_next_non_bypass (This, field);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250Field *        field      - A field in this display buffer.
+ * DESCRIPTION
+ *    Return the first non-bypass field following ``field'' in the format
+ *    table, wrapping around to the start.  This may be ``field'' itself if
+ *    it is the only non-bypass field.  Returns NULL if every field is a
+ *    bypass field.
+ *****/
+Tn5250Field* tn5250_dbuffer_next_non_bypass(Tn5250DBuffer* This,
+                                            Tn5250Field* field) {
+    if (!This->field_links_valid) {
+        tn5250_dbuffer_build_field_links(This);
+    }
+    return tn5250_dbuffer_field_by_id(This, This->field_next_input[field->id]);
+}
+
+/****f* lib5250/tn5250_dbuffer_prev_non_bypass
+ * NAME
+ *    tn5250_dbuffer_prev_non_bypass
+ * SYNOPSIS
+ *    prev = tn5250_dbuffer_prev_non_bypass (This, field);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250Field *        field      - A field in this display buffer.
+ * DESCRIPTION
+ *    Return the last non-bypass field preceding ``field'' in the format
+ *    table, wrapping around to the end.  Returns NULL if every field is a
+ *    bypass field.
+ *****/
+Tn5250Field* tn5250_dbuffer_prev_non_bypass(Tn5250DBuffer* This,
+                                            Tn5250Field* field) {
+    if (!This->field_links_valid) {
+        tn5250_dbuffer_build_field_links(This);
+    }
+    return tn5250_dbuffer_field_by_id(This, This->field_prev_input[field->id]);
+}
+
+/*
+ *    Make room for at least n fields in the format table.  Only the
+ *    index grows; the fields themselves stay where they are.
+ */
+static void tn5250_dbuffer_grow_field_table(Tn5250DBuffer* This, int n) {
+    int alloc = This->field_table_alloc == 0 ? 64 : This->field_table_alloc;
+
+    while (alloc < n) {
+        alloc *= 2;
+    }
+    if (alloc == This->field_table_alloc) {
+        return;
+    }
+    This->field_table = (Tn5250Field**)realloc(This->field_table,
+                                               alloc * sizeof(Tn5250Field*));
+    This->field_adopted =
+        (unsigned char*)realloc(This->field_adopted, alloc);
+    This->field_next_input =
+        (int*)realloc(This->field_next_input, alloc * sizeof(int));
+    This->field_prev_input =
+        (int*)realloc(This->field_prev_input, alloc * sizeof(int));
+    TN5250_ASSERT(This->field_table != NULL);
+    TN5250_ASSERT(This->field_adopted != NULL);
+    TN5250_ASSERT(This->field_next_input != NULL);
+    TN5250_ASSERT(This->field_prev_input != NULL);
+    This->field_table_alloc = alloc;
+}
+
+/*
+ *    Return an unused slot in the field blocks, adding a block if they
+ *    are all full.  Blocks are never moved or freed before the display
+ *    buffer is, so a field in one keeps its address.
+ */
+static Tn5250Field* tn5250_dbuffer_field_slot(Tn5250DBuffer* This) {
+    int block = This->field_block_used / TN5250_DBUFFER_FIELD_BLOCK;
+
+    if (block == This->field_block_count) {
+        This->field_blocks = (Tn5250Field**)realloc(
+            This->field_blocks, (block + 1) * sizeof(Tn5250Field*));
+        TN5250_ASSERT(This->field_blocks != NULL);
+        This->field_blocks[block] =
+            tn5250_new(Tn5250Field, TN5250_DBUFFER_FIELD_BLOCK);
+        TN5250_ASSERT(This->field_blocks[block] != NULL);
+        This->field_block_count++;
+    }
+    return &This->field_blocks[block][This->field_block_used++ %
+                                      TN5250_DBUFFER_FIELD_BLOCK];
+}
+
+/*
+ *    Free the fields which were handed to us by tn5250_dbuffer_add_field.
+ *    The ones in the field blocks are reused instead.
+ */
+static void tn5250_dbuffer_free_fields(Tn5250DBuffer* This) {
+    int i;
+
+    for (i = 0; i < This->field_count; i++) {
+        if (This->field_adopted[i]) {
+            tn5250_field_destroy(This->field_table[i]);
+        }
+    }
+}
+
+/*
+ *    Thread the next/prev pointers of the format table into a circular
+ *    list in id order, for the benefit of code that walks field_list.
+ */
+static void tn5250_dbuffer_link_field_table(Tn5250DBuffer* This) {
+    Tn5250Field** table = This->field_table;
+    int n = This->field_count;
+    int i;
+
+    if (n == 0) {
+        This->field_list = NULL;
+        return;
+    }
+    for (i = 0; i < n; i++) {
+        table[i]->next = table[(i + 1) % n];
+        table[i]->prev = table[(i + n - 1) % n];
+        table[i]->table = This;
+    }
+    This->field_list = table[0];
+}
+
+/*
+ *    Work out the next and previous non-bypass field for every field.  We
+ *    go round the table twice in each direction so that the links wrap.
+ */
+static void tn5250_dbuffer_build_field_links(Tn5250DBuffer* This) {
+    int n = This->field_count;
+    int i, k, last;
+
+    last = -1;
+    for (k = 2 * n - 1; k >= 0; k--) {
+        i = k % n;
+        if (k < n) {
+            This->field_next_input[i] = last;
+        }
+        if (!tn5250_field_is_bypass(This->field_table[i])) {
+            last = i;
+        }
+    }
+
+    last = -1;
+    for (k = 0; k < 2 * n; k++) {
+        i = k % n;
+        if (k >= n) {
+            This->field_prev_input[i] = last;
+        }
+        if (!tn5250_field_is_bypass(This->field_table[i])) {
+            last = i;
+        }
+    }
+    This->field_links_valid = 1;
 }
 
 /****f* lib5250/tn5250_dbuffer_first_non_bypass
@@ -672,7 +1131,9 @@ void tn5250_dbuffer_goto_ic(Tn5250DBuffer* This) {
 void tn5250_dbuffer_addch(Tn5250DBuffer* This, unsigned char c) {
     ASSERT_VALID(This);
 
+    tn5250_dbuffer_own_data(This);
     This->data[(This->cy * This->w) + This->cx] = c;
+    tn5250_dbuffer_mark_dirty(This, This->cy);
     tn5250_dbuffer_right(This, 1);
 
     ASSERT_VALID(This);
@@ -694,7 +1155,8 @@ void tn5250_dbuffer_del(Tn5250DBuffer* This, int fieldid, int shiftcount) {
     Tn5250Field *iter, *field;
     int x = This->cx, y = This->cy, fwdx, fwdy, i;
 
-    field = tn5250_field_list_find_by_id(This->field_list, fieldid);
+    tn5250_dbuffer_own_data(This);
+    field = tn5250_dbuffer_field_by_id(This, fieldid);
     iter = field;
 
     while (tn5250_field_is_continued(iter)) {
@@ -727,10 +1189,12 @@ void tn5250_dbuffer_del(Tn5250DBuffer* This, int fieldid, int shiftcount) {
         }
 
         This->data[y * This->w + x] = This->data[fwdy * This->w + fwdx];
+        tn5250_dbuffer_mark_dirty(This, y);
         x = fwdx;
         y = fwdy;
     }
     This->data[y * This->w + x] = 0x00;
+    tn5250_dbuffer_mark_dirty(This, y);
 
     ASSERT_VALID(This);
     return;
@@ -757,6 +1221,8 @@ void tn5250_dbuffer_del_this_field_only(Tn5250DBuffer* This, int shiftcount) {
      */
     int x = This->cx, y = This->cy, fwdx, fwdy, i;
 
+    tn5250_dbuffer_own_data(This);
+
     for (i = 0; i < shiftcount; i++) {
         fwdx = x + 1;
         fwdy = y;
@@ -765,10 +1231,12 @@ void tn5250_dbuffer_del_this_field_only(Tn5250DBuffer* This, int shiftcount) {
             fwdy++;
         }
         This->data[y * This->w + x] = This->data[fwdy * This->w + fwdx];
+        tn5250_dbuffer_mark_dirty(This, y);
         x = fwdx;
         y = fwdy;
     }
     This->data[y * This->w + x] = TN5250_DISPLAY_WORD_WRAP_SPACE;
+    tn5250_dbuffer_mark_dirty(This, y);
 
     ASSERT_VALID(This);
     return;
@@ -793,7 +1261,8 @@ void tn5250_dbuffer_ins(Tn5250DBuffer* This, int fieldid, unsigned char c,
     int x = This->cx, y = This->cy, i;
     unsigned char c2;
 
-    field = tn5250_field_list_find_by_id(This->field_list, fieldid);
+    tn5250_dbuffer_own_data(This);
+    field = tn5250_dbuffer_field_by_id(This, fieldid);
     iter = field;
 
     while (tn5250_field_is_continued(iter)) {
@@ -811,6 +1280,7 @@ void tn5250_dbuffer_ins(Tn5250DBuffer* This, int fieldid, unsigned char c,
     for (i = 0; i <= shiftcount; i++) {
         c2 = This->data[y * This->w + x];
         This->data[y * This->w + x] = c;
+        tn5250_dbuffer_mark_dirty(This, y);
         c = c2;
         if (++x == This->w) {
             x = 0;
@@ -875,6 +1345,8 @@ void tn5250_dbuffer_roll(Tn5250DBuffer* This, int top, int bot, int lines) {
         return;
     }
 
+    tn5250_dbuffer_own_data(This);
+    tn5250_dbuffer_mark_dirty_rows(This, top, bot);
     if (lines < 0) {
         /* Move text up */
         for (n = top; n <= bot; n++) {
@@ -921,6 +1393,530 @@ unsigned char tn5250_dbuffer_char_at(Tn5250DBuffer* This, int y, int x) {
     return This->data[y * This->w + x];
 }
 
+/****f* lib5250/tn5250_dbuffer_mark_dirty_rows
+ * NAME
+ *    tn5250_dbuffer_mark_dirty_rows
+ * SYNOPSIS
+ *    tn5250_dbuffer_mark_dirty_rows (This, top, bot);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  top        - First row which changed.
+ *    int                  bot        - Last row which changed.
+ * DESCRIPTION
+ *    Record that rows ``top'' through ``bot'' inclusive have changed.
+ *    Rows outside of the display buffer are ignored.
+ *****/
+void tn5250_dbuffer_mark_dirty_rows(Tn5250DBuffer* This, int top, int bot) {
+    if (top < 0) {
+        top = 0;
+    }
+    if (bot >= This->h) {
+        bot = This->h - 1;
+    }
+    for (; top <= bot; top++) {
+        tn5250_dbuffer_mark_dirty(This, top);
+    }
+}
+
+/****f* lib5250/tn5250_dbuffer_take_dirty_rows
+ * NAME
+ *    tn5250_dbuffer_take_dirty_rows
+ * SYNOPSIS
+ *    count = tn5250_dbuffer_take_dirty_rows (This, rows);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    unsigned char *      rows       - Array of tn5250_dbuffer_height(This)
+ *                                      bytes, or NULL.
+ * DESCRIPTION
+ *    Fetch and clear the set of rows which have changed since the last
+ *    call.  If ``rows'' is not NULL, rows[y] is set to 1 for each dirty
+ *    row and to 0 for every other row.  Returns the number of dirty rows.
+ *****/
+int tn5250_dbuffer_take_dirty_rows(Tn5250DBuffer* This, unsigned char* rows) {
+    int y, count = 0;
+
+    for (y = 0; y < This->h; y++) {
+        int dirty = (This->dirty_rows[y >> 3] >> (y & 7)) & 1;
+        if (rows != NULL) {
+            rows[y] = (unsigned char)dirty;
+        }
+        count += dirty;
+    }
+    memset(This->dirty_rows, 0, (This->h + 7) / 8);
+    return count;
+}
+
+/****f* lib5250/tn5250_dbuffer_text_row
+ * NAME
+ *    tn5250_dbuffer_text_row
+ * SYNOPSIS
+ *    row = tn5250_dbuffer_text_row (This, map, y);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250CharMap *      map        - Map to translate with.
+ *    int                  y          - Row to fetch.
+ * DESCRIPTION
+ *    Return row ``y'' of the display as tn5250_dbuffer_width(This) local
+ *    characters.  Attributes and other control characters read as
+ *    blanks, and characters in non-display fields are included as they
+ *    are.  The row is kept in a shadow plane and is only translated
+ *    again once something on it has changed, so this is cheap to call
+ *    on every refresh.  The pointer is good until the buffer changes
+ *    size or is destroyed.
+ *****/
+const unsigned char* tn5250_dbuffer_text_row(Tn5250DBuffer* This,
+                                             const Tn5250CharMap* map, int y) {
+    unsigned char* row;
+
+    TN5250_ASSERT(y >= 0 && y < This->h);
+
+    if (map != This->text_map) {
+        tn5250_dbuffer_free_text(This);
+        tn5250_dbuffer_init_text(This);
+        This->text_map = map;
+    }
+    if (This->text == NULL) {
+        This->text = tn5250_new(unsigned char, This->w * This->h);
+        This->text_generation = tn5250_new(unsigned long, This->h);
+        TN5250_ASSERT(This->text != NULL && This->text_generation != NULL);
+        memset(This->text_generation, 0, This->h * sizeof(unsigned long));
+    }
+
+    row = This->text + y * This->w;
+    if (This->text_generation[y] != This->row_generation[y]) {
+        tn5250_dbuffer_blank_row(This, row, y);
+        tn5250_char_map_to_local_n(map, row, row, This->w);
+        This->text_generation[y] = This->row_generation[y];
+    }
+    return row;
+}
+
+/****f* lib5250/tn5250_dbuffer_utf8_row
+ * NAME
+ *    tn5250_dbuffer_utf8_row
+ * SYNOPSIS
+ *    row = tn5250_dbuffer_utf8_row (This, map, y, &len);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    Tn5250CharMap *      map        - Map to translate with.
+ *    int                  y          - Row to fetch.
+ *    int *                len        - Set to the length of the row in
+ *                                      bytes.
+ * DESCRIPTION
+ *    As tn5250_dbuffer_text_row, but the row is returned as UTF-8.  It is
+ *    not NUL-terminated.
+ *****/
+const char* tn5250_dbuffer_utf8_row(Tn5250DBuffer* This,
+                                    const Tn5250CharMap* map, int y,
+                                    int* len) {
+    int size = This->w * TN5250_UTF8_MAX;
+    char* row;
+
+    TN5250_ASSERT(y >= 0 && y < This->h);
+
+    if (map != This->text_map) {
+        tn5250_dbuffer_free_text(This);
+        tn5250_dbuffer_init_text(This);
+        This->text_map = map;
+    }
+    if (This->utf8 == NULL) {
+        /* The extra row on the end is scratch space for blanking. */
+        This->utf8 = tn5250_new(char, size * This->h + This->w);
+        This->utf8_length = tn5250_new(int, This->h);
+        This->utf8_generation = tn5250_new(unsigned long, This->h);
+        TN5250_ASSERT(This->utf8 != NULL && This->utf8_length != NULL &&
+                      This->utf8_generation != NULL);
+        memset(This->utf8_generation, 0, This->h * sizeof(unsigned long));
+    }
+
+    row = This->utf8 + y * size;
+    if (This->utf8_generation[y] != This->row_generation[y]) {
+        unsigned char* scratch = (unsigned char*)This->utf8 + size * This->h;
+        tn5250_dbuffer_blank_row(This, scratch, y);
+        This->utf8_length[y] =
+            tn5250_char_map_to_utf8_n(map, row, size, scratch, This->w);
+        This->utf8_generation[y] = This->row_generation[y];
+    }
+    *len = This->utf8_length[y];
+    return row;
+}
+
+/*
+ *    Copy row y of the data plane to dst with attributes and other
+ *    control characters other than NUL and DUP replaced by EBCDIC blanks,
+ *    ready for translation.
+ */
+static void tn5250_dbuffer_blank_row(Tn5250DBuffer* This, unsigned char* dst,
+                                     int y) {
+    const unsigned char* src = This->data + y * This->w;
+    int x;
+
+    for (x = 0; x < This->w; x++) {
+        unsigned char c = src[x];
+        if ((c < 0x40 && c != 0x00 && c != 0x1c) || c == 0xff) {
+            c = 0x40;
+        }
+        dst[x] = c;
+    }
+}
+
+/*
+ *    Reset the text shadows so that they are allocated again on first
+ *    use.
+ */
+static void tn5250_dbuffer_init_text(Tn5250DBuffer* This) {
+    This->text_map = NULL;
+    This->text = NULL;
+    This->text_generation = NULL;
+    This->utf8 = NULL;
+    This->utf8_length = NULL;
+    This->utf8_generation = NULL;
+}
+
+/*
+ *    Free the text shadows.
+ */
+static void tn5250_dbuffer_free_text(Tn5250DBuffer* This) {
+    free(This->text);
+    free(This->text_generation);
+    free(This->utf8);
+    free(This->utf8_length);
+    free(This->utf8_generation);
+}
+
+/****f* lib5250/tn5250_dbuffer_char_row
+ * NAME
+ *    tn5250_dbuffer_char_row
+ * SYNOPSIS
+ *    chars = tn5250_dbuffer_char_row (This, y);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  y          - Row to fetch.
+ * DESCRIPTION
+ *    Return the EBCDIC characters of row ``y'' with 0x00 in place of each
+ *    attribute byte.  Use with tn5250_dbuffer_attr_row and
+ *    tn5250_dbuffer_field_row, which give the attribute and field id of
+ *    the same cells.  The pointer is good until the buffer next changes.
+ *****/
+const unsigned char* tn5250_dbuffer_char_row(Tn5250DBuffer* This, int y) {
+    TN5250_ASSERT(y >= 0 && y < This->h);
+    tn5250_dbuffer_resolve_planes(This);
+    return This->chars + y * This->w;
+}
+
+/****f* lib5250/tn5250_dbuffer_attr_row
+ * NAME
+ *    tn5250_dbuffer_attr_row
+ * SYNOPSIS
+ *    attrs = tn5250_dbuffer_attr_row (This, y);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  y          - Row to fetch.
+ * DESCRIPTION
+ *    Return the attribute in effect at each cell of row ``y'', or 0x00
+ *    where the cell holds an attribute byte itself.  The attribute
+ *    carried in from earlier rows is already applied, so rows can be
+ *    processed in any order.  The pointer is good until the buffer next
+ *    changes.
+ *****/
+const unsigned char* tn5250_dbuffer_attr_row(Tn5250DBuffer* This, int y) {
+    TN5250_ASSERT(y >= 0 && y < This->h);
+    tn5250_dbuffer_resolve_planes(This);
+    return This->attrs + y * This->w;
+}
+
+/****f* lib5250/tn5250_dbuffer_row_start_attr
+ * NAME
+ *    tn5250_dbuffer_row_start_attr
+ * SYNOPSIS
+ *    a = tn5250_dbuffer_row_start_attr (This, y);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  y          - Row to look at.
+ * DESCRIPTION
+ *    Return the attribute in effect at the start of row ``y''.
+ *****/
+unsigned char tn5250_dbuffer_row_start_attr(Tn5250DBuffer* This, int y) {
+    TN5250_ASSERT(y >= 0 && y < This->h);
+    tn5250_dbuffer_resolve_planes(This);
+    return This->plane_start_attr[y];
+}
+
+/****f* lib5250/tn5250_dbuffer_row_hash
+ * NAME
+ *    tn5250_dbuffer_row_hash
+ * SYNOPSIS
+ *    h = tn5250_dbuffer_row_hash (This, y);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  y          - Row to hash.
+ * DESCRIPTION
+ *    Return a 32-bit FNV-1a hash of row ``y'' of the data plane,
+ *    attribute bytes included.  Hashes are cached and a row is only
+ *    hashed again after it changes.
+ *****/
+unsigned long tn5250_dbuffer_row_hash(Tn5250DBuffer* This, int y) {
+    TN5250_ASSERT(y >= 0 && y < This->h);
+
+    if (This->row_hash == NULL) {
+        This->row_hash = tn5250_new(unsigned long, This->h);
+        This->row_hash_generation = tn5250_new(unsigned long, This->h);
+        TN5250_ASSERT(This->row_hash != NULL &&
+                      This->row_hash_generation != NULL);
+        memset(This->row_hash_generation, 0, This->h * sizeof(unsigned long));
+    }
+    if (This->row_hash_generation[y] != This->row_generation[y]) {
+        const unsigned char* src = This->data + y * This->w;
+        unsigned long h = TN5250_DBUFFER_HASH_BASIS;
+        int x;
+
+        for (x = 0; x < This->w; x++) {
+            h = tn5250_dbuffer_hash_byte(h, src[x]);
+        }
+        This->row_hash[y] = h;
+        This->row_hash_generation[y] = This->row_generation[y];
+    }
+    return This->row_hash[y];
+}
+
+/****f* lib5250/tn5250_dbuffer_unshare_data
+ * NAME
+ *    tn5250_dbuffer_unshare_data
+ * SYNOPSIS
+ *    tn5250_dbuffer_unshare_data (This);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ * DESCRIPTION
+ *    Give this buffer its own copy of the character data and field map,
+ *    which it has been sharing with a copy of itself.  This is called
+ *    through the tn5250_dbuffer_own_data macro before anything writes to
+ *    either of them.
+ *****/
+void tn5250_dbuffer_unshare_data(Tn5250DBuffer* This) {
+    unsigned char* data;
+    int* field_map;
+
+    TN5250_ASSERT(This->data_refs != NULL);
+    if (*This->data_refs > 1) {
+        data = tn5250_new(unsigned char, This->w * This->h);
+        field_map = tn5250_new(int, This->w * This->h);
+        TN5250_ASSERT(data != NULL && field_map != NULL);
+        memcpy(data, This->data, This->w * This->h);
+        memcpy(field_map, This->field_map, This->w * This->h * sizeof(int));
+        (*This->data_refs)--;
+        This->data = data;
+        This->field_map = field_map;
+    }
+    else {
+        /* Everyone else has gone; it is ours already. */
+        free(This->data_refs);
+    }
+    This->data_refs = NULL;
+}
+
+/****f* lib5250/tn5250_dbuffer_find
+ * NAME
+ *    tn5250_dbuffer_find
+ * SYNOPSIS
+ *    found = tn5250_dbuffer_find (This, pat, len, 0, 0, 23, 79, &y, &x);
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    const unsigned char * pat       - EBCDIC text to look for.
+ *    int                  len        - Length of ``pat''.
+ *    int                  top        - First row to search.
+ *    int                  left       - First column to search.
+ *    int                  bottom     - Last row to search.
+ *    int                  right      - Last column to search.
+ *    int *                y          - Set to the row of the match.
+ *    int *                x          - Set to the column of the match.
+ * DESCRIPTION
+ *    Search the rectangle for ``pat'', row by row.  A match may not run
+ *    off the end of a row or out of the rectangle.  The pattern is
+ *    compared with the data plane as it stands, so it must already be in
+ *    the host character set, and a blank in it does not match a null on
+ *    the screen.  Returns 1 and sets ``y'' and ``x'' (if not NULL) to the
+ *    first match, or returns 0.
+ *****/
+int tn5250_dbuffer_find(Tn5250DBuffer* This, const unsigned char* pat,
+                        int len, int top, int left, int bottom, int right,
+                        int* y, int* x) {
+    const unsigned char *row, *p, *last;
+    int r;
+
+    if (top < 0) {
+        top = 0;
+    }
+    if (left < 0) {
+        left = 0;
+    }
+    if (bottom >= This->h) {
+        bottom = This->h - 1;
+    }
+    if (right >= This->w) {
+        right = This->w - 1;
+    }
+    if (len <= 0 || right - left + 1 < len) {
+        return 0;
+    }
+
+    for (r = top; r <= bottom; r++) {
+        row = This->data + r * This->w + left;
+        last = row + (right - left + 1) - len;
+
+        /* memchr() is the fast part; only compare where the first
+         * character turns up. */
+        for (p = row; p <= last; p++) {
+            p = (const unsigned char*)memchr(p, pat[0], last - p + 1);
+            if (p == NULL) {
+                break;
+            }
+            if (memcmp(p + 1, pat + 1, len - 1) == 0) {
+                if (y != NULL) {
+                    *y = r;
+                }
+                if (x != NULL) {
+                    *x = left + (int)(p - row);
+                }
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/****f* lib5250/tn5250_dbuffer_changed_since
+ * NAME
+ *    tn5250_dbuffer_changed_since
+ * SYNOPSIS
+ *    if (tn5250_dbuffer_changed_since (This, 0, 23, gen)) ...
+ * INPUTS
+ *    Tn5250DBuffer *      This       -
+ *    int                  top        - First row to check.
+ *    int                  bottom     - Last row to check.
+ *    unsigned long        generation - Generation last looked at.
+ * DESCRIPTION
+ *    Return 1 if any of the rows from ``top'' to ``bottom'' has changed
+ *    since the buffer's generation was ``generation'', else 0.
+ *****/
+int tn5250_dbuffer_changed_since(Tn5250DBuffer* This, int top, int bottom,
+                                 unsigned long generation) {
+    int r;
+
+    if (This->generation == generation) {
+        return 0;
+    }
+    if (top < 0) {
+        top = 0;
+    }
+    if (bottom >= This->h) {
+        bottom = This->h - 1;
+    }
+    for (r = top; r <= bottom; r++) {
+        if (This->row_generation[r] > generation) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Let go of the character data and field map, freeing them unless
+ *    another buffer is still sharing them.
+ */
+static void tn5250_dbuffer_release_data(Tn5250DBuffer* This) {
+    if (This->data_refs != NULL && --(*This->data_refs) > 0) {
+        This->data_refs = NULL;
+        return;
+    }
+    free(This->data_refs);
+    free(This->data);
+    free(This->field_map);
+    This->data_refs = NULL;
+}
+
+/*
+ *    Bring the character and attribute planes up to date.  A row is split
+ *    again if it has changed, or if the attribute carried into it from
+ *    the row above is different.  When nothing has changed since the last
+ *    call this is a single comparison.
+ */
+static void tn5250_dbuffer_resolve_planes(Tn5250DBuffer* This) {
+    unsigned char a = 0x20;
+    int r, x;
+
+    if (This->chars == NULL) {
+        This->chars = tn5250_new(unsigned char, This->w * This->h);
+        This->attrs = tn5250_new(unsigned char, This->w * This->h);
+        This->plane_start_attr = tn5250_new(unsigned char, This->h);
+        This->plane_end_attr = tn5250_new(unsigned char, This->h);
+        This->plane_generation = tn5250_new(unsigned long, This->h);
+        TN5250_ASSERT(This->chars != NULL && This->attrs != NULL &&
+                      This->plane_start_attr != NULL &&
+                      This->plane_end_attr != NULL &&
+                      This->plane_generation != NULL);
+        memset(This->plane_generation, 0, This->h * sizeof(unsigned long));
+    }
+    else if (This->planes_checked == This->generation) {
+        return;
+    }
+
+    for (r = 0; r < This->h; r++) {
+        const unsigned char* src = This->data + r * This->w;
+        unsigned char* chars = This->chars + r * This->w;
+        unsigned char* attrs = This->attrs + r * This->w;
+
+        if (This->plane_generation[r] == This->row_generation[r] &&
+            This->plane_start_attr[r] == a) {
+            a = This->plane_end_attr[r];
+            continue;
+        }
+        This->plane_start_attr[r] = a;
+        for (x = 0; x < This->w; x++) {
+            unsigned char c = src[x];
+            if ((c & 0xe0) == 0x20) {
+                a = c;
+                chars[x] = 0x00;
+                attrs[x] = 0x00;
+            }
+            else {
+                chars[x] = c;
+                attrs[x] = a;
+            }
+        }
+        This->plane_generation[r] = This->row_generation[r];
+        This->plane_end_attr[r] = a;
+    }
+    This->planes_checked = This->generation;
+}
+
+/*
+ *    Reset the character and attribute planes and the row hashes so that
+ *    they are allocated again on first use.
+ */
+static void tn5250_dbuffer_init_planes(Tn5250DBuffer* This) {
+    This->chars = NULL;
+    This->attrs = NULL;
+    This->plane_start_attr = NULL;
+    This->plane_end_attr = NULL;
+    This->plane_generation = NULL;
+    This->planes_checked = 0;
+    This->row_hash = NULL;
+    This->row_hash_generation = NULL;
+}
+
+/*
+ *    Free the character and attribute planes and the row hashes.
+ */
+static void tn5250_dbuffer_free_planes(Tn5250DBuffer* This) {
+    free(This->chars);
+    free(This->attrs);
+    free(This->plane_start_attr);
+    free(This->plane_end_attr);
+    free(This->plane_generation);
+    free(This->row_hash);
+    free(This->row_hash_generation);
+}
+
 /****f* lib5250/tn5250_dbuffer_msg_line
  * NAME
  *    tn5250_dbuffer_msg_line
@@ -48,8 +48,23 @@ struct _Tn5250DBuffer {
     int tcx, tcy; /* for set_new_ic */
     unsigned char /*@notnull@ */* data;
 
-    /* Stuff from the old Tn5250Table structure. */
+    /* Stuff from the old Tn5250Table structure.  field_table holds a
+     * pointer to each field, indexed by id; field_list points at the
+     * first field and the next/prev links are kept up to date so that the
+     * list-walking code still works.  The list belongs to the table and
+     * must not be changed with the tn5250_field_list_* functions. */
     struct _Tn5250Field /*@null@ */* field_list;
+    struct _Tn5250Field** field_table;
+    int field_table_alloc;
+
+    /* Fields made by tn5250_dbuffer_add_field_copy are kept in blocks
+     * which never move, field_block_used slots at a time.  field_adopted
+     * is set for each id whose field was handed over by
+     * tn5250_dbuffer_add_field and has to be freed on its own. */
+    struct _Tn5250Field** field_blocks;
+    int field_block_count;
+    int field_block_used;
+    unsigned char* field_adopted;
     struct _Tn5250Window* window_list;
     struct _Tn5250Scrollbar* scrollbar_list;
     struct _Tn5250Menubar* menubar_list;
@@ -60,6 +75,65 @@ struct _Tn5250DBuffer {
     int menubar_count;
     int master_mdt;
 
+    /* Position-to-field map: one field id per screen cell (-1 where there
+     * is no field), so that hit-testing doesn't walk the field list. */
+    int* field_map;
+
+    /* Number of buffers sharing data and field_map, or NULL when this
+     * buffer has them to itself.  tn5250_dbuffer_copy shares them, and
+     * the first write through either buffer takes a private copy. */
+    int* data_refs;
+
+    /* Next/previous non-bypass field for each field id, used for tab and
+     * backtab.  Rebuilt on demand when field_links_valid is clear. */
+    int* field_next_input;
+    int* field_prev_input;
+    int field_links_valid;
+
+    /* One bit per row, set whenever something on that row changes, and a
+     * counter which is bumped on every change.  Terminals use these to
+     * repaint only what has changed since they last looked. */
+    unsigned char* dirty_rows;
+    unsigned long generation;
+
+    /* Different for every buffer made by tn5250_dbuffer_new or
+     * tn5250_dbuffer_copy, so that a cache keyed on it can't mistake a
+     * new buffer for a freed one which had the same address. */
+    unsigned long serial;
+
+    /* The value of generation when each row last changed. */
+    unsigned long* row_generation;
+
+    /* Optional shadows of the data plane in the local character set and
+     * in UTF-8.  They are allocated on first use, and after that a row is
+     * only translated again when its row_generation has moved on. */
+    const struct _Tn5250CharMap* text_map;
+    unsigned char* text;
+    unsigned long* text_generation;
+    char* utf8;
+    int* utf8_length;
+    unsigned long* utf8_generation;
+
+    /* Structure-of-arrays view of the data plane: the characters with the
+     * attribute bytes taken out (0x00 in their place), and the attribute
+     * in effect at every cell (0x00 on the attribute bytes themselves).
+     * Field ids per cell are in field_map.  Rows are resolved on demand,
+     * and once resolved can be processed independently of each other. */
+    unsigned char* chars;
+    unsigned char* attrs;
+    unsigned char* plane_start_attr;
+    unsigned char* plane_end_attr;
+    unsigned long* plane_generation;
+    unsigned long planes_checked;
+
+    /* FNV-1a hash of each row of the data plane, recomputed on demand
+     * when the row's generation moves on. */
+    unsigned long* row_hash;
+    unsigned long* row_hash_generation;
+
+    /* The last snapshot taken, which the next one shares rows with. */
+    struct _Tn5250Snapshot* snapshot;
+
     /* Header data (from SOH order) is saved here.  We even save data that
      * we don't understand here so we can insert that into our generated
      * WTD orders for save/restore screen. */
@@ -101,6 +175,28 @@ extern void tn5250_dbuffer_roll(Tn5250DBuffer* This, int top, int bot,
                                 int lines);
 
 extern unsigned char tn5250_dbuffer_char_at(Tn5250DBuffer* This, int y, int x);
+extern void tn5250_dbuffer_mark_dirty_rows(Tn5250DBuffer* This, int top,
+                                           int bot);
+extern int tn5250_dbuffer_take_dirty_rows(Tn5250DBuffer* This,
+                                          unsigned char* rows);
+extern const unsigned char*
+tn5250_dbuffer_text_row(Tn5250DBuffer* This, const struct _Tn5250CharMap* map,
+                        int y);
+extern const char* tn5250_dbuffer_utf8_row(Tn5250DBuffer* This,
+                                           const struct _Tn5250CharMap* map,
+                                           int y, int* len);
+extern const unsigned char* tn5250_dbuffer_char_row(Tn5250DBuffer* This,
+                                                    int y);
+extern const unsigned char* tn5250_dbuffer_attr_row(Tn5250DBuffer* This,
+                                                    int y);
+extern unsigned char tn5250_dbuffer_row_start_attr(Tn5250DBuffer* This, int y);
+extern unsigned long tn5250_dbuffer_row_hash(Tn5250DBuffer* This, int y);
+extern int tn5250_dbuffer_find(Tn5250DBuffer* This, const unsigned char* pat,
+                               int len, int top, int left, int bottom,
+                               int right, int* y, int* x);
+extern int tn5250_dbuffer_changed_since(Tn5250DBuffer* This, int top,
+                                        int bottom, unsigned long generation);
+extern void tn5250_dbuffer_unshare_data(Tn5250DBuffer* This);
 extern void tn5250_dbuffer_prevword(Tn5250DBuffer* This);
 extern void tn5250_dbuffer_nextword(Tn5250DBuffer* This);
 
@@ -109,9 +205,31 @@ extern void tn5250_dbuffer_nextword(Tn5250DBuffer* This);
 #define tn5250_dbuffer_cursor_x(This) ((This)->cx)
 #define tn5250_dbuffer_cursor_y(This) ((This)->cy)
 
-/* Format table manipulation. */
+/* Change tracking. */
+#define TN5250_DBUFFER_HASH_BASIS 2166136261UL
+#define TN5250_DBUFFER_HASH_PRIME 16777619UL
+#define tn5250_dbuffer_hash_byte(h, c)                                         \
+    ((((h) ^ (unsigned char)(c)) * TN5250_DBUFFER_HASH_PRIME) & 0xffffffffUL)
+#define tn5250_dbuffer_generation(This) ((This)->generation)
+#define tn5250_dbuffer_serial(This)     ((This)->serial)
+#define tn5250_dbuffer_mark_dirty(This, row)                                   \
+    ((This)->dirty_rows[(row) >> 3] |= (unsigned char)(1 << ((row) & 7)),      \
+     (void)((This)->row_generation[(row)] = ++(This)->generation))
+#define tn5250_dbuffer_row_generation(This, row) ((This)->row_generation[(row)])
+#define tn5250_dbuffer_own_data(This)                                          \
+    ((This)->data_refs != NULL ? tn5250_dbuffer_unshare_data(This) : (void)0)
+#define tn5250_dbuffer_field_row(This, y)                                      \
+    ((const int*)(This)->field_map + (y) * (This)->w)
+#define tn5250_dbuffer_mark_all_dirty(This)                                    \
+    tn5250_dbuffer_mark_dirty_rows((This), 0, (This)->h - 1)
+
+/* Format table manipulation.  A field in the format table keeps its
+ * address until the table is cleared or the display buffer destroyed;
+ * adding more fields never moves the ones already there. */
 extern void tn5250_dbuffer_add_field(Tn5250DBuffer* This,
                                      struct _Tn5250Field* field);
+extern struct _Tn5250Field*
+tn5250_dbuffer_add_field_copy(Tn5250DBuffer* This, struct _Tn5250Field* field);
 extern void tn5250_dbuffer_clear_table(Tn5250DBuffer* This);
 extern struct _Tn5250Field* tn5250_dbuffer_field_yx(Tn5250DBuffer* This, int y,
                                                     int x);
@@ -120,9 +238,22 @@ extern void tn5250_dbuffer_set_header_data(Tn5250DBuffer* This,
 extern int tn5250_dbuffer_send_data_for_aid_key(Tn5250DBuffer* This, int k);
 extern unsigned char* tn5250_dbuffer_field_data(Tn5250DBuffer* This,
                                                 struct _Tn5250Field* field);
+extern const unsigned char*
+tn5250_dbuffer_field_data_const(Tn5250DBuffer* This,
+                                struct _Tn5250Field* field);
+extern unsigned char* tn5250_dbuffer_writable_data(Tn5250DBuffer* This,
+                                                   int top, int bot);
 extern int tn5250_dbuffer_msg_line(Tn5250DBuffer* This);
 extern struct _Tn5250Field*
 tn5250_dbuffer_first_non_bypass(Tn5250DBuffer* This);
+extern struct _Tn5250Field* tn5250_dbuffer_field_by_id(Tn5250DBuffer* This,
+                                                       int id);
+extern struct _Tn5250Field*
+tn5250_dbuffer_next_non_bypass(Tn5250DBuffer* This,
+                               struct _Tn5250Field* field);
+extern struct _Tn5250Field*
+tn5250_dbuffer_prev_non_bypass(Tn5250DBuffer* This,
+                               struct _Tn5250Field* field);
 extern void tn5250_dbuffer_add_window(Tn5250DBuffer* This,
                                       struct _Tn5250Window* window);
 extern void tn5250_dbuffer_add_scrollbar(Tn5250DBuffer* This,
@@ -135,6 +266,8 @@ extern void tn5250_dbuffer_add_menubar(Tn5250DBuffer* This,
 #define tn5250_dbuffer_menubar_count(This) ((This)->menubar_count)
 #define tn5250_dbuffer_mdt(This)           ((This)->master_mdt)
 #define tn5250_dbuffer_set_mdt(This)       ((This)->master_mdt = 1)
+#define tn5250_dbuffer_invalidate_field_links(This)                            \
+    ((This)->field_links_valid = 0)
 
 #ifdef __cplusplus
 }
@@ -112,6 +112,7 @@ Tn5250Terminal* tn5250_debug_terminal_new(Tn5250Terminal* slave,
     Tn5250Terminal* This = tn5250_new(Tn5250Terminal, 1);
     if (This != NULL) {
         This->conn_fd = -1;
+        This->wait_limit = -1;
         This->init = debug_terminal_init;
         This->term = debug_terminal_term;
         This->destroy = debug_terminal_destroy;
@@ -368,6 +369,7 @@ static int debug_terminal_waitevent(Tn5250Terminal* This) {
     int n;
 
     if (feof(This->data->dbgstream->debugfile)) {
+        This->data->slaveterm->wait_limit = This->wait_limit;
         return (*(This->data->slaveterm->waitevent))(This->data->slaveterm);
     }
 
@@ -33,6 +33,14 @@ void tn5250_display_wordwrap_insert(Tn5250Display* This, unsigned char c,
                                     int shiftcount);
 void tn5250_display_wordwrap_addch(Tn5250Display* This, unsigned char c);
 int display_check_pccmd(Tn5250Display* This);
+static int display_wait_data(Tn5250Display* This, long msec);
+static void display_queue_key(Tn5250Display* This, int key);
+static void display_handle_key(Tn5250Display* This, int key);
+static void display_handle_run(Tn5250Display* This, const int* keys,
+                               int count);
+static int display_enter_run(Tn5250Display* This, const int* keys,
+                             int count);
+static void display_run_macro(Tn5250Display* This);
 
 /****f* lib5250/tn5250_display_new
  * NAME
@@ -62,7 +70,18 @@ Tn5250Display* tn5250_display_new() {
     This->field_minus_in_char = 0;
     This->uninhibited = 0;
     This->session = NULL;
+    This->key_queue = tn5250_new(int, TN5250_DISPLAY_KEYQ_SIZE);
     This->key_queue_head = This->key_queue_tail = 0;
+    This->key_queue_alloc = TN5250_DISPLAY_KEYQ_SIZE;
+    This->frame_interval = 0;
+    This->last_frame = 0;
+    This->frames = 0;
+    This->frames_skipped = 0;
+    This->recorder = NULL;
+    This->shadow = NULL;
+    This->script = NULL;
+    This->update_pending = 0;
+    This->update_urgent = 0;
     This->saved_msg_line = NULL;
     This->msg_line = NULL;
     This->map = NULL;
@@ -103,6 +122,15 @@ void tn5250_display_destroy(Tn5250Display* This) {
     if (This->msg_line != NULL) {
         free(This->msg_line);
     }
+    if (This->key_queue != NULL) {
+        free(This->key_queue);
+    }
+    if (This->recorder != NULL) {
+        tn5250_recorder_destroy(This->recorder);
+    }
+    if (This->shadow != NULL) {
+        tn5250_shadow_destroy(This->shadow);
+    }
     if (This->config != NULL) {
         tn5250_config_unref(This->config);
     }
@@ -158,6 +186,12 @@ int tn5250_display_config(Tn5250Display* This, Tn5250Config* config) {
             tn5250_config_get_bool(config, "field_minus_in_char");
     }
 
+    /* Limit how often the screen is redrawn while host data is arriving */
+    if (tn5250_config_get(config, "max_frame_rate")) {
+        tn5250_display_set_max_frame_rate(
+            This, tn5250_config_get_int(config, "max_frame_rate"));
+    }
+
     /* Set a terminal type if necessary */
     termtype = tn5250_config_get(config, "env.TERM");
 
@@ -179,6 +213,30 @@ int tn5250_display_config(Tn5250Display* This, Tn5250Config* config) {
         return -1; /* FIXME: An error message would be nice. */
     }
 
+    /* Record the session to a file for playing back later */
+    if ((v = tn5250_config_get(config, "record")) != NULL &&
+        This->recorder == NULL) {
+        This->recorder =
+            tn5250_recorder_new(v, tn5250_config_get(config, "map"));
+        if (This->recorder == NULL) {
+            return -1;
+        }
+    }
+    if (This->recorder != NULL &&
+        tn5250_config_get(config, "record_keyframe_interval")) {
+        tn5250_recorder_set_keyframe_interval(
+            This->recorder,
+            tn5250_config_get_int(config, "record_keyframe_interval"));
+    }
+
+    /* Let other processes watch the session */
+    if ((v = tn5250_config_get(config, "shadow")) != NULL &&
+        This->shadow == NULL) {
+        if ((This->shadow = tn5250_shadow_new(v)) == NULL) {
+            return -1;
+        }
+    }
+
     return 0;
 }
 
@@ -210,7 +268,9 @@ void tn5250_display_set_session(Tn5250Display* This, struct _Tn5250Session* s) {
  *    Tn5250Display *      This       -
  * DESCRIPTION
  *    Create a new display buffer and assign the old one an id so we can
- *    later restore it.  Return the id which must be > 0.
+ *    later restore it.  Return the id which must be > 0.  The two buffers
+ *    share their character data and field map until one of them is
+ *    written to; the format table is copied (see tn5250_dbuffer_copy).
  *****/
 Tn5250DBuffer* tn5250_display_push_dbuffer(Tn5250Display* This) {
     Tn5250DBuffer* dbuf;
@@ -254,8 +314,12 @@ void tn5250_display_restore_dbuffer(Tn5250Display* This, Tn5250DBuffer* id) {
 
     This->display_buffers->prev->next = This->display_buffers->next;
     This->display_buffers->next->prev = This->display_buffers->prev;
+    if (iter->generation <= This->display_buffers->generation) {
+        iter->generation = This->display_buffers->generation + 1;
+    }
     tn5250_dbuffer_destroy(This->display_buffers);
     This->display_buffers = iter;
+    tn5250_dbuffer_mark_all_dirty(This->display_buffers);
     return;
 }
 
@@ -318,14 +382,28 @@ void tn5250_display_set_terminal(Tn5250Display* This, Tn5250Terminal* term) {
  * INPUTS
  *    Tn5250Display *      This       -
  * DESCRIPTION
- *    Update the terminal's representation of the display.
+ *    Update the terminal's representation of the display now.  Most
+ *    callers should use tn5250_display_schedule_update instead, so that
+ *    several changes made in one pass through the event loop are drawn
+ *    as one frame.
  *****/
 void tn5250_display_update(Tn5250Display* This) {
+    This->update_pending = 0;
+    This->update_urgent = 0;
+    This->frames++;
+    if (This->frame_interval > 0) {
+        This->last_frame = tn5250_msec_now();
+    }
     if (This->msg_line != NULL) {
-        int l;
+        int l, ofs;
+        unsigned char* data;
         l = tn5250_dbuffer_msg_line(This->display_buffers);
-        memcpy(This->display_buffers->data + tn5250_display_width(This) * l,
-               This->msg_line, This->msg_len);
+        ofs = tn5250_display_width(This) * l;
+        if (memcmp(This->display_buffers->data + ofs, This->msg_line,
+                   This->msg_len) != 0) {
+            data = tn5250_dbuffer_writable_data(This->display_buffers, l, l);
+            memcpy(data + ofs, This->msg_line, This->msg_len);
+        }
     }
     if (display_check_pccmd(This) == 0) {
         if (This->terminal != NULL) {
@@ -336,9 +414,123 @@ void tn5250_display_update(Tn5250Display* This) {
             }
         }
     }
+    if (This->recorder != NULL) {
+        tn5250_recorder_frame(This->recorder, This);
+    }
+    if (This->shadow != NULL) {
+        tn5250_shadow_frame(This->shadow, This);
+    }
+    if (This->script != NULL) {
+        tn5250_script_frame(This->script, This);
+    }
+    return;
+}
+
+/****f* lib5250/tn5250_display_schedule_update
+ * NAME
+ *    tn5250_display_schedule_update
+ * SYNOPSIS
+ *    tn5250_display_schedule_update (This, echo);
+ * INPUTS
+ *    Tn5250Display *      This       -
+ *    int                  echo       - Nonzero if the change is the echo
+ *                                      of a keystroke.
+ * DESCRIPTION
+ *    Mark the display as needing to be redrawn.  The frame is drawn by
+ *    tn5250_display_flush, which the event loop calls once per pass, so
+ *    a burst of records from the host or a paste of many keys costs one
+ *    repaint.  Requests made while a frame is already pending are
+ *    counted in tn5250_display_frames_skipped.  Keystroke echo is never
+ *    held back by the frame rate limit.
+ *****/
+void tn5250_display_schedule_update(Tn5250Display* This, int echo) {
+    if (This->update_pending) {
+        This->frames_skipped++;
+    }
+    This->update_pending = 1;
+    if (echo) {
+        This->update_urgent = 1;
+    }
+    return;
+}
+
+/****f* lib5250/tn5250_display_flush
+ * NAME
+ *    tn5250_display_flush
+ * SYNOPSIS
+ *    wait = tn5250_display_flush (This);
+ * INPUTS
+ *    Tn5250Display *      This       -
+ * DESCRIPTION
+ *    Draw the pending frame, if there is one and the frame rate limit
+ *    allows.  Returns -1 if nothing was pending, 0 if the frame was
+ *    drawn, or the number of milliseconds until the held back frame may
+ *    be drawn.
+ *****/
+long tn5250_display_flush(Tn5250Display* This) {
+    long wait;
+
+    if (!This->update_pending) {
+        return -1;
+    }
+    if (This->frame_interval > 0 && !This->update_urgent) {
+        wait = This->frame_interval - tn5250_msec_since(This->last_frame);
+        /* If the clock went backwards, don't wait for it to catch up. */
+        if (wait > 0 && wait <= This->frame_interval) {
+            return wait;
+        }
+    }
+    tn5250_display_update(This);
+    return 0;
+}
+
+/****f* lib5250/tn5250_display_set_max_frame_rate
+ * NAME
+ *    tn5250_display_set_max_frame_rate
+ * SYNOPSIS
+ *    tn5250_display_set_max_frame_rate (This, fps);
+ * INPUTS
+ *    Tn5250Display *      This       -
+ *    int                  fps        - Frames per second, or 0 for no
+ *                                      limit.
+ * DESCRIPTION
+ *    Set how many times a second the screen may be redrawn while data
+ *    from the host is arriving.
+ *****/
+void tn5250_display_set_max_frame_rate(Tn5250Display* This, int fps) {
+    if (fps <= 0) {
+        This->frame_interval = 0;
+    }
+    else if ((This->frame_interval = 1000 / fps) == 0) {
+        This->frame_interval = 1;
+    }
     return;
 }
 
+/*
+ *    Wait up to msec milliseconds for data from the host while a frame is
+ *    being held back.  Returns nonzero if there is data to read.
+ */
+static int display_wait_data(Tn5250Display* This, long msec) {
+    SOCKET_TYPE fd = This->terminal->conn_fd;
+    fd_set fdr;
+    struct timeval tv;
+
+    if (fd < 0) {
+#ifdef WIN32
+        Sleep(msec);
+#else
+        usleep(msec * 1000);
+#endif
+        return 0;
+    }
+    tv.tv_sec = msec / 1000;
+    tv.tv_usec = (msec % 1000) * 1000;
+    FD_ZERO(&fdr);
+    FD_SET(fd, &fdr);
+    return select(fd + 1, &fdr, NULL, NULL, &tv) > 0;
+}
+
 /****f* lib5250/tn5250_display_waitevent
  * NAME
  *    tn5250_display_waitevent
@@ -349,9 +541,16 @@ void tn5250_display_update(Tn5250Display* This) {
  * DESCRIPTION
  *    Wait for a terminal event.  Handle keystrokes while we're at it
  *    and don't return those to the session (what would it do with them?)
+ *    Any pending frame is drawn before we block.  If the frame rate
+ *    limit is holding a frame back, the terminal's wait is limited to
+ *    when it is due, so keys are still handled (and echoed at once) and
+ *    data from the host goes into the same frame.  Terminals without the
+ *    TN5250_TERMINAL_WAIT_LIMIT flag can't be told that, so for them we
+ *    wait only for data from the host until the frame is due.
  *****/
 int tn5250_display_waitevent(Tn5250Display* This) {
-    int is_x_system, r, handled_key = 0;
+    int is_x_system, r, limit;
+    long wait;
 
     if (This->terminal == NULL) {
         return 0;
@@ -362,31 +561,55 @@ int tn5250_display_waitevent(Tn5250Display* This) {
 
         /* Handle keys from our key queue if we aren't X SYSTEM. */
         if (This->key_queue_head != This->key_queue_tail && !is_x_system) {
-            TN5250_LOG(("Handling buffered key.\n"));
-            tn5250_display_do_key(This, This->key_queue[This->key_queue_head]);
-            if (++This->key_queue_head == TN5250_DISPLAY_KEYQ_SIZE) {
-                This->key_queue_head = 0;
+            TN5250_LOG(("Handling buffered keys.\n"));
+            This->key_queue_head += tn5250_display_do_text(
+                This, This->key_queue + This->key_queue_head,
+                This->key_queue_tail - This->key_queue_head);
+            if (This->key_queue_head == This->key_queue_tail) {
+                This->key_queue_head = This->key_queue_tail = 0;
             }
-            handled_key = 1;
+            tn5250_display_schedule_update(This, 1);
             continue;
         }
 
         /* don't make the user press HELP to see what the error is */
         if (This->keystate == TN5250_KEYSTATE_PREHELP) {
             tn5250_display_do_key(This, K_HELP);
-            handled_key = 1;
+            tn5250_display_schedule_update(This, 1);
+        }
+
+        /* wait_limit is only there on terminals which have the flag; one
+         * built against an older lib5250 has a shorter structure. */
+        wait = tn5250_display_flush(This);
+        limit = (tn5250_terminal_flags(This->terminal) &
+                 TN5250_TERMINAL_WAIT_LIMIT) != 0;
+        if (wait > 0 && !limit) {
+            if (display_wait_data(This, wait)) {
+                return TN5250_TERMINAL_EVENT_DATA;
+            }
+            continue;
         }
 
-        if (handled_key) {
-            tn5250_display_update(This);
-            handled_key = 0;
+        if (limit) {
+            This->terminal->wait_limit = wait > 0 ? wait : -1;
         }
         r = tn5250_terminal_waitevent(This->terminal);
+        if (limit) {
+            This->terminal->wait_limit = -1;
+        }
         if ((r & TN5250_TERMINAL_EVENT_KEY) != 0) {
             tn5250_display_do_keys(This);
         }
 
-        if ((r & ~TN5250_TERMINAL_EVENT_KEY) != 0) {
+        if ((r & ~TN5250_TERMINAL_EVENT_KEY) == TN5250_TERMINAL_EVENT_TIMEOUT) {
+            /* If the time was up for the frame held back, draw it and
+             * carry on waiting; if not, it was the terminal's own
+             * timeout which ran out. */
+            if (wait <= 0 || tn5250_display_flush(This) != 0) {
+                return r;
+            }
+        }
+        else if ((r & ~TN5250_TERMINAL_EVENT_KEY) != 0) {
             return r;
         }
     }
@@ -505,7 +728,7 @@ Tn5250Field* tn5250_display_current_field(Tn5250Display* This) {
  *    a bypass field.
  *****/
 Tn5250Field* tn5250_display_next_field(Tn5250Display* This) {
-    Tn5250Field *iter = NULL, *next;
+    Tn5250Field* iter = NULL;
     int y, x;
 
     y = tn5250_display_cursor_y(This);
@@ -529,20 +752,12 @@ Tn5250Field* tn5250_display_next_field(Tn5250Display* This) {
                 }
             }
         }
-    }
-    else {
-        iter = iter->next;
-    }
-
-    next = iter;
-    while (tn5250_field_is_bypass(next)) {
-        next = next->next; /* Hehe */
-        if (next == iter && tn5250_field_is_bypass(next)) {
-            return NULL; /* No non-bypass fields. */
+        if (!tn5250_field_is_bypass(iter)) {
+            return iter;
         }
     }
 
-    return next;
+    return tn5250_dbuffer_next_non_bypass(This->display_buffers, iter);
 }
 
 /****f* lib5250/tn5250_display_prev_field
@@ -557,7 +772,7 @@ Tn5250Field* tn5250_display_next_field(Tn5250Display* This) {
  *    field.
  *****/
 Tn5250Field* tn5250_display_prev_field(Tn5250Display* This) {
-    Tn5250Field *iter = NULL, *prev;
+    Tn5250Field* iter = NULL;
     int y, x;
 
     y = tn5250_display_cursor_y(This);
@@ -581,20 +796,12 @@ Tn5250Field* tn5250_display_prev_field(Tn5250Display* This) {
                 }
             }
         }
-    }
-    else {
-        iter = iter->prev;
-    }
-
-    prev = iter;
-    while (tn5250_field_is_bypass(prev)) {
-        prev = prev->prev; /* Hehe */
-        if (prev == iter && tn5250_field_is_bypass(prev)) {
-            return NULL; /* No non-bypass fields. */
+        if (!tn5250_field_is_bypass(iter)) {
+            return iter;
         }
     }
 
-    return prev;
+    return tn5250_dbuffer_prev_non_bypass(This->display_buffers, iter);
 }
 
 /****f* lib5250/tn5250_display_set_cursor_home
@@ -969,7 +1176,8 @@ void tn5250_display_interactive_addch(Tn5250Display* This, unsigned char ch) {
     /* Add or insert the character (depending on whether insert mode is on). */
     if ((tn5250_display_indicators(This) & TN5250_DISPLAY_IND_INSERT) != 0) {
         int ofs = tn5250_field_length(field) - 1;
-        unsigned char* data = tn5250_display_field_data(This, field);
+        const unsigned char* data =
+            tn5250_display_field_data_const(This, field);
 
         if (tn5250_field_is_continued(field)) {
             contfield = field;
@@ -977,7 +1185,7 @@ void tn5250_display_interactive_addch(Tn5250Display* This, unsigned char ch) {
                 contfield = contfield->next;
             }
             ofs = tn5250_field_length(contfield) - 1;
-            data = tn5250_display_field_data(This, contfield);
+            data = tn5250_display_field_data_const(This, contfield);
         }
 
         if (tn5250_field_is_signed_num(field)) {
@@ -1158,6 +1366,153 @@ void tn5250_display_field_adjust(Tn5250Display* This, Tn5250Field* field) {
     return;
 }
 
+/*
+ *    Add a key to the type-ahead queue, growing it if need be.
+ */
+static void display_queue_key(Tn5250Display* This, int key) {
+    if (This->key_queue_tail == This->key_queue_alloc) {
+        if (This->key_queue_head != 0) {
+            /* Reuse the space taken by keys we've already handled. */
+            memmove(This->key_queue, This->key_queue + This->key_queue_head,
+                    (This->key_queue_tail - This->key_queue_head) *
+                        sizeof(int));
+            This->key_queue_tail -= This->key_queue_head;
+            This->key_queue_head = 0;
+        }
+        else {
+            This->key_queue_alloc *= 2;
+            This->key_queue = (int*)realloc(
+                This->key_queue, This->key_queue_alloc * sizeof(int));
+            TN5250_ASSERT(This->key_queue != NULL);
+        }
+    }
+    This->key_queue[This->key_queue_tail++] = key;
+    return;
+}
+
+/*
+ *    Handle one key from the terminal: do it now if the keyboard state
+ *    allows, otherwise keep it as type-ahead.
+ */
+static void display_handle_key(Tn5250Display* This, int key) {
+    int dokey = 0;
+
+    switch (This->keystate) {
+    case TN5250_KEYSTATE_UNLOCKED:
+        dokey = 1;
+        break;
+    case TN5250_KEYSTATE_HARDWARE:
+        if (key == K_RESET) {
+            TN5250_LOG(("doing key %d in hw error state.\n", key));
+        }
+        dokey = 1;
+        break;
+    case TN5250_KEYSTATE_LOCKED:
+        switch (key) {
+        case K_SYSREQ:
+        case K_ATTENTION:
+            TN5250_LOG(("doing key %d in locked state.\n", key));
+            dokey = 1;
+            break;
+        }
+        break;
+    case TN5250_KEYSTATE_PREHELP:
+        switch (key) {
+        case K_RESET:
+        case K_HELP:
+        case K_ATTENTION:
+            dokey = 1;
+            TN5250_LOG(("Doing key %d in prehelp state\n", key));
+            break;
+        }
+        break;
+        break;
+    case TN5250_KEYSTATE_POSTHELP:
+        switch (key) {
+        case K_RESET:
+        case K_ATTENTION:
+            TN5250_LOG(("Doing key %d in posthelp state.\n", key));
+            dokey = 1;
+            break;
+        }
+    }
+
+    if (!dokey) {
+        display_queue_key(This, key);
+    }
+    else {
+        /* if we're hitting a special keypress (such as error reset)
+           in a state where typeahead is not allowed, then clear
+           the key queue */
+        if (This->key_queue_head != This->key_queue_tail) {
+            This->key_queue_head = This->key_queue_tail = 0;
+        }
+        tn5250_display_do_key(This, key);
+    }
+    return;
+}
+
+/*
+ *    Handle a run of data keys collected by tn5250_display_do_keys.  As
+ *    long as the keyboard stays unlocked they are entered in bulk; any
+ *    left over once it locks are handled one at a time as usual.
+ */
+static void display_handle_run(Tn5250Display* This, const int* keys,
+                               int count) {
+    int i = 0;
+
+    while (i < count) {
+        if (This->keystate == TN5250_KEYSTATE_UNLOCKED) {
+            i += tn5250_display_do_text(This, keys + i, count - i);
+        }
+        else {
+            display_handle_key(This, keys[i++]);
+        }
+    }
+    return;
+}
+
+/*
+ *    Play the rest of the running macro.  Runs of data keys go through
+ *    display_handle_run like typed ones, so a long macro is entered in
+ *    a few bulk steps and drawn once at the end.  An EXEC key in the
+ *    macro stops it.  The keys are played from a copy, because the keys
+ *    played can record over the macro or reload the macro file.
+ */
+static void display_run_macro(Tn5250Display* This) {
+    const int* running;
+    int* keys;
+    int count, start, i = 0;
+
+    count = tn5250_macro_getkeys(This, &running);
+    TN5250_LOG(("Playing %d macro keys\n", count));
+    keys = tn5250_new(int, count > 0 ? count : 1);
+    TN5250_ASSERT(keys != NULL);
+    if (count > 0) {
+        memcpy(keys, running, count * sizeof(int));
+    }
+
+    while (i < count && tn5250_macro_estate(This) == 3) {
+        start = i;
+        while (i < count && keys[i] >= ' ' && keys[i] <= 255) {
+            i++;
+        }
+        if (i > start) {
+            display_handle_run(This, keys + start, i - start);
+        }
+        else {
+            display_handle_key(This, keys[i++]);
+        }
+    }
+
+    free(keys);
+    if (tn5250_macro_estate(This) == 3) {
+        tn5250_macro_endexec(This);
+    }
+    tn5250_display_indicator_clear(This, TN5250_DISPLAY_IND_MACRO);
+    return;
+}
+
 /****f* lib5250/tn5250_display_do_keys
  * NAME
  *    tn5250_display_do_keys
@@ -1167,98 +1522,149 @@ void tn5250_display_field_adjust(Tn5250Display* This, Tn5250Field* field) {
  *    Tn5250Display *      This       -
  * DESCRIPTION
  *    Handle keys from the terminal until we run out or are in the X SYSTEM
- *    state.
+ *    state.  Data keys typed while the keyboard is unlocked are collected
+ *    and handed to tn5250_display_do_text together, so that a paste goes
+ *    into the field in one go.  A macro started by one of the keys is
+ *    played in the same way before the next key is read.
  *****/
 void tn5250_display_do_keys(Tn5250Display* This) {
+    int run[TN5250_DISPLAY_KEYQ_SIZE];
+    int run_len = 0;
     int cur_key;
-    char Last;
-    int dokey;
 
     TN5250_LOG(("display_do_keys!\n"));
 
     do {
-        cur_key = tn5250_macro_getkey(This, &Last);
-
-        if (Last) {
-            tn5250_display_indicator_clear(This, TN5250_DISPLAY_IND_MACRO);
+        if (tn5250_macro_estate(This) == 3) {
+            display_handle_run(This, run, run_len);
+            run_len = 0;
+            display_run_macro(This);
         }
 
-        if (cur_key == 0) {
-            cur_key = tn5250_display_getkey(This);
-        }
+        cur_key = tn5250_display_getkey(This);
 
         if (cur_key != -1) {
             tn5250_macro_reckey(This, cur_key);
-            dokey = 0;
 
-            switch (This->keystate) {
-            case TN5250_KEYSTATE_UNLOCKED:
-                dokey = 1;
-                break;
-            case TN5250_KEYSTATE_HARDWARE:
-                if (cur_key == K_RESET) {
-                    TN5250_LOG(("doing key %d in hw error state.\n", cur_key));
-                }
-                dokey = 1;
-                break;
-            case TN5250_KEYSTATE_LOCKED:
-                switch (cur_key) {
-                case K_SYSREQ:
-                case K_ATTENTION:
-                    TN5250_LOG(("doing key %d in locked state.\n", cur_key));
-                    dokey = 1;
-                    break;
-                }
-                break;
-            case TN5250_KEYSTATE_PREHELP:
-                switch (cur_key) {
-                case K_RESET:
-                case K_HELP:
-                case K_ATTENTION:
-                    dokey = 1;
-                    TN5250_LOG(("Doing key %d in prehelp state\n", cur_key));
-                    break;
-                }
-                break;
-                break;
-            case TN5250_KEYSTATE_POSTHELP:
-                switch (cur_key) {
-                case K_RESET:
-                case K_ATTENTION:
-                    TN5250_LOG(("Doing key %d in posthelp state.\n", cur_key));
-                    dokey = 1;
-                    break;
-                }
-            }
-
-            if (!dokey) {
-                if ((This->key_queue_tail + 1 == This->key_queue_head) ||
-                    (This->key_queue_head == 0 &&
-                     This->key_queue_tail == TN5250_DISPLAY_KEYQ_SIZE - 1)) {
-                    TN5250_LOG(("Beep: Key queue full.\n"));
-                    tn5250_display_beep(This);
-                }
-                This->key_queue[This->key_queue_tail] = cur_key;
-                if (++This->key_queue_tail == TN5250_DISPLAY_KEYQ_SIZE) {
-                    This->key_queue_tail = 0;
-                }
-            }
-            else {
-                /* if we're hitting a special keypress (such as error reset)
-                   in a state where typeahead is not allowed, then clear
-                   the key queue */
-                if (This->key_queue_head != This->key_queue_tail) {
-                    This->key_queue_head = This->key_queue_tail = 0;
-                }
-                tn5250_display_do_key(This, cur_key);
+            if (This->keystate == TN5250_KEYSTATE_UNLOCKED &&
+                cur_key >= ' ' && cur_key <= 255 &&
+                run_len < TN5250_DISPLAY_KEYQ_SIZE) {
+                run[run_len++] = cur_key;
+                continue;
             }
+            display_handle_run(This, run, run_len);
+            run_len = 0;
+            display_handle_key(This, cur_key);
         }
     } while (cur_key != -1);
 
-    tn5250_display_update(This);
+    display_handle_run(This, run, run_len);
+    tn5250_display_schedule_update(This, 1);
     return;
 }
 
+/*
+ *    Enter as many of the keys as can go straight into the current field
+ *    without any of the special handling in
+ *    tn5250_display_interactive_addch: plain data characters that are
+ *    valid for the field, typed over (not inserted) in an ordinary field,
+ *    stopping short of the field's last position so that field exit,
+ *    auto-enter and FER are left to the single key path.  Returns the
+ *    number of keys entered, which may be 0.
+ */
+static int display_enter_run(Tn5250Display* This, const int* keys,
+                             int count) {
+    Tn5250Field* field;
+    unsigned char* data;
+    int pos, room, n, i, ch;
+    int sign_keys;
+
+    if (This->keystate != TN5250_KEYSTATE_UNLOCKED ||
+        (tn5250_display_indicators(This) &
+         (TN5250_DISPLAY_IND_INSERT | TN5250_DISPLAY_IND_FER)) != 0 ||
+        (This->terminal != NULL && This->terminal->putkey != NULL) ||
+        This->display_buffers->menubar_count > 0) {
+        return 0;
+    }
+    field = tn5250_display_current_field(This);
+    if (field == NULL || tn5250_field_is_bypass(field) ||
+        tn5250_field_is_wordwrap(field) || tn5250_field_is_continued(field)) {
+        return 0;
+    }
+
+    pos = tn5250_field_count_left(field, tn5250_display_cursor_y(This),
+                                  tn5250_display_cursor_x(This));
+    room = tn5250_field_length(field) - 1 - pos;
+    if (count > room) {
+        count = room;
+    }
+    sign_keys = This->sign_key_hack && (tn5250_field_is_num_only(field) ||
+                                        tn5250_field_is_signed_num(field));
+
+    for (n = 0; n < count; n++) {
+        ch = keys[n];
+        if (ch < ' ' || ch > 255 || (sign_keys && (ch == '+' || ch == '-'))) {
+            break;
+        }
+        if (tn5250_field_is_monocase(field) && isalpha(ch)) {
+            ch = toupper(ch);
+        }
+        if (!tn5250_field_valid_char(field, ch, &(This->keySRC))) {
+            break;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    data = tn5250_display_field_data(This, field) + pos;
+    for (i = 0; i < n; i++) {
+        ch = keys[i];
+        if (tn5250_field_is_monocase(field) && isalpha(ch)) {
+            ch = toupper(ch);
+        }
+        data[i] = tn5250_char_map_to_remote(This->map, ch);
+    }
+    tn5250_field_set_mdt(field);
+    tn5250_dbuffer_right(This->display_buffers, n);
+    return n;
+}
+
+/****f* lib5250/tn5250_display_do_text
+ * NAME
+ *    tn5250_display_do_text
+ * SYNOPSIS
+ *    n = tn5250_display_do_text (This, keys, count);
+ * INPUTS
+ *    Tn5250Display *      This       -
+ *    const int *          keys       - Keys to handle.
+ *    int                  count      - Number of keys.
+ * DESCRIPTION
+ *    Handle keys as tn5250_display_do_key would, one after another, until
+ *    they are used up or the keyboard is no longer unlocked.  Runs of data
+ *    characters are checked against the field type and written into the
+ *    field together, and the last position of a field is always typed
+ *    through tn5250_display_interactive_addch, so auto-enter and field
+ *    exit happen at the same character they would for single keys.
+ *    Returns the number of keys handled, which is at least one if count
+ *    is not zero.
+ *****/
+int tn5250_display_do_text(Tn5250Display* This, const int* keys, int count) {
+    int i = 0, n;
+
+    while (i < count) {
+        if ((n = display_enter_run(This, keys + i, count - i)) == 0) {
+            tn5250_display_do_key(This, keys[i]);
+            n = 1;
+        }
+        i += n;
+        if (This->keystate != TN5250_KEYSTATE_UNLOCKED) {
+            break;
+        }
+    }
+    return i;
+}
+
 /****f* lib5250/tn5250_display_do_key
  * NAME
  *    tn5250_display_do_key
@@ -1866,8 +2272,10 @@ void tn5250_display_indicator_clear(Tn5250Display* This, int inds) {
     if ((inds & TN5250_DISPLAY_IND_INHIBIT) != 0 &&
         This->saved_msg_line != NULL) {
         int l = tn5250_dbuffer_msg_line(This->display_buffers);
-        memcpy(This->display_buffers->data + l * tn5250_display_width(This),
-               This->saved_msg_line, tn5250_display_width(This));
+        unsigned char* data;
+        data = tn5250_dbuffer_writable_data(This->display_buffers, l, l);
+        memcpy(data + l * tn5250_display_width(This), This->saved_msg_line,
+               tn5250_display_width(This));
         free(This->saved_msg_line);
         This->saved_msg_line = NULL;
         free(This->msg_line);
@@ -2136,7 +2544,8 @@ void tn5250_display_kf_backtab(Tn5250Display* This) {
 void tn5250_display_kf_end(Tn5250Display* This) {
     Tn5250Field* field = tn5250_display_current_field(This);
     if (field != NULL && !tn5250_field_is_bypass(field)) {
-        unsigned char* data = tn5250_display_field_data(This, field);
+        const unsigned char* data =
+            tn5250_display_field_data_const(This, field);
         int i = tn5250_field_length(field) - 1;
         int y = tn5250_field_start_row(field);
         int x = tn5250_field_start_col(field);
@@ -2516,6 +2925,7 @@ void tn5250_display_save_msg_line(Tn5250Display* This) {
 void tn5250_display_set_msg_line(Tn5250Display* This,
                                  const unsigned char* msgline, int msglen) {
     int l;
+    unsigned char* data;
 
     if (This->msg_line != NULL) {
         free(This->msg_line);
@@ -2527,8 +2937,9 @@ void tn5250_display_set_msg_line(Tn5250Display* This,
     This->msg_len = msglen;
 
     l = tn5250_dbuffer_msg_line(This->display_buffers);
-    memcpy(This->display_buffers->data + tn5250_display_width(This) * l,
-           This->msg_line, This->msg_len);
+    data = tn5250_dbuffer_writable_data(This->display_buffers, l, l);
+    memcpy(data + tn5250_display_width(This) * l, This->msg_line,
+           This->msg_len);
     return;
 }
 
@@ -2544,7 +2955,7 @@ void tn5250_display_set_msg_line(Tn5250Display* This,
  *    Save the current message line.
  *****/
 void tn5250_display_set_char_map(Tn5250Display* This, const char* name) {
-    Tn5250CharMap* map = tn5250_char_map_new(name);
+    const Tn5250CharMap* map = tn5250_char_map_new(name);
     TN5250_ASSERT(map != NULL);
     if (This->map != NULL) {
         tn5250_char_map_destroy(This->map);
@@ -2574,36 +2985,32 @@ void tn5250_display_erase_region(Tn5250Display* This, unsigned int startrow,
                                  unsigned int startcol, unsigned int endrow,
                                  unsigned int endcol, unsigned int leftedge,
                                  unsigned int rightedge) {
-    int i, j;
+    int i, j, w = This->display_buffers->w;
+    unsigned char* data;
+    unsigned char blank = tn5250_char_map_to_remote(This->map, ' ');
 
+    data = tn5250_dbuffer_writable_data(This->display_buffers, startrow - 1,
+                                        endrow - 1);
     if (startrow == endrow) {
         for (j = startcol - 1; j < endcol; j++) {
-            This->display_buffers
-                ->data[((startrow - 1) * This->display_buffers->w) + j] =
-                tn5250_char_map_to_remote(This->map, ' ');
+            data[((startrow - 1) * w) + j] = blank;
         }
     }
     else {
         for (i = startrow - 1; i < endrow; i++) {
             if (i == (startrow - 1)) {
                 for (j = startcol - 1; j < rightedge; j++) {
-                    This->display_buffers
-                        ->data[(i * This->display_buffers->w) + j] =
-                        tn5250_char_map_to_remote(This->map, ' ');
+                    data[(i * w) + j] = blank;
                 }
             }
             else if (i == (endrow - 1)) {
                 for (j = leftedge - 1; j < endcol; j++) {
-                    This->display_buffers
-                        ->data[(i * This->display_buffers->w) + j] =
-                        tn5250_char_map_to_remote(This->map, ' ');
+                    data[(i * w) + j] = blank;
                 }
             }
             else {
                 for (j = leftedge - 1; j < rightedge; j++) {
-                    This->display_buffers
-                        ->data[(i * This->display_buffers->w) + j] =
-                        tn5250_char_map_to_remote(This->map, ' ');
+                    data[(i * w) + j] = blank;
                 }
             }
         }
@@ -2626,7 +3033,7 @@ void tn5250_display_wordwrap_delete(Tn5250Display* This) {
     Tn5250Field* iter;
     int buflen;
     unsigned char *text, *ptr;
-    unsigned char* data;
+    const unsigned char* data;
     unsigned char espace = TN5250_DISPLAY_WORD_WRAP_SPACE;
 
     /* Use code from x5250 (with permission).  The basic idea here is to
@@ -2667,13 +3074,13 @@ void tn5250_display_wordwrap_delete(Tn5250Display* This) {
      * ends of word wrap fields.
      */
     for (iter = field; tn5250_field_is_wordwrap(iter); iter = iter->next) {
-        data = tn5250_display_field_data(This, iter);
+        data = tn5250_display_field_data_const(This, iter);
         memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
         ptr = ptr + (tn5250_field_length(iter) * sizeof(unsigned char));
         memcpy(ptr, &espace, sizeof(unsigned char));
         ptr = ptr + sizeof(unsigned char);
     }
-    data = tn5250_display_field_data(This, iter);
+    data = tn5250_display_field_data_const(This, iter);
     memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
     tn5250_display_wordwrap(This, text, buflen, tn5250_field_length(field),
                             field);
@@ -2700,7 +3107,7 @@ void tn5250_display_wordwrap_insert(Tn5250Display* This, unsigned char c,
     unsigned char c2;
     int buflen;
     unsigned char *text, *ptr;
-    unsigned char* data;
+    const unsigned char* data;
     unsigned char espace = TN5250_DISPLAY_WORD_WRAP_SPACE;
 
     /* First allocate enough space to do the copying.  This will be sum of
@@ -2737,7 +3144,7 @@ void tn5250_display_wordwrap_insert(Tn5250Display* This, unsigned char c,
 
     if (!tn5250_field_is_continued_first(field)) {
         iter = field->prev;
-        data = tn5250_display_field_data(This, iter);
+        data = tn5250_display_field_data_const(This, iter);
         memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
         ptr = ptr + (tn5250_field_length(iter) * sizeof(unsigned char));
         memcpy(ptr, &espace, sizeof(unsigned char));
@@ -2789,13 +3196,13 @@ void tn5250_display_wordwrap_insert(Tn5250Display* This, unsigned char c,
      */
     for (iter = field->next; tn5250_field_is_wordwrap(iter);
          iter = iter->next) {
-        data = tn5250_display_field_data(This, iter);
+        data = tn5250_display_field_data_const(This, iter);
         memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
         ptr = ptr + (tn5250_field_length(iter) * sizeof(unsigned char));
         memcpy(ptr, &espace, sizeof(unsigned char));
         ptr = ptr + sizeof(unsigned char);
     }
-    data = tn5250_display_field_data(This, iter);
+    data = tn5250_display_field_data_const(This, iter);
     memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
 
     if (!tn5250_field_is_continued_first(field)) {
@@ -2840,16 +3247,18 @@ void tn5250_display_wordwrap_addch(Tn5250Display* This, unsigned char c) {
     Tn5250Field* field = tn5250_display_current_field(This);
     Tn5250Field* iter;
     int buflen;
-    unsigned char *text, *ptr;
-    unsigned char* data;
+    unsigned char *text, *ptr, *screen;
+    const unsigned char* data;
     unsigned char espace = TN5250_DISPLAY_WORD_WRAP_SPACE;
 
     /* Use our own version of tn5250_dbuffer_addch().  We can't use the real
      * version because we don't want to advance the cursor position.
      */
-    This->display_buffers
-        ->data[(This->display_buffers->cy * This->display_buffers->w) +
-               This->display_buffers->cx] = c;
+    screen = tn5250_dbuffer_writable_data(This->display_buffers,
+                                          This->display_buffers->cy,
+                                          This->display_buffers->cy);
+    screen[(This->display_buffers->cy * This->display_buffers->w) +
+           This->display_buffers->cx] = c;
 
     /* First allocate enough space to do the copying.  This will be sum of
      * the lengths of the word wrap fields in this group starting from the
@@ -2884,7 +3293,7 @@ void tn5250_display_wordwrap_addch(Tn5250Display* This, unsigned char c) {
     ptr = text;
 
     if (!tn5250_field_is_continued_first(field)) {
-        data = tn5250_display_field_data(This, field->prev);
+        data = tn5250_display_field_data_const(This, field->prev);
         memcpy(ptr, data,
                tn5250_field_length(field->prev) * sizeof(unsigned char));
         ptr = ptr + (tn5250_field_length(field->prev) * sizeof(unsigned char));
@@ -2897,13 +3306,13 @@ void tn5250_display_wordwrap_addch(Tn5250Display* This, unsigned char c) {
      * spaces are implied at the ends of word wrap fields.
      */
     for (iter = field; tn5250_field_is_wordwrap(iter); iter = iter->next) {
-        data = tn5250_display_field_data(This, iter);
+        data = tn5250_display_field_data_const(This, iter);
         memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
         ptr = ptr + (tn5250_field_length(iter) * sizeof(unsigned char));
         memcpy(ptr, &espace, sizeof(unsigned char));
         ptr = ptr + sizeof(unsigned char);
     }
-    data = tn5250_display_field_data(This, iter);
+    data = tn5250_display_field_data_const(This, iter);
     memcpy(ptr, data, tn5250_field_length(iter) * sizeof(unsigned char));
 
     if (!tn5250_field_is_continued_first(field)) {
@@ -3197,18 +3606,18 @@ int display_check_pccmd(Tn5250Display* This) {
     }
 
     /* The header bytes are followed by a 123 character fixed-length command
-       string. */
+       string, which runs on into the next row.  Take it from the text
+       shadow rather than translating it again. */
 
-    memcpy(cmdstr, This->display_buffers->data + 12, 123);
+    for (b = 0; b < 123; b++) {
+        int w = tn5250_display_width(This);
+        const unsigned char* row = tn5250_display_text_row(This, (12 + b) / w);
+        cmdstr[b] = (char)row[(12 + b) % w];
+    }
     cmdstr[123] = '\0';
 
     /* Strip any trailing blanks from the command string */
 
-    for (b = 0; b < 123; b++) {
-        cmdstr[b] =
-            tn5250_char_map_to_local(tn5250_display_char_map(This), cmdstr[b]);
-    }
-
     b = 122;
     while (b && cmdstr[b] == ' ') {
         cmdstr[b] = '\0';
@@ -3221,7 +3630,7 @@ int display_check_pccmd(Tn5250Display* This) {
        that it has been run */
 
     tn5250_run_cmd(cmdstr, wait);
-    This->display_buffers->data[1] = 0x00;
+    tn5250_dbuffer_writable_data(This->display_buffers, 0, 0)[1] = 0x00;
 
     /* Send back the ENTER key to tell the host that the command was run */
 
@@ -26,7 +26,9 @@
 extern "C" {
 #endif
 
-#define TN5250_DISPLAY_KEYQ_SIZE 50
+/* Initial size of the type-ahead queue, which grows as needed, and the
+ * most data keys tn5250_display_do_keys collects into one batch. */
+#define TN5250_DISPLAY_KEYQ_SIZE 64
 
 #define TN5250_DISPLAY_IND_INHIBIT         0x0001
 #define TN5250_DISPLAY_IND_MESSAGE_WAITING 0x0002
@@ -62,9 +64,12 @@ struct _Tn5250Display {
     struct _Tn5250DBuffer* display_buffers;
     struct _Tn5250Terminal* terminal;
     struct _Tn5250Session* session;
-    struct _Tn5250CharMap* map;
+    const struct _Tn5250CharMap* map;
     struct _Tn5250Config* config;
     struct _Tn5250Macro* macro;
+    struct _Tn5250Recorder* recorder; /* NULL unless recording */
+    struct _Tn5250Shadow* shadow;     /* NULL unless being watched */
+    struct _Tn5250Script* script;     /* NULL unless a script drives it */
     int indicators;
 
     unsigned char* saved_msg_line;
@@ -73,11 +78,21 @@ struct _Tn5250Display {
     int keystate;
     int keySRC;
 
-    /* Queued keystroke ring buffer. */
+    /* Queued keystrokes (type-ahead) are key_queue[key_queue_head] to
+     * key_queue[key_queue_tail - 1]. */
+    int* key_queue;
     int key_queue_head, key_queue_tail;
-    int key_queue[TN5250_DISPLAY_KEYQ_SIZE];
+    int key_queue_alloc;
+
+    /* Render scheduling. */
+    long frame_interval;      /* Minimum msec between frames, 0 for no limit */
+    unsigned long last_frame; /* When the last frame was drawn */
+    unsigned long frames;
+    unsigned long frames_skipped;
 
     unsigned int indicators_dirty : 1;
+    unsigned int update_pending : 1;
+    unsigned int update_urgent : 1;
     unsigned int pending_insert : 1;
     unsigned int destructive_backspace : 1;
     unsigned int sign_key_hack : 1;
@@ -104,6 +119,9 @@ extern void tn5250_display_restore_dbuffer(Tn5250Display* This,
 extern void tn5250_display_set_terminal(Tn5250Display* This,
                                         struct _Tn5250Terminal*);
 extern void tn5250_display_update(Tn5250Display* This);
+extern void tn5250_display_schedule_update(Tn5250Display* This, int echo);
+extern long tn5250_display_flush(Tn5250Display* This);
+extern void tn5250_display_set_max_frame_rate(Tn5250Display* This, int fps);
 
 extern int tn5250_display_waitevent(Tn5250Display* This);
 extern int tn5250_display_getkey(Tn5250Display* This);
@@ -148,6 +166,8 @@ extern void tn5250_display_set_char_map(Tn5250Display* This, const char* name);
 /* Key functions */
 extern void tn5250_display_do_keys(Tn5250Display* This);
 extern void tn5250_display_do_key(Tn5250Display* This, int);
+extern int tn5250_display_do_text(Tn5250Display* This, const int* keys,
+                                  int count);
 extern void tn5250_display_kf_backspace(Tn5250Display* This);
 extern void tn5250_display_kf_up(Tn5250Display* This);
 extern void tn5250_display_kf_down(Tn5250Display* This);
@@ -180,6 +200,8 @@ void tn5250_display_wordwrap(Tn5250Display* This, unsigned char* text,
 
 #define tn5250_display_dbuffer(This)    ((This)->display_buffers)
 #define tn5250_display_indicators(This) ((This)->indicators)
+#define tn5250_display_snapshot(This)                                          \
+    (tn5250_snapshot_new((This)->display_buffers))
 #define tn5250_display_inhibited(This)                                         \
     ((tn5250_display_indicators(This) & TN5250_DISPLAY_IND_INHIBIT) != 0)
 #define tn5250_display_inhibit(This)                                           \
@@ -211,9 +233,21 @@ void tn5250_display_wordwrap(Tn5250Display* This, unsigned char* text,
 #define tn5250_display_pending_insert(This) ((This)->pending_insert)
 #define tn5250_display_field_data(This, field)                                 \
     (tn5250_dbuffer_field_data((This)->display_buffers, (field)))
+#define tn5250_display_field_data_const(This, field)                           \
+    (tn5250_dbuffer_field_data_const((This)->display_buffers, (field)))
 #define tn5250_display_msg_line(This)                                          \
     (tn5250_dbuffer_msg_line((This)->display_buffers))
 #define tn5250_display_char_map(This) ((This)->map)
+#define tn5250_display_text_row(This, y)                                       \
+    (tn5250_dbuffer_text_row((This)->display_buffers, (This)->map, (y)))
+#define tn5250_display_utf8_row(This, y, len)                                  \
+    (tn5250_dbuffer_utf8_row((This)->display_buffers, (This)->map, (y), (len)))
+
+#define tn5250_display_frames(This)         ((This)->frames)
+#define tn5250_display_frames_skipped(This) ((This)->frames_skipped)
+#define tn5250_display_update_pending(This) ((This)->update_pending)
+#define tn5250_display_queued_keys(This)                                       \
+    ((This)->key_queue_tail - (This)->key_queue_head)
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,12 @@
 
 #include "tn5250-private.h"
 
+/* A field is meant to fit in one 64-byte cache line, so that walking the
+ * format table touches one line per field.  This fails to compile (the
+ * array size is negative) if Tn5250Field grows past that. */
+typedef char
+    tn5250_field_fits_cache_line[sizeof(Tn5250Field) <= 64 ? 1 : -1];
+
 /****f* lib5250/tn5250_field_new
  * NAME
  *    tn5250_field_new
@@ -118,39 +124,39 @@ void tn5250_field_dump(Tn5250Field* This) {
     if (This->resequence != 0) {
         TN5250_LOG(("Entry field resequencing: %d ", This->resequence));
     }
-    if (This->magstripe) {
+    if (tn5250_field_is_magstripe(This)) {
         TN5250_LOG(("Magnetic stripe reader entry field "));
     }
-    if (This->lightpen) {
+    if (tn5250_field_is_lightpen(This)) {
         TN5250_LOG(("Selector light pen or cursor select field "));
     }
-    if (This->magandlight) {
+    if (tn5250_field_is_magandlight(This)) {
         TN5250_LOG(
             ("Magnetic stripe reader and selector light pen entry field "));
     }
-    if (This->lightandattn) {
+    if (tn5250_field_is_lightandattn(This)) {
         TN5250_LOG(
             ("Selector light pen and selectable attention entry field "));
     }
-    if (This->ideographiconly) {
+    if (tn5250_field_is_ideographic_only(This)) {
         TN5250_LOG(("Ideographic-only entry field "));
     }
-    if (This->ideographicdatatype) {
+    if (tn5250_field_is_ideographic_data(This)) {
         TN5250_LOG(("Ideographic data type entry field "));
     }
-    if (This->ideographiceither) {
+    if (tn5250_field_is_ideographic_either(This)) {
         TN5250_LOG(("Ideographic-either entry field "));
     }
-    if (This->ideographicopen) {
+    if (tn5250_field_is_ideographic_open(This)) {
         TN5250_LOG(("Ideographic-open entry field "));
     }
     if (This->transparency != 0) {
         TN5250_LOG(("Transparency entry field: %d ", This->transparency));
     }
-    if (This->forwardedge) {
+    if (tn5250_field_is_forward_edge(This)) {
         TN5250_LOG(("Forward edge trigger entry field "));
     }
-    if (This->continuous) {
+    if (tn5250_field_is_continued(This)) {
         TN5250_LOG(("continuous "));
     }
     if (tn5250_field_is_continued_first(This)) {
@@ -162,7 +168,7 @@ void tn5250_field_dump(Tn5250Field* This) {
     if (tn5250_field_is_continued_last(This)) {
         TN5250_LOG(("(last) "));
     }
-    if (This->wordwrap) {
+    if (tn5250_field_is_wordwrap(This)) {
         TN5250_LOG(("wordwrap "));
     }
     if (This->nextfieldprogressionid != 0) {
@@ -175,10 +181,10 @@ void tn5250_field_dump(Tn5250Field* This) {
         TN5250_LOG(
             ("Pointer device selection entry field: %x ", This->pointeraid));
     }
-    if (This->selfcheckmod11) {
+    if (tn5250_field_is_self_check_mod11(This)) {
         TN5250_LOG(("Self-check modulus 11 entry field "));
     }
-    if (This->selfcheckmod10) {
+    if (tn5250_field_is_self_check_mod10(This)) {
         TN5250_LOG(("Self-check modulus 10 entry field "));
     }
 
@@ -461,13 +467,15 @@ void tn5250_field_set_mdt(Tn5250Field* This) {
     /* Taken from tn5250j
      * get the first field of a continued edit field if it is continued
      */
-    if ((This->continuous) && !tn5250_field_is_continued_first(This)) {
+    if (tn5250_field_is_continued(This) &&
+        !tn5250_field_is_continued_first(This)) {
         Tn5250Field* iter;
 
         for (iter = This->prev;
-             (iter->continuous && !tn5250_field_is_continued_first(iter));
+             (tn5250_field_is_continued(iter) &&
+              !tn5250_field_is_continued_first(iter));
              iter = iter->prev) {
-            TN5250_ASSERT(iter->continuous);
+            TN5250_ASSERT(tn5250_field_is_continued(iter));
         }
 
         tn5250_field_set_mdt(iter);
@@ -488,11 +496,13 @@ void tn5250_field_set_mdt(Tn5250Field* This) {
  * INPUTS
  *    Tn5250Field *        list       -
  * DESCRIPTION
- *    Destroy all fields in a field list.
+ *    Destroy all fields in a field list.  The list must not be a display
+ *    buffer's format table, which frees its own fields.
  *****/
 Tn5250Field* tn5250_field_list_destroy(Tn5250Field* list) {
     Tn5250Field *iter, *next;
 
+    TN5250_ASSERT(list == NULL || list->table == NULL);
     if ((iter = list) != NULL) {
         /*@-usereleased@ */
         do {
@@ -514,9 +524,13 @@ Tn5250Field* tn5250_field_list_destroy(Tn5250Field* list) {
  *    Tn5250Field *        list       -
  *    Tn5250Field *        node       -
  * DESCRIPTION
- *    Add a field to the end of a list of fields.
+ *    Add a field to the end of a list of fields.  Use
+ *    tn5250_dbuffer_add_field to add one to a display buffer's format
+ *    table.
  *****/
 Tn5250Field* tn5250_field_list_add(Tn5250Field* list, Tn5250Field* node) {
+    TN5250_ASSERT(list == NULL || list->table == NULL);
+    TN5250_ASSERT(node->table == NULL);
     node->prev = node->next = NULL;
 
     if (list == NULL) {
@@ -539,9 +553,11 @@ Tn5250Field* tn5250_field_list_add(Tn5250Field* list, Tn5250Field* node) {
  *    Tn5250Field *        list       -
  *    Tn5250Field *        node       -
  * DESCRIPTION
- *    Remove a field from a list of fields.
+ *    Remove a field from a list of fields.  Fields can't be removed from
+ *    a display buffer's format table, only cleared all at once.
  *****/
 Tn5250Field* tn5250_field_list_remove(Tn5250Field* list, Tn5250Field* node) {
+    TN5250_ASSERT(node->table == NULL);
     if (list == NULL) {
         return NULL;
     }
@@ -592,7 +608,8 @@ Tn5250Field* tn5250_field_list_find_by_id(Tn5250Field* list, int id) {
  * INPUTS
  *    Tn5250Field *        This       -
  * DESCRIPTION
- *    Copy all fields in a list to another list.
+ *    Copy all fields in a list to another list.  The copies don't belong
+ *    to any display buffer, even if the originals do.
  *****/
 Tn5250Field* tn5250_field_list_copy(Tn5250Field* This) {
     Tn5250Field *new_list = NULL, *iter, *new_field;
@@ -600,6 +617,7 @@ Tn5250Field* tn5250_field_list_copy(Tn5250Field* This) {
         do {
             new_field = tn5250_field_copy(iter);
             if (new_field != NULL) {
+                new_field->table = NULL;
                 new_list = tn5250_field_list_add(new_list, new_field);
             }
             iter = iter->next;
@@ -50,48 +50,29 @@ struct _Tn5250DBuffer;
 struct _Tn5250Field {
     struct _Tn5250Field /*@dependent@*/ /*@null@*/* next;
     struct _Tn5250Field /*@dependent@*/ /*@null@*/* prev;
+    struct _Tn5250DBuffer /*@dependent@*/* table;
+    void* script_slot;
     int id;
     int entry_id;
-    int resequence;
-    short magstripe;
-    short lightpen;
-    short magandlight;
-    short lightandattn;
-    short ideographiconly;
-    short ideographicdatatype;
-    short ideographiceither;
-    short ideographicopen;
-    int transparency;
-    short forwardedge;
-    short continuous;
-    short continued_first;
-    short continued_middle;
-    short continued_last;
-    short wordwrap;
-    int nextfieldprogressionid;
-    unsigned char highlightentryattr;
-    unsigned char pointeraid;
-    short selfcheckmod11;
-    short selfcheckmod10;
-    struct _Tn5250DBuffer /*@dependent@*/* table;
-
-    int w; /* Display width, needed for some calcs */
 
     Tn5250Uint16 FFW;
 
-    /* The problem with this single FCW is that there can be multiple FCWs
-     * per field, so just one doesn't cut it.  We could make a linked list
-     * of FCWs defined for each field, but that may be overkill.  For now,
-     * keep this one and add a flag above for each capability we support.
-     *
-     * Tn5250Uint16 FCW;
-     */
-    unsigned char attribute;
-    int start_row;
-    int start_col;
-    int length;
+    /* There can be multiple FCWs per field, so rather than keep the FCW
+     * itself we keep a bit for each capability we support (see the
+     * TN5250_FIELD_FCW_* flags below), plus the few FCWs that carry a
+     * value in their second byte. */
+    Tn5250Uint16 flags;
+    unsigned char resequence;
+    unsigned char transparency;
+    unsigned char nextfieldprogressionid;
+    unsigned char highlightentryattr;
+    unsigned char pointeraid;
 
-    void* script_slot;
+    unsigned char attribute;
+    Tn5250Uint16 start_row;
+    Tn5250Uint16 start_col;
+    Tn5250Uint16 length;
+    Tn5250Uint16 w; /* Display width, needed for some calcs */
 };
 
 typedef struct _Tn5250Field Tn5250Field;
@@ -127,6 +108,24 @@ typedef struct _Tn5250Field Tn5250Field;
 #define TN5250_FIELD_MANDATORY_FILL 0x0007
 #define TN5250_FIELD_MAND_FILL_MASK 0x0007
 
+/* Field Control Word capabilities (Tn5250Field.flags) */
+#define TN5250_FIELD_FCW_MAGSTRIPE           0x0001
+#define TN5250_FIELD_FCW_LIGHTPEN            0x0002
+#define TN5250_FIELD_FCW_MAGANDLIGHT         0x0004
+#define TN5250_FIELD_FCW_LIGHTANDATTN        0x0008
+#define TN5250_FIELD_FCW_IDEOGRAPHIC_ONLY    0x0010
+#define TN5250_FIELD_FCW_IDEOGRAPHIC_DATA    0x0020
+#define TN5250_FIELD_FCW_IDEOGRAPHIC_EITHER  0x0040
+#define TN5250_FIELD_FCW_IDEOGRAPHIC_OPEN    0x0080
+#define TN5250_FIELD_FCW_FORWARD_EDGE        0x0100
+#define TN5250_FIELD_FCW_CONTINUED           0x0200
+#define TN5250_FIELD_FCW_CONTINUED_FIRST     0x0400
+#define TN5250_FIELD_FCW_CONTINUED_MIDDLE    0x0800
+#define TN5250_FIELD_FCW_CONTINUED_LAST      0x1000
+#define TN5250_FIELD_FCW_WORDWRAP            0x2000
+#define TN5250_FIELD_FCW_SELF_CHECK_MOD11    0x4000
+#define TN5250_FIELD_FCW_SELF_CHECK_MOD10    0x8000
+
 /* Manipulate fields */
 extern Tn5250Field /*@only@*/ /*@null@*/* tn5250_field_new(int w);
 extern Tn5250Field /*@only@*/ /*@null@*/* tn5250_field_copy(Tn5250Field* This);
@@ -195,11 +194,42 @@ extern int tn5250_field_valid_char(Tn5250Field* This, int ch, int* src);
 #define tn5250_field_is_higlighted_entry(This)                                 \
     ((tn5250_field_control(This) & 0xFF00) ==                                  \
      TN5250_FIELD_CONTROL_HILIGHTED_ENTRY)
-#define tn5250_field_is_continued(This)        ((This)->continuous)
-#define tn5250_field_is_continued_first(This)  ((This)->continued_first)
-#define tn5250_field_is_continued_middle(This) ((This)->continued_middle)
-#define tn5250_field_is_continued_last(This)   ((This)->continued_last)
-#define tn5250_field_is_wordwrap(This)         ((This)->wordwrap)
+#define tn5250_field_has_flag(This, flag) (((This)->flags & (flag)) != 0)
+#define tn5250_field_set_flag(This, flag, on)                                  \
+    (void)((on) ? ((This)->flags |= (flag)) : ((This)->flags &= ~(flag)))
+
+#define tn5250_field_is_magstripe(This)                                        \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_MAGSTRIPE)
+#define tn5250_field_is_lightpen(This)                                         \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_LIGHTPEN)
+#define tn5250_field_is_magandlight(This)                                      \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_MAGANDLIGHT)
+#define tn5250_field_is_lightandattn(This)                                     \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_LIGHTANDATTN)
+#define tn5250_field_is_ideographic_only(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_IDEOGRAPHIC_ONLY)
+#define tn5250_field_is_ideographic_data(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_IDEOGRAPHIC_DATA)
+#define tn5250_field_is_ideographic_either(This)                               \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_IDEOGRAPHIC_EITHER)
+#define tn5250_field_is_ideographic_open(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_IDEOGRAPHIC_OPEN)
+#define tn5250_field_is_forward_edge(This)                                     \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_FORWARD_EDGE)
+#define tn5250_field_is_continued(This)                                        \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_CONTINUED)
+#define tn5250_field_is_continued_first(This)                                  \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_CONTINUED_FIRST)
+#define tn5250_field_is_continued_middle(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_CONTINUED_MIDDLE)
+#define tn5250_field_is_continued_last(This)                                   \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_CONTINUED_LAST)
+#define tn5250_field_is_wordwrap(This)                                         \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_WORDWRAP)
+#define tn5250_field_is_self_check_mod11(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_SELF_CHECK_MOD11)
+#define tn5250_field_is_self_check_mod10(This)                                 \
+    tn5250_field_has_flag(This, TN5250_FIELD_FCW_SELF_CHECK_MOD10)
 
 #define tn5250_field_attribute(This) ((This)->attribute)
 #define tn5250_field_start_row(This) ((This)->start_row)
@@ -0,0 +1,621 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#define _TN5250_TERMINAL_PRIVATE_DEFINED
+#include "tn5250-private.h"
+#include "headless.h"
+
+static void headless_terminal_init(Tn5250Terminal* This);
+static void headless_terminal_term(Tn5250Terminal* This);
+static void headless_terminal_destroy(Tn5250Terminal /*@only@*/* This);
+static int headless_terminal_width(Tn5250Terminal* This);
+static int headless_terminal_height(Tn5250Terminal* This);
+static int headless_terminal_flags(Tn5250Terminal* This);
+static void headless_terminal_update(Tn5250Terminal* This,
+                                     Tn5250Display* display);
+static void headless_terminal_update_indicators(Tn5250Terminal* This,
+                                                Tn5250Display* display);
+static int headless_terminal_waitevent(Tn5250Terminal* This);
+static int headless_terminal_getkey(Tn5250Terminal* This);
+static void headless_terminal_beep(Tn5250Terminal* This);
+static void headless_terminal_wakeup(Tn5250Terminal* This);
+
+struct _Tn5250TerminalPrivate {
+    Tn5250Display* display;
+
+    /* Keys waiting to be picked up by getkey, in keys[key_head] to
+     * keys[key_tail - 1]. */
+    int* keys;
+    int key_head, key_tail;
+    int keys_alloc;
+
+    /* Bumped by update.  This is all the work we do when the screen
+     * changes. */
+    unsigned long generation;
+
+    /* How long waitevent blocks for, in milliseconds (-1 for ever). */
+    long timeout;
+
+    /* A pipe which is readable while there are keys waiting, so that an
+     * event loop watching the connection can watch this too. */
+    int wakeup[2];
+    unsigned int wakeup_pending : 1;
+    unsigned int quit_flag : 1;
+};
+
+/****f* lib5250/tn5250_headless_terminal_new
+ * NAME
+ *    tn5250_headless_terminal_new
+ * SYNOPSIS
+ *    term = tn5250_headless_terminal_new ();
+ *    tn5250_display_set_terminal (display, term);
+ * INPUTS
+ *    None
+ * DESCRIPTION
+ *    Create a terminal with no user interface, for programs which drive a
+ *    session themselves.  Updating it costs nothing: it only counts how
+ *    many times the screen has changed.  Keys come from
+ *    tn5250_headless_terminal_push_key and friends rather than from a
+ *    keyboard, and the screen is read back with
+ *    tn5250_headless_terminal_text and tn5250_headless_terminal_field.
+ *****/
+Tn5250Terminal* tn5250_headless_terminal_new(void) {
+    Tn5250Terminal* r = tn5250_new(Tn5250Terminal, 1);
+    if (r == NULL) return NULL;
+
+    r->data = tn5250_new(struct _Tn5250TerminalPrivate, 1);
+    if (r->data == NULL) {
+        free(r);
+        return NULL;
+    }
+
+    r->data->display = NULL;
+    r->data->keys = NULL;
+    r->data->key_head = r->data->key_tail = 0;
+    r->data->keys_alloc = 0;
+    r->data->generation = 0;
+    r->data->timeout = -1;
+    r->data->wakeup[0] = r->data->wakeup[1] = -1;
+    r->data->wakeup_pending = 0;
+    r->data->quit_flag = 0;
+
+#ifndef WIN32
+    if (pipe(r->data->wakeup) == 0) {
+        fcntl(r->data->wakeup[0], F_SETFL, O_NONBLOCK);
+        fcntl(r->data->wakeup[1], F_SETFL, O_NONBLOCK);
+    }
+    else {
+        r->data->wakeup[0] = r->data->wakeup[1] = -1;
+    }
+#endif
+
+    r->conn_fd = -1;
+    r->wait_limit = -1;
+    r->init = headless_terminal_init;
+    r->term = headless_terminal_term;
+    r->destroy = headless_terminal_destroy;
+    r->width = headless_terminal_width;
+    r->height = headless_terminal_height;
+    r->flags = headless_terminal_flags;
+    r->update = headless_terminal_update;
+    r->update_indicators = headless_terminal_update_indicators;
+    r->waitevent = headless_terminal_waitevent;
+    r->getkey = headless_terminal_getkey;
+    r->putkey = NULL;
+    r->beep = headless_terminal_beep;
+    r->enhanced = NULL;
+    r->config = NULL;
+    return r;
+}
+
+/****f* lib5250/tn5250_headless_terminal_set_timeout
+ * NAME
+ *    tn5250_headless_terminal_set_timeout
+ * SYNOPSIS
+ *    tn5250_headless_terminal_set_timeout (This, 0);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    long                 timeout    - Milliseconds, or -1 for no limit.
+ * DESCRIPTION
+ *    Set how long waitevent waits for keys or host data before giving up
+ *    and returning TN5250_TERMINAL_EVENT_TIMEOUT.  The default is to wait
+ *    for ever, as the other terminals do.  A program with its own event
+ *    loop sets this to 0, watches the connection's socket and
+ *    tn5250_headless_terminal_wakeup_fd, and calls tn5250_session_poll
+ *    when either is readable.
+ *****/
+void tn5250_headless_terminal_set_timeout(Tn5250Terminal* This,
+                                          long timeout) {
+    This->data->timeout = timeout;
+}
+
+/****f* lib5250/tn5250_headless_terminal_wakeup_fd
+ * NAME
+ *    tn5250_headless_terminal_wakeup_fd
+ * SYNOPSIS
+ *    fd = tn5250_headless_terminal_wakeup_fd (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Returns a file descriptor which is readable while there are keys for
+ *    the session to process, or -1 if there isn't one (on Windows, or if
+ *    the pipe could not be created).  Don't read from it; waitevent does.
+ *****/
+int tn5250_headless_terminal_wakeup_fd(Tn5250Terminal* This) {
+    return This->data->wakeup[0];
+}
+
+/****f* lib5250/tn5250_headless_terminal_quit
+ * NAME
+ *    tn5250_headless_terminal_quit
+ * SYNOPSIS
+ *    tn5250_headless_terminal_quit (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Make the next waitevent return TN5250_TERMINAL_EVENT_QUIT, which
+ *    ends tn5250_session_main_loop.
+ *****/
+void tn5250_headless_terminal_quit(Tn5250Terminal* This) {
+    This->data->quit_flag = 1;
+    headless_terminal_wakeup(This);
+}
+
+/****f* lib5250/tn5250_headless_terminal_push_key
+ * NAME
+ *    tn5250_headless_terminal_push_key
+ * SYNOPSIS
+ *    tn5250_headless_terminal_push_key (This, K_ENTER);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    int                  key        - A K_* code or a local character.
+ * DESCRIPTION
+ *    Queue a key for the session, as if it had been typed.  Keys are
+ *    handled the next time the session waits for an event, subject to
+ *    the usual keyboard locking and type-ahead rules.
+ *****/
+void tn5250_headless_terminal_push_key(Tn5250Terminal* This, int key) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+
+    if (p->key_tail == p->keys_alloc) {
+        if (p->key_head != 0) {
+            /* Reuse the space taken by keys we've already handed out. */
+            memmove(p->keys, p->keys + p->key_head,
+                    (p->key_tail - p->key_head) * sizeof(int));
+            p->key_tail -= p->key_head;
+            p->key_head = 0;
+        }
+        else {
+            p->keys_alloc = p->keys_alloc == 0 ? 64 : p->keys_alloc * 2;
+            p->keys = (int*)realloc(p->keys, p->keys_alloc * sizeof(int));
+            TN5250_ASSERT(p->keys != NULL);
+        }
+    }
+    p->keys[p->key_tail++] = key;
+    headless_terminal_wakeup(This);
+}
+
+/****f* lib5250/tn5250_headless_terminal_type_string
+ * NAME
+ *    tn5250_headless_terminal_type_string
+ * SYNOPSIS
+ *    tn5250_headless_terminal_type_string (This, "QSECOFR\tSECRET\n");
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    const char *         text       - Characters in the local charset.
+ * DESCRIPTION
+ *    Queue a string of keys.  Tab, backspace and newline (or carriage
+ *    return) become the Tab, Backspace and Enter keys; everything else is
+ *    typed as it is.
+ *****/
+void tn5250_headless_terminal_type_string(Tn5250Terminal* This,
+                                          const char* text) {
+    for (; *text != '\0'; text++) {
+        switch (*text) {
+        case '\t':
+            tn5250_headless_terminal_push_key(This, K_TAB);
+            break;
+        case '\b':
+            tn5250_headless_terminal_push_key(This, K_BACKSPACE);
+            break;
+        case '\r':
+        case '\n':
+            tn5250_headless_terminal_push_key(This, K_ENTER);
+            break;
+        default:
+            tn5250_headless_terminal_push_key(This, (unsigned char)*text);
+            break;
+        }
+    }
+}
+
+/****f* lib5250/tn5250_headless_terminal_pending_keys
+ * NAME
+ *    tn5250_headless_terminal_pending_keys
+ * SYNOPSIS
+ *    n = tn5250_headless_terminal_pending_keys (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Returns the number of keys which have been pushed but not yet
+ *    handed to the display, plus any the display is holding as
+ *    type-ahead while the keyboard is locked.
+ *****/
+int tn5250_headless_terminal_pending_keys(Tn5250Terminal* This) {
+    Tn5250Display* display = This->data->display;
+    int n = This->data->key_tail - This->data->key_head;
+
+    if (display != NULL) {
+        n += tn5250_display_queued_keys(display);
+    }
+    return n;
+}
+
+/****f* lib5250/tn5250_headless_terminal_generation
+ * NAME
+ *    tn5250_headless_terminal_generation
+ * SYNOPSIS
+ *    gen = tn5250_headless_terminal_generation (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Returns a counter which goes up every time the display is updated.
+ *    If it hasn't moved, nothing on the screen can have changed.
+ *****/
+unsigned long tn5250_headless_terminal_generation(Tn5250Terminal* This) {
+    return This->data->generation;
+}
+
+/****f* lib5250/tn5250_headless_terminal_keyboard_locked
+ * NAME
+ *    tn5250_headless_terminal_keyboard_locked
+ * SYNOPSIS
+ *    if (!tn5250_headless_terminal_keyboard_locked (This))
+ *       tn5250_headless_terminal_type_string (This, "WRKACTJOB\n");
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Returns non-zero unless the keyboard is unlocked and input is not
+ *    inhibited, that is, unless keys typed now would be acted on straight
+ *    away.
+ *****/
+int tn5250_headless_terminal_keyboard_locked(Tn5250Terminal* This) {
+    Tn5250Display* display = This->data->display;
+
+    if (display == NULL) {
+        return 1;
+    }
+    return display->keystate != TN5250_KEYSTATE_UNLOCKED ||
+           tn5250_display_inhibited(display);
+}
+
+/****f* lib5250/tn5250_headless_terminal_text
+ * NAME
+ *    tn5250_headless_terminal_text
+ * SYNOPSIS
+ *    row = tn5250_headless_terminal_text (This, y, &len);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    int                  y          - Row to fetch.
+ *    int *                len        - Set to the length in bytes.
+ * DESCRIPTION
+ *    Returns a row of the screen as UTF-8, with attribute bytes shown as
+ *    blanks, or NULL if the terminal hasn't been given a display yet.
+ *    The row is not NUL-terminated and is only good until the screen
+ *    next changes.
+ *****/
+const char* tn5250_headless_terminal_text(Tn5250Terminal* This, int y,
+                                          int* len) {
+    Tn5250Display* display = This->data->display;
+
+    if (display == NULL) {
+        return NULL;
+    }
+    return tn5250_dbuffer_utf8_row(tn5250_display_dbuffer(display),
+                                   tn5250_display_char_map(display), y, len);
+}
+
+/****f* lib5250/tn5250_headless_terminal_field_count
+ * NAME
+ *    tn5250_headless_terminal_field_count
+ * SYNOPSIS
+ *    n = tn5250_headless_terminal_field_count (This);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ * DESCRIPTION
+ *    Returns the number of fields on the current screen.
+ *****/
+int tn5250_headless_terminal_field_count(Tn5250Terminal* This) {
+    if (This->data->display == NULL) {
+        return 0;
+    }
+    return tn5250_dbuffer_field_count(
+        tn5250_display_dbuffer(This->data->display));
+}
+
+/****f* lib5250/tn5250_headless_terminal_field
+ * NAME
+ *    tn5250_headless_terminal_field
+ * SYNOPSIS
+ *    field = tn5250_headless_terminal_field (This, n);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    int                  n          - 0 for the first field.
+ * DESCRIPTION
+ *    Returns the n'th field on the current screen, in the order the host
+ *    defined them, or NULL if there aren't that many.
+ *****/
+Tn5250Field* tn5250_headless_terminal_field(Tn5250Terminal* This, int n) {
+    if (n < 0 || n >= tn5250_headless_terminal_field_count(This)) {
+        return NULL;
+    }
+    return tn5250_dbuffer_field_by_id(
+        tn5250_display_dbuffer(This->data->display), n);
+}
+
+/****f* lib5250/tn5250_headless_terminal_field_text
+ * NAME
+ *    tn5250_headless_terminal_field_text
+ * SYNOPSIS
+ *    len = tn5250_headless_terminal_field_text (This, field, buf, size);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    Tn5250Field *        field      -
+ *    char *               buf        - Where to put the text.
+ *    int                  size       - Size of buf.
+ * DESCRIPTION
+ *    Copy the contents of a field into buf in the local character set,
+ *    NUL-terminated and truncated to fit if need be.  Returns the number
+ *    of characters copied, not counting the NUL.
+ *****/
+int tn5250_headless_terminal_field_text(Tn5250Terminal* This,
+                                        Tn5250Field* field, char* buf,
+                                        int size) {
+    Tn5250Display* display = This->data->display;
+    Tn5250DBuffer* dbuffer;
+    const unsigned char* row;
+    int y, x, n, len = 0;
+
+    if (size <= 0) {
+        return 0;
+    }
+    if (display != NULL) {
+        dbuffer = tn5250_display_dbuffer(display);
+        y = tn5250_field_start_row(field);
+        x = tn5250_field_start_col(field);
+        n = tn5250_field_length(field);
+        if (n > size - 1) {
+            n = size - 1;
+        }
+
+        /* Fields can wrap onto the following rows. */
+        while (len < n && y < tn5250_dbuffer_height(dbuffer)) {
+            row = tn5250_dbuffer_text_row(dbuffer,
+                                          tn5250_display_char_map(display), y);
+            while (len < n && x < tn5250_dbuffer_width(dbuffer)) {
+                buf[len++] = (char)row[x++];
+            }
+            y++;
+            x = 0;
+        }
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+/****f* lib5250/tn5250_headless_terminal_wait
+ * NAME
+ *    tn5250_headless_terminal_wait
+ * SYNOPSIS
+ *    tn5250_headless_terminal_type_string (This, "1\n");
+ *    r = tn5250_headless_terminal_wait (This, session,
+ *                                       TN5250_HEADLESS_WAIT_UNLOCKED, 5000);
+ * INPUTS
+ *    Tn5250Terminal *     This       -
+ *    Tn5250Session *      session    - The session using this terminal.
+ *    int                  events     - TN5250_HEADLESS_WAIT_* flags.
+ *    long                 timeout    - Milliseconds, or -1 for no limit.
+ * DESCRIPTION
+ *    Run the session until one of the events happens: the screen changes
+ *    from what it was when we were called, or the keyboard is unlocked
+ *    once all the keys that have been pushed have been handled.  Returns
+ *    the events which happened, 0 if the timeout ran out first, or -1 if
+ *    the session ended.
+ *****/
+int tn5250_headless_terminal_wait(Tn5250Terminal* This,
+                                  struct _Tn5250Session* session, int events,
+                                  long timeout) {
+    unsigned long generation = This->data->generation;
+    long saved_timeout = This->data->timeout;
+    unsigned long deadline = 0;
+    long left;
+    int result = 0;
+
+    if (timeout >= 0) {
+        deadline = tn5250_msec_now() + timeout;
+    }
+
+    while (1) {
+        if (tn5250_headless_terminal_pending_keys(This) == 0) {
+            if ((events & TN5250_HEADLESS_WAIT_SCREEN) != 0 &&
+                This->data->generation != generation) {
+                result |= TN5250_HEADLESS_WAIT_SCREEN;
+            }
+            if ((events & TN5250_HEADLESS_WAIT_UNLOCKED) != 0 &&
+                !tn5250_headless_terminal_keyboard_locked(This)) {
+                result |= TN5250_HEADLESS_WAIT_UNLOCKED;
+            }
+            if (result != 0) {
+                break;
+            }
+        }
+
+        left = -1;
+        if (timeout >= 0) {
+            left = tn5250_msec_until(deadline);
+            if (left < 0) {
+                break;
+            }
+        }
+        This->data->timeout = left;
+        if (tn5250_session_poll(session) < 0) {
+            result = -1;
+            break;
+        }
+    }
+
+    This->data->timeout = saved_timeout;
+    return result;
+}
+
+/*
+ *    Make the wakeup pipe readable, if it isn't already.
+ */
+static void headless_terminal_wakeup(Tn5250Terminal* This) {
+    char c = 0;
+
+    if (This->data->wakeup[1] >= 0 && !This->data->wakeup_pending) {
+        if (write(This->data->wakeup[1], &c, 1) == 1) {
+            This->data->wakeup_pending = 1;
+        }
+    }
+}
+
+static void headless_terminal_init(Tn5250Terminal* This) {}
+
+static void headless_terminal_term(Tn5250Terminal* This) {}
+
+static void headless_terminal_destroy(Tn5250Terminal* This) {
+    if (This->data->wakeup[0] >= 0) {
+        close(This->data->wakeup[0]);
+        close(This->data->wakeup[1]);
+    }
+    if (This->data->keys != NULL) {
+        free(This->data->keys);
+    }
+    free(This->data);
+    free(This);
+}
+
+/*
+ *    We can show any size of screen the host sends.
+ */
+static int headless_terminal_width(Tn5250Terminal* This) { return 132; }
+
+static int headless_terminal_height(Tn5250Terminal* This) { return 28; }
+
+static int headless_terminal_flags(Tn5250Terminal* This) {
+    return TN5250_TERMINAL_WAIT_LIMIT;
+}
+
+static void headless_terminal_update(Tn5250Terminal* This,
+                                     Tn5250Display* display) {
+    This->data->display = display;
+    This->data->generation++;
+}
+
+static void headless_terminal_update_indicators(Tn5250Terminal* This,
+                                                Tn5250Display* display) {
+    This->data->display = display;
+}
+
+/*
+ *    Report keys if we have any, otherwise wait up to the timeout (or the
+ *    display's wait limit, if that is sooner) for the host to send
+ *    something or for keys to be pushed from elsewhere.
+ */
+static int headless_terminal_waitevent(Tn5250Terminal* This) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+    fd_set fdr;
+    struct timeval tv;
+    int result = 0;
+    int sm = 0;
+    long timeout = p->timeout;
+    char buf[16];
+
+    if (This->wait_limit >= 0 && (timeout < 0 || This->wait_limit < timeout)) {
+        timeout = This->wait_limit;
+    }
+
+    if (p->quit_flag) return TN5250_TERMINAL_EVENT_QUIT;
+
+    FD_ZERO(&fdr);
+    if (p->wakeup[0] >= 0) {
+        FD_SET(p->wakeup[0], &fdr);
+        sm = p->wakeup[0] + 1;
+    }
+    if (This->conn_fd >= 0) {
+        FD_SET(This->conn_fd, &fdr);
+        if (This->conn_fd + 1 > sm) {
+            sm = This->conn_fd + 1;
+        }
+    }
+
+    if (p->key_head != p->key_tail) {
+        tv.tv_sec = tv.tv_usec = 0;
+        result |= TN5250_TERMINAL_EVENT_KEY;
+    }
+    else if (timeout >= 0) {
+        tv.tv_sec = timeout / 1000;
+        tv.tv_usec = (timeout % 1000) * 1000;
+    }
+    else if (sm == 0) {
+        /* Nothing could ever wake us up. */
+        return TN5250_TERMINAL_EVENT_QUIT;
+    }
+
+    if (select(sm, &fdr, NULL, NULL,
+               result == 0 && timeout < 0 ? NULL : &tv) > 0) {
+        if (p->wakeup[0] >= 0 && FD_ISSET(p->wakeup[0], &fdr)) {
+            while (read(p->wakeup[0], buf, sizeof(buf)) > 0) {
+                ;
+            }
+            p->wakeup_pending = 0;
+        }
+        if (This->conn_fd >= 0 && FD_ISSET(This->conn_fd, &fdr)) {
+            result |= TN5250_TERMINAL_EVENT_DATA;
+        }
+    }
+    if (p->key_head != p->key_tail) {
+        result |= TN5250_TERMINAL_EVENT_KEY;
+    }
+    if (p->quit_flag) {
+        result |= TN5250_TERMINAL_EVENT_QUIT;
+    }
+    if (result == 0) {
+        result = TN5250_TERMINAL_EVENT_TIMEOUT;
+    }
+    return result;
+}
+
+static int headless_terminal_getkey(Tn5250Terminal* This) {
+    struct _Tn5250TerminalPrivate* p = This->data;
+
+    if (p->key_head == p->key_tail) {
+        p->key_head = p->key_tail = 0;
+        return -1;
+    }
+    return p->keys[p->key_head++];
+}
+
+static void headless_terminal_beep(Tn5250Terminal* This) {
+    TN5250_LOG(("HEADLESS: beep\n"));
+}
@@ -0,0 +1,66 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct _Tn5250Session;
+struct _Tn5250Field;
+
+/* Events for tn5250_headless_terminal_wait */
+#define TN5250_HEADLESS_WAIT_SCREEN   0x0001 /* Screen has changed */
+#define TN5250_HEADLESS_WAIT_UNLOCKED 0x0002 /* Keyboard is unlocked */
+
+extern Tn5250Terminal* tn5250_headless_terminal_new(void);
+extern void tn5250_headless_terminal_set_timeout(Tn5250Terminal* This,
+                                                 long timeout);
+extern int tn5250_headless_terminal_wakeup_fd(Tn5250Terminal* This);
+extern void tn5250_headless_terminal_quit(Tn5250Terminal* This);
+
+extern void tn5250_headless_terminal_push_key(Tn5250Terminal* This, int key);
+extern void tn5250_headless_terminal_type_string(Tn5250Terminal* This,
+                                                 const char* text);
+extern int tn5250_headless_terminal_pending_keys(Tn5250Terminal* This);
+
+extern unsigned long tn5250_headless_terminal_generation(Tn5250Terminal* This);
+extern int tn5250_headless_terminal_keyboard_locked(Tn5250Terminal* This);
+extern const char* tn5250_headless_terminal_text(Tn5250Terminal* This, int y,
+                                                 int* len);
+extern int tn5250_headless_terminal_field_count(Tn5250Terminal* This);
+extern struct _Tn5250Field*
+tn5250_headless_terminal_field(Tn5250Terminal* This, int n);
+extern int tn5250_headless_terminal_field_text(Tn5250Terminal* This,
+                                               struct _Tn5250Field* field,
+                                               char* buf, int size);
+
+extern int tn5250_headless_terminal_wait(Tn5250Terminal* This,
+                                         struct _Tn5250Session* session,
+                                         int events, long timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADLESS_H */
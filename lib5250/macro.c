@@ -24,7 +24,10 @@
 
 #include "tn5250-private.h"
 
-#define MAX_LINESZ  103 /* Maximum macro line size */
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#define MAX_LINESZ  103 /* Line size macros are written with */
 #define CR          0x0D
 #define LF          0x0A
 #define MAX_SPECKEY 12 /* Maximum special key name size */
@@ -105,76 +108,100 @@ static const MacroKey MKey[] = {
 
 char PState[12]; /* Printable state */
 
-int macro_isnewmacro(char* Buff, unsigned char** name);
-void macro_write(int Num, unsigned char* name, int* Buff, FILE* MF);
+static int macro_isnewmacro(const char* Buff, char** name);
+static char* macro_readline(FILE* MF, char** Buff, size_t* Alloc);
+static int macro_specialkey(const char* Buff, int* Pt);
+static int macro_addkey(Tn5250MacroData* Mac, int key);
+static void macro_addline(Tn5250MacroData* Mac, const char* Buff);
+static Tn5250MacroData* macro_new(Tn5250Macro* Macro, int Num,
+                                  const char* name);
+static void macro_remove(Tn5250Macro* Macro, Tn5250MacroData* Mac);
+static void macro_clearmem(Tn5250Macro* Macro);
+static int macro_filestamp(Tn5250Macro* Macro, Tn5250MacroStamp* stamp);
+static int macro_samestamp(Tn5250MacroStamp* a, Tn5250MacroStamp* b);
+static char macro_loadfile(Tn5250Macro* Macro);
+static void macro_write(Tn5250MacroData* Mac, FILE* MF);
+static char macro_savefile(Tn5250Macro* Macro);
 
 /*
- * Clean trailing CRs. Returns line size
+ * Return the macro number of a "[Mnn]name" line, or -1 for a "[M]name"
+ * line, which starts a macro known only by its name.  Returns 0 if this
+ * line doesn't start a macro.
  */
-int macro_buffer_clean(char* Buff) {
-    int i;
-
-    i = strlen(Buff) - 1;
-    while ((i >= 0) && ((Buff[i] == CR) || (Buff[i] == LF))) {
-        Buff[i--] = 0;
-    }
-
-    return (i + 1);
-}
-
-/*
- * Return macro number
- */
-int macro_isnewmacro(char* Buff, unsigned char** name) {
+static int macro_isnewmacro(const char* Buff, char** name) {
     int i, Num;
-    int length;
-    char* ptr;
 
+    *name = NULL;
+    if ((Buff[0] != '[') || (Buff[1] != 'M')) {
+        return (0);
+    }
     Num = 0;
-    if ((Buff[0] == '[') && (Buff[1] == 'M')) {
-        i = 2;
-        while (isdigit(Buff[i])) {
-            Num = (Num * 10) + Buff[i] - '0';
-            i++;
-        }
-        if (Buff[i] != ']') {
-            Num = 0;
+    i = 2;
+    while (isdigit((unsigned char)Buff[i])) {
+        Num = (Num * 10) + Buff[i] - '0';
+        i++;
+    }
+    if (Buff[i] != ']') {
+        return (0);
+    }
+    if (i == 2) {
+        if (Buff[3] == 0) {
+            return (0); /* A named macro needs a name */
         }
+        Num = -1;
+    }
+    else if (Num == 0) {
+        return (0);
     }
 
     /* Get the macro name if it exists */
-    if ((Num != 0) && (strlen(Buff) > (i + 1))) {
-        ptr = Buff;
-        ptr += i;
-        ptr++;
-        length = strlen(Buff) - (i + 1);
-        *name = (unsigned char*)calloc(length + 1, sizeof(unsigned char));
-        strncpy((char*)*name, ptr, length);
+    if (Buff[i + 1] != 0) {
+        *name = (char*)malloc(strlen(Buff + i + 1) + 1);
+        if (*name != NULL) {
+            strcpy(*name, Buff + i + 1);
+        }
     }
     return (Num);
 }
 
 /*
- * Determines the macro size
+ * Read a line of any length, without its line end.  Returns NULL at the
+ * end of the file.
  */
-int macro_macrosize(int* Mac) {
-    int i;
-
-    i = 0;
-    if (Mac != NULL) {
-        while (*Mac != 0) {
-            i++;
-            Mac++;
+static char* macro_readline(FILE* MF, char** Buff, size_t* Alloc) {
+    size_t len = 0;
+    char* p;
+
+    for (;;) {
+        if (*Alloc - len < 128) {
+            if ((p = (char*)realloc(*Buff, *Alloc * 2 + 128)) == NULL) {
+                return (NULL);
+            }
+            *Buff = p;
+            *Alloc = *Alloc * 2 + 128;
+        }
+        if (fgets(*Buff + len, (int)(*Alloc - len), MF) == NULL) {
+            if (len == 0) {
+                return (NULL);
+            }
+            break;
+        }
+        len += strlen(*Buff + len);
+        if (len > 0 && (*Buff)[len - 1] == LF) {
+            break;
         }
     }
-
-    return (i);
+    while ((len > 0) &&
+           (((*Buff)[len - 1] == CR) || ((*Buff)[len - 1] == LF))) {
+        (*Buff)[--len] = 0;
+    }
+    return (*Buff);
 }
 
 /*
  * Reads a special key from macro text
  */
-int macro_specialkey(char* Buff, int* Pt) {
+static int macro_specialkey(const char* Buff, int* Pt) {
     int i, j;
 
     if (Buff[*Pt] == '[') {
@@ -187,7 +214,8 @@ int macro_specialkey(char* Buff, int* Pt) {
         if (Buff[*Pt + i] == ']') {
             j = 0;
             while ((MKey[j].km_code != 0) &&
-                   (strncmp(MKey[j].km_str, &Buff[*Pt + 1], i - 1) != 0)) {
+                   ((strlen(MKey[j].km_str) != (size_t)(i - 1)) ||
+                    (strncmp(MKey[j].km_str, &Buff[*Pt + 1], i - 1) != 0))) {
                 j++;
             }
             if (MKey[j].km_code != 0) {
@@ -200,103 +228,190 @@ int macro_specialkey(char* Buff, int* Pt) {
 }
 
 /*
- * Add the line contents to macro
- * TODO : add an escape character
- * TODO : resize macro buffer when special keys are transcoded
+ * Add a key to a macro, growing it as needed.
  */
-void macro_addline(int** PDest, char* Buff, int Sz) {
-    int i, j, key;
+static int macro_addkey(Tn5250MacroData* Mac, int key) {
     int* Buffer;
-    int NSz, OSz;
 
-    if (*PDest == NULL) {
-        Buffer = (int*)malloc((Sz + 1) * sizeof(int));
-        OSz = 0;
-    }
-    else {
-        OSz = macro_macrosize(*PDest);
-        NSz = OSz + Sz + 1;
-        Buffer = *PDest;
-        Buffer = (int*)realloc(*PDest, NSz * sizeof(int));
+    if (Mac->count == Mac->alloc) {
+        Buffer = (int*)realloc(Mac->keys,
+                               (Mac->alloc * 2 + 64) * sizeof(int));
+        if (Buffer == NULL) {
+            return (0);
+        }
+        Mac->keys = Buffer;
+        Mac->alloc = Mac->alloc * 2 + 64;
     }
+    Mac->keys[Mac->count++] = key;
+    return (1);
+}
 
-    if (Buffer != NULL) {
-        *PDest = Buffer;
+/*
+ * Add the line contents to macro
+ * TODO : add an escape character
+ */
+static void macro_addline(Tn5250MacroData* Mac, const char* Buff) {
+    int j, key;
 
-        i = j = 0;
-        while (Buff[j] != 0) {
-            if ((key = macro_specialkey(Buff, &j)) > 0) {
-                Buffer[OSz + i] = key; /* maybe should resize buffer here */
-            }
-            else {
-                Buffer[OSz + i] = (int)Buff[j];
-            }
-            i++;
-            j++;
+    j = 0;
+    while (Buff[j] != 0) {
+        if ((key = macro_specialkey(Buff, &j)) == 0) {
+            key = (unsigned char)Buff[j];
         }
-
-        Buffer[OSz + i] = 0;
+        if (!macro_addkey(Mac, key)) {
+            return;
+        }
+        j++;
     }
 }
 
 /*
- * Load the macro definitions file
+ * Make an empty macro and add it to the end of the list.  Num is the
+ * function key, or the macro number, or -1 for a macro known only by
+ * its name.  A macro already using the number is replaced.
  */
-char macro_loadfile(Tn5250Macro* Macro) {
-    FILE* MFile;
-    int Sz, Num, CurMacro;
-    char Buffer[MAX_LINESZ];
-    unsigned char* macroname;
+static Tn5250MacroData* macro_new(Tn5250Macro* Macro, int Num,
+                                  const char* name) {
+    Tn5250MacroData* Mac;
+    Tn5250MacroData** Link;
 
-    if (Macro->fname != NULL) {
-        if ((MFile = fopen(Macro->fname, "rt")) != NULL) {
-            CurMacro = 0;
-            while (fgets(Buffer, MAX_LINESZ, MFile) != NULL) {
-                Sz = macro_buffer_clean(Buffer);
-                macroname = NULL;
-
-                if ((Num = macro_isnewmacro(Buffer, &macroname)) > 0) {
-                    if (Num <= 24) {
-                        CurMacro = Num;
-                    }
-                    if (macroname != NULL) {
-                        Macro->data[CurMacro - 1].name =
-                            (unsigned char*)realloc(
-                                Macro->data[CurMacro - 1].name,
-                                sizeof(unsigned char) *
-                                    (strlen((const char*)macroname) + 1));
-                        strcpy((char*)Macro->data[CurMacro - 1].name,
-                               (char*)macroname);
-                        free(macroname);
-                    }
-                }
-                else {
-                    if ((CurMacro > 0) && (Sz > 0)) {
-                        macro_addline(&Macro->data[CurMacro - 1].BuffM, Buffer,
-                                      Sz);
-                    }
-                }
-            }
-            fclose(MFile);
+    if (Num > 0 && (Mac = tn5250_macro_find_number(Macro, Num)) != NULL) {
+        macro_remove(Macro, Mac);
+    }
+
+    Mac = tn5250_new(Tn5250MacroData, 1);
+    if (Mac == NULL) {
+        return (NULL);
+    }
+    Mac->next = NULL;
+    Mac->number = Num;
+    Mac->name = NULL;
+    Mac->description = NULL;
+    Mac->keys = NULL;
+    Mac->count = 0;
+    Mac->alloc = 0;
+    if (name != NULL) {
+        Mac->name = (unsigned char*)malloc(strlen(name) + 1);
+        if (Mac->name != NULL) {
+            strcpy((char*)Mac->name, name);
         }
-        return (1);
     }
 
-    return (0);
+    for (Link = &Macro->list; *Link != NULL; Link = &(*Link)->next) {
+    }
+    *Link = Mac;
+    if (Num >= 1 && Num <= 24) {
+        Macro->fkeys[Num - 1] = Mac;
+    }
+    return (Mac);
+}
+
+/*
+ * Take a macro out of the list and free it, stopping it if it is the one
+ * being played.
+ */
+static void macro_remove(Tn5250Macro* Macro, Tn5250MacroData* Mac) {
+    Tn5250MacroData** Link;
+
+    for (Link = &Macro->list; *Link != Mac; Link = &(*Link)->next) {
+    }
+    *Link = Mac->next;
+    if (Mac->number >= 1 && Mac->number <= 24) {
+        Macro->fkeys[Mac->number - 1] = NULL;
+    }
+    if (Macro->running == Mac) {
+        /* It can't carry on without its keys. */
+        Macro->running = NULL;
+        Macro->EState = 0;
+    }
+    free(Mac->keys);
+    free(Mac->name);
+    free(Mac->description);
+    free(Mac);
 }
 
 /*
  * Clear macros in memory
  */
-void macro_clearmem(Tn5250Macro* Macro) {
-    int i;
+static void macro_clearmem(Tn5250Macro* Macro) {
+    while (Macro->list != NULL) {
+        macro_remove(Macro, Macro->list);
+    }
+    Macro->loaded = 0;
+}
 
-    for (i = 0; i < 24; i++) {
-        if (Macro->data[i].BuffM != NULL) {
-            free(Macro->data[i].BuffM);
-            Macro->data[i].BuffM = NULL;
+/*
+ * Get the modification time, inode and size of the macro file.  Returns
+ * 0 if there is no file.
+ */
+static int macro_filestamp(Tn5250Macro* Macro, Tn5250MacroStamp* stamp) {
+    struct stat st;
+
+    if ((Macro->fname == NULL) || (stat(Macro->fname, &st) != 0)) {
+        return (0);
+    }
+    stamp->mtime = st.st_mtime;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+    stamp->mtime_nsec = (long)st.st_mtim.tv_nsec;
+#else
+    stamp->mtime_nsec = 0;
+#endif
+    stamp->ino = st.st_ino;
+    stamp->size = (long)st.st_size;
+    return (1);
+}
+
+/*
+ * Return 1 if two stamps are of the same file, unchanged.
+ */
+static int macro_samestamp(Tn5250MacroStamp* a, Tn5250MacroStamp* b) {
+    return (a->mtime == b->mtime && a->mtime_nsec == b->mtime_nsec &&
+            a->ino == b->ino && a->size == b->size);
+}
+
+/*
+ * Load the macro definitions file, unless what is in memory was loaded
+ * from (or saved to) the file as it is now.
+ */
+static char macro_loadfile(Tn5250Macro* Macro) {
+    FILE* MFile;
+    int Num;
+    char* Buffer = NULL;
+    size_t Alloc = 0;
+    char* macroname;
+    Tn5250MacroStamp stamp;
+    Tn5250MacroData* CurMacro;
+
+    if (Macro->fname == NULL) {
+        return (0);
+    }
+    if (!macro_filestamp(Macro, &stamp)) {
+        macro_clearmem(Macro);
+        return (1);
+    }
+    if (Macro->loaded && macro_samestamp(&stamp, &Macro->stamp)) {
+        return (1);
+    }
+
+    macro_clearmem(Macro);
+    if ((MFile = fopen(Macro->fname, "rt")) != NULL) {
+        TN5250_LOG(("Macro: loading %s\n", Macro->fname));
+        CurMacro = NULL;
+        while (macro_readline(MFile, &Buffer, &Alloc) != NULL) {
+            if ((Num = macro_isnewmacro(Buffer, &macroname)) != 0) {
+                CurMacro = macro_new(Macro, Num, macroname);
+                free(macroname);
+            }
+            else if ((CurMacro != NULL) && (Buffer[0] != 0)) {
+                macro_addline(CurMacro, Buffer);
+            }
         }
+        free(Buffer);
+        fclose(MFile);
     }
+    Macro->stamp = stamp;
+    Macro->loaded = 1;
+    return (1);
 }
 
 #ifdef __WIN32__
@@ -406,27 +521,38 @@ Tn5250Macro* tn5250_macro_init() {
 
     This->RState = 0;
     This->EState = 0;
+    This->FctnKey = 0;
     This->TleBuff = 0;
+    This->list = NULL;
     for (i = 0; i < 24; i++) {
-        This->data[i].BuffM = NULL;
-        This->data[i].name = NULL;
-        This->data[i].description = NULL;
+        This->fkeys[i] = NULL;
     }
+    This->recording = NULL;
+    This->running = NULL;
+    This->fname = NULL;
+    memset(&This->stamp, 0, sizeof(Tn5250MacroStamp));
+    This->loaded = 0;
     return This;
 }
 
 /*
  * Write one macro to file
  */
-void macro_write(int Num, unsigned char* name, int* Buff, FILE* MF) {
+static void macro_write(Tn5250MacroData* Mac, FILE* MF) {
     int i, j, Sz;
 
-    fprintf(MF, "[M%02i]%s\n", Num, name);
+    if (Mac->number > 0) {
+        fprintf(MF, "[M%02i]%s\n", Mac->number,
+                Mac->name != NULL ? (char*)Mac->name : "");
+    }
+    else {
+        fprintf(MF, "[M]%s\n", (char*)Mac->name);
+    }
 
-    i = Sz = 0;
-    while (Buff[i] != 0) {
+    Sz = 0;
+    for (i = 0; i < Mac->count; i++) {
         j = 0;
-        while ((MKey[j].km_code != 0) && (MKey[j].km_code != Buff[i])) {
+        while ((MKey[j].km_code != 0) && (MKey[j].km_code != Mac->keys[i])) {
             j++;
         }
         if (MKey[j].km_code == 0) {
@@ -434,7 +560,7 @@ void macro_write(int Num, unsigned char* name, int* Buff, FILE* MF) {
                 fprintf(MF, "\n");
                 Sz = 0;
             }
-            fprintf(MF, "%c", (char)Buff[i]);
+            fprintf(MF, "%c", (char)Mac->keys[i]);
             Sz++;
         }
         else {
@@ -445,8 +571,6 @@ void macro_write(int Num, unsigned char* name, int* Buff, FILE* MF) {
             fprintf(MF, "[%s]", MKey[j].km_str);
             Sz += strlen(MKey[j].km_str) + 2;
         }
-
-        i++;
     }
 
     fprintf(MF, "\n\n");
@@ -455,19 +579,19 @@ void macro_write(int Num, unsigned char* name, int* Buff, FILE* MF) {
 /*
  * Save the macro definitions file
  */
-char macro_savefile(Tn5250Macro* Macro) {
+static char macro_savefile(Tn5250Macro* Macro) {
     FILE* MFile;
-    int i;
+    Tn5250MacroData* Mac;
 
     if (Macro->fname != NULL) {
         if ((MFile = fopen(Macro->fname, "wt")) != NULL) {
-            for (i = 0; i < 24; i++) {
-                if (Macro->data[i].BuffM != NULL) {
-                    macro_write(i + 1, Macro->data[i].name,
-                                Macro->data[i].BuffM, MFile);
-                }
+            for (Mac = Macro->list; Mac != NULL; Mac = Mac->next) {
+                macro_write(Mac, MFile);
             }
             fclose(MFile);
+
+            /* What is in memory is what is in the file. */
+            Macro->loaded = macro_filestamp(Macro, &Macro->stamp);
         }
         return (1);
     }
@@ -485,20 +609,13 @@ char macro_savefile(Tn5250Macro* Macro) {
  *    Macro system termination
  *****/
 void tn5250_macro_exit(Tn5250Macro* This) {
-    int i;
-
     if (This != NULL) {
         /* macro_savefile (This) ; */
 
         if (This->fname != NULL) {
             free(This->fname);
         }
-
-        for (i = 0; i < 24; i++) {
-            free(This->data[i].BuffM);
-            free(This->data[i].name);
-            free(This->data[i].description);
-        }
+        macro_clearmem(This);
         free(This);
     }
 }
@@ -535,6 +652,57 @@ int tn5250_macro_attach(Tn5250Display* This, Tn5250Macro* Macro) {
     return 0;
 }
 
+/****f* lib5250/tn5250_macro_find
+ * NAME
+ *    tn5250_macro_find
+ * SYNOPSIS
+ *    mac = tn5250_macro_find (This, "signon");
+ * INPUTS
+ *    Tn5250Macro *        This       -
+ *    const char *         name       - Name of the macro.
+ * DESCRIPTION
+ *    Find a macro by name, loading the macro file first if it has
+ *    changed.  Returns NULL if there is no such macro.
+ *****/
+Tn5250MacroData* tn5250_macro_find(Tn5250Macro* This, const char* name) {
+    Tn5250MacroData* Mac;
+
+    macro_loadfile(This);
+    for (Mac = This->list; Mac != NULL; Mac = Mac->next) {
+        if ((Mac->name != NULL) && (strcmp((char*)Mac->name, name) == 0)) {
+            return (Mac);
+        }
+    }
+    return (NULL);
+}
+
+/****f* lib5250/tn5250_macro_find_number
+ * NAME
+ *    tn5250_macro_find_number
+ * SYNOPSIS
+ *    mac = tn5250_macro_find_number (This, 3);
+ * INPUTS
+ *    Tn5250Macro *        This       -
+ *    int                  num        - Number of the macro.
+ * DESCRIPTION
+ *    Find a macro by number, as it stands in memory.  Macros 1 to 24 are
+ *    the ones run by the function keys.  Returns NULL if there is no
+ *    such macro.
+ *****/
+Tn5250MacroData* tn5250_macro_find_number(Tn5250Macro* This, int num) {
+    Tn5250MacroData* Mac;
+
+    if (num >= 1 && num <= 24) {
+        return (This->fkeys[num - 1]);
+    }
+    for (Mac = This->list; Mac != NULL; Mac = Mac->next) {
+        if (Mac->number == num) {
+            return (Mac);
+        }
+    }
+    return (NULL);
+}
+
 /****f* lib5250/tn5250_macro_rstate
  * NAME
  *    tn5250_macro_rstate
@@ -566,7 +734,7 @@ char tn5250_macro_startdef(Tn5250Display* This) {
     if (This->macro != NULL) {
         This->macro->RState = 1;
         This->macro->FctnKey = 0;
-        This->macro->TleBuff = MACRO_BUFSIZE;
+        This->macro->TleBuff = 0;
         return (1);
     }
     return (0);
@@ -580,32 +748,20 @@ char tn5250_macro_startdef(Tn5250Display* This) {
  * INPUTS
  *    Tn5250Display *      This       - Current display
  * DESCRIPTION
- *    Ends a macro definition
+ *    Ends a macro definition.  Recording no keys deletes the macro.
  *****/
 void tn5250_macro_enddef(Tn5250Display* This) {
-    int NumMacro;
-    int* Buffer;
+    Tn5250Macro* Macro = This->macro;
 
-    if (This->macro != NULL) {
-        if (This->macro->RState > 1) {
-            NumMacro = This->macro->FctnKey - K_F1;
-            if (This->macro->TleBuff > 0) {
-                This->macro->data[NumMacro].BuffM[This->macro->TleBuff++] = 0;
-
-                Buffer = (int*)realloc(This->macro->data[NumMacro].BuffM,
-                                       This->macro->TleBuff * sizeof(int));
-                if (Buffer != NULL) {
-                    This->macro->data[NumMacro].BuffM = Buffer;
-                }
-            }
-            else {
-                free(This->macro->data[NumMacro].BuffM);
-                This->macro->data[NumMacro].BuffM = NULL;
+    if (Macro != NULL) {
+        if ((Macro->RState > 1) && (Macro->recording != NULL)) {
+            if (Macro->recording->count == 0) {
+                macro_remove(Macro, Macro->recording);
             }
-
-            macro_savefile(This->macro);
+            Macro->recording = NULL;
+            macro_savefile(Macro);
         }
-        This->macro->RState = 0;
+        Macro->RState = 0;
     }
 }
 
@@ -621,28 +777,29 @@ void tn5250_macro_enddef(Tn5250Display* This) {
  *    Receives a function key. Return True if macro definition key
  *****/
 char tn5250_macro_recfunct(Tn5250Display* This, int key) {
-    int* Buffer;
+    Tn5250Macro* Macro = This->macro;
+    Tn5250MacroData* Old;
+    char* name = NULL;
     int NumMacro;
 
-    if ((This->macro != NULL) && (This->macro->RState == 1)) {
-        Buffer = (int*)malloc((MACRO_BUFSIZE + 1) * sizeof(int));
-        if (Buffer != NULL) {
-            This->macro->RState = 2;
-            This->macro->FctnKey = key;
-            NumMacro = key - K_F1;
-            if ((NumMacro >= 0) && (NumMacro < 24)) {
-                macro_clearmem(This->macro);
-                macro_loadfile(This->macro);
-
-                if (This->macro->data[NumMacro].BuffM != NULL) {
-                    free(This->macro->data[NumMacro].BuffM);
-                }
-                This->macro->data[NumMacro].BuffM = Buffer;
-                This->macro->TleBuff = 0;
-                return (1);
+    if ((Macro != NULL) && (Macro->RState == 1)) {
+        NumMacro = key - K_F1 + 1;
+        if ((NumMacro >= 1) && (NumMacro <= 24)) {
+            macro_loadfile(Macro);
+
+            /* Keep the name of the macro we are replacing. */
+            if ((Old = Macro->fkeys[NumMacro - 1]) != NULL &&
+                Old->name != NULL) {
+                name = (char*)Old->name;
+                Old->name = NULL;
             }
-            else {
-                free(Buffer);
+            Macro->recording = macro_new(Macro, NumMacro, name);
+            free(name);
+            if (Macro->recording != NULL) {
+                Macro->RState = 2;
+                Macro->FctnKey = key;
+                Macro->TleBuff = 0;
+                return (1);
             }
         }
     }
@@ -661,13 +818,11 @@ char tn5250_macro_recfunct(Tn5250Display* This, int key) {
  *    Receives a key.
  *****/
 void tn5250_macro_reckey(Tn5250Display* This, int key) {
-    int NumMacro;
+    Tn5250Macro* Macro = This->macro;
 
-    if ((This->macro != NULL) && (This->macro->RState == 2) &&
-        (key != K_MEMO)) {
-        NumMacro = This->macro->FctnKey - K_F1;
-        if (This->macro->TleBuff < MACRO_BUFSIZE) {
-            This->macro->data[NumMacro].BuffM[This->macro->TleBuff++] = key;
+    if ((Macro != NULL) && (Macro->RState == 2) && (key != K_MEMO)) {
+        if (macro_addkey(Macro->recording, key)) {
+            Macro->TleBuff = Macro->recording->count;
         }
     }
 }
@@ -680,23 +835,23 @@ void tn5250_macro_reckey(Tn5250Display* This, int key) {
  * INPUTS
  *    Tn5250Display *      This       - Current display
  * DESCRIPTION
- *    Returns a printable macro state (always 11 char long)
+ *    Returns a printable macro state (always 11 char long).  While
+ *    recording this shows the number of keys recorded so far.
  *****/
 char* tn5250_macro_printstate(Tn5250Display* This) {
-    int NumKey;
+    int NumKey, Count;
 
     PState[0] = 0;
     if (This->macro != NULL) {
+        Count = This->macro->TleBuff > 9999 ? 9999 : This->macro->TleBuff;
         if (This->macro->RState > 0) /* recording state */
         {
             if (This->macro->RState == 1) {
-                sprintf(PState, "R %04i     ",
-                        MACRO_BUFSIZE - This->macro->TleBuff);
+                sprintf(PState, "R %04i     ", 0);
             }
             else {
                 NumKey = This->macro->FctnKey - K_F1 + 1;
-                sprintf(PState, "R %04i  F%02i",
-                        MACRO_BUFSIZE - This->macro->TleBuff, NumKey);
+                sprintf(PState, "R %04i  F%02i", Count, NumKey);
             }
         }
         else /* execution state */
@@ -704,6 +859,13 @@ char* tn5250_macro_printstate(Tn5250Display* This) {
                 if (This->macro->EState == 1) {
                     sprintf(PState, "P          ");
                 }
+                else if (This->macro->FctnKey == 0) {
+                    sprintf(PState, "P %-9.9s",
+                            (This->macro->running != NULL &&
+                             This->macro->running->name != NULL)
+                                ? (char*)This->macro->running->name
+                                : "");
+                }
                 else {
                     NumKey = This->macro->FctnKey - K_F1 + 1;
                     sprintf(PState, "P F%02i      ", NumKey);
@@ -762,6 +924,7 @@ char tn5250_macro_startexec(Tn5250Display* This) {
 void tn5250_macro_endexec(Tn5250Display* This) {
     if (This->macro != NULL) {
         This->macro->EState = 0;
+        This->macro->running = NULL;
     }
 }
 
@@ -774,7 +937,8 @@ void tn5250_macro_endexec(Tn5250Display* This) {
  *    Tn5250Display *      This       - Current display
  *    int 		   key     - function key received
  * DESCRIPTION
- *    Receives an execution function key.
+ *    Receives an execution function key.  The macro file is only read
+ *    again if it has changed since it was last loaded or saved.
  *****/
 char tn5250_macro_execfunct(Tn5250Display* This, int key) {
     int NumMacro;
@@ -782,11 +946,11 @@ char tn5250_macro_execfunct(Tn5250Display* This, int key) {
     if ((This->macro != NULL) && (This->macro->EState == 1)) {
         This->macro->EState = 2;
         This->macro->FctnKey = key;
-        NumMacro = key - K_F1;
-        if ((NumMacro >= 0) && (NumMacro < 24)) {
-            macro_clearmem(This->macro);
+        NumMacro = key - K_F1 + 1;
+        if ((NumMacro >= 1) && (NumMacro <= 24)) {
             macro_loadfile(This->macro);
 
+            This->macro->running = This->macro->fkeys[NumMacro - 1];
             This->macro->EState = 3; /* Ok to run macro */
             This->macro->TleBuff = 0;
             return (1);
@@ -795,11 +959,41 @@ char tn5250_macro_execfunct(Tn5250Display* This, int key) {
     return (0);
 }
 
+/****f* lib5250/tn5250_macro_run
+ * NAME
+ *    tn5250_macro_run
+ * SYNOPSIS
+ *    tn5250_macro_run (This, "signon");
+ * INPUTS
+ *    Tn5250Display *      This       - Current display
+ *    const char *         name       - Name of the macro to run.
+ * DESCRIPTION
+ *    Start running a macro by name, as if its function key had been
+ *    pressed after EXEC.  Its keys are played by the next call to
+ *    tn5250_display_do_keys.  Returns 0 if there is no such macro or a
+ *    macro is being recorded or run.
+ *****/
+char tn5250_macro_run(Tn5250Display* This, const char* name) {
+    Tn5250MacroData* Mac;
+
+    if ((This->macro == NULL) || (This->macro->RState != 0) ||
+        (This->macro->EState != 0) ||
+        ((Mac = tn5250_macro_find(This->macro, name)) == NULL)) {
+        return (0);
+    }
+    This->macro->running = Mac;
+    This->macro->FctnKey = 0;
+    This->macro->EState = 3;
+    This->macro->TleBuff = 0;
+    tn5250_display_indicator_set(This, TN5250_DISPLAY_IND_MACRO);
+    return (1);
+}
+
 /****f* lib5250/tn5250_macro_getkey
  * NAME
- *    tn5250_macro_execfunct
+ *    tn5250_macro_getkey
  * SYNOPSIS
- *    tn5250_macro_execfunct (This,Last);
+ *    key = tn5250_macro_getkey (This,Last);
  * INPUTS
  *    Tn5250Display *      This       - Current display
  *    char  *		   Last     - to return a "toggle indicator off"
@@ -807,31 +1001,51 @@ char tn5250_macro_execfunct(Tn5250Display* This, int key) {
  *    Sends a key to execute
  *****/
 int tn5250_macro_getkey(Tn5250Display* This, char* Last) {
-    int NumMacro;
-    int key, nkey;
+    Tn5250Macro* Macro = This->macro;
+    int key = 0;
 
     *Last = 0;
-    if ((This->macro != NULL) && (This->macro->EState == 3)) {
-        NumMacro = This->macro->FctnKey - K_F1;
-        if (This->macro->data[NumMacro].BuffM != NULL) {
-            key = This->macro->data[NumMacro].BuffM[This->macro->TleBuff];
-            if (key != 0) {
-                nkey =
-                    This->macro->data[NumMacro].BuffM[++This->macro->TleBuff];
-            }
-
-            if ((key == 0) || (nkey == 0)) {
-                *Last = 1;
-                This->macro->EState = 0;
-            }
-
-            return (key);
+    if ((Macro != NULL) && (Macro->EState == 3)) {
+        if ((Macro->running != NULL) &&
+            (Macro->TleBuff < Macro->running->count)) {
+            key = Macro->running->keys[Macro->TleBuff++];
         }
-        else {
-            This->macro->EState = 0;
+        if ((Macro->running == NULL) ||
+            (Macro->TleBuff >= Macro->running->count)) {
             *Last = 1;
-            return (0);
+            Macro->EState = 0;
+            Macro->running = NULL;
         }
     }
-    return (0);
+    return (key);
+}
+
+/****f* lib5250/tn5250_macro_getkeys
+ * NAME
+ *    tn5250_macro_getkeys
+ * SYNOPSIS
+ *    count = tn5250_macro_getkeys (This, &keys);
+ * INPUTS
+ *    Tn5250Display *      This       - Current display
+ *    const int **         keys       - Set to the keys.
+ * DESCRIPTION
+ *    Hand over the rest of the running macro at once, so that its keys
+ *    can be handled without going round the display loop for each one.
+ *    The keys stay valid while tn5250_macro_estate returns 3; the
+ *    caller should stop when it doesn't (an EXEC key in the macro stops
+ *    it) and call tn5250_macro_endexec when it has finished.  Returns
+ *    the number of keys.
+ *****/
+int tn5250_macro_getkeys(Tn5250Display* This, const int** keys) {
+    Tn5250Macro* Macro = This->macro;
+    int count;
+
+    *keys = NULL;
+    if ((Macro == NULL) || (Macro->EState != 3) || (Macro->running == NULL)) {
+        return (0);
+    }
+    *keys = Macro->running->keys + Macro->TleBuff;
+    count = Macro->running->count - Macro->TleBuff;
+    Macro->TleBuff = Macro->running->count;
+    return (count);
 }
@@ -24,12 +24,12 @@
 #ifndef MACRO_H
 #define MACRO_H
 
+#include <sys/types.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define MACRO_BUFSIZE 2000 /* 9999 Max */
-
 /****s* lib5250/Tn5250MacroData
  * NAME
  *    Tn5250MacroData
@@ -37,24 +37,46 @@ extern "C" {
  *
  * DESCRIPTION
  *    For each macro defined, this contains the macro contents, a name,
- *    and an optional description.
+ *    and an optional description.  The contents are the keys to play,
+ *    as read from the macro file when it was loaded.  Macros 1 to 24 are
+ *    run by the function keys; others, and those with number 0, are run
+ *    by name.
  *
  * SOURCE
  */
 struct _Tn5250MacroData {
-    int* BuffM;
+    struct _Tn5250MacroData* next;
+    int number; /* Macro number, 0 for a macro known only by name */
     unsigned char* name;
     unsigned char* description;
+    int* keys;
+    int count, alloc;
 };
 
 typedef struct _Tn5250MacroData Tn5250MacroData;
 
+/*
+ * What stat said about the macro file.  The nanoseconds are 0 where
+ * stat has none; the inode catches a file replaced by a rename.
+ */
+struct _Tn5250MacroStamp {
+    time_t mtime;
+    long mtime_nsec;
+    ino_t ino;
+    long size;
+};
+
+typedef struct _Tn5250MacroStamp Tn5250MacroStamp;
+
 /****s* lib5250/Tn5250Macro
  * NAME
  *    Tn5250Macro
  * SYNOPSIS
  *
  * DESCRIPTION
+ *    The macros from the macro file, in the order they appear there.
+ *    The file is read again only when its modification time, inode or
+ *    size has changed since it was last loaded or saved.
  *
  * SOURCE
  */
@@ -62,9 +84,14 @@ struct _Tn5250Macro {
     char RState; /* Macro record state */
     char EState; /* Macro execution state */
     int FctnKey;
-    Tn5250MacroData data[24];
-    int TleBuff;
-    char* fname; /* Macro file name */
+    int TleBuff; /* Keys recorded, or played of the running macro */
+    Tn5250MacroData* list;
+    Tn5250MacroData* fkeys[24];
+    Tn5250MacroData* recording;
+    Tn5250MacroData* running;
+    char* fname;            /* Macro file name */
+    Tn5250MacroStamp stamp; /* The file when loaded or saved */
+    int loaded;
 };
 
 typedef struct _Tn5250Macro Tn5250Macro;
@@ -84,6 +111,12 @@ extern char tn5250_macro_startexec(Tn5250Display* This);
 extern void tn5250_macro_endexec(Tn5250Display* This);
 extern char tn5250_macro_execfunct(Tn5250Display* This, int key);
 extern int tn5250_macro_getkey(Tn5250Display* This, char* Last);
+extern int tn5250_macro_getkeys(Tn5250Display* This, const int** keys);
+extern char tn5250_macro_run(Tn5250Display* This, const char* name);
+extern Tn5250MacroData* tn5250_macro_find(Tn5250Macro* This,
+                                          const char* name);
+extern Tn5250MacroData* tn5250_macro_find_number(Tn5250Macro* This,
+                                                 int num);
 
 #ifdef __cplusplus
 }
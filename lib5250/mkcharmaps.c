@@ -0,0 +1,435 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* mkcharmaps -- Generate charmaps.h for lib5250.
+ *
+ * This is run by "make charmaps" in the build directory, and the header
+ * it writes is kept in the source tree, so the tables don't depend on the
+ * iconv of whoever builds lib5250 and nothing has to run on the build
+ * machine when cross compiling.  For every map in transmaps.h, with the
+ * corrections from transfix.h applied, it writes out:
+ *
+ *   - the EBCDIC <-> local translation tables,
+ *   - a 256 entry UTF-8 output table, each entry being the encoded length
+ *     followed by up to three bytes, composed from the local table and
+ *     the local character set's Unicode mapping (taken from iconv),
+ *   - a perfect hash from Unicode code point to EBCDIC for input,
+ *
+ * and then the tn5250_transmaps registry itself with a perfect hash over
+ * the map names.  Nothing in the generated tables is changed at run time.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <iconv.h>
+
+#include "utility.h"
+#include "transmaps.h"
+#include "transfix.h"
+
+/* Local character set of each EBCDIC CCSID.  This must agree with the
+ * table in the transmaps script. */
+struct _charset {
+    int ccsid;
+    const char* unix_enc;
+    const char* win_enc;
+};
+
+static const struct _charset charsets[] = {
+    {37, "ISO-8859-1", "WINDOWS-1252"},   {256, "ISO-8859-1", "WINDOWS-1252"},
+    {273, "ISO-8859-1", "WINDOWS-1252"},  {277, "ISO-8859-1", "WINDOWS-1252"},
+    {278, "ISO-8859-1", "WINDOWS-1252"},  {280, "ISO-8859-1", "WINDOWS-1252"},
+    {284, "ISO-8859-1", "WINDOWS-1252"},  {285, "ISO-8859-1", "WINDOWS-1252"},
+    {297, "ISO-8859-1", "WINDOWS-1252"},  {500, "ISO-8859-1", "WINDOWS-1252"},
+    {871, "ISO-8859-1", "WINDOWS-1252"},  {870, "ISO-8859-2", "WINDOWS-1250"},
+    {905, "ISO-8859-3", "WINDOWS-1254"},  {880, "ISO-8859-5", "WINDOWS-1251"},
+    {420, "ISO-8859-6", "WINDOWS-1256"},  {875, "ISO-8859-7", "WINDOWS-1253"},
+    {424, "ISO-8859-8", "WINDOWS-1255"},  {1026, "ISO-8859-9", "WINDOWS-1254"},
+    {290, "JIS_X0201", NULL},             {0, NULL, NULL}};
+
+#define UCS_NONE        0xffffffffUL
+#define UCS_REPLACEMENT 0xfffdUL
+#define HASH_EMPTY      0xffff
+#define HASH_MIN_BITS   9
+#define HASH_MAX_BITS   12
+#define NAME_MIN_BITS   6
+#define NAME_MAX_BITS   8
+#define NAME_NONE       0xff
+
+/*
+ *    Find the local character set for a map name such as "37" or "win37".
+ */
+static const char* map_charset(const char* name) {
+    const struct _charset* c;
+    int win = 0;
+
+    if (strncmp(name, "win", 3) == 0) {
+        win = 1;
+        name += 3;
+    }
+    for (c = charsets; c->ccsid != 0; c++) {
+        if (c->ccsid == atoi(name)) {
+            return win ? c->win_enc : c->unix_enc;
+        }
+    }
+    return NULL;
+}
+
+/*
+ *    Fill ucs[] with the Unicode code point of each byte in the local
+ *    character set, or UCS_NONE where the byte is undefined.  JIS X0201
+ *    is done by hand since not every iconv knows about it.
+ */
+static void charset_to_ucs(const char* enc, unsigned long* ucs) {
+    iconv_t cd;
+    int c;
+
+    if (strcmp(enc, "JIS_X0201") == 0) {
+        for (c = 0; c < 256; c++) {
+            if (c < 0x80) {
+                ucs[c] = c;
+            }
+            else if (c >= 0xa1 && c <= 0xdf) {
+                ucs[c] = 0xff61UL + (c - 0xa1);
+            }
+            else {
+                ucs[c] = UCS_NONE;
+            }
+        }
+        ucs[0x5c] = 0x00a5UL; /* YEN SIGN */
+        ucs[0x7e] = 0x203eUL; /* OVERLINE */
+        return;
+    }
+
+    cd = iconv_open("UCS-4BE", enc);
+    if (cd == (iconv_t)-1) {
+        fprintf(stderr, "mkcharmaps: iconv_open %s: %s\n", enc,
+                strerror(errno));
+        exit(1);
+    }
+
+    for (c = 0; c < 256; c++) {
+        char in = (char)c;
+        unsigned char out[8];
+        char* inp = &in;
+        char* outp = (char*)out;
+        size_t inleft = 1, outleft = sizeof(out);
+
+        iconv(cd, NULL, NULL, NULL, NULL);
+        if (iconv(cd, &inp, &inleft, &outp, &outleft) == (size_t)-1 ||
+            sizeof(out) - outleft != 4) {
+            ucs[c] = UCS_NONE;
+            continue;
+        }
+        ucs[c] = ((unsigned long)out[0] << 24) | ((unsigned long)out[1] << 16) |
+                 ((unsigned long)out[2] << 8) | (unsigned long)out[3];
+        if (ucs[c] >= HASH_EMPTY) {
+            ucs[c] = UCS_NONE;
+        }
+    }
+    iconv_close(cd);
+}
+
+/*
+ *    Apply a list of { local, remote } corrections from transfix.h.
+ */
+static void apply_fix(unsigned char* to_remote, unsigned char* to_local,
+                      const unsigned char (*fix)[2], int n) {
+    int i;
+
+    for (i = 0; i < n; i++) {
+        to_remote[fix[i][0]] = fix[i][1];
+        to_local[fix[i][1]] = fix[i][0];
+    }
+}
+
+/*
+ *    Write one output table entry: the encoded length, then the bytes.
+ */
+static void print_utf8(unsigned long u) {
+    if (u < 0x80) {
+        printf("{1, 0x%02lx, 0, 0}", u);
+    }
+    else if (u < 0x800) {
+        printf("{2, 0x%02lx, 0x%02lx, 0}", 0xc0 | (u >> 6), 0x80 | (u & 0x3f));
+    }
+    else {
+        printf("{3, 0x%02lx, 0x%02lx, 0x%02lx}", 0xe0 | (u >> 12),
+               0x80 | ((u >> 6) & 0x3f), 0x80 | (u & 0x3f));
+    }
+}
+
+/*
+ *    Search for a multiplier which places every key in its own slot of a
+ *    table with 1 << bits entries.  This must use the same hash as
+ *    tn5250_char_map_from_ucs in utility.c.
+ */
+static int find_hash(const unsigned long* keys, int n, int bits,
+                     unsigned long* mult, Tn5250Uint16* slots) {
+    unsigned long seed = 0x9e3779b1UL;
+    int size = 1 << bits;
+    int tries, i;
+
+    for (tries = 0; tries < 100000; tries++) {
+        unsigned long m = (seed | 1) & 0xffffffffUL;
+
+        seed = (seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+        for (i = 0; i < size; i++) {
+            slots[i] = HASH_EMPTY;
+        }
+        for (i = 0; i < n; i++) {
+            int slot = (int)(((keys[i] * m) & 0xffffffffUL) >> (32 - bits));
+            if (slots[slot] != HASH_EMPTY) {
+                break;
+            }
+            slots[slot] = (Tn5250Uint16)i;
+        }
+        if (i == n) {
+            *mult = m;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Write out a 256 byte translation table.
+ */
+static void print_table(const char* prefix, const char* name,
+                        const char* suffix, const unsigned char* tab) {
+    int i;
+
+    printf("static unsigned char const %s_%s_%s[256] = {\n", prefix, name,
+           suffix);
+    for (i = 0; i < 256; i++) {
+        printf("%s0x%02x%s", i % 8 == 0 ? "    " : " ", tab[i],
+               i == 255 ? "};\n\n" : (i % 8 == 7 ? ",\n" : ","));
+    }
+}
+
+/*
+ *    Hash a map name.  This must be the same as tn5250_char_map_lookup in
+ *    utility.c.
+ */
+static unsigned long name_hash(const char* name, unsigned long seed) {
+    unsigned long h = seed;
+
+    while (*name) {
+        h = ((h ^ (unsigned char)*name++) * 16777619UL) & 0xffffffffUL;
+    }
+    return h;
+}
+
+/*
+ *    Search for a seed which gives every map name its own slot in a table
+ *    with 1 << bits entries.
+ */
+static int find_name_hash(const Tn5250CharMap* maps, int n, int bits,
+                          unsigned long* seed, unsigned char* slots) {
+    unsigned long s = 2166136261UL;
+    int size = 1 << bits;
+    int tries, i;
+
+    for (tries = 0; tries < 100000; tries++) {
+        s = (s * 1103515245UL + 12345UL) & 0xffffffffUL;
+        memset(slots, NAME_NONE, size);
+        for (i = 0; i < n; i++) {
+            int slot = (int)(name_hash(maps[i].name, s) >> (32 - bits));
+            if (slots[slot] != NAME_NONE) {
+                break;
+            }
+            slots[slot] = (unsigned char)i;
+        }
+        if (i == n) {
+            *seed = s;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Write out the tables for one map and return the hash parameters.
+ */
+static void print_map(const Tn5250CharMap* t, unsigned long* mult,
+                      int* bits) {
+    unsigned char to_remote[256], to_local[256];
+    unsigned long ucs[256], keys[256];
+    unsigned char values[256];
+    Tn5250Uint16 slots[1 << HASH_MAX_BITS];
+    const char* enc = map_charset(t->name);
+    int n = 0;
+    int i, j;
+
+    if (enc == NULL) {
+        fprintf(stderr, "mkcharmaps: no character set for map %s\n", t->name);
+        exit(1);
+    }
+    charset_to_ucs(enc, ucs);
+
+    memcpy(to_remote, t->to_remote_map, sizeof(to_remote));
+    memcpy(to_local, t->to_local_map, sizeof(to_local));
+    if (strcmp(t->name, "870") == 0) {
+        apply_fix(to_remote, to_local, tn5250_transfix_870,
+                  TN5250_TRANSFIX_COUNT(tn5250_transfix_870));
+    }
+    else if (strcmp(t->name, "win870") == 0) {
+        apply_fix(to_remote, to_local, tn5250_transfix_win870,
+                  TN5250_TRANSFIX_COUNT(tn5250_transfix_win870));
+    }
+
+    printf("/* Map %s (%s) */\n\n", t->name, enc);
+    print_table("charmap", t->name, "to_remote", to_remote);
+    print_table("charmap", t->name, "to_local", to_local);
+    printf("static const unsigned char utf8map_%s_out[256][4] = {\n",
+           t->name);
+    for (i = 0; i < 256; i++) {
+        unsigned long u = ucs[to_local[i]];
+        /* NUL and DUP are shown as in tn5250_char_map_to_local. */
+        if (i == 0x00) {
+            u = ' ';
+        }
+        else if (i == 0x1c) {
+            u = '*';
+        }
+        printf("    ");
+        print_utf8(u == UCS_NONE ? UCS_REPLACEMENT : u);
+        printf(i == 255 ? "};\n\n" : ",\n");
+    }
+
+    /* The first local character wins if two share a code point. */
+    for (i = 0; i < 256; i++) {
+        if (ucs[i] == UCS_NONE) {
+            continue;
+        }
+        for (j = 0; j < n; j++) {
+            if (keys[j] == ucs[i]) {
+                break;
+            }
+        }
+        if (j == n) {
+            keys[n] = ucs[i];
+            values[n] = to_remote[i];
+            n++;
+        }
+    }
+
+    for (*bits = HASH_MIN_BITS; *bits <= HASH_MAX_BITS; (*bits)++) {
+        if (find_hash(keys, n, *bits, mult, slots)) {
+            break;
+        }
+    }
+    if (*bits > HASH_MAX_BITS) {
+        fprintf(stderr, "mkcharmaps: no perfect hash for map %s\n", t->name);
+        exit(1);
+    }
+
+    printf("static const Tn5250Uint16 utf8map_%s_keys[%d] = {\n", t->name,
+           1 << *bits);
+    for (i = 0; i < (1 << *bits); i++) {
+        printf("%s0x%04lx%s", i % 8 == 0 ? "    " : " ",
+               slots[i] == HASH_EMPTY ? (unsigned long)HASH_EMPTY
+                                      : keys[slots[i]],
+               i == (1 << *bits) - 1 ? "};\n\n" : (i % 8 == 7 ? ",\n" : ","));
+    }
+    printf("static const unsigned char utf8map_%s_values[%d] = {\n", t->name,
+           1 << *bits);
+    for (i = 0; i < (1 << *bits); i++) {
+        printf("%s0x%02x%s", i % 8 == 0 ? "    " : " ",
+               slots[i] == HASH_EMPTY ? 0 : values[slots[i]],
+               i == (1 << *bits) - 1 ? "};\n\n" : (i % 8 == 7 ? ",\n" : ","));
+    }
+}
+
+int main(void) {
+    const Tn5250CharMap* t;
+    unsigned long mult[NAME_NONE];
+    int bits[NAME_NONE];
+    unsigned char slots[1 << NAME_MAX_BITS];
+    unsigned long seed;
+    int name_bits;
+    int n = 0;
+    int i;
+
+    printf("/* charmaps.h was automagically generated by mkcharmaps from "
+           "transmaps.h.\n"
+           "   Any changes should be made in transmaps, transfix.h or "
+           "mkcharmaps.c and\n"
+           "   NOT in this file!  Run \"make charmaps\" in lib5250 to "
+           "regenerate it.\n */\n\n");
+
+    for (t = tn5250_transmaps; t->name; t++, n++) {
+        if (n == NAME_NONE) {
+            fprintf(stderr, "mkcharmaps: too many maps\n");
+            return 1;
+        }
+        print_map(t, &mult[n], &bits[n]);
+    }
+
+    printf("/* This is the translation-map index which is looked up in "
+           "utility.c\n */\n\n");
+    printf("const Tn5250CharMap tn5250_transmaps[] = {\n");
+    for (t = tn5250_transmaps; t->name; t++) {
+        printf("    {\"%s\", charmap_%s_to_remote, charmap_%s_to_local},\n",
+               t->name, t->name, t->name);
+    }
+    printf("    {NULL, NULL, NULL}};\n\n");
+
+    /* Same order as tn5250_transmaps, so the index of a map in one is the
+     * index of its UTF-8 tables in the other. */
+    printf("static const Tn5250Utf8Map tn5250_utf8maps[] = {\n");
+    i = 0;
+    for (t = tn5250_transmaps; t->name; t++, i++) {
+        printf("    {utf8map_%s_out, utf8map_%s_keys, utf8map_%s_values, "
+               "0x%08lxUL, %d},\n",
+               t->name, t->name, t->name, mult[i], 32 - bits[i]);
+    }
+    printf("    {NULL, NULL, NULL, 0, 0}};\n\n");
+
+    for (name_bits = NAME_MIN_BITS; name_bits <= NAME_MAX_BITS; name_bits++) {
+        if (find_name_hash(tn5250_transmaps, n, name_bits, &seed, slots)) {
+            break;
+        }
+    }
+    if (name_bits > NAME_MAX_BITS) {
+        fprintf(stderr, "mkcharmaps: no perfect hash for the map names\n");
+        return 1;
+    }
+
+    printf("/* Perfect hash over the map names: slot to tn5250_transmaps "
+           "index. */\n\n");
+    printf("#define TN5250_CHARMAP_HASH_SEED 0x%08lxUL\n", seed);
+    printf("#define TN5250_CHARMAP_HASH_BITS %d\n", name_bits);
+    printf("#define TN5250_CHARMAP_NONE      0x%02x\n\n", NAME_NONE);
+    printf("static const unsigned char tn5250_charmap_slots[%d] = {\n",
+           1 << name_bits);
+    for (i = 0; i < (1 << name_bits); i++) {
+        printf("%s0x%02x%s", i % 8 == 0 ? "    " : " ", slots[i],
+               i == (1 << name_bits) - 1 ? "};\n"
+                                         : (i % 8 == 7 ? ",\n" : ","));
+    }
+    return 0;
+}
@@ -215,23 +215,30 @@ void tn5250_print_session_set_output_command(Tn5250PrintSession* This,
  * DESCRIPTION
  *    Retrieves the response code from the startup response record.  The
  *    function returns 1 for a successful startup, and 0 otherwise.  On return,
- *    code contains the 5 character response code.
+ *    code contains the 5 character response code, or is empty if the record
+ *    is too short to hold one.
  *****/
 int tn5250_print_session_get_response_code(Tn5250PrintSession* This,
                                            char* code) {
 
-    /* Offset of first byte of data after record variable-length header. */
-    int o = 6 + tn5250_record_data(This->rec)[6];
+    unsigned char* data = tn5250_record_data(This->rec);
+    int len = tn5250_record_length(This->rec);
+    int o;
     int i;
 
-    for (i = 0; i < 4; i++) {
-        if (This->map == NULL) {
-            code[i] = tn5250_record_data(This->rec)[o + i + 5];
-        }
-        else {
-            code[i] = tn5250_char_map_to_local(
-                This->map, tn5250_record_data(This->rec)[o + i + 5]);
-        }
+    /* Offset of first byte of data after record variable-length header. */
+    if (len < 7 || len < 6 + data[6] + 9) {
+        code[0] = '\0';
+        return 0;
+    }
+    o = 6 + data[6];
+
+    if (This->map == NULL) {
+        memcpy(code, data + o + 5, 4);
+    }
+    else {
+        tn5250_char_map_to_local_n(This->map, (unsigned char*)code,
+                                   data + o + 5, 4);
     }
 
     code[4] = '\0';
@@ -43,7 +43,7 @@ struct _Tn5250PrintSession {
     Tn5250Record /*@owned@*/* rec;
     int conn_fd;
     FILE /*@null@*/* printfile;
-    Tn5250CharMap* map;
+    const Tn5250CharMap* map;
     char /*@null@*/* output_cmd;
     void* script_slot;
 };
@@ -0,0 +1,742 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#include "tn5250-private.h"
+#include <time.h>
+
+#if defined(HAVE_ZLIB_H) && defined(HAVE_LIBZ)
+#include <zlib.h>
+#define RECORDER_DEFLATE 1
+#endif
+
+#if !defined(WIN32) && defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+#define RECORDER_THREADS 1
+#endif
+
+#ifdef O_BINARY
+#define RECORDER_O_BINARY O_BINARY
+#else
+#define RECORDER_O_BINARY 0
+#endif
+
+#define RECORDER_MAGIC       "TN5250RC"
+#define RECORDER_VERSION     1
+#define RECORDER_HEADER_SIZE 14 /* Size of a frame header */
+
+/* A frame waiting for the writer. */
+struct _Tn5250RecorderEntry {
+    Tn5250Snapshot* snapshot;
+    unsigned long msec;
+    unsigned long indicators;
+    int gap;
+};
+
+typedef struct _Tn5250RecorderEntry Tn5250RecorderEntry;
+
+struct _Tn5250RecorderPrivate {
+    FILE* file;
+    unsigned long start;
+
+    /* Capture side: the last frame queued, so that an update which drew
+     * nothing new is not recorded twice. */
+    Tn5250Snapshot* last_queued;
+    unsigned long last_indicators;
+    unsigned long last_msec;
+
+    Tn5250RecorderEntry queue[TN5250_RECORDER_QUEUE_SIZE];
+    int queue_head;
+    int queue_count;
+    int keyframe; /* Next frame written is a keyframe */
+
+    /* Writer side: the frame last written, which deltas are taken
+     * against. */
+    Tn5250Snapshot* last_written;
+    unsigned long last_keyframe;
+    unsigned char* raw;
+    unsigned long raw_alloc;
+    unsigned char* out;
+    unsigned long out_alloc;
+    int error;
+
+#ifdef RECORDER_THREADS
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    int stop;
+#endif
+};
+
+typedef struct _Tn5250RecorderPrivate Tn5250RecorderPrivate;
+
+#ifdef RECORDER_THREADS
+#define recorder_lock(p)   pthread_mutex_lock(&(p)->lock)
+#define recorder_unlock(p) pthread_mutex_unlock(&(p)->lock)
+#else
+#define recorder_lock(p)   (void)0
+#define recorder_unlock(p) (void)0
+#endif
+
+static void recorder_put16(unsigned char* p, unsigned long v);
+static void recorder_put32(unsigned char* p, unsigned long v);
+static unsigned long recorder_get16(const unsigned char* p);
+static unsigned long recorder_get32(const unsigned char* p);
+static int recorder_grow(unsigned char** buf, unsigned long* alloc,
+                         unsigned long size);
+static void recorder_write(Tn5250Recorder* This, Tn5250RecorderEntry* entry,
+                           int keyframe);
+static void recorder_drain(Tn5250Recorder* This);
+#ifdef RECORDER_THREADS
+static void* recorder_thread(void* arg);
+#endif
+static int player_load(Tn5250Player* This, int n);
+
+/****f* lib5250/tn5250_recorder_new
+ * NAME
+ *    tn5250_recorder_new
+ * SYNOPSIS
+ *    rec = tn5250_recorder_new ("session.rec", "37");
+ * INPUTS
+ *    const char *         filename   - File to record to.
+ *    const char *         map_name   - Name of the session's character
+ *                                      map, saved for the player.
+ * DESCRIPTION
+ *    Create the file and start the writer.  Returns NULL if the file
+ *    could not be created.
+ *****/
+Tn5250Recorder* tn5250_recorder_new(const char* filename,
+                                    const char* map_name) {
+    Tn5250Recorder* This;
+    Tn5250RecorderPrivate* p;
+    unsigned char header[16];
+    size_t len = strlen(map_name);
+    int fd;
+
+    if (len > 255) {
+        len = 255;
+    }
+
+    This = tn5250_new(Tn5250Recorder, 1);
+    p = tn5250_new(Tn5250RecorderPrivate, 1);
+    if (This == NULL || p == NULL) {
+        free(This);
+        free(p);
+        return NULL;
+    }
+    memset(p, 0, sizeof(Tn5250RecorderPrivate));
+    This->data = p;
+    This->keyframe_interval = TN5250_RECORDER_KEYFRAME_INTERVAL;
+    This->frames = 0;
+    This->dropped = 0;
+    This->written = 0;
+    This->keyframes = 0;
+    This->bytes = 0;
+
+    /* A recording can hold anything typed on screen, so only the user
+     * may read it. */
+    fd = open(filename, O_CREAT | O_TRUNC | O_WRONLY | RECORDER_O_BINARY, 0600);
+    if (fd < 0 || (p->file = fdopen(fd, "wb")) == NULL) {
+        TN5250_LOG(("Recorder: can't create %s: %s\n", filename,
+                    strerror(errno)));
+        if (fd >= 0) {
+            close(fd);
+        }
+        free(p);
+        free(This);
+        return NULL;
+    }
+
+    memcpy(header, RECORDER_MAGIC, 8);
+    recorder_put16(header + 8, RECORDER_VERSION);
+    recorder_put32(header + 10, (unsigned long)time(NULL));
+    header[14] = (unsigned char)len;
+    fwrite(header, 1, 15, p->file);
+    fwrite(map_name, 1, len, p->file);
+    This->bytes = 15 + len;
+
+    p->start = tn5250_msec_now();
+    p->keyframe = 1;
+
+#ifdef RECORDER_THREADS
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+    if (pthread_create(&p->thread, NULL, recorder_thread, This) != 0) {
+        TN5250_LOG(("Recorder: no writer thread, writing synchronously\n"));
+        p->stop = -1;
+    }
+#endif
+    return This;
+}
+
+/****f* lib5250/tn5250_recorder_destroy
+ * NAME
+ *    tn5250_recorder_destroy
+ * SYNOPSIS
+ *    tn5250_recorder_destroy (This);
+ * INPUTS
+ *    Tn5250Recorder *     This       -
+ * DESCRIPTION
+ *    Write out the frames still queued, close the file and free the
+ *    recorder.
+ *****/
+void tn5250_recorder_destroy(Tn5250Recorder* This) {
+    Tn5250RecorderPrivate* p = This->data;
+
+#ifdef RECORDER_THREADS
+    if (p->stop == 0) {
+        recorder_lock(p);
+        p->stop = 1;
+        pthread_cond_signal(&p->wake);
+        recorder_unlock(p);
+        pthread_join(p->thread, NULL);
+    }
+    else {
+        recorder_drain(This);
+    }
+    pthread_cond_destroy(&p->wake);
+    pthread_mutex_destroy(&p->lock);
+#else
+    recorder_drain(This);
+#endif
+
+    fclose(p->file);
+    if (p->last_queued != NULL) {
+        tn5250_snapshot_unref(p->last_queued);
+    }
+    if (p->last_written != NULL) {
+        tn5250_snapshot_unref(p->last_written);
+    }
+    free(p->raw);
+    free(p->out);
+    free(p);
+    free(This);
+}
+
+/****f* lib5250/tn5250_recorder_frame
+ * NAME
+ *    tn5250_recorder_frame
+ * SYNOPSIS
+ *    tn5250_recorder_frame (This, display);
+ * INPUTS
+ *    Tn5250Recorder *     This       -
+ *    Tn5250Display *      display    - Display which has just been drawn.
+ * DESCRIPTION
+ *    Record the display as it now stands.  This takes a snapshot and
+ *    queues it; the writer thread does the rest.  If the queue is full
+ *    this frame takes the place of the newest one queued, which is lost,
+ *    and is written as a keyframe.
+ *****/
+void tn5250_recorder_frame(Tn5250Recorder* This, Tn5250Display* display) {
+    Tn5250RecorderPrivate* p = This->data;
+    Tn5250RecorderEntry* entry;
+    Tn5250Snapshot* snap;
+    Tn5250Snapshot* old = NULL;
+    unsigned long indicators = (unsigned long)display->indicators;
+    long msec;
+
+    snap = tn5250_snapshot_new(display->display_buffers);
+    if (snap == p->last_queued && indicators == p->last_indicators) {
+        tn5250_snapshot_unref(snap);
+        return;
+    }
+    if (p->last_queued != NULL) {
+        tn5250_snapshot_unref(p->last_queued);
+    }
+    p->last_queued = tn5250_snapshot_ref(snap);
+    p->last_indicators = indicators;
+
+    /* Times must not go backwards, whatever the clock does. */
+    msec = tn5250_msec_since(p->start);
+    if (msec < 0 || (unsigned long)msec < p->last_msec) {
+        msec = (long)p->last_msec;
+    }
+    p->last_msec = (unsigned long)msec;
+    This->frames++;
+
+    recorder_lock(p);
+    if (p->queue_count == TN5250_RECORDER_QUEUE_SIZE) {
+        /* The writer is behind.  Replace the newest frame queued rather
+         * than dropping this one, so that the screen as it is left is
+         * always recorded. */
+        entry = &p->queue[(p->queue_head + p->queue_count - 1) %
+                          TN5250_RECORDER_QUEUE_SIZE];
+        old = entry->snapshot;
+        entry->gap = 1;
+        This->dropped++;
+    }
+    else {
+        entry = &p->queue[(p->queue_head + p->queue_count) %
+                          TN5250_RECORDER_QUEUE_SIZE];
+        entry->gap = 0;
+        p->queue_count++;
+    }
+    entry->snapshot = snap;
+    entry->msec = (unsigned long)msec;
+    entry->indicators = indicators;
+#ifdef RECORDER_THREADS
+    pthread_cond_signal(&p->wake);
+#endif
+    recorder_unlock(p);
+
+    if (old != NULL) {
+        tn5250_snapshot_unref(old);
+    }
+#ifdef RECORDER_THREADS
+    if (p->stop == 0) {
+        return;
+    }
+#endif
+    recorder_drain(This);
+}
+
+/****f* lib5250/tn5250_recorder_keyframe
+ * NAME
+ *    tn5250_recorder_keyframe
+ * SYNOPSIS
+ *    tn5250_recorder_keyframe (This);
+ * INPUTS
+ *    Tn5250Recorder *     This       -
+ * DESCRIPTION
+ *    Write the next frame as a keyframe, whenever the last one was.
+ *****/
+void tn5250_recorder_keyframe(Tn5250Recorder* This) {
+    recorder_lock(This->data);
+    This->data->keyframe = 1;
+    recorder_unlock(This->data);
+}
+
+/*
+ *    Store a big endian number.
+ */
+static void recorder_put16(unsigned char* p, unsigned long v) {
+    p[0] = (unsigned char)(v >> 8);
+    p[1] = (unsigned char)v;
+}
+
+static void recorder_put32(unsigned char* p, unsigned long v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+/*
+ *    Fetch a big endian number.
+ */
+static unsigned long recorder_get16(const unsigned char* p) {
+    return ((unsigned long)p[0] << 8) | p[1];
+}
+
+static unsigned long recorder_get32(const unsigned char* p) {
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) |
+           ((unsigned long)p[2] << 8) | p[3];
+}
+
+/*
+ *    Make sure a buffer can hold size bytes.
+ */
+static int recorder_grow(unsigned char** buf, unsigned long* alloc,
+                         unsigned long size) {
+    unsigned char* n;
+
+    if (size <= *alloc) {
+        return 0;
+    }
+    if ((n = (unsigned char*)realloc(*buf, size)) == NULL) {
+        return -1;
+    }
+    *buf = n;
+    *alloc = size;
+    return 0;
+}
+
+/*
+ *    Write the queued frames, taking the lock only to take each one off
+ *    the queue and to count what was written.
+ */
+static void recorder_drain(Tn5250Recorder* This) {
+    Tn5250RecorderPrivate* p = This->data;
+    Tn5250RecorderEntry entry;
+    int keyframe;
+
+    recorder_lock(p);
+    while (p->queue_count > 0) {
+        entry = p->queue[p->queue_head];
+        p->queue_head = (p->queue_head + 1) % TN5250_RECORDER_QUEUE_SIZE;
+        p->queue_count--;
+        keyframe = p->keyframe || entry.gap;
+        p->keyframe = 0;
+        recorder_unlock(p);
+
+        recorder_write(This, &entry, keyframe);
+
+        recorder_lock(p);
+    }
+    recorder_unlock(p);
+    fflush(p->file);
+}
+
+#ifdef RECORDER_THREADS
+/*
+ *    The writer thread.
+ */
+static void* recorder_thread(void* arg) {
+    Tn5250Recorder* This = (Tn5250Recorder*)arg;
+    Tn5250RecorderPrivate* p = This->data;
+
+    recorder_lock(p);
+    for (;;) {
+        while (p->queue_count == 0 && !p->stop) {
+            pthread_cond_wait(&p->wake, &p->lock);
+        }
+        if (p->queue_count == 0) {
+            break;
+        }
+        recorder_unlock(p);
+        recorder_drain(This);
+        recorder_lock(p);
+    }
+    recorder_unlock(p);
+    return NULL;
+}
+#endif
+
+/*
+ *    Write one frame: every row for a keyframe, otherwise the rows which
+ *    differ from the frame last written.
+ */
+static void recorder_write(Tn5250Recorder* This, Tn5250RecorderEntry* entry,
+                           int keyframe) {
+    Tn5250RecorderPrivate* p = This->data;
+    Tn5250Snapshot* snap = entry->snapshot;
+    Tn5250Snapshot* last = p->last_written;
+    unsigned char header[RECORDER_HEADER_SIZE];
+    unsigned char flags = entry->gap ? TN5250_RECORDER_FLAG_GAP : 0;
+    unsigned char* data;
+    unsigned long raw_len, stored_len;
+
+    if (last == NULL || last->w != snap->w || last->h != snap->h ||
+        entry->msec - p->last_keyframe >=
+            (unsigned long)This->keyframe_interval) {
+        keyframe = 1;
+    }
+    raw_len = 0;
+    if (!p->error) {
+        raw_len = tn5250_snapshot_encode(snap, keyframe ? NULL : last,
+                                         entry->indicators, &p->raw,
+                                         &p->raw_alloc);
+    }
+    if (raw_len == 0) {
+        p->error = 1;
+        tn5250_snapshot_unref(snap);
+        return;
+    }
+
+    data = p->raw;
+    stored_len = raw_len;
+#ifdef RECORDER_DEFLATE
+    {
+        uLongf len = compressBound(raw_len);
+
+        if (recorder_grow(&p->out, &p->out_alloc, len) == 0 &&
+            compress2(p->out, &len, p->raw, raw_len, Z_BEST_SPEED) == Z_OK &&
+            len < raw_len) {
+            data = p->out;
+            stored_len = len;
+            flags |= TN5250_RECORDER_FLAG_DEFLATED;
+        }
+    }
+#endif
+
+    header[0] = keyframe ? TN5250_RECORDER_FRAME_KEY
+                         : TN5250_RECORDER_FRAME_DELTA;
+    header[1] = flags;
+    recorder_put32(header + 2, entry->msec);
+    recorder_put32(header + 6, stored_len);
+    recorder_put32(header + 10, raw_len);
+    if (fwrite(header, 1, RECORDER_HEADER_SIZE, p->file) !=
+            RECORDER_HEADER_SIZE ||
+        fwrite(data, 1, stored_len, p->file) != stored_len) {
+        TN5250_LOG(("Recorder: write failed: %s\n", strerror(errno)));
+        p->error = 1;
+    }
+
+    if (last != NULL) {
+        tn5250_snapshot_unref(last);
+    }
+    p->last_written = snap;
+    if (keyframe) {
+        p->last_keyframe = entry->msec;
+    }
+
+    recorder_lock(p);
+    This->written++;
+    if (keyframe) {
+        This->keyframes++;
+    }
+    This->bytes += RECORDER_HEADER_SIZE + stored_len;
+    recorder_unlock(p);
+}
+
+/****f* lib5250/tn5250_player_open
+ * NAME
+ *    tn5250_player_open
+ * SYNOPSIS
+ *    player = tn5250_player_open ("session.rec");
+ * INPUTS
+ *    const char *         filename   - Recording to play.
+ * DESCRIPTION
+ *    Open a recording and index its frames.  Nothing is on screen until
+ *    tn5250_player_next or tn5250_player_seek is called.  A recording
+ *    which stops part way through a frame, because the session that made
+ *    it was killed, plays up to the last whole frame.  Returns NULL if
+ *    the file can't be read or isn't a recording.
+ *****/
+Tn5250Player* tn5250_player_open(const char* filename) {
+    Tn5250Player* This;
+    unsigned char header[RECORDER_HEADER_SIZE + 1];
+    Tn5250PlayerFrame* index;
+    int alloc = 0;
+    long offset, size;
+    unsigned long len;
+
+    This = tn5250_new(Tn5250Player, 1);
+    if (This == NULL) {
+        return NULL;
+    }
+    memset(This, 0, sizeof(Tn5250Player));
+
+    if ((This->file = fopen(filename, "rb")) == NULL) {
+        free(This);
+        return NULL;
+    }
+    if (fread(header, 1, 15, This->file) != 15 ||
+        memcmp(header, RECORDER_MAGIC, 8) != 0 ||
+        recorder_get16(header + 8) != RECORDER_VERSION ||
+        fread(This->map_name, 1, header[14], This->file) != header[14]) {
+        TN5250_LOG(("Player: %s is not a recording\n", filename));
+        tn5250_player_close(This);
+        return NULL;
+    }
+    This->start_time = recorder_get32(header + 10);
+    This->map_name[header[14]] = '\0';
+    This->map = tn5250_char_map_new(This->map_name);
+
+    offset = 15 + header[14];
+    fseek(This->file, 0, SEEK_END);
+    size = ftell(This->file);
+    fseek(This->file, offset, SEEK_SET);
+    while (fread(header, 1, RECORDER_HEADER_SIZE, This->file) ==
+           RECORDER_HEADER_SIZE) {
+        len = recorder_get32(header + 6);
+        if (size - offset - RECORDER_HEADER_SIZE < (long)len) {
+            break; /* Cut short */
+        }
+        if (This->frame_count == alloc) {
+            alloc = alloc == 0 ? 256 : alloc * 2;
+            index = (Tn5250PlayerFrame*)realloc(
+                This->index, alloc * sizeof(Tn5250PlayerFrame));
+            TN5250_ASSERT(index != NULL);
+            This->index = index;
+        }
+        index = &This->index[This->frame_count++];
+        index->offset = offset;
+        index->type = header[0];
+        index->flags = header[1];
+        index->msec = recorder_get32(header + 2);
+
+        offset += RECORDER_HEADER_SIZE + (long)len;
+        fseek(This->file, offset, SEEK_SET);
+    }
+
+    This->dbuffer = tn5250_dbuffer_new(80, 24);
+    TN5250_ASSERT(This->dbuffer != NULL);
+    return This;
+}
+
+/****f* lib5250/tn5250_player_close
+ * NAME
+ *    tn5250_player_close
+ * SYNOPSIS
+ *    tn5250_player_close (This);
+ * INPUTS
+ *    Tn5250Player *       This       -
+ * DESCRIPTION
+ *    Close the recording and free the player and its display buffer.
+ *****/
+void tn5250_player_close(Tn5250Player* This) {
+    if (This->file != NULL) {
+        fclose(This->file);
+    }
+    if (This->dbuffer != NULL) {
+        tn5250_dbuffer_destroy(This->dbuffer);
+    }
+    if (This->map != NULL) {
+        tn5250_char_map_destroy(This->map);
+    }
+    free(This->index);
+    free(This->buf);
+    free(This->raw);
+    free(This);
+}
+
+/****f* lib5250/tn5250_player_next
+ * NAME
+ *    tn5250_player_next
+ * SYNOPSIS
+ *    while (tn5250_player_next (This) > 0) ...
+ * INPUTS
+ *    Tn5250Player *       This       -
+ * DESCRIPTION
+ *    Put the next frame on screen.  Returns 1 if there was one, 0 at the
+ *    end of the recording, and -1 if it couldn't be read.
+ *****/
+int tn5250_player_next(Tn5250Player* This) {
+    if (This->position >= This->frame_count) {
+        return 0;
+    }
+    if (player_load(This, This->position) < 0) {
+        return -1;
+    }
+    This->position++;
+    return 1;
+}
+
+/****f* lib5250/tn5250_player_seek
+ * NAME
+ *    tn5250_player_seek
+ * SYNOPSIS
+ *    tn5250_player_seek (This, msec);
+ * INPUTS
+ *    Tn5250Player *       This       -
+ *    unsigned long        msec       - Time since the start of the
+ *                                      recording.
+ * DESCRIPTION
+ *    Put on screen what was on screen ``msec'' milliseconds into the
+ *    recording (the first frame, if that is earlier than the first
+ *    frame).  Frames are played from the keyframe before that time, or
+ *    from the frame on screen if that is nearer.  Returns 0, or -1 if a
+ *    frame couldn't be read.
+ *****/
+int tn5250_player_seek(Tn5250Player* This, unsigned long msec) {
+    int lo = 0, hi = This->frame_count - 1, mid, target, key;
+
+    if (This->frame_count == 0) {
+        return 0;
+    }
+
+    /* The last frame at or before msec. */
+    target = 0;
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        if (This->index[mid].msec <= msec) {
+            target = mid;
+            lo = mid + 1;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+
+    for (key = target; key > 0; key--) {
+        if (This->index[key].type == TN5250_RECORDER_FRAME_KEY) {
+            break;
+        }
+    }
+    if (This->position <= key || This->position > target + 1) {
+        This->position = key;
+    }
+    while (This->position <= target) {
+        if (tn5250_player_next(This) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/****f* lib5250/tn5250_player_duration
+ * NAME
+ *    tn5250_player_duration
+ * SYNOPSIS
+ *    msec = tn5250_player_duration (This);
+ * INPUTS
+ *    Tn5250Player *       This       -
+ * DESCRIPTION
+ *    Time of the last frame, in milliseconds from the start.
+ *****/
+unsigned long tn5250_player_duration(Tn5250Player* This) {
+    if (This->frame_count == 0) {
+        return 0;
+    }
+    return This->index[This->frame_count - 1].msec;
+}
+
+/*
+ *    Read frame n and apply it to the display buffer.
+ */
+static int player_load(Tn5250Player* This, int n) {
+    Tn5250PlayerFrame* frame = &This->index[n];
+    unsigned char header[RECORDER_HEADER_SIZE];
+    unsigned long stored_len, raw_len;
+    unsigned char* raw;
+
+    if (fseek(This->file, frame->offset, SEEK_SET) != 0 ||
+        fread(header, 1, RECORDER_HEADER_SIZE, This->file) !=
+            RECORDER_HEADER_SIZE) {
+        return -1;
+    }
+    stored_len = recorder_get32(header + 6);
+    raw_len = recorder_get32(header + 10);
+    if (raw_len < TN5250_SNAPSHOT_HEADER_SIZE ||
+        recorder_grow(&This->buf, &This->buf_alloc, stored_len) < 0 ||
+        fread(This->buf, 1, stored_len, This->file) != stored_len) {
+        return -1;
+    }
+
+    raw = This->buf;
+    if ((frame->flags & TN5250_RECORDER_FLAG_DEFLATED) != 0) {
+#ifdef RECORDER_DEFLATE
+        uLongf len = raw_len;
+
+        if (recorder_grow(&This->raw, &This->raw_alloc, raw_len) < 0 ||
+            uncompress(This->raw, &len, This->buf, stored_len) != Z_OK ||
+            len != raw_len) {
+            return -1;
+        }
+        raw = This->raw;
+#else
+        TN5250_LOG(("Player: compressed frame, and no zlib\n"));
+        return -1;
+#endif
+    }
+    else if (stored_len != raw_len) {
+        return -1;
+    }
+
+    if (tn5250_snapshot_decode(This->dbuffer, raw, raw_len,
+                               &This->indicators) < 0) {
+        return -1;
+    }
+
+    This->msec = frame->msec;
+    This->flags = frame->flags;
+    return 0;
+}
@@ -0,0 +1,172 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Frames the writer may fall behind by before we start dropping them. */
+#define TN5250_RECORDER_QUEUE_SIZE 64
+
+/* Default time between keyframes, in milliseconds. */
+#define TN5250_RECORDER_KEYFRAME_INTERVAL 10000
+
+/* Frame types and flags as they appear in the file. */
+#define TN5250_RECORDER_FRAME_KEY     'K'
+#define TN5250_RECORDER_FRAME_DELTA   'D'
+#define TN5250_RECORDER_FLAG_DEFLATED 0x01
+#define TN5250_RECORDER_FLAG_GAP      0x02
+
+struct _Tn5250DBuffer;
+struct _Tn5250Display;
+struct _Tn5250Snapshot;
+struct _Tn5250CharMap;
+struct _Tn5250RecorderPrivate;
+
+/****s* lib5250/Tn5250Recorder
+ * NAME
+ *    Tn5250Recorder
+ * SYNOPSIS
+ *    Tn5250Recorder *rec = tn5250_recorder_new ("session.rec", "37");
+ *    tn5250_recorder_frame (rec, display);
+ *    tn5250_recorder_destroy (rec);
+ * DESCRIPTION
+ *    Records what the display looked like each time it was drawn, so
+ *    that a session can be played back later.  Capturing a frame takes a
+ *    snapshot of the display buffer, which shares the rows that have not
+ *    changed, and puts it on a queue; a writer thread works out which
+ *    rows changed, compresses them with zlib and writes them out.  A
+ *    keyframe with every row is written every keyframe_interval
+ *    milliseconds so that the player can seek.  If the writer falls more
+ *    than TN5250_RECORDER_QUEUE_SIZE frames behind, frames are dropped,
+ *    and the frame after a gap is written as a keyframe marked as such.
+ *
+ *    The file starts with the eight bytes "TN5250RC", a two byte
+ *    version, the session start time as four bytes of seconds since
+ *    the epoch, and the character map name as a length byte and the
+ *    name.  Each frame is then a type byte ('K' or 'D'), a flags byte,
+ *    the milliseconds since the start, the stored and unpacked lengths
+ *    of its data, and the data.  Unpacked, the data is the screen
+ *    height, width, cursor row and column, the indicators, the number
+ *    of rows which follow, and each row as its number and its contents.
+ *    Numbers are big endian; lengths, times and indicators are four
+ *    bytes and the rest two.
+ * SOURCE
+ */
+struct _Tn5250Recorder {
+    struct _Tn5250RecorderPrivate* data;
+    long keyframe_interval;
+    unsigned long frames;   /* Frames captured */
+    unsigned long dropped;  /* Frames dropped because the queue was full */
+    unsigned long written;  /* Frames written */
+    unsigned long keyframes;
+    unsigned long bytes;    /* Bytes written to the file */
+};
+
+typedef struct _Tn5250Recorder Tn5250Recorder;
+/*******/
+
+/****s* lib5250/Tn5250Player
+ * NAME
+ *    Tn5250Player
+ * SYNOPSIS
+ *    Tn5250Player *p = tn5250_player_open ("session.rec");
+ *    tn5250_player_seek (p, 60000);
+ *    while (tn5250_player_next (p) > 0)
+ *       show (tn5250_player_dbuffer (p), tn5250_player_time (p));
+ *    tn5250_player_close (p);
+ * DESCRIPTION
+ *    Plays back a file written by Tn5250Recorder.  The frames are loaded
+ *    into a display buffer, so the usual text, UTF-8 and search
+ *    functions work on the screen being played back.  The frames are
+ *    indexed when the file is opened, so seeking decodes only the frames
+ *    from the keyframe before the time asked for.
+ * SOURCE
+ */
+struct _Tn5250PlayerFrame {
+    long offset;
+    unsigned long msec;
+    unsigned char type;
+    unsigned char flags;
+};
+
+typedef struct _Tn5250PlayerFrame Tn5250PlayerFrame;
+
+struct _Tn5250Player {
+    FILE* file;
+    struct _Tn5250DBuffer* dbuffer;
+    const struct _Tn5250CharMap* map;
+    char map_name[256];
+    unsigned long start_time;
+
+    Tn5250PlayerFrame* index;
+    int frame_count;
+    int position; /* Index of the next frame to play */
+
+    unsigned long msec; /* Time of the frame on screen */
+    unsigned long indicators;
+    unsigned char flags;
+    unsigned char* buf;
+    unsigned char* raw;
+    unsigned long buf_alloc, raw_alloc;
+};
+
+typedef struct _Tn5250Player Tn5250Player;
+/*******/
+
+extern Tn5250Recorder* tn5250_recorder_new(const char* filename,
+                                           const char* map_name);
+extern void tn5250_recorder_destroy(Tn5250Recorder* This);
+extern void tn5250_recorder_frame(Tn5250Recorder* This,
+                                  struct _Tn5250Display* display);
+extern void tn5250_recorder_keyframe(Tn5250Recorder* This);
+
+#define tn5250_recorder_set_keyframe_interval(This, msec)                      \
+    (void)((This)->keyframe_interval = (msec))
+#define tn5250_recorder_frames(This)    ((This)->frames)
+#define tn5250_recorder_dropped(This)   ((This)->dropped)
+#define tn5250_recorder_written(This)   ((This)->written)
+#define tn5250_recorder_keyframes(This) ((This)->keyframes)
+#define tn5250_recorder_bytes(This)     ((This)->bytes)
+
+extern Tn5250Player* tn5250_player_open(const char* filename);
+extern void tn5250_player_close(Tn5250Player* This);
+extern int tn5250_player_next(Tn5250Player* This);
+extern int tn5250_player_seek(Tn5250Player* This, unsigned long msec);
+extern unsigned long tn5250_player_duration(Tn5250Player* This);
+
+#define tn5250_player_dbuffer(This)     ((This)->dbuffer)
+#define tn5250_player_char_map(This)    ((This)->map)
+#define tn5250_player_time(This)        ((This)->msec)
+#define tn5250_player_indicators(This)  ((This)->indicators)
+#define tn5250_player_after_gap(This)                                          \
+    (((This)->flags & TN5250_RECORDER_FLAG_GAP) != 0)
+#define tn5250_player_start_time(This)  ((This)->start_time)
+#define tn5250_player_frame_count(This) ((This)->frame_count)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORDER_H */
@@ -0,0 +1,373 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#include "tn5250-private.h"
+
+#define TN5250_SCREEN_BUCKETS 64
+
+static void tn5250_screen_registry_reset(Tn5250ScreenRegistry* This,
+                                         Tn5250DBuffer* dbuffer);
+static unsigned long tn5250_screen_registry_masked_hash(
+    Tn5250ScreenRegistry* This, Tn5250DBuffer* dbuffer, int y);
+
+/****f* lib5250/tn5250_screen_registry_new
+ * NAME
+ *    tn5250_screen_registry_new
+ * SYNOPSIS
+ *    reg = tn5250_screen_registry_new ();
+ * INPUTS
+ *    None
+ * DESCRIPTION
+ *    Create a new, empty screen registry.
+ *****/
+Tn5250ScreenRegistry* tn5250_screen_registry_new(void) {
+    Tn5250ScreenRegistry* This = tn5250_new(Tn5250ScreenRegistry, 1);
+    int i;
+
+    if (This == NULL) {
+        return NULL;
+    }
+    This->buckets = tn5250_new(Tn5250Screen*, TN5250_SCREEN_BUCKETS);
+    if (This->buckets == NULL) {
+        free(This);
+        return NULL;
+    }
+    for (i = 0; i < TN5250_SCREEN_BUCKETS; i++) {
+        This->buckets[i] = NULL;
+    }
+    This->bucket_count = TN5250_SCREEN_BUCKETS;
+    This->screen_count = 0;
+
+    This->regions = NULL;
+    This->region_count = 0;
+
+    This->last_serial = 0;
+    This->last_generation = 0;
+    This->rows = This->cols = 0;
+    This->row_volatile = NULL;
+    This->masked_hash = NULL;
+    This->masked_generation = NULL;
+    This->fingerprint = 0;
+    This->current = NULL;
+
+    This->hits = 0;
+    This->misses = 0;
+    return This;
+}
+
+/****f* lib5250/tn5250_screen_registry_destroy
+ * NAME
+ *    tn5250_screen_registry_destroy
+ * SYNOPSIS
+ *    tn5250_screen_registry_destroy (This);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ * DESCRIPTION
+ *    Free the registry and all of its screen definitions.
+ *****/
+void tn5250_screen_registry_destroy(Tn5250ScreenRegistry* This) {
+    Tn5250Screen *iter, *next;
+    int i;
+
+    for (i = 0; i < This->bucket_count; i++) {
+        for (iter = This->buckets[i]; iter != NULL; iter = next) {
+            next = iter->next;
+            free(iter->name);
+            free(iter);
+        }
+    }
+    free(This->buckets);
+    free(This->regions);
+    free(This->row_volatile);
+    free(This->masked_hash);
+    free(This->masked_generation);
+    free(This);
+}
+
+/****f* lib5250/tn5250_screen_registry_add_volatile
+ * NAME
+ *    tn5250_screen_registry_add_volatile
+ * SYNOPSIS
+ *    tn5250_screen_registry_add_volatile (This, top, left, bottom, right);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    int                  top        - First row of the region.
+ *    int                  left       - First column of the region.
+ *    int                  bottom     - Last row of the region.
+ *    int                  right      - Last column of the region.
+ * DESCRIPTION
+ *    Leave the cells in the given rectangle out of every fingerprint.
+ *    Fingerprints depend on the volatile regions, so these should all be
+ *    added before any screens are defined.
+ *****/
+void tn5250_screen_registry_add_volatile(Tn5250ScreenRegistry* This, int top,
+                                         int left, int bottom, int right) {
+    Tn5250ScreenRegion* r;
+
+    This->regions = (Tn5250ScreenRegion*)realloc(
+        This->regions, (This->region_count + 1) * sizeof(Tn5250ScreenRegion));
+    TN5250_ASSERT(This->regions != NULL);
+
+    r = &This->regions[This->region_count++];
+    r->top = top;
+    r->left = left;
+    r->bottom = bottom;
+    r->right = right;
+
+    /* Work the row masks out again on the next lookup. */
+    This->last_serial = 0;
+}
+
+/****f* lib5250/tn5250_screen_registry_define
+ * NAME
+ *    tn5250_screen_registry_define
+ * SYNOPSIS
+ *    screen = tn5250_screen_registry_define (This, "signon", fingerprint);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    const char *         name       - Name of the screen.
+ *    unsigned long        fingerprint - Its fingerprint.
+ * DESCRIPTION
+ *    Add a screen definition to the registry.  If a screen with the same
+ *    fingerprint is already defined, it is renamed.  Returns the
+ *    definition.
+ *****/
+Tn5250Screen* tn5250_screen_registry_define(Tn5250ScreenRegistry* This,
+                                            const char* name,
+                                            unsigned long fingerprint) {
+    Tn5250Screen* screen = tn5250_screen_registry_find(This, fingerprint);
+    int bucket;
+
+    if (screen != NULL) {
+        free(screen->name);
+        screen->name = (char*)malloc(strlen(name) + 1);
+        TN5250_ASSERT(screen->name != NULL);
+        strcpy(screen->name, name);
+        return screen;
+    }
+
+    screen = tn5250_new(Tn5250Screen, 1);
+    TN5250_ASSERT(screen != NULL);
+    screen->name = (char*)malloc(strlen(name) + 1);
+    TN5250_ASSERT(screen->name != NULL);
+    strcpy(screen->name, name);
+    screen->fingerprint = fingerprint;
+    screen->matches = 0;
+
+    bucket = (int)(fingerprint & (This->bucket_count - 1));
+    screen->next = This->buckets[bucket];
+    This->buckets[bucket] = screen;
+    This->screen_count++;
+
+    /* The screen on display may be the one just defined. */
+    This->last_serial = 0;
+    return screen;
+}
+
+/****f* lib5250/tn5250_screen_registry_learn
+ * NAME
+ *    tn5250_screen_registry_learn
+ * SYNOPSIS
+ *    screen = tn5250_screen_registry_learn (This, "signon", dbuffer);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    const char *         name       - Name of the screen.
+ *    Tn5250DBuffer *      dbuffer    - Display buffer showing the screen.
+ * DESCRIPTION
+ *    Define the screen currently in ``dbuffer'' under the given name.
+ *****/
+Tn5250Screen* tn5250_screen_registry_learn(Tn5250ScreenRegistry* This,
+                                           const char* name,
+                                           Tn5250DBuffer* dbuffer) {
+    return tn5250_screen_registry_define(
+        This, name, tn5250_screen_registry_fingerprint(This, dbuffer));
+}
+
+/****f* lib5250/tn5250_screen_registry_find
+ * NAME
+ *    tn5250_screen_registry_find
+ * SYNOPSIS
+ *    screen = tn5250_screen_registry_find (This, fingerprint);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    unsigned long        fingerprint - Fingerprint to look up.
+ * DESCRIPTION
+ *    Return the screen definition with the given fingerprint, or NULL.
+ *****/
+Tn5250Screen* tn5250_screen_registry_find(Tn5250ScreenRegistry* This,
+                                          unsigned long fingerprint) {
+    Tn5250Screen* iter;
+
+    iter = This->buckets[fingerprint & (This->bucket_count - 1)];
+    for (; iter != NULL; iter = iter->next) {
+        if (iter->fingerprint == fingerprint) {
+            return iter;
+        }
+    }
+    return NULL;
+}
+
+/****f* lib5250/tn5250_screen_registry_fingerprint
+ * NAME
+ *    tn5250_screen_registry_fingerprint
+ * SYNOPSIS
+ *    fp = tn5250_screen_registry_fingerprint (This, dbuffer);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    Tn5250DBuffer *      dbuffer    -
+ * DESCRIPTION
+ *    Return the fingerprint of the screen in ``dbuffer'': a hash of its
+ *    size and row hashes, with the volatile regions left out.  If the
+ *    buffer has not changed since the last call, the last fingerprint is
+ *    returned straight away.
+ *****/
+unsigned long tn5250_screen_registry_fingerprint(Tn5250ScreenRegistry* This,
+                                                 Tn5250DBuffer* dbuffer) {
+    unsigned long fp = TN5250_DBUFFER_HASH_BASIS;
+    unsigned long h;
+    int y, i;
+
+    if (tn5250_dbuffer_serial(dbuffer) == This->last_serial &&
+        tn5250_dbuffer_generation(dbuffer) == This->last_generation &&
+        This->rows == tn5250_dbuffer_height(dbuffer) &&
+        This->cols == tn5250_dbuffer_width(dbuffer)) {
+        return This->fingerprint;
+    }
+    if (tn5250_dbuffer_serial(dbuffer) != This->last_serial ||
+        This->rows != tn5250_dbuffer_height(dbuffer) ||
+        This->cols != tn5250_dbuffer_width(dbuffer)) {
+        tn5250_screen_registry_reset(This, dbuffer);
+    }
+
+    fp = tn5250_dbuffer_hash_byte(fp, This->rows);
+    fp = tn5250_dbuffer_hash_byte(fp, This->cols);
+    for (y = 0; y < This->rows; y++) {
+        if (This->row_volatile[y]) {
+            h = tn5250_screen_registry_masked_hash(This, dbuffer, y);
+        }
+        else {
+            h = tn5250_dbuffer_row_hash(dbuffer, y);
+        }
+        for (i = 0; i < 4; i++) {
+            fp = tn5250_dbuffer_hash_byte(fp, h >> (i * 8));
+        }
+    }
+
+    This->fingerprint = fp;
+    This->last_generation = tn5250_dbuffer_generation(dbuffer);
+    return fp;
+}
+
+/****f* lib5250/tn5250_screen_registry_recognize
+ * NAME
+ *    tn5250_screen_registry_recognize
+ * SYNOPSIS
+ *    screen = tn5250_screen_registry_recognize (This, dbuffer);
+ * INPUTS
+ *    Tn5250ScreenRegistry * This     -
+ *    Tn5250DBuffer *      dbuffer    -
+ * DESCRIPTION
+ *    Look the screen in ``dbuffer'' up in the registry.  Returns its
+ *    definition, or NULL if the screen is not known, and counts a hit or
+ *    a miss.  The result is also kept as the registry's current screen.
+ *****/
+Tn5250Screen* tn5250_screen_registry_recognize(Tn5250ScreenRegistry* This,
+                                               Tn5250DBuffer* dbuffer) {
+    Tn5250Screen* screen = tn5250_screen_registry_find(
+        This, tn5250_screen_registry_fingerprint(This, dbuffer));
+
+    if (screen != NULL) {
+        screen->matches++;
+        This->hits++;
+    }
+    else {
+        This->misses++;
+    }
+    This->current = screen;
+    return screen;
+}
+
+/*
+ *    Start looking at a different display buffer, or at one which has
+ *    changed size: work out which rows have volatile cells and forget
+ *    any masked row hashes.
+ */
+static void tn5250_screen_registry_reset(Tn5250ScreenRegistry* This,
+                                         Tn5250DBuffer* dbuffer) {
+    int y, i;
+
+    This->rows = tn5250_dbuffer_height(dbuffer);
+    This->cols = tn5250_dbuffer_width(dbuffer);
+    This->last_serial = tn5250_dbuffer_serial(dbuffer);
+
+    free(This->row_volatile);
+    free(This->masked_hash);
+    free(This->masked_generation);
+    This->row_volatile = tn5250_new(unsigned char, This->rows);
+    This->masked_hash = tn5250_new(unsigned long, This->rows);
+    This->masked_generation = tn5250_new(unsigned long, This->rows);
+    TN5250_ASSERT(This->row_volatile != NULL && This->masked_hash != NULL &&
+                  This->masked_generation != NULL);
+
+    for (y = 0; y < This->rows; y++) {
+        This->row_volatile[y] = 0;
+        This->masked_generation[y] = 0;
+        for (i = 0; i < This->region_count; i++) {
+            if (y >= This->regions[i].top && y <= This->regions[i].bottom) {
+                This->row_volatile[y] = 1;
+            }
+        }
+    }
+}
+
+/*
+ *    Hash row y with the cells in volatile regions taken as zero.  The
+ *    result is cached until the row changes.
+ */
+static unsigned long tn5250_screen_registry_masked_hash(
+    Tn5250ScreenRegistry* This, Tn5250DBuffer* dbuffer, int y) {
+    const unsigned char* src;
+    unsigned long h = TN5250_DBUFFER_HASH_BASIS;
+    int x, i;
+
+    if (This->masked_generation[y] ==
+        tn5250_dbuffer_row_generation(dbuffer, y)) {
+        return This->masked_hash[y];
+    }
+
+    src = dbuffer->data + y * This->cols;
+    for (x = 0; x < This->cols; x++) {
+        unsigned char c = src[x];
+        for (i = 0; i < This->region_count; i++) {
+            const Tn5250ScreenRegion* r = &This->regions[i];
+            if (y >= r->top && y <= r->bottom && x >= r->left &&
+                x <= r->right) {
+                c = 0;
+                break;
+            }
+        }
+        h = tn5250_dbuffer_hash_byte(h, c);
+    }
+
+    This->masked_hash[y] = h;
+    This->masked_generation[y] = tn5250_dbuffer_row_generation(dbuffer, y);
+    return h;
+}
@@ -0,0 +1,135 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct _Tn5250DBuffer;
+
+/****s* lib5250/Tn5250Screen
+ * NAME
+ *    Tn5250Screen
+ * SYNOPSIS
+ *    screen = tn5250_screen_registry_recognize (registry, dbuffer);
+ *    if (screen != NULL)
+ *       printf ("%s\n", tn5250_screen_name (screen));
+ * DESCRIPTION
+ *    A named screen definition: the fingerprint that identifies the
+ *    screen, and a count of how many times it has been recognised.
+ * SOURCE
+ */
+struct _Tn5250Screen {
+    struct _Tn5250Screen* next; /* Next in the same hash bucket */
+    char* name;
+    unsigned long fingerprint;
+    unsigned long matches;
+};
+
+typedef struct _Tn5250Screen Tn5250Screen;
+/*******/
+
+/****s* lib5250/Tn5250ScreenRegistry
+ * NAME
+ *    Tn5250ScreenRegistry
+ * SYNOPSIS
+ *    Tn5250ScreenRegistry *reg = tn5250_screen_registry_new ();
+ *    tn5250_screen_registry_add_volatile (reg, 0, 70, 0, 79);
+ *    tn5250_screen_registry_learn (reg, "signon", dbuffer);
+ *    screen = tn5250_screen_registry_recognize (reg, dbuffer);
+ *    tn5250_screen_registry_destroy (reg);
+ * DESCRIPTION
+ *    Maps screen fingerprints to named screen definitions.  A fingerprint
+ *    is built from the display buffer's cached row hashes, with the
+ *    cells in the volatile regions (clocks, job numbers and so on) left
+ *    out, so recognising the current screen costs a hash table lookup
+ *    once the rows that changed have been hashed.  A registry keeps
+ *    state about the display buffer it last looked at and belongs to one
+ *    session.
+ * SOURCE
+ */
+struct _Tn5250ScreenRegion {
+    int top, left, bottom, right;
+};
+
+typedef struct _Tn5250ScreenRegion Tn5250ScreenRegion;
+
+struct _Tn5250ScreenRegistry {
+    Tn5250Screen** buckets;
+    int bucket_count;
+    int screen_count;
+
+    Tn5250ScreenRegion* regions; /* Volatile regions */
+    int region_count;
+
+    /* What we worked out for the display buffer we last looked at. */
+    unsigned long last_serial; /* 0 if none */
+    unsigned long last_generation;
+    int rows, cols;
+    unsigned char* row_volatile; /* Row has cells in a volatile region */
+    unsigned long* masked_hash;
+    unsigned long* masked_generation;
+    unsigned long fingerprint;
+    Tn5250Screen* current;
+
+    unsigned long hits;
+    unsigned long misses;
+};
+
+typedef struct _Tn5250ScreenRegistry Tn5250ScreenRegistry;
+/*******/
+
+extern Tn5250ScreenRegistry* tn5250_screen_registry_new(void);
+extern void tn5250_screen_registry_destroy(Tn5250ScreenRegistry* This);
+extern void tn5250_screen_registry_add_volatile(Tn5250ScreenRegistry* This,
+                                                int top, int left, int bottom,
+                                                int right);
+extern Tn5250Screen* tn5250_screen_registry_define(Tn5250ScreenRegistry* This,
+                                                   const char* name,
+                                                   unsigned long fingerprint);
+extern Tn5250Screen*
+tn5250_screen_registry_learn(Tn5250ScreenRegistry* This, const char* name,
+                             struct _Tn5250DBuffer* dbuffer);
+extern Tn5250Screen* tn5250_screen_registry_find(Tn5250ScreenRegistry* This,
+                                                 unsigned long fingerprint);
+extern unsigned long
+tn5250_screen_registry_fingerprint(Tn5250ScreenRegistry* This,
+                                   struct _Tn5250DBuffer* dbuffer);
+extern Tn5250Screen*
+tn5250_screen_registry_recognize(Tn5250ScreenRegistry* This,
+                                 struct _Tn5250DBuffer* dbuffer);
+
+#define tn5250_screen_name(This)             ((This)->name)
+#define tn5250_screen_fingerprint(This)      ((This)->fingerprint)
+#define tn5250_screen_matches(This)          ((This)->matches)
+#define tn5250_screen_registry_count(This)   ((This)->screen_count)
+#define tn5250_screen_registry_current(This) ((This)->current)
+#define tn5250_screen_registry_hits(This)    ((This)->hits)
+#define tn5250_screen_registry_misses(This)  ((This)->misses)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCREEN_H */
@@ -0,0 +1,620 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#include "tn5250-private.h"
+
+static void script_enter_keys(Tn5250Script* This);
+static int script_check(Tn5250Script* This);
+static int script_step(Tn5250Script* This, int readable);
+
+/****f* lib5250/tn5250_script_new
+ * NAME
+ *    tn5250_script_new
+ * SYNOPSIS
+ *    script = tn5250_script_new (session, func, data);
+ * INPUTS
+ *    Tn5250Session *      session    - The session to drive.
+ *    Tn5250ScriptFunc     func       - The step function.
+ *    void *               data       - Passed to the step function.
+ * DESCRIPTION
+ *    Create a script to drive a session which is already connected and
+ *    has a display.  The step function is first called by the first
+ *    tn5250_script_poll.  Only one script may drive a session at a time,
+ *    and it must be destroyed before the session is.
+ *****/
+Tn5250Script* tn5250_script_new(Tn5250Session* session, Tn5250ScriptFunc func,
+                                void* data) {
+    Tn5250Script* This;
+
+    TN5250_ASSERT(session->display != NULL);
+    TN5250_ASSERT(session->display->script == NULL);
+
+    This = tn5250_new(Tn5250Script, 1);
+    if (This == NULL) {
+        return NULL;
+    }
+
+    This->session = session;
+    This->func = func;
+    This->data = data;
+    This->resume = 0;
+    This->status = TN5250_SCRIPT_WAITING;
+    This->wait = 0;
+    This->result = 0;
+    This->deadline = 0;
+    This->timed = 0;
+    This->screens = 0;
+    This->wait_screen = 0;
+    This->pattern = NULL;
+    This->pattern_len = 0;
+    This->searched_serial = 0;
+    This->searched_generation = 0;
+    This->keys = NULL;
+    This->key_head = This->key_tail = This->key_alloc = 0;
+    This->fields = NULL;
+    This->fields_alloc = 0;
+    This->field_text = NULL;
+    This->field_text_alloc = 0;
+
+    session->display->script = This;
+    return This;
+}
+
+/****f* lib5250/tn5250_script_destroy
+ * NAME
+ *    tn5250_script_destroy
+ * SYNOPSIS
+ *    tn5250_script_destroy (This);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ * DESCRIPTION
+ *    Stop driving the session and free the script.  Keys which have not
+ *    been entered yet are thrown away.
+ *****/
+void tn5250_script_destroy(Tn5250Script* This) {
+    if (This->session->display->script == This) {
+        This->session->display->script = NULL;
+    }
+    free(This->pattern);
+    free(This->keys);
+    free(This->fields);
+    free(This->field_text);
+    free(This);
+}
+
+/****f* lib5250/tn5250_script_send_key
+ * NAME
+ *    tn5250_script_send_key
+ * SYNOPSIS
+ *    tn5250_script_send_key (This, K_ENTER);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    int                  key        - A K_* code or a local character.
+ * DESCRIPTION
+ *    Queue a key to be entered, as if it had been typed.
+ *****/
+void tn5250_script_send_key(Tn5250Script* This, int key) {
+    if (This->key_tail == This->key_alloc) {
+        if (This->key_head != 0) {
+            memmove(This->keys, This->keys + This->key_head,
+                    (This->key_tail - This->key_head) * sizeof(int));
+            This->key_tail -= This->key_head;
+            This->key_head = 0;
+        }
+        else {
+            This->key_alloc = This->key_alloc == 0 ? 64 : This->key_alloc * 2;
+            This->keys =
+                (int*)realloc(This->keys, This->key_alloc * sizeof(int));
+            TN5250_ASSERT(This->keys != NULL);
+        }
+    }
+    This->keys[This->key_tail++] = key;
+}
+
+/****f* lib5250/tn5250_script_send_keys
+ * NAME
+ *    tn5250_script_send_keys
+ * SYNOPSIS
+ *    tn5250_script_send_keys (This, "WRKACTJOB\n");
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    const char *         text       - Characters in the local charset.
+ * DESCRIPTION
+ *    Queue a string of keys.  Tab, backspace and newline (or carriage
+ *    return) become the Tab, Backspace and Enter keys; everything else is
+ *    typed as it is.
+ *****/
+void tn5250_script_send_keys(Tn5250Script* This, const char* text) {
+    for (; *text != '\0'; text++) {
+        switch (*text) {
+        case '\t':
+            tn5250_script_send_key(This, K_TAB);
+            break;
+        case '\b':
+            tn5250_script_send_key(This, K_BACKSPACE);
+            break;
+        case '\r':
+        case '\n':
+            tn5250_script_send_key(This, K_ENTER);
+            break;
+        default:
+            tn5250_script_send_key(This, (unsigned char)*text);
+            break;
+        }
+    }
+}
+
+/****f* lib5250/tn5250_script_set_field
+ * NAME
+ *    tn5250_script_set_field
+ * SYNOPSIS
+ *    tn5250_script_set_field (This, 0, "QSECOFR");
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    int                  id         - 0 for the first field.
+ *    const char *         text       - Characters in the local charset.
+ * DESCRIPTION
+ *    Replace the contents of a field straight away, without typing into
+ *    it, and set its modified data tag so that it is sent with the next
+ *    aid key.  Text too long for the field is cut short, and the rest of
+ *    the field is filled with nulls.  Monocase fields are upper cased.
+ *    Returns the number of characters put in the field, or -1 if there
+ *    is no such field or it can't be typed in.
+ *****/
+int tn5250_script_set_field(Tn5250Script* This, int id, const char* text) {
+    Tn5250Display* display = This->session->display;
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    Tn5250Field* field;
+    unsigned char* data;
+    int i, len = strlen(text), c;
+
+    if (id < 0 || id >= tn5250_dbuffer_field_count(dbuffer) ||
+        (field = tn5250_dbuffer_field_by_id(dbuffer, id)) == NULL ||
+        tn5250_field_is_bypass(field)) {
+        return -1;
+    }
+    if (len > tn5250_field_length(field)) {
+        len = tn5250_field_length(field);
+    }
+
+    data = tn5250_dbuffer_field_data(dbuffer, field);
+    for (i = 0; i < tn5250_field_length(field); i++) {
+        c = 0x00;
+        if (i < len) {
+            c = (unsigned char)text[i];
+            if (tn5250_field_is_monocase(field) && isalpha(c)) {
+                c = toupper(c);
+            }
+            c = tn5250_char_map_to_remote(tn5250_display_char_map(display), c);
+        }
+        data[i] = (unsigned char)c;
+    }
+    tn5250_field_set_mdt(field);
+    tn5250_display_schedule_update(display, 1);
+    return len;
+}
+
+/****f* lib5250/tn5250_script_read_fields
+ * NAME
+ *    tn5250_script_read_fields
+ * SYNOPSIS
+ *    n = tn5250_script_read_fields (This, &fields);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    const Tn5250ScriptField ** fields - Set to the fields.
+ * DESCRIPTION
+ *    Read every field on the current screen, in the order the host
+ *    defined them.  The array belongs to the script and is good until
+ *    the next call.  Returns the number of fields.
+ *****/
+int tn5250_script_read_fields(Tn5250Script* This,
+                              const Tn5250ScriptField** fields) {
+    Tn5250Display* display = This->session->display;
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    Tn5250ScriptField* sf;
+    Tn5250Field* field;
+    const unsigned char* data;
+    int count = tn5250_dbuffer_field_count(dbuffer);
+    int n, i, text_len = 0, pos;
+    char* p;
+
+    for (n = 0; n < count; n++) {
+        text_len += tn5250_dbuffer_field_by_id(dbuffer, n)->length + 1;
+    }
+    if (count > This->fields_alloc) {
+        free(This->fields);
+        This->fields = tn5250_new(Tn5250ScriptField, count);
+        TN5250_ASSERT(This->fields != NULL);
+        This->fields_alloc = count;
+    }
+    if (text_len > This->field_text_alloc) {
+        free(This->field_text);
+        This->field_text = (char*)malloc(text_len);
+        TN5250_ASSERT(This->field_text != NULL);
+        This->field_text_alloc = text_len;
+    }
+
+    pos = 0;
+    for (n = 0; n < count; n++) {
+        field = tn5250_dbuffer_field_by_id(dbuffer, n);
+        sf = &This->fields[n];
+        sf->id = n;
+        sf->row = tn5250_field_start_row(field);
+        sf->col = tn5250_field_start_col(field);
+        sf->length = tn5250_field_length(field);
+        sf->input = !tn5250_field_is_bypass(field);
+        sf->modified = tn5250_field_mdt(field);
+
+        p = This->field_text + pos;
+        data = tn5250_dbuffer_field_data_const(dbuffer, field);
+        for (i = 0; i < sf->length; i++) {
+            p[i] = data[i] == 0x00
+                       ? ' '
+                       : (char)tn5250_char_map_to_local(
+                             tn5250_display_char_map(display), data[i]);
+        }
+        p[i] = '\0';
+        sf->text = p;
+        pos += sf->length + 1;
+    }
+
+    *fields = This->fields;
+    return count;
+}
+
+/****f* lib5250/tn5250_script_wait_for
+ * NAME
+ *    tn5250_script_wait_for
+ * SYNOPSIS
+ *    tn5250_script_wait_for (This, TN5250_SCRIPT_WAIT_TEXT, "Sign On", -1);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    int                  events     - TN5250_SCRIPT_WAIT_* flags.
+ *    const char *         text       - Text for TN5250_SCRIPT_WAIT_TEXT,
+ *                                      in the local character set.
+ *    long                 timeout    - Milliseconds, or -1 for no limit.
+ * DESCRIPTION
+ *    Say what the step function is waiting for before it returns
+ *    TN5250_SCRIPT_WAITING; TN5250_SCRIPT_WAIT_FOR does both.  It is
+ *    called again once every key it has sent has been handled and one of
+ *    the events happens: the host sends a screen after the wait starts,
+ *    the text is anywhere on the screen, or the keyboard is unlocked.
+ *    tn5250_script_result then gives the event, or 0 if the timeout ran
+ *    out first.
+ *****/
+void tn5250_script_wait_for(Tn5250Script* This, int events, const char* text,
+                            long timeout) {
+    Tn5250Display* display = This->session->display;
+    int i;
+
+    This->wait = events;
+    This->result = 0;
+    This->wait_screen = This->screens;
+    This->timed = timeout >= 0;
+    if (timeout >= 0) {
+        This->deadline = tn5250_msec_now() + timeout;
+    }
+
+    free(This->pattern);
+    This->pattern = NULL;
+    This->pattern_len = 0;
+    This->searched_serial = 0;
+    if ((events & TN5250_SCRIPT_WAIT_TEXT) != 0 && text != NULL) {
+        This->pattern_len = strlen(text);
+        This->pattern = (unsigned char*)malloc(This->pattern_len + 1);
+        TN5250_ASSERT(This->pattern != NULL);
+        for (i = 0; i < This->pattern_len; i++) {
+            This->pattern[i] = tn5250_char_map_to_remote(
+                tn5250_display_char_map(display), (unsigned char)text[i]);
+        }
+    }
+}
+
+/****f* lib5250/tn5250_script_fd
+ * NAME
+ *    tn5250_script_fd
+ * SYNOPSIS
+ *    FD_SET (tn5250_script_fd (This), &fdr);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ * DESCRIPTION
+ *    Returns the socket to watch for data from the host, or -1 if the
+ *    session has no stream.
+ *****/
+int tn5250_script_fd(Tn5250Script* This) {
+    if (This->session->stream == NULL) {
+        return -1;
+    }
+    return (int)tn5250_stream_socket_handle(This->session->stream);
+}
+
+/****f* lib5250/tn5250_script_timeout
+ * NAME
+ *    tn5250_script_timeout
+ * SYNOPSIS
+ *    msec = tn5250_script_timeout (This);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ * DESCRIPTION
+ *    Returns how many milliseconds the caller may wait for the socket
+ *    before it should call tn5250_script_poll anyway: 0 if the script
+ *    can make progress now, the time left on its wait, or -1 if only
+ *    data from the host will move it on.
+ *****/
+long tn5250_script_timeout(Tn5250Script* This) {
+    long left;
+
+    if (This->status != TN5250_SCRIPT_WAITING || This->wait == 0) {
+        return 0;
+    }
+    if (!This->timed) {
+        return -1;
+    }
+    left = tn5250_msec_until(This->deadline);
+    return left > 0 ? left : 0;
+}
+
+/****f* lib5250/tn5250_script_poll
+ * NAME
+ *    tn5250_script_poll
+ * SYNOPSIS
+ *    status = tn5250_script_poll (This);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ * DESCRIPTION
+ *    Do whatever the script can do now without blocking: receive what
+ *    the host has sent, enter keys, and run the step function for as
+ *    long as its waits are over.  Returns TN5250_SCRIPT_WAITING, or
+ *    TN5250_SCRIPT_DONE or TN5250_SCRIPT_FAILED once the script has
+ *    finished.  A script fails if its step function says so or the host
+ *    disconnects.
+ *****/
+int tn5250_script_poll(Tn5250Script* This) {
+    fd_set fdr;
+    struct timeval tv;
+    int fd = tn5250_script_fd(This);
+    int readable = 0;
+
+    if (fd >= 0 && This->status == TN5250_SCRIPT_WAITING) {
+        FD_ZERO(&fdr);
+        FD_SET(fd, &fdr);
+        tv.tv_sec = tv.tv_usec = 0;
+        readable = select(fd + 1, &fdr, NULL, NULL, &tv) > 0;
+    }
+    return script_step(This, readable);
+}
+
+/****f* lib5250/tn5250_script_run
+ * NAME
+ *    tn5250_script_run
+ * SYNOPSIS
+ *    while (tn5250_script_run (scripts, n, -1) > 0)
+ *       ;
+ * INPUTS
+ *    Tn5250Script **      scripts    - The scripts to run.
+ *    int                  count      - How many there are.
+ *    long                 timeout    - Milliseconds, or -1 for no limit.
+ * DESCRIPTION
+ *    Run scripts on many sessions from one thread.  We sleep in one
+ *    select on all their sockets until a host sends something or a wait
+ *    times out, and step only the scripts that can move on.  Returns
+ *    when the timeout runs out or every script has finished, with the
+ *    number still running.
+ *****/
+int tn5250_script_run(Tn5250Script** scripts, int count, long timeout) {
+    fd_set fdr;
+    struct timeval tv;
+    unsigned long deadline = 0;
+    long wait, left;
+    int i, fd, sm, running;
+
+    if (timeout >= 0) {
+        deadline = tn5250_msec_now() + timeout;
+    }
+
+    while (1) {
+        running = 0;
+        sm = 0;
+        wait = -1;
+        FD_ZERO(&fdr);
+        for (i = 0; i < count; i++) {
+            if (scripts[i]->status != TN5250_SCRIPT_WAITING) {
+                continue;
+            }
+            running++;
+            if ((fd = tn5250_script_fd(scripts[i])) >= 0) {
+                FD_SET(fd, &fdr);
+                if (fd + 1 > sm) {
+                    sm = fd + 1;
+                }
+            }
+            left = tn5250_script_timeout(scripts[i]);
+            if (left >= 0 && (wait < 0 || left < wait)) {
+                wait = left;
+            }
+        }
+        if (running == 0) {
+            break;
+        }
+        if (timeout >= 0) {
+            left = tn5250_msec_until(deadline);
+            if (left < 0) {
+                break;
+            }
+            if (wait < 0 || left < wait) {
+                wait = left;
+            }
+        }
+        if (wait < 0 && sm == 0) {
+            break; /* Nothing could ever wake us up. */
+        }
+
+        tv.tv_sec = wait / 1000;
+        tv.tv_usec = (wait % 1000) * 1000;
+        if (select(sm, &fdr, NULL, NULL, wait < 0 ? NULL : &tv) < 0) {
+            FD_ZERO(&fdr);
+        }
+        for (i = 0; i < count; i++) {
+            if (scripts[i]->status == TN5250_SCRIPT_WAITING) {
+                fd = tn5250_script_fd(scripts[i]);
+                script_step(scripts[i], fd >= 0 && FD_ISSET(fd, &fdr));
+            }
+        }
+    }
+    return running;
+}
+
+/****f* lib5250/tn5250_script_frame
+ * NAME
+ *    tn5250_script_frame
+ * SYNOPSIS
+ *    tn5250_script_frame (This, display);
+ * INPUTS
+ *    Tn5250Script *       This       -
+ *    Tn5250Display *      display    - The display being drawn.
+ * DESCRIPTION
+ *    Called by tn5250_display_update each time the display is drawn.
+ *    The first frame drawn after data from the host has been handled
+ *    counts as a screen, whenever it is drawn and whoever received the
+ *    data.
+ *****/
+void tn5250_script_frame(Tn5250Script* This, Tn5250Display* display) {
+    if (This->session->received) {
+        This->session->received = 0;
+        This->screens++;
+    }
+}
+
+/*
+ *    Enter the keys we can.  While the keyboard is unlocked they go in
+ *    together through tn5250_display_do_text; while it isn't, only the
+ *    keys that are allowed then go in, and the rest wait.
+ */
+static void script_enter_keys(Tn5250Script* This) {
+    Tn5250Display* display = This->session->display;
+    int key;
+
+    while (This->key_head != This->key_tail) {
+        if (display->keystate == TN5250_KEYSTATE_UNLOCKED &&
+            !tn5250_display_inhibited(display)) {
+            This->key_head += tn5250_display_do_text(
+                display, This->keys + This->key_head,
+                This->key_tail - This->key_head);
+            continue;
+        }
+        key = This->keys[This->key_head];
+        if (key != K_RESET && key != K_SYSREQ && key != K_ATTENTION) {
+            break;
+        }
+        This->key_head++;
+        tn5250_display_do_key(display, key);
+    }
+    if (This->key_head == This->key_tail) {
+        This->key_head = This->key_tail = 0;
+    }
+    tn5250_display_flush(display);
+}
+
+/*
+ *    Returns the condition which has ended the wait, if there is one.
+ *    The screen is only searched again when it has changed.
+ */
+static int script_check(Tn5250Script* This) {
+    Tn5250Display* display = This->session->display;
+    Tn5250DBuffer* dbuffer;
+    int h;
+
+    if (This->key_head != This->key_tail ||
+        tn5250_display_queued_keys(display) != 0) {
+        return 0;
+    }
+    if ((This->wait & TN5250_SCRIPT_WAIT_SCREEN) != 0 &&
+        This->screens != This->wait_screen) {
+        return TN5250_SCRIPT_WAIT_SCREEN;
+    }
+    if ((This->wait & TN5250_SCRIPT_WAIT_UNLOCK) != 0 &&
+        display->keystate == TN5250_KEYSTATE_UNLOCKED &&
+        !tn5250_display_inhibited(display)) {
+        return TN5250_SCRIPT_WAIT_UNLOCK;
+    }
+    if ((This->wait & TN5250_SCRIPT_WAIT_TEXT) != 0 && This->pattern != NULL) {
+        /* The display buffer may have been swapped by a save or restore
+         * screen, so look it up again each time round. */
+        dbuffer = tn5250_display_dbuffer(display);
+        h = tn5250_dbuffer_height(dbuffer);
+        if (tn5250_dbuffer_serial(dbuffer) != This->searched_serial ||
+            tn5250_dbuffer_changed_since(dbuffer, 0, h - 1,
+                                         This->searched_generation)) {
+            This->searched_serial = tn5250_dbuffer_serial(dbuffer);
+            This->searched_generation = tn5250_dbuffer_generation(dbuffer);
+            if (tn5250_dbuffer_find(dbuffer, This->pattern, This->pattern_len,
+                                    0, 0, h - 1,
+                                    tn5250_dbuffer_width(dbuffer) - 1, NULL,
+                                    NULL)) {
+                return TN5250_SCRIPT_WAIT_TEXT;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Handle data from the host if there is some, then enter keys and run
+ *    the step function until it has to wait.
+ */
+static int script_step(Tn5250Script* This, int readable) {
+    int r;
+
+    if (This->status != TN5250_SCRIPT_WAITING) {
+        return This->status;
+    }
+    if (readable) {
+        if (tn5250_session_receive(This->session) < 0) {
+            This->status = TN5250_SCRIPT_FAILED;
+            return This->status;
+        }
+    }
+
+    while (1) {
+        script_enter_keys(This);
+        if (This->wait != 0) {
+            if ((r = script_check(This)) == 0) {
+                if (!This->timed ||
+                    tn5250_msec_until(This->deadline) > 0) {
+                    break;
+                }
+            }
+            This->result = r;
+            This->wait = 0;
+        }
+
+        r = This->func(This, This->data);
+        if (r != TN5250_SCRIPT_WAITING) {
+            script_enter_keys(This);
+            This->status = r;
+            break;
+        }
+        if (This->wait == 0) {
+            break; /* Yielded without waiting: carry on next time. */
+        }
+    }
+    return This->status;
+}
@@ -0,0 +1,186 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* What a script's step function and tn5250_script_poll return. */
+#define TN5250_SCRIPT_WAITING 0
+#define TN5250_SCRIPT_DONE    1
+#define TN5250_SCRIPT_FAILED  (-1)
+
+/* Conditions for tn5250_script_wait_for */
+#define TN5250_SCRIPT_WAIT_SCREEN 0x0001 /* The host has sent a screen */
+#define TN5250_SCRIPT_WAIT_TEXT   0x0002 /* Text is on the screen */
+#define TN5250_SCRIPT_WAIT_UNLOCK 0x0004 /* Keyboard unlocked, keys entered */
+
+struct _Tn5250Session;
+struct _Tn5250Display;
+struct _Tn5250Script;
+
+typedef int (*Tn5250ScriptFunc)(struct _Tn5250Script* script, void* data);
+
+/****s* lib5250/Tn5250ScriptField
+ * NAME
+ *    Tn5250ScriptField
+ * SYNOPSIS
+ *    n = tn5250_script_read_fields (script, &fields);
+ * DESCRIPTION
+ *    A field on the screen as tn5250_script_read_fields returns it.  The
+ *    text is in the local character set, padded with blanks to the
+ *    length of the field.
+ * SOURCE
+ */
+struct _Tn5250ScriptField {
+    int id;
+    int row, col;
+    int length;
+    int input;    /* Non-zero unless this is a bypass field */
+    int modified; /* Non-zero if the MDT is set */
+    const char* text;
+};
+
+typedef struct _Tn5250ScriptField Tn5250ScriptField;
+/*******/
+
+/****s* lib5250/Tn5250Script
+ * NAME
+ *    Tn5250Script
+ * SYNOPSIS
+ *    static int signon (Tn5250Script *s, void *data)
+ *    {
+ *       TN5250_SCRIPT_BEGIN (s);
+ *       TN5250_SCRIPT_WAIT_FOR (s, TN5250_SCRIPT_WAIT_TEXT, "Sign On", 30000);
+ *       tn5250_script_set_field (s, 0, "QSECOFR");
+ *       tn5250_script_set_field (s, 1, "SECRET");
+ *       tn5250_script_send_key (s, K_ENTER);
+ *       TN5250_SCRIPT_WAIT_FOR (s, TN5250_SCRIPT_WAIT_UNLOCK, NULL, 30000);
+ *       TN5250_SCRIPT_END (s);
+ *    }
+ *
+ *    script = tn5250_script_new (session, signon, NULL);
+ *    while (tn5250_script_run (&script, 1, -1) > 0)
+ *       ;
+ * DESCRIPTION
+ *    Drives a session from C without blocking, so that one thread can
+ *    run scripts on many sessions at once.  A script is a step function
+ *    written as a coroutine: TN5250_SCRIPT_WAIT_FOR records what it is
+ *    waiting for and returns, and the function carries on after the
+ *    wait the next time it is called.  As with any switch based
+ *    coroutine, local variables do not keep their values across a wait;
+ *    keep them in the data passed to tn5250_script_new.
+ *
+ *    Nothing is polled on a timer.  The script is stepped when the
+ *    session's socket is readable, through tn5250_script_poll or
+ *    tn5250_script_run.  The display tells the script each time it is
+ *    drawn, so a wait for a screen costs nothing until the host sends
+ *    one, and a wait for text only searches the rows which changed.
+ *
+ *    Keys sent by the script are entered while the keyboard is unlocked
+ *    and held while it is locked, as type-ahead would be, except for
+ *    Reset, System Request and Attention which are entered at once.
+ * SOURCE
+ */
+struct _Tn5250Script {
+    struct _Tn5250Session* session;
+    Tn5250ScriptFunc func;
+    void* data;
+    int resume; /* Where the step function carries on from */
+    int status;
+    int wait;   /* TN5250_SCRIPT_WAIT_* flags, 0 if not waiting */
+    int result; /* The condition which ended the last wait, 0 on timeout */
+    unsigned long deadline;
+    unsigned int timed : 1; /* deadline is set */
+
+    unsigned long screens;     /* Frames drawn for data from the host */
+    unsigned long wait_screen; /* screens when the wait started */
+
+    /* Text being waited for, in the host character set, and the display
+     * buffer as it was when it was last searched. */
+    unsigned char* pattern;
+    int pattern_len;
+    unsigned long searched_serial; /* 0 if not searched yet */
+    unsigned long searched_generation;
+
+    /* Keys waiting to be entered, keys[key_head] to keys[key_tail - 1]. */
+    int* keys;
+    int key_head, key_tail, key_alloc;
+
+    Tn5250ScriptField* fields;
+    int fields_alloc;
+    char* field_text;
+    int field_text_alloc;
+};
+
+typedef struct _Tn5250Script Tn5250Script;
+/*******/
+
+#define TN5250_SCRIPT_BEGIN(s)                                                 \
+    switch ((s)->resume) {                                                     \
+    case 0:
+#define TN5250_SCRIPT_WAIT_FOR(s, events, text, timeout)                       \
+    do {                                                                       \
+        tn5250_script_wait_for((s), (events), (text), (timeout));              \
+        (s)->resume = __LINE__;                                                \
+        return TN5250_SCRIPT_WAITING;                                          \
+    case __LINE__:;                                                            \
+    } while (0)
+#define TN5250_SCRIPT_END(s)                                                   \
+    }                                                                          \
+    (s)->resume = -1;                                                          \
+    return TN5250_SCRIPT_DONE
+
+extern Tn5250Script* tn5250_script_new(struct _Tn5250Session* session,
+                                       Tn5250ScriptFunc func, void* data);
+extern void tn5250_script_destroy(Tn5250Script* This);
+
+extern void tn5250_script_send_key(Tn5250Script* This, int key);
+extern void tn5250_script_send_keys(Tn5250Script* This, const char* text);
+extern int tn5250_script_set_field(Tn5250Script* This, int id,
+                                   const char* text);
+extern int tn5250_script_read_fields(Tn5250Script* This,
+                                     const Tn5250ScriptField** fields);
+extern void tn5250_script_wait_for(Tn5250Script* This, int events,
+                                   const char* text, long timeout);
+
+extern int tn5250_script_fd(Tn5250Script* This);
+extern long tn5250_script_timeout(Tn5250Script* This);
+extern int tn5250_script_poll(Tn5250Script* This);
+extern int tn5250_script_run(Tn5250Script** scripts, int count,
+                             long timeout);
+
+extern void tn5250_script_frame(Tn5250Script* This,
+                                struct _Tn5250Display* display);
+
+#define tn5250_script_session(This) ((This)->session)
+#define tn5250_script_status(This)  ((This)->status)
+#define tn5250_script_result(This)  ((This)->result)
+#define tn5250_script_screens(This) ((This)->screens)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCRIPT_H */
@@ -111,6 +111,9 @@ Tn5250Session* tn5250_session_new() {
     This->stream = NULL;
     This->invited = 1;
     This->read_opcode = 0;
+    This->screens = NULL;
+    This->screen = NULL;
+    This->received = 0;
 
     This->handle_aidkey = tn5250_session_handle_aidkey;
     This->display = NULL;
@@ -178,36 +181,196 @@ int tn5250_session_config(Tn5250Session* This, Tn5250Config* config) {
  *****/
 void tn5250_session_set_stream(Tn5250Session* This, Tn5250Stream* newstream) {
     if ((This->stream = newstream) != NULL) {
-        tn5250_display_update(This->display);
+        tn5250_display_schedule_update(This->display, 0);
     }
     return;
 }
 
-/****f* lib5250/tn5250_session_main_loop
+/****f* lib5250/tn5250_session_set_screen_registry
  * NAME
- *    tn5250_session_main_loop
+ *    tn5250_session_set_screen_registry
  * SYNOPSIS
- *    tn5250_session_main_loop (This);
+ *    tn5250_session_set_screen_registry (This, screens);
  * INPUTS
  *    Tn5250Session *      This       -
+ *    Tn5250ScreenRegistry * screens  -
  * DESCRIPTION
- *    DOCUMENT ME!!!
+ *    Recognise the screen against ``screens'' each time data from the
+ *    host has been handled.  The registry is not freed with the session.
+ *    Pass NULL to stop recognising screens.
  *****/
-void tn5250_session_main_loop(Tn5250Session* This) {
-    int r;
+void tn5250_session_set_screen_registry(Tn5250Session* This,
+                                        Tn5250ScreenRegistry* screens) {
+    This->screens = screens;
+    This->screen = NULL;
+}
+
+/****f* lib5250/tn5250_session_wait_for_text
+ * NAME
+ *    tn5250_session_wait_for_text
+ * SYNOPSIS
+ *    r = tn5250_session_wait_for_text (This, "Sign On", 0, 0, 5, 79, 5000);
+ * INPUTS
+ *    Tn5250Session *      This       -
+ *    const char *         text       - Text to wait for, in the local
+ *                                      character set.
+ *    int                  top        - First row of the region.
+ *    int                  left       - First column of the region.
+ *    int                  bottom     - Last row of the region.
+ *    int                  right      - Last column of the region.
+ *    long                 timeout    - Milliseconds to wait, or -1 to
+ *                                      wait for ever.
+ * DESCRIPTION
+ *    Handle data from the host until ``text'' appears in the region or
+ *    the timeout runs out.  The text is translated to the host character
+ *    set once, and the region is only searched again when a row in it
+ *    has changed; in between we sleep in select() on the stream.
+ *    Keystrokes are not read while waiting.  Returns 1 when the text is
+ *    on the screen, 0 on timeout, or -1 if the host disconnected or the
+ *    wait failed.
+ *****/
+int tn5250_session_wait_for_text(Tn5250Session* This, const char* text,
+                                 int top, int left, int bottom, int right,
+                                 long timeout) {
+    Tn5250DBuffer* dbuffer;
+    unsigned long searched = 0, generation = 0;
+    unsigned char* pat;
+    unsigned long deadline = 0;
+    long left_msec;
+    int len = strlen(text);
+    int fd, i, found = 0;
+    fd_set fdr;
+    struct timeval tv;
+
+    pat = (unsigned char*)malloc(len + 1);
+    TN5250_ASSERT(pat != NULL);
+    for (i = 0; i < len; i++) {
+        pat[i] = tn5250_char_map_to_remote(
+            tn5250_display_char_map(This->display), (unsigned char)text[i]);
+    }
+    if (timeout >= 0) {
+        deadline = tn5250_msec_now() + timeout;
+    }
 
     while (1) {
-        r = tn5250_display_waitevent(This->display);
-        if ((r & TN5250_TERMINAL_EVENT_QUIT) != 0) {
-            return;
+        /* The display buffer may have been swapped by a save or restore
+         * screen, so look it up again each time round. */
+        dbuffer = tn5250_display_dbuffer(This->display);
+        if (tn5250_dbuffer_serial(dbuffer) != searched ||
+            tn5250_dbuffer_changed_since(dbuffer, top, bottom, generation)) {
+            found = tn5250_dbuffer_find(dbuffer, pat, len, top, left, bottom,
+                                        right, NULL, NULL);
+            searched = tn5250_dbuffer_serial(dbuffer);
+            generation = tn5250_dbuffer_generation(dbuffer);
+            if (found) {
+                break;
+            }
         }
-        if ((r & TN5250_TERMINAL_EVENT_DATA) != 0) {
-            if (!tn5250_stream_handle_receive(This->stream)) {
-                return;
+
+        if (This->stream == NULL) {
+            break;
+        }
+        left_msec = -1;
+        if (timeout >= 0) {
+            left_msec = tn5250_msec_until(deadline);
+            if (left_msec <= 0) {
+                break;
             }
-            tn5250_session_handle_receive(This);
+            tv.tv_sec = left_msec / 1000;
+            tv.tv_usec = (left_msec % 1000) * 1000;
+        }
+
+        fd = tn5250_stream_socket_handle(This->stream);
+        FD_ZERO(&fdr);
+        FD_SET(fd, &fdr);
+        i = select(fd + 1, &fdr, NULL, NULL, left_msec < 0 ? NULL : &tv);
+        if (i < 0 && errno != EINTR) {
+            found = -1;
+            break;
+        }
+        if (i <= 0) {
+            continue; /* Interrupted, or timed out: the deadline decides. */
+        }
+        if (tn5250_session_receive(This) < 0) {
+            found = -1;
+            break;
+        }
+    }
+
+    free(pat);
+    return found;
+}
+
+/****f* lib5250/tn5250_session_poll
+ * NAME
+ *    tn5250_session_poll
+ * SYNOPSIS
+ *    while (tn5250_session_poll (This) >= 0)
+ *       ;
+ * INPUTS
+ *    Tn5250Session *      This       -
+ * DESCRIPTION
+ *    Wait for the terminal to report an event and handle it: keys are
+ *    processed by the display, and data from the host is received and
+ *    processed.  The screen is redrawn at most once for all the records
+ *    that came in.  How long this blocks is up to the terminal; one which
+ *    returns TN5250_TERMINAL_EVENT_TIMEOUT lets the caller run its own
+ *    event loop around this.  Returns the terminal's event flags, or -1
+ *    when the session is over (the terminal wants to quit or the host has
+ *    disconnected).
+ *****/
+int tn5250_session_poll(Tn5250Session* This) {
+    int r;
+
+    r = tn5250_display_waitevent(This->display);
+    if ((r & TN5250_TERMINAL_EVENT_QUIT) != 0) {
+        return -1;
+    }
+    if ((r & TN5250_TERMINAL_EVENT_DATA) != 0) {
+        if (tn5250_session_receive(This) < 0) {
+            return -1;
         }
     }
+    return r;
+}
+
+/****f* lib5250/tn5250_session_receive
+ * NAME
+ *    tn5250_session_receive
+ * SYNOPSIS
+ *    if (tn5250_session_receive (This) < 0)
+ *       disconnected ();
+ * INPUTS
+ *    Tn5250Session *      This       -
+ * DESCRIPTION
+ *    Read what the host has sent, process the records and draw the
+ *    result.  Only call this when the stream's socket is readable, or it
+ *    will block.  Returns 0, or -1 if the host has disconnected.
+ *****/
+int tn5250_session_receive(Tn5250Session* This) {
+    if (!tn5250_stream_handle_receive(This->stream)) {
+        return -1;
+    }
+    tn5250_session_handle_receive(This);
+    tn5250_display_flush(This->display);
+    return 0;
+}
+
+/****f* lib5250/tn5250_session_main_loop
+ * NAME
+ *    tn5250_session_main_loop
+ * SYNOPSIS
+ *    tn5250_session_main_loop (This);
+ * INPUTS
+ *    Tn5250Session *      This       -
+ * DESCRIPTION
+ *    Handle events until the terminal wants to quit or the host
+ *    disconnects.
+ *****/
+void tn5250_session_main_loop(Tn5250Session* This) {
+    while (tn5250_session_poll(This) >= 0) {
+        ;
+    }
     return;
 }
 
@@ -249,8 +412,16 @@ static void tn5250_session_handle_receive(Tn5250Session* This) {
             tn5250_record_destroy(This->record);
         }
         This->record = tn5250_stream_get_record(This->stream);
+        if (This->record->data.data == NULL
+            || tn5250_record_length(This->record) < 10) {
+            /* Too short for the 5250 header: nothing to process. */
+            TN5250_LOG(("HandleReceive: short record (%d bytes) dropped.\n",
+                        tn5250_record_length(This->record)));
+            continue;
+        }
         cur_opcode = tn5250_record_opcode(This->record);
         atn = tn5250_record_attention(This->record);
+        This->received = 1;
 
         TN5250_LOG(
             ("HandleReceive: cur_opcode = 0x%02X %d\n", cur_opcode, atn));
@@ -296,7 +467,11 @@ static void tn5250_session_handle_receive(Tn5250Session* This) {
             tn5250_session_process_stream(This);
         }
     }
-    tn5250_display_update(This->display);
+    if (This->screens != NULL) {
+        This->screen = tn5250_screen_registry_recognize(
+            This->screens, tn5250_display_dbuffer(This->display));
+    }
+    tn5250_display_schedule_update(This->display, 0);
     return;
 }
 
@@ -434,7 +609,7 @@ static void tn5250_session_send_fields(Tn5250Session* This, int aidcode) {
     tn5250_display_indicator_set(This->display, TN5250_DISPLAY_IND_X_SYSTEM);
     This->display->keystate = TN5250_KEYSTATE_LOCKED;
     tn5250_display_indicator_clear(This->display, TN5250_DISPLAY_IND_INSERT);
-    tn5250_display_update(This->display);
+    tn5250_display_schedule_update(This->display, 1);
 
     header.h5250.flowtype = TN5250_RECORD_FLOW_DISPLAY;
     header.h5250.flags = TN5250_RECORD_H_NONE;
@@ -462,12 +637,13 @@ static void tn5250_session_send_fields(Tn5250Session* This, int aidcode) {
 static void tn5250_session_send_field(Tn5250Session* This, Tn5250Buffer* buf,
                                       Tn5250Field* field) {
     int size, n;
-    unsigned char* data;
+    const unsigned char* data;
+    unsigned char* joined = NULL;
     unsigned char c;
     Tn5250Field* iter;
 
     size = tn5250_field_length(field);
-    data = tn5250_display_field_data(This->display, field);
+    data = tn5250_display_field_data_const(This->display, field);
 
     TN5250_LOG(("Sending:\n"));
     tn5250_field_dump(field);
@@ -484,7 +660,7 @@ static void tn5250_session_send_field(Tn5250Session* This, Tn5250Buffer* buf,
      * Which appears to be a perfectly valid assumption since the "Functions
      * Reference" manual says they have to be.
      */
-    if (field->continuous) {
+    if (tn5250_field_is_continued(field)) {
         /* We also must only send back data for the first subfield of a
          * continuous field.  All subfields are treated as one and are sent
          * as part of the first subfield.
@@ -496,23 +672,27 @@ static void tn5250_session_send_field(Tn5250Session* This, Tn5250Buffer* buf,
             int i = 0;
 
             /* 1st loop: Guess the full size */
-            for (iter = field->next; iter->continuous; iter = iter->next) {
+            for (iter = field->next; tn5250_field_is_continued(iter);
+                 iter = iter->next) {
                 size += tn5250_field_length(iter);
                 if (tn5250_field_is_continued_last(iter)) {
                     break;
                 }
             }
 
-            data = malloc(size);
+            joined = malloc(size);
             /* 2nd loop: Copy the data in the temporary buffer */
-            for (iter = field; iter->continuous; iter = iter->next) {
-                memcpy(data + i, tn5250_display_field_data(This->display, iter),
+            for (iter = field; tn5250_field_is_continued(iter);
+                 iter = iter->next) {
+                memcpy(joined + i,
+                       tn5250_display_field_data_const(This->display, iter),
                        tn5250_field_length(iter));
                 i += tn5250_field_length(iter);
                 if (tn5250_field_is_continued_last(iter)) {
                     break;
                 }
             }
+            data = joined;
         }
         else {
             return;
@@ -596,8 +776,8 @@ static void tn5250_session_send_field(Tn5250Session* This, Tn5250Buffer* buf,
         break;
     }
 
-    if (field->continuous) {
-        free(data);
+    if (joined != NULL) {
+        free(joined);
     }
     return;
 }
@@ -1500,6 +1680,7 @@ static void tn5250_session_start_of_field(Tn5250Session* This) {
     int Y, X;
     /* int done, curpos; */
     Tn5250Field* field;
+    Tn5250Field new_field;
     unsigned char FFW1, FFW2, FCW1, FCW2;
     Tn5250Uint16 FCW;
     unsigned char Attr;
@@ -1720,42 +1901,61 @@ static void tn5250_session_start_of_field(Tn5250Session* This) {
                 tn5250_field_start_row(field) == Y) {
                 field->FFW = (FFW1 << 8) | FFW2;
                 field->attribute = Attr;
+                tn5250_dbuffer_invalidate_field_links(
+                    tn5250_display_dbuffer(This->display));
             }
         }
         else {
             TN5250_LOG(("StartOfField: Adding field.\n"));
-            field = tn5250_field_new(tn5250_display_width(This->display));
-            TN5250_ASSERT(field != NULL);
+            /* The format table keeps its own copy of the field, so it is
+             * built up on the stack. */
+            field = &new_field;
+            memset(field, 0, sizeof(Tn5250Field));
+            field->id = -1;
+            field->w = tn5250_display_width(This->display);
 
             field->FFW = (FFW1 << 8) | FFW2;
             field->resequence = resequence;
-            field->magstripe = magstripe;
-            field->lightpen = lightpen;
-            field->magandlight = magandlight;
-            field->lightandattn = lightandattn;
-            field->ideographiconly = ideographiconly;
-            field->ideographicdatatype = ideographicdatatype;
-            field->ideographiceither = ideographiceither;
-            field->ideographicopen = ideographicopen;
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_MAGSTRIPE, magstripe);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_LIGHTPEN, lightpen);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_MAGANDLIGHT,
+                                  magandlight);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_LIGHTANDATTN,
+                                  lightandattn);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_IDEOGRAPHIC_ONLY,
+                                  ideographiconly);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_IDEOGRAPHIC_DATA,
+                                  ideographicdatatype);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_IDEOGRAPHIC_EITHER,
+                                  ideographiceither);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_IDEOGRAPHIC_OPEN,
+                                  ideographicopen);
             field->transparency = transparency;
-            field->forwardedge = forwardedge;
-            field->continuous = continuous;
-            field->continued_first = cont_first;
-            field->continued_middle = cont_middle;
-            field->continued_last = cont_last;
-            field->wordwrap = wordwrap;
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_FORWARD_EDGE,
+                                  forwardedge);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_CONTINUED,
+                                  continuous);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_CONTINUED_FIRST,
+                                  cont_first);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_CONTINUED_MIDDLE,
+                                  cont_middle);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_CONTINUED_LAST,
+                                  cont_last);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_WORDWRAP, wordwrap);
             field->nextfieldprogressionid = progressionid;
             field->highlightentryattr = highlightentryattr;
             field->pointeraid = pointeraid;
-            field->selfcheckmod11 = selfcheckmod11;
-            field->selfcheckmod10 = selfcheckmod10;
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_SELF_CHECK_MOD11,
+                                  selfcheckmod11);
+            tn5250_field_set_flag(field, TN5250_FIELD_FCW_SELF_CHECK_MOD10,
+                                  selfcheckmod10);
             field->attribute = Attr;
             field->length = (Length1 << 8) | Length2;
             field->start_row = Y;
             field->start_col = X;
 
-            tn5250_dbuffer_add_field(tn5250_display_dbuffer(This->display),
-                                     field);
+            field = tn5250_dbuffer_add_field_copy(
+                tn5250_display_dbuffer(This->display), field);
         }
     }
     else {
@@ -2367,7 +2567,7 @@ static void tn5250_session_read_cmd(Tn5250Session* This, int readop) {
 static void tn5250_session_query_reply(Tn5250Session* This) {
     unsigned char temp[67];
     const char* scan;
-    int dev_type, dev_model, i, enhanced;
+    int dev_type, dev_model, enhanced;
     StreamHeader header;
 
     TN5250_LOG(("Sending QueryReply.\n"));
@@ -2465,10 +2665,8 @@ static void tn5250_session_query_reply(Tn5250Session* This) {
     sprintf((char*)temp + 30, "%04d", dev_type);
     sprintf((char*)temp + 35, "%02d", dev_model);
 
-    for (i = 30; i <= 36; i++) {
-        temp[i] = tn5250_char_map_to_remote(
-            tn5250_display_char_map(This->display), temp[i]);
-    }
+    tn5250_char_map_to_remote_n(tn5250_display_char_map(This->display),
+                                temp + 30, temp + 30, 7);
 
     temp[37] = 0x02; /* Keyboard ID:
                         X'02' = Standard Keyboard
@@ -83,6 +83,8 @@ extern "C" {
 
 struct _Tn5250Display;
 struct _Tn5250Config;
+struct _Tn5250ScreenRegistry;
+struct _Tn5250Screen;
 
 /****s* lib5250/Tn5250Session
  * NAME
@@ -108,6 +110,10 @@ struct _Tn5250Session {
     struct _Tn5250Config* config;
     int read_opcode; /* Current read opcode. */
     int invited;
+
+    struct _Tn5250ScreenRegistry* screens; /* Not owned by the session */
+    struct _Tn5250Screen* screen; /* Screen recognised after last receive */
+    int received; /* Host data handled since the display was last drawn */
 };
 
 typedef struct _Tn5250Session Tn5250Session;
@@ -122,6 +128,18 @@ extern void tn5250_session_set_stream(Tn5250Session* This,
                                       Tn5250Stream /*@only@*/* newstream);
 #define tn5250_session_stream(This) ((This)->stream)
 
+extern void
+tn5250_session_set_screen_registry(Tn5250Session* This,
+                                   struct _Tn5250ScreenRegistry* screens);
+#define tn5250_session_screen_registry(This) ((This)->screens)
+#define tn5250_session_screen(This)          ((This)->screen)
+
+extern int tn5250_session_wait_for_text(Tn5250Session* This, const char* text,
+                                        int top, int left, int bottom,
+                                        int right, long timeout);
+
+extern int tn5250_session_poll(Tn5250Session* This);
+extern int tn5250_session_receive(Tn5250Session* This);
 extern void tn5250_session_main_loop(Tn5250Session* This);
 
 #ifdef __cplusplus
@@ -0,0 +1,716 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#include "tn5250-private.h"
+
+#if !defined(WIN32) && defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#define SHADOW_SUPPORTED 1
+#endif
+
+#ifdef SHADOW_SUPPORTED
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define SHADOW_MESSAGE_HEADER 5 /* Type byte and length */
+
+/* An encoded screen or delta, shared by every observer sending it.  Its
+ * reference count is only touched with the lock held. */
+struct _Tn5250ShadowMessage {
+    int refs;
+    unsigned long len;
+    unsigned char* data;
+};
+
+typedef struct _Tn5250ShadowMessage Tn5250ShadowMessage;
+
+/* Belongs to the thread. */
+struct _Tn5250ShadowObserver {
+    struct _Tn5250ShadowObserver* next;
+    int fd;
+    unsigned long seq;   /* Sequence number of the next delta to send */
+    unsigned long epoch; /* Value of epoch when this was last in step */
+    int resync;          /* Send the whole screen next */
+    Tn5250ShadowMessage* msg; /* Message being sent */
+    unsigned long sent;       /* How much of it has gone */
+};
+
+typedef struct _Tn5250ShadowObserver Tn5250ShadowObserver;
+
+struct _Tn5250ShadowPrivate {
+    char* path;
+    int listen_fd;
+    int wake[2];
+    pthread_mutex_t lock;
+    pthread_t thread;
+
+    /* Shared, under the lock.  Delta number seq is in
+     * log[seq % TN5250_SHADOW_LOG_SIZE], and takes a reader from the
+     * screen before it to the screen after it; latest is the screen
+     * after the last delta.  epoch changes when the screen moved on
+     * without a delta, which puts every observer out of step. */
+    Tn5250ShadowMessage* log[TN5250_SHADOW_LOG_SIZE];
+    unsigned long next_seq;
+    unsigned long epoch;
+    Tn5250Snapshot* latest;
+    unsigned long latest_indicators;
+    int woken; /* A byte is waiting in the wake pipe */
+    int stop;
+
+    /* Belong to the session. */
+    unsigned char* buf;
+    unsigned long alloc;
+
+    /* Belong to the thread. */
+    Tn5250ShadowObserver* observers;
+    unsigned char* screen_buf;
+    unsigned long screen_alloc;
+};
+
+typedef struct _Tn5250ShadowPrivate Tn5250ShadowPrivate;
+
+static Tn5250ShadowMessage* shadow_message_new(int type,
+                                               const unsigned char* data,
+                                               unsigned long len);
+static void shadow_message_unref(Tn5250ShadowMessage* msg);
+static void* shadow_thread(void* arg);
+static void shadow_accept(Tn5250Shadow* This);
+static int shadow_pending(Tn5250Shadow* This, Tn5250ShadowObserver* obs);
+static int shadow_send(Tn5250Shadow* This, Tn5250ShadowObserver* obs);
+static void shadow_drop(Tn5250Shadow* This, Tn5250ShadowObserver* obs);
+static int shadow_nonblocking(int fd);
+
+#endif /* SHADOW_SUPPORTED */
+
+/****f* lib5250/tn5250_shadow_new
+ * NAME
+ *    tn5250_shadow_new
+ * SYNOPSIS
+ *    shadow = tn5250_shadow_new ("/tmp/tn5250.sock");
+ * INPUTS
+ *    const char *         path       - Where to create the socket.
+ * DESCRIPTION
+ *    Create the socket, which only its owner may connect to, and start
+ *    the thread which looks after the observers.  A socket already at
+ *    ``path'', left by a session which went away, is replaced; anything
+ *    else there is left alone and NULL returned.  Returns NULL too if the
+ *    socket can't be created, or if this platform has no unix sockets or
+ *    threads.
+ *****/
+Tn5250Shadow* tn5250_shadow_new(const char* path) {
+#ifdef SHADOW_SUPPORTED
+    Tn5250Shadow* This;
+    Tn5250ShadowPrivate* p;
+    struct sockaddr_un addr;
+    struct stat st;
+    mode_t mask;
+    int r;
+
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        TN5250_LOG(("Shadow: socket path too long: %s\n", path));
+        return NULL;
+    }
+    This = tn5250_new(Tn5250Shadow, 1);
+    p = tn5250_new(Tn5250ShadowPrivate, 1);
+    if (This == NULL || p == NULL) {
+        free(This);
+        free(p);
+        return NULL;
+    }
+    memset(This, 0, sizeof(Tn5250Shadow));
+    memset(p, 0, sizeof(Tn5250ShadowPrivate));
+    This->data = p;
+    p->listen_fd = -1;
+    p->wake[0] = p->wake[1] = -1;
+
+    if (lstat(path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            TN5250_LOG(("Shadow: %s is there and isn't a socket\n", path));
+            goto fail;
+        }
+        unlink(path);
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    if ((p->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        TN5250_LOG(("Shadow: can't create socket: %s\n", strerror(errno)));
+        goto fail;
+    }
+
+    /* Nobody else may connect, even in the moment before the chmod. */
+    mask = umask(0077);
+    r = bind(p->listen_fd, (struct sockaddr*)&addr, sizeof(addr));
+    umask(mask);
+    if (r < 0 || chmod(path, 0600) < 0 || listen(p->listen_fd, 16) < 0 ||
+        shadow_nonblocking(p->listen_fd) < 0 || pipe(p->wake) < 0 ||
+        shadow_nonblocking(p->wake[0]) < 0 ||
+        shadow_nonblocking(p->wake[1]) < 0) {
+        TN5250_LOG(("Shadow: can't listen on %s: %s\n", path,
+                    strerror(errno)));
+        goto fail;
+    }
+    p->path = (char*)malloc(strlen(path) + 1);
+    TN5250_ASSERT(p->path != NULL);
+    strcpy(p->path, path);
+
+    pthread_mutex_init(&p->lock, NULL);
+    if (pthread_create(&p->thread, NULL, shadow_thread, This) != 0) {
+        TN5250_LOG(("Shadow: can't start thread\n"));
+        pthread_mutex_destroy(&p->lock);
+        unlink(path);
+        free(p->path);
+        goto fail;
+    }
+    return This;
+
+fail:
+    if (p->listen_fd >= 0) {
+        close(p->listen_fd);
+    }
+    if (p->wake[0] >= 0) {
+        close(p->wake[0]);
+        close(p->wake[1]);
+    }
+    free(p);
+    free(This);
+    return NULL;
+#else
+    TN5250_LOG(("Shadow: not supported on this platform\n"));
+    return NULL;
+#endif
+}
+
+/****f* lib5250/tn5250_shadow_destroy
+ * NAME
+ *    tn5250_shadow_destroy
+ * SYNOPSIS
+ *    tn5250_shadow_destroy (This);
+ * INPUTS
+ *    Tn5250Shadow *       This       -
+ * DESCRIPTION
+ *    Disconnect the observers, remove the socket and free the shadow.
+ *****/
+void tn5250_shadow_destroy(Tn5250Shadow* This) {
+#ifdef SHADOW_SUPPORTED
+    Tn5250ShadowPrivate* p = This->data;
+    int i;
+
+    pthread_mutex_lock(&p->lock);
+    p->stop = 1;
+    pthread_mutex_unlock(&p->lock);
+    if (write(p->wake[1], "", 1) < 0) {
+        /* Full, so the thread is being woken anyway. */
+    }
+    pthread_join(p->thread, NULL);
+
+    while (p->observers != NULL) {
+        shadow_drop(This, p->observers);
+    }
+    close(p->listen_fd);
+    close(p->wake[0]);
+    close(p->wake[1]);
+    unlink(p->path);
+    free(p->path);
+
+    for (i = 0; i < TN5250_SHADOW_LOG_SIZE; i++) {
+        if (p->log[i] != NULL) {
+            shadow_message_unref(p->log[i]);
+        }
+    }
+    if (p->latest != NULL) {
+        tn5250_snapshot_unref(p->latest);
+    }
+    pthread_mutex_destroy(&p->lock);
+    free(p->buf);
+    free(p->screen_buf);
+    free(p);
+#endif
+    free(This);
+}
+
+/****f* lib5250/tn5250_shadow_frame
+ * NAME
+ *    tn5250_shadow_frame
+ * SYNOPSIS
+ *    tn5250_shadow_frame (This, display);
+ * INPUTS
+ *    Tn5250Shadow *       This       -
+ *    Tn5250Display *      display    - Display which has just been drawn.
+ * DESCRIPTION
+ *    Pass the rows which have changed since the last frame on to the
+ *    observers.  With no observers this only takes a snapshot, for the
+ *    next observer to be sent.  Nothing here waits on an observer.
+ *****/
+void tn5250_shadow_frame(Tn5250Shadow* This, Tn5250Display* display) {
+#ifdef SHADOW_SUPPORTED
+    Tn5250ShadowPrivate* p = This->data;
+    Tn5250ShadowMessage* msg = NULL;
+    Tn5250ShadowMessage* old_msg = NULL;
+    Tn5250Snapshot* snap;
+    Tn5250Snapshot* old;
+    unsigned long indicators = (unsigned long)display->indicators;
+    unsigned long len;
+    int wake = 0;
+
+    /* Only this thread changes latest, so it can be read unlocked. */
+    snap = tn5250_snapshot_new(display->display_buffers);
+    if (snap == p->latest && indicators == p->latest_indicators) {
+        tn5250_snapshot_unref(snap);
+        return;
+    }
+    This->frames++;
+
+    if (This->observers > 0) {
+        len = tn5250_snapshot_encode(snap, p->latest, indicators, &p->buf,
+                                     &p->alloc);
+        if (len > 0) {
+            msg = shadow_message_new(p->latest == NULL ? TN5250_SHADOW_SCREEN
+                                                       : TN5250_SHADOW_DELTA,
+                                     p->buf, len);
+        }
+    }
+
+    pthread_mutex_lock(&p->lock);
+    old = p->latest;
+    p->latest = snap;
+    p->latest_indicators = indicators;
+    if (msg != NULL) {
+        old_msg = p->log[p->next_seq % TN5250_SHADOW_LOG_SIZE];
+        p->log[p->next_seq % TN5250_SHADOW_LOG_SIZE] = msg;
+        p->next_seq++;
+        This->broadcasts++;
+        This->bytes += msg->len;
+        if (old_msg != NULL) {
+            shadow_message_unref(old_msg);
+        }
+    }
+    else if (This->observers > 0) {
+        /* Someone connected since we looked. */
+        p->epoch++;
+    }
+    if (This->observers > 0 && !p->woken) {
+        p->woken = 1;
+        wake = 1;
+    }
+    pthread_mutex_unlock(&p->lock);
+
+    if (wake && write(p->wake[1], "", 1) < 0) {
+        TN5250_LOG(("Shadow: can't wake thread: %s\n", strerror(errno)));
+    }
+    if (old != NULL) {
+        tn5250_snapshot_unref(old);
+    }
+#endif
+}
+
+/****f* lib5250/tn5250_shadow_viewer_new
+ * NAME
+ *    tn5250_shadow_viewer_new
+ * SYNOPSIS
+ *    viewer = tn5250_shadow_viewer_new ("/tmp/tn5250.sock");
+ * INPUTS
+ *    const char *         path       - Socket of the session to watch.
+ * DESCRIPTION
+ *    Connect to a shadowed session.  Returns NULL if we can't.
+ *****/
+Tn5250ShadowViewer* tn5250_shadow_viewer_new(const char* path) {
+#ifdef SHADOW_SUPPORTED
+    Tn5250ShadowViewer* This;
+    struct sockaddr_un addr;
+
+    if (strlen(path) >= sizeof(addr.sun_path) ||
+        (This = tn5250_new(Tn5250ShadowViewer, 1)) == NULL) {
+        return NULL;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    if ((This->fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+        connect(This->fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        TN5250_LOG(("Shadow: can't connect to %s: %s\n", path,
+                    strerror(errno)));
+        if (This->fd >= 0) {
+            close(This->fd);
+        }
+        free(This);
+        return NULL;
+    }
+    This->dbuffer = tn5250_dbuffer_new(80, 24);
+    TN5250_ASSERT(This->dbuffer != NULL);
+    This->indicators = 0;
+    This->frames = 0;
+    This->buf = NULL;
+    This->len = This->alloc = 0;
+    return This;
+#else
+    return NULL;
+#endif
+}
+
+/****f* lib5250/tn5250_shadow_viewer_destroy
+ * NAME
+ *    tn5250_shadow_viewer_destroy
+ * SYNOPSIS
+ *    tn5250_shadow_viewer_destroy (This);
+ * INPUTS
+ *    Tn5250ShadowViewer * This       -
+ * DESCRIPTION
+ *    Disconnect and free the viewer.
+ *****/
+void tn5250_shadow_viewer_destroy(Tn5250ShadowViewer* This) {
+#ifdef SHADOW_SUPPORTED
+    close(This->fd);
+#endif
+    tn5250_dbuffer_destroy(This->dbuffer);
+    free(This->buf);
+    free(This);
+}
+
+/****f* lib5250/tn5250_shadow_viewer_read
+ * NAME
+ *    tn5250_shadow_viewer_read
+ * SYNOPSIS
+ *    n = tn5250_shadow_viewer_read (This);
+ * INPUTS
+ *    Tn5250ShadowViewer * This       -
+ * DESCRIPTION
+ *    Read from the socket, waiting if there is nothing to read, and
+ *    apply each whole message read to the display buffer.  Returns the
+ *    number of messages applied, which may be 0, or -1 if the session
+ *    has gone or sent something we don't understand.
+ *****/
+int tn5250_shadow_viewer_read(Tn5250ShadowViewer* This) {
+#ifdef SHADOW_SUPPORTED
+    unsigned char* p;
+    unsigned long len, used = 0;
+    long n;
+    int count = 0;
+
+    if (This->alloc - This->len < 4096) {
+        p = (unsigned char*)realloc(This->buf, This->alloc + 8192);
+        if (p == NULL) {
+            return -1;
+        }
+        This->buf = p;
+        This->alloc += 8192;
+    }
+    n = (long)read(This->fd, This->buf + This->len, This->alloc - This->len);
+    if (n < 0 && (errno == EINTR || errno == EAGAIN)) {
+        return 0;
+    }
+    if (n <= 0) {
+        return -1;
+    }
+    This->len += n;
+
+    while (This->len - used >= 5) {
+        p = This->buf + used;
+        len = ((unsigned long)p[1] << 24) | ((unsigned long)p[2] << 16) |
+              ((unsigned long)p[3] << 8) | p[4];
+        if (This->len - used - 5 < len) {
+            break;
+        }
+        if (tn5250_snapshot_decode(This->dbuffer, p + 5, len,
+                                   &This->indicators) < 0) {
+            return -1;
+        }
+        used += 5 + len;
+        This->frames++;
+        count++;
+    }
+    if (used > 0) {
+        memmove(This->buf, This->buf + used, This->len - used);
+        This->len -= used;
+    }
+    return count;
+#else
+    return -1;
+#endif
+}
+
+#ifdef SHADOW_SUPPORTED
+
+/*
+ *    Make a message with one reference from an encoded screen.
+ */
+static Tn5250ShadowMessage* shadow_message_new(int type,
+                                               const unsigned char* data,
+                                               unsigned long len) {
+    Tn5250ShadowMessage* msg;
+
+    msg = (Tn5250ShadowMessage*)malloc(sizeof(Tn5250ShadowMessage) +
+                                       SHADOW_MESSAGE_HEADER + len);
+    if (msg == NULL) {
+        return NULL;
+    }
+    msg->refs = 1;
+    msg->len = SHADOW_MESSAGE_HEADER + len;
+    msg->data = (unsigned char*)(msg + 1);
+    msg->data[0] = (unsigned char)type;
+    msg->data[1] = (unsigned char)(len >> 24);
+    msg->data[2] = (unsigned char)(len >> 16);
+    msg->data[3] = (unsigned char)(len >> 8);
+    msg->data[4] = (unsigned char)len;
+    memcpy(msg->data + SHADOW_MESSAGE_HEADER, data, len);
+    return msg;
+}
+
+/*
+ *    Drop a reference to a message.  Called with the lock held.
+ */
+static void shadow_message_unref(Tn5250ShadowMessage* msg) {
+    if (--msg->refs == 0) {
+        free(msg);
+    }
+}
+
+/*
+ *    The thread: accept observers and send them what they are owed,
+ *    whenever the session wakes us or an observer can take more.
+ */
+static void* shadow_thread(void* arg) {
+    Tn5250Shadow* This = (Tn5250Shadow*)arg;
+    Tn5250ShadowPrivate* p = This->data;
+    Tn5250ShadowObserver* obs;
+    Tn5250ShadowObserver* next;
+    fd_set rfds, wfds;
+    char junk[256];
+    int maxfd;
+
+    for (;;) {
+        FD_ZERO(&rfds);
+        FD_ZERO(&wfds);
+        FD_SET(p->wake[0], &rfds);
+        FD_SET(p->listen_fd, &rfds);
+        maxfd = p->wake[0] > p->listen_fd ? p->wake[0] : p->listen_fd;
+        for (obs = p->observers; obs != NULL; obs = obs->next) {
+            FD_SET(obs->fd, &rfds);
+            if (shadow_pending(This, obs)) {
+                FD_SET(obs->fd, &wfds);
+            }
+            if (obs->fd > maxfd) {
+                maxfd = obs->fd;
+            }
+        }
+        if (select(maxfd + 1, &rfds, &wfds, NULL, NULL) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            TN5250_LOG(("Shadow: select: %s\n", strerror(errno)));
+            break;
+        }
+
+        if (FD_ISSET(p->wake[0], &rfds)) {
+            while (read(p->wake[0], junk, sizeof(junk)) > 0) {
+            }
+            pthread_mutex_lock(&p->lock);
+            p->woken = 0;
+            if (p->stop) {
+                pthread_mutex_unlock(&p->lock);
+                break;
+            }
+            pthread_mutex_unlock(&p->lock);
+        }
+        if (FD_ISSET(p->listen_fd, &rfds)) {
+            shadow_accept(This);
+        }
+
+        for (obs = p->observers; obs != NULL; obs = next) {
+            next = obs->next;
+            if (FD_ISSET(obs->fd, &rfds)) {
+                /* Observers have nothing to say; this is a hang up. */
+                long n = (long)read(obs->fd, junk, sizeof(junk));
+                if (n == 0 ||
+                    (n < 0 && errno != EAGAIN && errno != EINTR)) {
+                    shadow_drop(This, obs);
+                    continue;
+                }
+            }
+            if (shadow_send(This, obs) < 0) {
+                shadow_drop(This, obs);
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ *    Take on the observers waiting to connect.  Each starts by being sent
+ *    the whole screen.
+ */
+static void shadow_accept(Tn5250Shadow* This) {
+    Tn5250ShadowPrivate* p = This->data;
+    Tn5250ShadowObserver* obs;
+    int fd;
+
+    while ((fd = accept(p->listen_fd, NULL, NULL)) >= 0) {
+        if (shadow_nonblocking(fd) < 0 ||
+            (obs = tn5250_new(Tn5250ShadowObserver, 1)) == NULL) {
+            close(fd);
+            continue;
+        }
+        obs->fd = fd;
+        obs->seq = 0;
+        obs->epoch = 0;
+        obs->resync = 1;
+        obs->msg = NULL;
+        obs->sent = 0;
+        obs->next = p->observers;
+        p->observers = obs;
+
+        pthread_mutex_lock(&p->lock);
+        This->observers++;
+        pthread_mutex_unlock(&p->lock);
+        TN5250_LOG(("Shadow: observer connected\n"));
+    }
+}
+
+/*
+ *    Is there anything to send to this observer?
+ */
+static int shadow_pending(Tn5250Shadow* This, Tn5250ShadowObserver* obs) {
+    Tn5250ShadowPrivate* p = This->data;
+    int pending;
+
+    if (obs->msg != NULL) {
+        return 1;
+    }
+    pthread_mutex_lock(&p->lock);
+    pending = p->latest != NULL && (obs->resync || obs->epoch != p->epoch ||
+                                    obs->seq != p->next_seq);
+    pthread_mutex_unlock(&p->lock);
+    return pending;
+}
+
+/*
+ *    Send an observer as much as it will take without blocking.  An
+ *    observer which is out of step, or whose next delta has left the log,
+ *    is sent the latest screen instead.  Returns -1 if the observer has
+ *    gone.
+ */
+static int shadow_send(Tn5250Shadow* This, Tn5250ShadowObserver* obs) {
+    Tn5250ShadowPrivate* p = This->data;
+    Tn5250Snapshot* snap;
+    unsigned long indicators, len;
+    long n;
+
+    for (;;) {
+        if (obs->msg == NULL) {
+            pthread_mutex_lock(&p->lock);
+            if (p->latest == NULL) {
+                pthread_mutex_unlock(&p->lock);
+                return 0;
+            }
+            if (obs->resync || obs->epoch != p->epoch ||
+                p->next_seq - obs->seq > TN5250_SHADOW_LOG_SIZE) {
+                if (!obs->resync) {
+                    This->resyncs++;
+                }
+                snap = tn5250_snapshot_ref(p->latest);
+                indicators = p->latest_indicators;
+                obs->seq = p->next_seq;
+                obs->epoch = p->epoch;
+                obs->resync = 0;
+                pthread_mutex_unlock(&p->lock);
+
+                len = tn5250_snapshot_encode(snap, NULL, indicators,
+                                             &p->screen_buf, &p->screen_alloc);
+                tn5250_snapshot_unref(snap);
+                if (len == 0 ||
+                    (obs->msg = shadow_message_new(
+                         TN5250_SHADOW_SCREEN, p->screen_buf, len)) == NULL) {
+                    return -1;
+                }
+            }
+            else if (obs->seq != p->next_seq) {
+                obs->msg = p->log[obs->seq % TN5250_SHADOW_LOG_SIZE];
+                obs->msg->refs++;
+                obs->seq++;
+                pthread_mutex_unlock(&p->lock);
+            }
+            else {
+                pthread_mutex_unlock(&p->lock);
+                return 0;
+            }
+            obs->sent = 0;
+        }
+
+        n = (long)send(obs->fd, obs->msg->data + obs->sent,
+                       obs->msg->len - obs->sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+        }
+        obs->sent += n;
+        if (obs->sent == obs->msg->len) {
+            pthread_mutex_lock(&p->lock);
+            shadow_message_unref(obs->msg);
+            pthread_mutex_unlock(&p->lock);
+            obs->msg = NULL;
+        }
+    }
+}
+
+/*
+ *    Disconnect an observer.
+ */
+static void shadow_drop(Tn5250Shadow* This, Tn5250ShadowObserver* obs) {
+    Tn5250ShadowPrivate* p = This->data;
+    Tn5250ShadowObserver** link;
+
+    for (link = &p->observers; *link != obs; link = &(*link)->next) {
+    }
+    *link = obs->next;
+    close(obs->fd);
+
+    pthread_mutex_lock(&p->lock);
+    if (obs->msg != NULL) {
+        shadow_message_unref(obs->msg);
+    }
+    This->observers--;
+    pthread_mutex_unlock(&p->lock);
+    free(obs);
+    TN5250_LOG(("Shadow: observer disconnected\n"));
+}
+
+/*
+ *    Put a descriptor in non-blocking mode, and keep it from children.
+ */
+static int shadow_nonblocking(int fd) {
+    int flags;
+
+    if ((flags = fcntl(fd, F_GETFL)) < 0 ||
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        return -1;
+    }
+    return fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+#endif /* SHADOW_SUPPORTED */
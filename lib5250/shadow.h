@@ -0,0 +1,126 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef SHADOW_H
+#define SHADOW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Deltas an observer may fall behind by before it is sent the whole
+ * screen again instead. */
+#define TN5250_SHADOW_LOG_SIZE 256
+
+/* Message types on the socket. */
+#define TN5250_SHADOW_SCREEN 'K'
+#define TN5250_SHADOW_DELTA  'D'
+
+struct _Tn5250DBuffer;
+struct _Tn5250Display;
+struct _Tn5250ShadowPrivate;
+
+/****s* lib5250/Tn5250Shadow
+ * NAME
+ *    Tn5250Shadow
+ * SYNOPSIS
+ *    Tn5250Shadow *shadow = tn5250_shadow_new ("/tmp/tn5250.sock");
+ *    tn5250_shadow_frame (shadow, display);
+ *    tn5250_shadow_destroy (shadow);
+ * DESCRIPTION
+ *    Lets other processes watch a session, read only, over a unix
+ *    socket.  An observer which connects is sent the whole screen, and
+ *    then the rows which change each time the display is drawn.
+ *
+ *    The session encodes each delta once, into a message which goes in
+ *    a ring of the last TN5250_SHADOW_LOG_SIZE deltas, and wakes a
+ *    thread which sends the same message to every observer.  The
+ *    session never waits for an observer: one which falls so far behind
+ *    that the deltas it needs have left the ring is sent the current
+ *    screen and carries on from there.
+ *
+ *    Each message is a type byte, TN5250_SHADOW_SCREEN or
+ *    TN5250_SHADOW_DELTA, a four byte big endian length, and a screen as
+ *    encoded by tn5250_snapshot_encode.  Screens come from snapshots, so
+ *    observers are never sent what is in a nondisplay field.
+ * SOURCE
+ */
+struct _Tn5250Shadow {
+    struct _Tn5250ShadowPrivate* data;
+    int observers;
+    unsigned long frames;     /* Frames the session has drawn */
+    unsigned long broadcasts; /* Deltas encoded for the observers */
+    unsigned long bytes;      /* Bytes in those deltas */
+    unsigned long resyncs;    /* Screens sent to observers which fell behind */
+};
+
+typedef struct _Tn5250Shadow Tn5250Shadow;
+/*******/
+
+/****s* lib5250/Tn5250ShadowViewer
+ * NAME
+ *    Tn5250ShadowViewer
+ * SYNOPSIS
+ *    Tn5250ShadowViewer *v = tn5250_shadow_viewer_new ("/tmp/tn5250.sock");
+ *    while (tn5250_shadow_viewer_read (v) >= 0)
+ *       show (tn5250_shadow_viewer_dbuffer (v));
+ *    tn5250_shadow_viewer_destroy (v);
+ * DESCRIPTION
+ *    The observer's end of a Tn5250Shadow socket.  Screens and deltas
+ *    read from the socket are applied to a display buffer.
+ * SOURCE
+ */
+struct _Tn5250ShadowViewer {
+    int fd;
+    struct _Tn5250DBuffer* dbuffer;
+    unsigned long indicators;
+    unsigned long frames;
+    unsigned char* buf;
+    unsigned long len, alloc;
+};
+
+typedef struct _Tn5250ShadowViewer Tn5250ShadowViewer;
+/*******/
+
+extern Tn5250Shadow* tn5250_shadow_new(const char* path);
+extern void tn5250_shadow_destroy(Tn5250Shadow* This);
+extern void tn5250_shadow_frame(Tn5250Shadow* This,
+                                struct _Tn5250Display* display);
+
+#define tn5250_shadow_observers(This)  ((This)->observers)
+#define tn5250_shadow_frames(This)     ((This)->frames)
+#define tn5250_shadow_broadcasts(This) ((This)->broadcasts)
+#define tn5250_shadow_resyncs(This)    ((This)->resyncs)
+
+extern Tn5250ShadowViewer* tn5250_shadow_viewer_new(const char* path);
+extern void tn5250_shadow_viewer_destroy(Tn5250ShadowViewer* This);
+extern int tn5250_shadow_viewer_read(Tn5250ShadowViewer* This);
+
+#define tn5250_shadow_viewer_fd(This)         ((This)->fd)
+#define tn5250_shadow_viewer_dbuffer(This)    ((This)->dbuffer)
+#define tn5250_shadow_viewer_indicators(This) ((This)->indicators)
+#define tn5250_shadow_viewer_frames(This)     ((This)->frames)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHADOW_H */
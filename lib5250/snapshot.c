@@ -0,0 +1,308 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#include "tn5250-private.h"
+
+/* Reference counts may be dropped from any thread. */
+#if defined(WIN32)
+#define snapshot_ref_inc(p) InterlockedIncrement((LONG volatile*)(p))
+#define snapshot_ref_dec(p) InterlockedDecrement((LONG volatile*)(p))
+#elif defined(__GNUC__)
+#define snapshot_ref_inc(p) __sync_add_and_fetch((p), 1)
+#define snapshot_ref_dec(p) __sync_sub_and_fetch((p), 1)
+#else
+#define snapshot_ref_inc(p) (++*(p))
+#define snapshot_ref_dec(p) (--*(p))
+#endif
+
+/* Attributes 0x27, 0x2f, 0x37 and 0x3f hide what follows them. */
+#define snapshot_nondisplay(a) ((a) != 0x00 && ((a) & 0x07) == 0x07)
+
+static Tn5250SnapshotRow* tn5250_snapshot_row_new(Tn5250DBuffer* dbuffer,
+                                                  int y);
+static void tn5250_snapshot_row_unref(Tn5250SnapshotRow* row);
+static void tn5250_snapshot_put16(unsigned char* p, unsigned long v);
+static unsigned long tn5250_snapshot_get16(const unsigned char* p);
+
+/****f* lib5250/tn5250_snapshot_new
+ * NAME
+ *    tn5250_snapshot_new
+ * SYNOPSIS
+ *    snap = tn5250_snapshot_new (dbuffer);
+ * INPUTS
+ *    Tn5250DBuffer *      dbuffer    - Buffer to take a snapshot of.
+ * DESCRIPTION
+ *    Return a snapshot of ``dbuffer'' holding one reference, which the
+ *    caller releases with tn5250_snapshot_unref.  If the buffer has not
+ *    changed since its last snapshot, that snapshot is returned again;
+ *    otherwise rows which have not changed are shared with it.
+ *****/
+Tn5250Snapshot* tn5250_snapshot_new(Tn5250DBuffer* dbuffer) {
+    Tn5250Snapshot* prev = dbuffer->snapshot;
+    Tn5250Snapshot* This;
+    int y;
+
+    if (prev != NULL && prev->generation == dbuffer->generation &&
+        prev->cx == dbuffer->cx && prev->cy == dbuffer->cy) {
+        return tn5250_snapshot_ref(prev);
+    }
+
+    /* The row pointers live in the same allocation, after the header. */
+    This = (Tn5250Snapshot*)malloc(sizeof(Tn5250Snapshot) +
+                                   dbuffer->h * sizeof(Tn5250SnapshotRow*));
+    TN5250_ASSERT(This != NULL);
+    This->rows = (Tn5250SnapshotRow**)(This + 1);
+    This->refcount = 1;
+    This->w = dbuffer->w;
+    This->h = dbuffer->h;
+    This->cx = dbuffer->cx;
+    This->cy = dbuffer->cy;
+    This->generation = dbuffer->generation;
+
+    for (y = 0; y < This->h; y++) {
+        if (prev != NULL &&
+            prev->rows[y]->generation == dbuffer->row_generation[y] &&
+            prev->rows[y]->start_attr ==
+                tn5250_dbuffer_row_start_attr(dbuffer, y)) {
+            This->rows[y] = prev->rows[y];
+            snapshot_ref_inc(&This->rows[y]->refcount);
+        }
+        else {
+            This->rows[y] = tn5250_snapshot_row_new(dbuffer, y);
+        }
+    }
+
+    /* The buffer keeps its own reference to share rows with next time. */
+    if (prev != NULL) {
+        tn5250_snapshot_unref(prev);
+    }
+    dbuffer->snapshot = tn5250_snapshot_ref(This);
+    return This;
+}
+
+/****f* lib5250/tn5250_snapshot_ref
+ * NAME
+ *    tn5250_snapshot_ref
+ * SYNOPSIS
+ *    snap = tn5250_snapshot_ref (This);
+ * INPUTS
+ *    Tn5250Snapshot *     This       -
+ * DESCRIPTION
+ *    Take another reference to the snapshot.  Returns the snapshot.
+ *****/
+Tn5250Snapshot* tn5250_snapshot_ref(Tn5250Snapshot* This) {
+    snapshot_ref_inc(&This->refcount);
+    return This;
+}
+
+/****f* lib5250/tn5250_snapshot_unref
+ * NAME
+ *    tn5250_snapshot_unref
+ * SYNOPSIS
+ *    tn5250_snapshot_unref (This);
+ * INPUTS
+ *    Tn5250Snapshot *     This       -
+ * DESCRIPTION
+ *    Drop a reference to the snapshot, freeing it (and any rows no other
+ *    snapshot is using) when the last one goes.
+ *****/
+void tn5250_snapshot_unref(Tn5250Snapshot* This) {
+    int y;
+
+    if (snapshot_ref_dec(&This->refcount) != 0) {
+        return;
+    }
+    for (y = 0; y < This->h; y++) {
+        tn5250_snapshot_row_unref(This->rows[y]);
+    }
+    free(This);
+}
+
+/****f* lib5250/tn5250_snapshot_encode
+ * NAME
+ *    tn5250_snapshot_encode
+ * SYNOPSIS
+ *    len = tn5250_snapshot_encode (This, prev, indicators, &buf, &alloc);
+ * INPUTS
+ *    Tn5250Snapshot *     This       - Screen to encode.
+ *    Tn5250Snapshot *     prev       - Screen the reader already has, or
+ *                                      NULL to encode every row.
+ *    unsigned long        indicators - Display indicators to go with it.
+ *    unsigned char **     buf        - Buffer to encode into, grown with
+ *                                      realloc as needed.
+ *    unsigned long *      alloc      - Size of ``buf''.
+ * DESCRIPTION
+ *    Encode the screen, or the rows of it which differ from ``prev'', as
+ *    the screen height, width, cursor row and column, the indicators,
+ *    the number of rows which follow, and each row as its number and its
+ *    contents.  Numbers are big endian; the indicators are four bytes and
+ *    the rest two.  Rows shared with ``prev'' are skipped without being
+ *    compared.  Every row is encoded if ``prev'' is a different size.
+ *    Returns the length, or 0 if the buffer could not be grown.
+ *****/
+unsigned long tn5250_snapshot_encode(Tn5250Snapshot* This, Tn5250Snapshot* prev,
+                                     unsigned long indicators,
+                                     unsigned char** buf,
+                                     unsigned long* alloc) {
+    unsigned long size, len;
+    unsigned char* p;
+    int y, rows = 0;
+
+    size = TN5250_SNAPSHOT_HEADER_SIZE + (unsigned long)This->h * (This->w + 2);
+    if (size > *alloc) {
+        if ((p = (unsigned char*)realloc(*buf, size)) == NULL) {
+            return 0;
+        }
+        *buf = p;
+        *alloc = size;
+    }
+    if (prev != NULL && (prev->w != This->w || prev->h != This->h)) {
+        prev = NULL;
+    }
+
+    p = *buf;
+    tn5250_snapshot_put16(p, This->h);
+    tn5250_snapshot_put16(p + 2, This->w);
+    tn5250_snapshot_put16(p + 4, This->cy);
+    tn5250_snapshot_put16(p + 6, This->cx);
+    tn5250_snapshot_put16(p + 8, indicators >> 16);
+    tn5250_snapshot_put16(p + 10, indicators);
+    len = TN5250_SNAPSHOT_HEADER_SIZE;
+    for (y = 0; y < This->h; y++) {
+        if (prev != NULL &&
+            (This->rows[y] == prev->rows[y] ||
+             memcmp(This->rows[y]->data, prev->rows[y]->data, This->w) == 0)) {
+            continue;
+        }
+        tn5250_snapshot_put16(p + len, y);
+        memcpy(p + len + 2, This->rows[y]->data, This->w);
+        len += This->w + 2;
+        rows++;
+    }
+    tn5250_snapshot_put16(p + 12, rows);
+    return len;
+}
+
+/****f* lib5250/tn5250_snapshot_decode
+ * NAME
+ *    tn5250_snapshot_decode
+ * SYNOPSIS
+ *    ret = tn5250_snapshot_decode (dbuffer, data, len, &indicators);
+ * INPUTS
+ *    Tn5250DBuffer *      dbuffer    - Buffer to apply the screen to.
+ *    const unsigned char * data      - Screen from tn5250_snapshot_encode.
+ *    unsigned long        len        - Length of ``data''.
+ *    unsigned long *      indicators - Set to the display indicators.
+ * DESCRIPTION
+ *    Apply an encoded screen to a display buffer, resizing the buffer if
+ *    the screen is a different size.  Only rows whose contents change
+ *    are marked dirty.  Returns 0, or -1 if the data is malformed.
+ *****/
+int tn5250_snapshot_decode(Tn5250DBuffer* dbuffer, const unsigned char* data,
+                           unsigned long len, unsigned long* indicators) {
+    const unsigned char* row;
+    unsigned char* dst;
+    int h, w, cy, cx, rows, y;
+
+    if (len < TN5250_SNAPSHOT_HEADER_SIZE) {
+        return -1;
+    }
+    h = (int)tn5250_snapshot_get16(data);
+    w = (int)tn5250_snapshot_get16(data + 2);
+    cy = (int)tn5250_snapshot_get16(data + 4);
+    cx = (int)tn5250_snapshot_get16(data + 6);
+    rows = (int)tn5250_snapshot_get16(data + 12);
+    if (h == 0 || w == 0 || cy >= h || cx >= w ||
+        len != TN5250_SNAPSHOT_HEADER_SIZE + (unsigned long)rows * (w + 2)) {
+        return -1;
+    }
+    for (row = data + TN5250_SNAPSHOT_HEADER_SIZE; row < data + len;
+         row += w + 2) {
+        if ((int)tn5250_snapshot_get16(row) >= h) {
+            return -1;
+        }
+    }
+
+    if (h != dbuffer->h || w != dbuffer->w) {
+        tn5250_dbuffer_set_size(dbuffer, h, w);
+    }
+    for (row = data + TN5250_SNAPSHOT_HEADER_SIZE; row < data + len;
+         row += w + 2) {
+        y = (int)tn5250_snapshot_get16(row);
+        if (memcmp(dbuffer->data + y * w, row + 2, w) != 0) {
+            dst = tn5250_dbuffer_writable_data(dbuffer, y, y) + y * w;
+            memcpy(dst, row + 2, w);
+        }
+    }
+    tn5250_dbuffer_cursor_set(dbuffer, cy, cx);
+    if (indicators != NULL) {
+        *indicators = (tn5250_snapshot_get16(data + 8) << 16) |
+                      tn5250_snapshot_get16(data + 10);
+    }
+    return 0;
+}
+
+/*
+ *    Copy row y of the buffer into a new row block with one reference,
+ *    nulling the cells which are not displayed.  The data lives in the
+ *    same allocation, just after the header.
+ */
+static Tn5250SnapshotRow* tn5250_snapshot_row_new(Tn5250DBuffer* dbuffer,
+                                                  int y) {
+    Tn5250SnapshotRow* row;
+    const unsigned char* attrs = tn5250_dbuffer_attr_row(dbuffer, y);
+    int x;
+
+    row = (Tn5250SnapshotRow*)malloc(sizeof(Tn5250SnapshotRow) + dbuffer->w);
+    TN5250_ASSERT(row != NULL);
+    row->refcount = 1;
+    row->generation = dbuffer->row_generation[y];
+    row->start_attr = tn5250_dbuffer_row_start_attr(dbuffer, y);
+    row->data = (unsigned char*)(row + 1);
+    memcpy(row->data, dbuffer->data + y * dbuffer->w, dbuffer->w);
+    for (x = 0; x < dbuffer->w; x++) {
+        if (snapshot_nondisplay(attrs[x])) {
+            row->data[x] = 0x00;
+        }
+    }
+    return row;
+}
+
+/*
+ *    Drop a reference to a row block.
+ */
+static void tn5250_snapshot_row_unref(Tn5250SnapshotRow* row) {
+    if (snapshot_ref_dec(&row->refcount) == 0) {
+        free(row);
+    }
+}
+
+/*
+ *    Store and fetch big endian numbers for the encoded form.
+ */
+static void tn5250_snapshot_put16(unsigned char* p, unsigned long v) {
+    p[0] = (unsigned char)(v >> 8);
+    p[1] = (unsigned char)v;
+}
+
+static unsigned long tn5250_snapshot_get16(const unsigned char* p) {
+    return ((unsigned long)p[0] << 8) | p[1];
+}
@@ -0,0 +1,101 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct _Tn5250DBuffer;
+
+/* Size of the screen header in an encoded snapshot. */
+#define TN5250_SNAPSHOT_HEADER_SIZE 14
+
+/****s* lib5250/Tn5250Snapshot
+ * NAME
+ *    Tn5250Snapshot
+ * SYNOPSIS
+ *    Tn5250Snapshot *snap = tn5250_snapshot_new (dbuffer);
+ *    ... hand snap to another thread ...
+ *    row = tn5250_snapshot_row (snap, y);
+ *    tn5250_snapshot_unref (snap);
+ * DESCRIPTION
+ *    An immutable, reference counted copy of the data plane and cursor of
+ *    a display buffer.  Cells under a nondisplay attribute are nulled in
+ *    the copy, so that a snapshot can be written to a recording or sent
+ *    to an observer without giving away passwords.  Rows are kept in
+ *    separately counted blocks, and a new snapshot shares every row
+ *    which has not changed since the buffer's previous snapshot, so
+ *    taking one costs a pointer per row plus a copy of the rows that
+ *    changed.  Nothing in a snapshot is written after it has been made,
+ *    and the reference counts are updated atomically, so snapshots may be
+ *    read and released from any thread.
+ *    Taking a snapshot must happen on the thread that owns the buffer.
+ * SOURCE
+ */
+struct _Tn5250SnapshotRow {
+    volatile long refcount;
+    unsigned long generation; /* Row generation this was copied at */
+    unsigned char start_attr; /* Attribute carried in from earlier rows */
+    unsigned char* data;
+};
+
+typedef struct _Tn5250SnapshotRow Tn5250SnapshotRow;
+
+struct _Tn5250Snapshot {
+    volatile long refcount;
+    int w, h;
+    int cx, cy;
+    unsigned long generation;
+    Tn5250SnapshotRow** rows;
+};
+
+typedef struct _Tn5250Snapshot Tn5250Snapshot;
+/*******/
+
+extern Tn5250Snapshot* tn5250_snapshot_new(struct _Tn5250DBuffer* dbuffer);
+extern Tn5250Snapshot* tn5250_snapshot_ref(Tn5250Snapshot* This);
+extern void tn5250_snapshot_unref(Tn5250Snapshot* This);
+extern unsigned long tn5250_snapshot_encode(Tn5250Snapshot* This,
+                                            Tn5250Snapshot* prev,
+                                            unsigned long indicators,
+                                            unsigned char** buf,
+                                            unsigned long* alloc);
+extern int tn5250_snapshot_decode(struct _Tn5250DBuffer* dbuffer,
+                                  const unsigned char* data, unsigned long len,
+                                  unsigned long* indicators);
+
+#define tn5250_snapshot_width(This)      ((This)->w)
+#define tn5250_snapshot_height(This)     ((This)->h)
+#define tn5250_snapshot_cursor_x(This)   ((This)->cx)
+#define tn5250_snapshot_cursor_y(This)   ((This)->cy)
+#define tn5250_snapshot_generation(This) ((This)->generation)
+#define tn5250_snapshot_row(This, y)                                           \
+    ((const unsigned char*)(This)->rows[(y)]->data)
+#define tn5250_snapshot_char_at(This, y, x) ((This)->rows[(y)]->data[(x)])
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAPSHOT_H */
@@ -27,12 +27,14 @@ extern "C" {
 #endif
 
 /* Flags */
-#define TN5250_TERMINAL_HAS_COLOR 0x0001
+#define TN5250_TERMINAL_HAS_COLOR  0x0001
+#define TN5250_TERMINAL_WAIT_LIMIT 0x0002
 
 /* Events */
-#define TN5250_TERMINAL_EVENT_KEY  0x0001
-#define TN5250_TERMINAL_EVENT_DATA 0x0002
-#define TN5250_TERMINAL_EVENT_QUIT 0x0004
+#define TN5250_TERMINAL_EVENT_KEY     0x0001
+#define TN5250_TERMINAL_EVENT_DATA    0x0002
+#define TN5250_TERMINAL_EVENT_QUIT    0x0004
+#define TN5250_TERMINAL_EVENT_TIMEOUT 0x0008
 
 /* Key definitions
  * These are directly copied from <curses.h>, although the only real
@@ -188,6 +190,15 @@ struct _Tn5250Terminal {
     void (*destroy_menuitem)(struct _Tn5250Terminal* This,
                              struct _Tn5250Display* display,
                              struct _Tn5250Menuitem* menuitem);
+
+    /* How long waitevent may block, in milliseconds, or -1 for as long as
+     * it likes.  The display sets this while the frame rate limit holds a
+     * frame back.  A terminal which honours it, returning
+     * TN5250_TERMINAL_EVENT_TIMEOUT when the time is up, says so with the
+     * TN5250_TERMINAL_WAIT_LIMIT flag; the display never sets it on any
+     * other terminal.  Kept at the end so that terminals built against an
+     * older lib5250 still line up. */
+    long wait_limit;
 };
 
 typedef struct _Tn5250Terminal Tn5250Terminal;
@@ -74,6 +74,10 @@
 #include "field.h"
 #include "codes5250.h"
 #include "scrollbar.h"
+#include "screen.h"
+#include "snapshot.h"
+#include "recorder.h"
+#include "shadow.h"
 #include "session.h"
 #include "printsession.h"
 #include "display.h"
@@ -82,6 +86,8 @@
 #include "wtd.h"
 #include "window.h"
 #include "terminal.h"
+#include "headless.h"
+#include "script.h"
 #include "debug.h"
 #include "scs.h"
 #include "conf.h"
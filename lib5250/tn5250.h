@@ -43,6 +43,12 @@ extern "C" {
 #include <tn5250/window.h>
 
 #include <tn5250/terminal.h>
+#include <tn5250/headless.h>
+#include <tn5250/script.h>
+#include <tn5250/screen.h>
+#include <tn5250/snapshot.h>
+#include <tn5250/recorder.h>
+#include <tn5250/shadow.h>
 #include <tn5250/session.h>
 #include <tn5250/printsession.h>
 #include <tn5250/debug.h>
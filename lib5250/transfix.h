@@ -0,0 +1,42 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef TRANSFIX_H
+#define TRANSFIX_H
+
+/* Corrections to the generated tables in transmaps.h.  Some characters
+ * were reported wrong for CCSID 870, and since transmaps.h is a generated
+ * file they are overridden here -SCK
+ *
+ * Each pair is { local, remote } and is applied in both directions, so
+ * that to_remote_map[local] == remote and to_local_map[remote] == local.
+ */
+
+static const unsigned char tn5250_transfix_870[][2] = {
+    {163, 186}, {172, 185}, {188, 183}, {202, 114}, {234, 82}};
+
+static const unsigned char tn5250_transfix_win870[][2] = {
+    {142, 184}, {143, 185}, {158, 182}, {159, 183},
+    {163, 186}, {202, 114}, {234, 82}};
+
+#define TN5250_TRANSFIX_COUNT(fix) ((int)(sizeof(fix) / sizeof(fix[0])))
+
+#endif /* TRANSFIX_H */
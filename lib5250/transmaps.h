@@ -1,5 +1,5 @@
 /* transmaps.h was automagically generated by transmaps and GNU recode.
-   Any changes should be made in transmaps or utility.c and NOT in this file!
+   Any changes should be made in transmaps or transfix.h and NOT in this file!
  */
 
 /* Conversion table generated mechanically by Free `recode' 3.6
@@ -2817,7 +2817,7 @@ unsigned char const ibm1026_to_windows_1254[256] = {
 /* This is the translation-map index which is scanned in utility.c
  */
 
-Tn5250CharMap tn5250_transmaps[] = {
+const Tn5250CharMap tn5250_transmaps[] = {
     // clang-format off
     { "37",      iso_8859_1_to_ibm037,    ibm037_to_iso_8859_1    },
     { "256",     iso_8859_1_to_ibm256,    ibm256_to_iso_8859_1    },
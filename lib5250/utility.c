@@ -20,7 +20,22 @@
  *
  */
 #include "tn5250-private.h"
-#include "transmaps.h"
+
+/* UTF-8 tables for each map, generated by mkcharmaps into charmaps.h along
+ * with tn5250_transmaps and in the same order.  ``out'' holds the encoded
+ * length and then the bytes for each EBCDIC character; ``keys'' and
+ * ``values'' are a perfect hash from Unicode code point back to EBCDIC. */
+typedef struct _Tn5250Utf8Map {
+    const unsigned char (*out)[4];
+    const Tn5250Uint16* keys;
+    const unsigned char* values;
+    unsigned long mult;
+    int shift;
+} Tn5250Utf8Map;
+
+#include "charmaps.h"
+
+#define TN5250_EBCDIC_SUB 0x3f
 
 #if defined(__SVR4) && defined(__sun)
 #include <sys/filio.h>
@@ -33,10 +48,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
-static unsigned char mapfix[256];
-static unsigned char mapfix2[256];
-static unsigned char mapfix3[256];
-static unsigned char mapfix4[256];
+#ifdef HAVE_CLOCK_GETTIME
+#include <time.h>
+#endif
 
 #ifndef WIN32
 
@@ -188,7 +202,8 @@ int tn5250_make_socket(unsigned short int port) {
  * DESCRIPTION
  *    Translate the specified character from local to remote.
  *****/
-Tn5250Char tn5250_char_map_to_remote(Tn5250CharMap* map, Tn5250Char ascii) {
+Tn5250Char tn5250_char_map_to_remote(const Tn5250CharMap* map,
+                                     Tn5250Char ascii) {
     return map->to_remote_map[ascii];
 }
 
@@ -202,7 +217,8 @@ Tn5250Char tn5250_char_map_to_remote(Tn5250CharMap* map, Tn5250Char ascii) {
  * DESCRIPTION
  *    Translate the specified character from remote character to local.
  *****/
-Tn5250Char tn5250_char_map_to_local(Tn5250CharMap* map, Tn5250Char ebcdic) {
+Tn5250Char tn5250_char_map_to_local(const Tn5250CharMap* map,
+                                    Tn5250Char ebcdic) {
     switch (ebcdic) {
     case 0x1C:
         return '*'; /* This should be an overstriken asterisk (DUP) */
@@ -213,99 +229,257 @@ Tn5250Char tn5250_char_map_to_local(Tn5250CharMap* map, Tn5250Char ebcdic) {
     }
 }
 
-/****f* lib5250/tn5250_char_map_new
+/****f* lib5250/tn5250_char_map_to_remote_n
  * NAME
- *    tn5250_char_map_new
+ *    tn5250_char_map_to_remote_n
  * SYNOPSIS
- *    cmap = tn5250_char_map_new ("37");
+ *    tn5250_char_map_to_remote_n (map, dst, src, len);
  * INPUTS
- *    const char *         map        - Name of the character translation map.
+ *    Tn5250CharMap *      map        - the character map to use.
+ *    Tn5250Char *         dst        - where to put the remote characters.
+ *    const Tn5250Char *   src        - the local characters to translate.
+ *    int                  len        - number of characters.
  * DESCRIPTION
- *    Create a new translation map.
- * NOTES
- *    Translation maps are currently statically allocated, although you should
- *    call tn5250_char_map_destroy (a no-op) for future compatibility.
+ *    Translate a run of characters from local to remote.  This gives the
+ *    same result as calling tn5250_char_map_to_remote on each character.
+ *    ``dst'' may be the same buffer as ``src''.
  *****/
-Tn5250CharMap* tn5250_char_map_new(const char* map) {
-    Tn5250CharMap* t;
+void tn5250_char_map_to_remote_n(const Tn5250CharMap* map, Tn5250Char* dst,
+                                 const Tn5250Char* src, int len) {
+    const unsigned char* tab = map->to_remote_map;
+    int i;
+
+    for (i = 0; i + 4 <= len; i += 4) {
+        Tn5250Char c0 = tab[src[i]], c1 = tab[src[i + 1]];
+        Tn5250Char c2 = tab[src[i + 2]], c3 = tab[src[i + 3]];
+        dst[i] = c0;
+        dst[i + 1] = c1;
+        dst[i + 2] = c2;
+        dst[i + 3] = c3;
+    }
+    for (; i < len; i++) {
+        dst[i] = tab[src[i]];
+    }
+}
 
-    /* XXX: HACK: These characters were reported wrong in transmaps.h.
-            Since that's a generated file, I'm overriding them here -SCK */
+/****f* lib5250/tn5250_char_map_to_local_n
+ * NAME
+ *    tn5250_char_map_to_local_n
+ * SYNOPSIS
+ *    tn5250_char_map_to_local_n (map, dst, src, len);
+ * INPUTS
+ *    Tn5250CharMap *      map        - the character map to use.
+ *    Tn5250Char *         dst        - where to put the local characters.
+ *    const Tn5250Char *   src        - the remote characters to translate.
+ *    int                  len        - number of characters.
+ * DESCRIPTION
+ *    Translate a run of characters from remote to local.  This gives the
+ *    same result as calling tn5250_char_map_to_local on each character,
+ *    including the special cases for NUL and DUP.  ``dst'' may be the
+ *    same buffer as ``src''.
+ *****/
+void tn5250_char_map_to_local_n(const Tn5250CharMap* map, Tn5250Char* dst,
+                                const Tn5250Char* src, int len) {
+    const unsigned char* tab = map->to_local_map;
+    int i;
+
+    for (i = 0; i < len; i++) {
+        Tn5250Char c = src[i];
+        Tn5250Char l = tab[c];
+        if (c <= 0x1C) {
+            if (c == 0x1C) {
+                l = '*'; /* DUP */
+            }
+            else if (c == 0) {
+                l = ' ';
+            }
+        }
+        dst[i] = l;
+    }
+}
 
-    TN5250_LOG(("tn5250_char_map_new: map = \"%s\"\n", map));
+/****f* lib5250/tn5250_char_map_from_ucs
+ * NAME
+ *    tn5250_char_map_from_ucs
+ * SYNOPSIS
+ *    ec = tn5250_char_map_from_ucs (map, ucs);
+ * INPUTS
+ *    Tn5250CharMap *      map        - the character map to use.
+ *    unsigned long        ucs        - the Unicode code point.
+ * DESCRIPTION
+ *    Translate a Unicode character to remote.  Characters which are not
+ *    in the map's local character set become the EBCDIC SUB character.
+ *****/
+Tn5250Char tn5250_char_map_from_ucs(const Tn5250CharMap* map,
+                                    unsigned long ucs) {
+    const Tn5250Utf8Map* u = &tn5250_utf8maps[map - tn5250_transmaps];
+    int slot;
 
-    if (!strcmp(map, "870") || !strcmp(map, "win870")) {
-
-        TN5250_LOG(("tn5250_char_map_new: Installing 870 workaround\n"));
-
-        memcpy(mapfix, windows_1250_to_ibm870, sizeof(mapfix));
-        memcpy(mapfix2, ibm870_to_windows_1250, sizeof(mapfix2));
-        memcpy(mapfix3, iso_8859_2_to_ibm870, sizeof(mapfix3));
-        memcpy(mapfix4, ibm870_to_iso_8859_2, sizeof(mapfix4));
-
-        mapfix[142] = 184;
-        mapfix[143] = 185;
-        mapfix[158] = 182;
-        mapfix[159] = 183;
-        mapfix[163] = 186;
-        mapfix[202] = 114;
-        mapfix[234] = 82;
-
-        mapfix2[82] = 234;
-        mapfix2[114] = 202;
-        mapfix2[182] = 158;
-        mapfix2[183] = 159;
-        mapfix2[184] = 142;
-        mapfix2[185] = 143;
-        mapfix2[186] = 163;
-
-        mapfix3[163] = 186;
-        mapfix3[172] = 185;
-        mapfix3[188] = 183;
-        mapfix3[202] = 114;
-        mapfix3[234] = 82;
-
-        mapfix4[82] = 234;
-        mapfix4[114] = 202;
-        mapfix4[183] = 188;
-        mapfix4[185] = 172;
-        mapfix4[186] = 163;
-
-        for (t = tn5250_transmaps; t->name; t++) {
-            if (!strcmp(t->name, "win870")) {
-                t->to_remote_map = mapfix;
-                t->to_local_map = mapfix2;
-                TN5250_LOG(("Workaround installed for map \"win870\"\n"));
-            }
-            else if (!strcmp(t->name, "870")) {
-                t->to_remote_map = mapfix3;
-                t->to_local_map = mapfix4;
-                TN5250_LOG(("Workaround installed for map \"870\"\n"));
+    if (ucs >= 0xffff) {
+        return TN5250_EBCDIC_SUB;
+    }
+    slot = (int)(((ucs * u->mult) & 0xffffffffUL) >> u->shift);
+    return u->keys[slot] == ucs ? u->values[slot] : TN5250_EBCDIC_SUB;
+}
+
+/****f* lib5250/tn5250_char_map_to_utf8_n
+ * NAME
+ *    tn5250_char_map_to_utf8_n
+ * SYNOPSIS
+ *    n = tn5250_char_map_to_utf8_n (map, dst, dstlen, src, len);
+ * INPUTS
+ *    Tn5250CharMap *      map        - the character map to use.
+ *    char *               dst        - where to put the UTF-8 bytes.
+ *    int                  dstlen     - size of ``dst'' in bytes.
+ *    const Tn5250Char *   src        - the remote characters to translate.
+ *    int                  len        - number of characters.
+ * DESCRIPTION
+ *    Translate a run of characters from remote straight to UTF-8, with
+ *    the same special cases for NUL and DUP as tn5250_char_map_to_local.
+ *    Translation stops at the first character that does not fit, so
+ *    ``dst'' should hold len * TN5250_UTF8_MAX bytes to be sure of
+ *    getting everything.  No terminating NUL is written.  Returns the
+ *    number of bytes written.
+ *****/
+int tn5250_char_map_to_utf8_n(const Tn5250CharMap* map, char* dst, int dstlen,
+                              const Tn5250Char* src, int len) {
+    const unsigned char(*out)[4] = tn5250_utf8maps[map - tn5250_transmaps].out;
+    char* p = dst;
+    char* end = dst + dstlen;
+    int i = 0;
+
+    /* While there is room for the longest encoding, copy the whole entry
+     * and step over only the bytes that belong to it. */
+    while (i < len && end - p >= TN5250_UTF8_MAX) {
+        const unsigned char* e = out[src[i++]];
+        memcpy(p, e + 1, TN5250_UTF8_MAX);
+        p += e[0];
+    }
+    while (i < len) {
+        const unsigned char* e = out[src[i++]];
+        if (end - p < e[0]) {
+            break;
+        }
+        memcpy(p, e + 1, e[0]);
+        p += e[0];
+    }
+    return (int)(p - dst);
+}
+
+/****f* lib5250/tn5250_char_map_from_utf8_n
+ * NAME
+ *    tn5250_char_map_from_utf8_n
+ * SYNOPSIS
+ *    n = tn5250_char_map_from_utf8_n (map, dst, src, len);
+ * INPUTS
+ *    Tn5250CharMap *      map        - the character map to use.
+ *    Tn5250Char *         dst        - where to put the remote characters.
+ *    const char *         src        - the UTF-8 text to translate.
+ *    int                  len        - number of bytes in ``src''.
+ * DESCRIPTION
+ *    Translate a run of UTF-8 text to remote.  ``dst'' must have room for
+ *    ``len'' characters.  Malformed sequences and characters which are
+ *    not in the map become the EBCDIC SUB character.  Returns the number
+ *    of characters written.
+ *****/
+int tn5250_char_map_from_utf8_n(const Tn5250CharMap* map, Tn5250Char* dst,
+                                const char* src, int len) {
+    static const unsigned long utf8_min[] = {0, 0, 0x80, 0x800, 0x10000};
+    const unsigned char* s = (const unsigned char*)src;
+    int i = 0, n = 0;
+
+    while (i < len) {
+        unsigned long ucs = s[i];
+        int k, seqlen;
+
+        if (ucs < 0x80) {
+            seqlen = 1;
+        }
+        else if ((ucs & 0xe0) == 0xc0) {
+            ucs &= 0x1f;
+            seqlen = 2;
+        }
+        else if ((ucs & 0xf0) == 0xe0) {
+            ucs &= 0x0f;
+            seqlen = 3;
+        }
+        else if ((ucs & 0xf8) == 0xf0) {
+            ucs &= 0x07;
+            seqlen = 4;
+        }
+        else {
+            ucs = 0xffff;
+            seqlen = 1;
+        }
+        for (k = 1; k < seqlen; k++) {
+            if (i + k >= len || (s[i + k] & 0xc0) != 0x80) {
+                ucs = 0xffff;
+                break;
             }
+            ucs = (ucs << 6) | (s[i + k] & 0x3f);
+        }
+        if (k == seqlen && seqlen > 1 && ucs < utf8_min[seqlen]) {
+            ucs = 0xffff; /* overlong */
         }
+        dst[n++] = tn5250_char_map_from_ucs(map, ucs);
+        i += k;
     }
+    return n;
+}
+
+/*
+ *    Find a map by name in the perfect hash generated by mkcharmaps.
+ */
+static const Tn5250CharMap* tn5250_char_map_lookup(const char* name) {
+    unsigned long h = TN5250_CHARMAP_HASH_SEED;
+    const char* p;
+    int i;
+
+    for (p = name; *p; p++) {
+        h = ((h ^ (unsigned char)*p) * 16777619UL) & 0xffffffffUL;
+    }
+    i = tn5250_charmap_slots[h >> (32 - TN5250_CHARMAP_HASH_BITS)];
+    if (i == TN5250_CHARMAP_NONE || strcmp(tn5250_transmaps[i].name, name)) {
+        return NULL;
+    }
+    return &tn5250_transmaps[i];
+}
+
+/****f* lib5250/tn5250_char_map_new
+ * NAME
+ *    tn5250_char_map_new
+ * SYNOPSIS
+ *    cmap = tn5250_char_map_new ("37");
+ * INPUTS
+ *    const char *         map        - Name of the character translation map.
+ * DESCRIPTION
+ *    Look up a translation map by name.  Returns NULL if there is no such
+ *    map.
+ * NOTES
+ *    Translation maps are generated at build time and never modified, so
+ *    one map may be shared by any number of sessions and threads.  You
+ *    should still call tn5250_char_map_destroy (a no-op) for future
+ *    compatibility.
+ *****/
+const Tn5250CharMap* tn5250_char_map_new(const char* map) {
+    TN5250_LOG(("tn5250_char_map_new: map = \"%s\"\n", map));
 
     /* Under Windows, we'll try the "winXXX" maps first, then fall back
        to the standard (unix) versions */
 #ifdef WIN32
     {
+        const Tn5250CharMap* t;
         char winmap[10];
         _snprintf(winmap, sizeof(winmap) - 1, "win%s", map);
-        for (t = tn5250_transmaps; t->name; t++) {
-            if (strcmp(t->name, winmap) == 0) {
-                TN5250_LOG(("Using map %s\n", t->name));
-                return t;
-            }
+        winmap[sizeof(winmap) - 1] = '\0';
+        if ((t = tn5250_char_map_lookup(winmap)) != NULL) {
+            TN5250_LOG(("Using map %s\n", t->name));
+            return t;
         }
     }
 #endif
 
-    for (t = tn5250_transmaps; t->name; t++) {
-        if (strcmp(t->name, map) == 0) {
-            return t;
-        }
-    }
-    return NULL;
+    return tn5250_char_map_lookup(map);
 }
 
 /****f* lib5250/tn5250_char_map_destroy
@@ -318,7 +492,7 @@ Tn5250CharMap* tn5250_char_map_new(const char* map) {
  * DESCRIPTION
  *    Frees the character map's resources.
  *****/
-void tn5250_char_map_destroy(Tn5250CharMap* map) { /* NOOP */
+void tn5250_char_map_destroy(const Tn5250CharMap* map) { /* NOOP */
 }
 
 /****f* lib5250/tn5250_char_map_printable_p
@@ -336,7 +510,7 @@ void tn5250_char_map_destroy(Tn5250CharMap* map) { /* NOOP */
  *    character, a NUL, or a few other odds and ends.
  * SOURCE
  */
-int tn5250_char_map_printable_p(Tn5250CharMap* map, Tn5250Char data) {
+int tn5250_char_map_printable_p(const Tn5250CharMap* map, Tn5250Char data) {
     switch (data) {
         /*
            Ideographic Shift-In and Shift-Out.
@@ -361,7 +535,7 @@ int tn5250_char_map_printable_p(Tn5250CharMap* map, Tn5250Char data) {
  * DESCRIPTION
  *    Determines whether the character is a 5250 attribute.
  *****/
-int tn5250_char_map_attribute_p(Tn5250CharMap* map, Tn5250Char data) {
+int tn5250_char_map_attribute_p(const Tn5250CharMap* map, Tn5250Char data) {
     return ((data & 0xE0) == 0x20);
 }
 
@@ -617,6 +791,42 @@ int tn5250_setenv(const char* name, const char* value, int overwrite) {
     return ret;
 }
 
+/****f* lib5250/tn5250_msec_now
+ * NAME
+ *    tn5250_msec_now
+ * SYNOPSIS
+ *    deadline = tn5250_msec_now () + timeout;
+ * INPUTS
+ *    None
+ * DESCRIPTION
+ *    Milliseconds from some fixed point, for working out timeouts.  The
+ *    value wraps round, so only the difference between two values means
+ *    anything: compare them with tn5250_msec_until and tn5250_msec_since
+ *    rather than with < or >.  The clock is monotonic where the system
+ *    has one, so setting the time of day doesn't upset timeouts.
+ *****/
+unsigned long tn5250_msec_now(void) {
+#ifdef WIN32
+    return (unsigned long)GetTickCount();
+#else
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+        return (unsigned long)ts.tv_sec * 1000UL +
+               (unsigned long)(ts.tv_nsec / 1000000L);
+    }
+#endif
+    {
+        struct timeval tv;
+
+        gettimeofday(&tv, NULL);
+        return (unsigned long)tv.tv_sec * 1000UL +
+               (unsigned long)(tv.tv_usec / 1000);
+    }
+#endif
+}
+
 /****f* lib5250/tn5250_run_cmd
  * NAME
  *    tn5250_run_cmd
@@ -34,7 +34,7 @@ typedef unsigned char Tn5250Char;
  * NAME
  *    Tn5250CharMap
  * SYNOPSIS
- *    Tn5250CharMap *map = tn5250_char_map_new ("37");
+ *    const Tn5250CharMap *map = tn5250_char_map_new ("37");
  *    ac = tn5250_char_map_to_local(map,ec);
  *    ec = tn5250_char_map_to_remote(map,ac);
  *    if (tn5250_char_map_printable_p (map,ec))
@@ -65,22 +65,45 @@ struct _clientaddr {
 
 typedef struct _clientaddr clientaddr;
 
-extern Tn5250CharMap tn5250_transmaps[];
+extern const Tn5250CharMap tn5250_transmaps[];
 /*******/
 
-Tn5250CharMap* tn5250_char_map_new(const char* maping);
-void tn5250_char_map_destroy(Tn5250CharMap* This);
+const Tn5250CharMap* tn5250_char_map_new(const char* maping);
+void tn5250_char_map_destroy(const Tn5250CharMap* This);
 
 void tn5250_closeall(int fd);
 int tn5250_daemon(int nochdir, int noclose, int ignsigcld);
 int tn5250_make_socket(unsigned short int port);
 
-Tn5250Char tn5250_char_map_to_remote(Tn5250CharMap* This, Tn5250Char ascii);
-Tn5250Char tn5250_char_map_to_local(Tn5250CharMap* This, Tn5250Char ebcdic);
-
-int tn5250_char_map_printable_p(Tn5250CharMap* This, Tn5250Char data);
-int tn5250_char_map_attribute_p(Tn5250CharMap* This, Tn5250Char data);
+Tn5250Char tn5250_char_map_to_remote(const Tn5250CharMap* This,
+                                     Tn5250Char ascii);
+Tn5250Char tn5250_char_map_to_local(const Tn5250CharMap* This,
+                                    Tn5250Char ebcdic);
+void tn5250_char_map_to_remote_n(const Tn5250CharMap* This, Tn5250Char* dst,
+                                 const Tn5250Char* src, int len);
+void tn5250_char_map_to_local_n(const Tn5250CharMap* This, Tn5250Char* dst,
+                                const Tn5250Char* src, int len);
+
+/* Longest UTF-8 encoding of any character in a map. */
+#define TN5250_UTF8_MAX 3
+
+Tn5250Char tn5250_char_map_from_ucs(const Tn5250CharMap* This,
+                                    unsigned long ucs);
+int tn5250_char_map_to_utf8_n(const Tn5250CharMap* This, char* dst, int dstlen,
+                              const Tn5250Char* src, int len);
+int tn5250_char_map_from_utf8_n(const Tn5250CharMap* This, Tn5250Char* dst,
+                                const char* src, int len);
+
+int tn5250_char_map_printable_p(const Tn5250CharMap* This, Tn5250Char data);
+int tn5250_char_map_attribute_p(const Tn5250CharMap* This, Tn5250Char data);
 int tn5250_setenv(const char* name, const char* value, int overwrite);
+unsigned long tn5250_msec_now(void);
+
+/* Milliseconds left until, or gone since, a tn5250_msec_now() value.
+ * These work across the clock wrapping round as long as the two times
+ * are within about 24 days of each other. */
+#define tn5250_msec_until(t) ((long)((unsigned long)(t) - tn5250_msec_now()))
+#define tn5250_msec_since(t) ((long)(tn5250_msec_now() - (unsigned long)(t)))
 
 /* Idea shamelessly stolen from GTK+ */
 #define tn5250_new(type, count) (type*)malloc(sizeof(type) * (count))
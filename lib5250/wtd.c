@@ -32,6 +32,11 @@ static void tn5250_wtd_context_write_field(Tn5250WTDContext* This,
                                            Tn5250Field* field,
                                            unsigned char attr);
 static void tn5250_wtd_context_convert_nosrc(Tn5250WTDContext* This);
+static void tn5250_wtd_context_convert_diff(Tn5250WTDContext* This);
+static int tn5250_wtd_context_same_format(Tn5250WTDContext* This);
+static int tn5250_wtd_context_same_field(Tn5250Field* a, Tn5250Field* b);
+static void tn5250_wtd_context_flush_at(Tn5250WTDContext* This, int pos);
+static void tn5250_wtd_context_sba(Tn5250WTDContext* This, int next, int pos);
 static Tn5250Field* tn5250_wtd_context_peek_field(Tn5250WTDContext* This);
 static void tn5250_wtd_context_write_cwsf(Tn5250WTDContext* This,
                                           Tn5250Window* window);
@@ -115,14 +120,23 @@ void tn5250_wtd_context_set_ic(Tn5250WTDContext* This, int y, int x) {
  * INPUTS
  *    Tn5250WTDContext *   This       -
  * DESCRIPTION
- *    Convert the display info to WTD data.
+ *    Convert the display info to WTD data.  Without a source display
+ *    buffer this is a full screen restore; with one, we write only what
+ *    is needed to turn the source into the destination.
  *****/
 void tn5250_wtd_context_convert(Tn5250WTDContext* This) {
-    /* The differential conversion is not yet implemented, and probably
-     * won't be until we implement the 5250 server. */
-    TN5250_ASSERT(This->src == NULL);
-
-    tn5250_wtd_context_convert_nosrc(This);
+    /* Windows, menus and scroll bars are only written by the full
+     * conversion, and a size change needs a clear unit anyway. */
+    if (This->src == NULL ||
+        tn5250_dbuffer_width(This->src) != tn5250_dbuffer_width(This->dst) ||
+        tn5250_dbuffer_height(This->src) != tn5250_dbuffer_height(This->dst) ||
+        This->src->window_list != NULL || This->dst->window_list != NULL ||
+        This->src->menubar_list != NULL || This->dst->menubar_list != NULL) {
+        tn5250_wtd_context_convert_nosrc(This);
+    }
+    else {
+        tn5250_wtd_context_convert_diff(This);
+    }
     return;
 }
 
@@ -220,6 +234,178 @@ static void tn5250_wtd_context_convert_nosrc(Tn5250WTDContext* This) {
     return;
 }
 
+/****i* lib5250/tn5250_wtd_context_convert_diff
+ * NAME
+ *    tn5250_wtd_context_convert_diff
+ * SYNOPSIS
+ *    tn5250_wtd_context_convert_diff (This);
+ * INPUTS
+ *    Tn5250WTDContext *   This       -
+ * DESCRIPTION
+ *    Write a Write to Display command which turns the source display
+ *    buffer into the destination.  If the format tables have the same
+ *    fields in the same places, only the fields whose FFW or attribute
+ *    changed get an SF order; otherwise an SOH clears the format table
+ *    and every field is written again.  Data is written only where it
+ *    differs, with an SBA in front of each run.  We keep a copy of what
+ *    the display will hold as we go, since an SF order for an input
+ *    field also writes an attribute after the end of the field.
+ *****/
+static void tn5250_wtd_context_convert_diff(Tn5250WTDContext* This) {
+    int w = tn5250_dbuffer_width(This->dst);
+    int size = w * tn5250_dbuffer_height(This->dst);
+    int same_format = tn5250_wtd_context_same_format(This);
+    int pos, next = -1, end;
+    unsigned char *cur, c, attr;
+    Tn5250Field *field, *old;
+
+    TN5250_LOG(("wtd_context_convert_diff entered.\n"));
+
+    cur = (unsigned char*)malloc(size);
+    TN5250_ASSERT(cur != NULL);
+    memcpy(cur, This->src->data, size);
+
+    tn5250_wtd_context_putc(This, ESC);
+    tn5250_wtd_context_putc(This, CMD_WRITE_TO_DISPLAY);
+    tn5250_wtd_context_putc(This, 0x00); /* CC1 */
+    tn5250_wtd_context_putc(This, 0x00); /* CC2 */
+
+    if (!same_format) {
+        int i;
+        tn5250_wtd_context_putc(This, SOH);
+        tn5250_wtd_context_putc(This, This->dst->header_length);
+        for (i = 0; i < This->dst->header_length; i++) {
+            tn5250_wtd_context_putc(This, This->dst->header_data[i]);
+        }
+    }
+
+    tn5250_wtd_context_putc(This, IC);
+    tn5250_wtd_context_putc(This, This->y);
+    tn5250_wtd_context_putc(This, This->x);
+
+    /* ``next'' is where the display will write the next character. */
+    for (pos = 0; pos < size; pos++) {
+        This->y = pos / w;
+        This->x = pos % w;
+        c = This->dst->data[pos];
+
+        field = tn5250_wtd_context_peek_field(This);
+        if (field != NULL && same_format) {
+            /* Same format: the source field has the same id. */
+            old = This->src->field_table[field->id];
+            if (old->FFW == field->FFW && old->attribute == field->attribute) {
+                field = NULL;
+            }
+        }
+
+        if (field != NULL) {
+            if (next != pos) {
+                tn5250_wtd_context_sba(This, next, pos);
+            }
+            tn5250_wtd_context_write_field(This, field, c);
+
+            /* Mirror what the SF order does to the display. */
+            attr = ((c & 0xe0) != 0x20) ? tn5250_field_attribute(field) : c;
+            cur[pos] = attr;
+            end = tn5250_field_end_row(field) * w +
+                  tn5250_field_end_col(field) + 1;
+            cur[end < size ? end : 0] = 0x20;
+            next = pos + 1;
+        }
+        else if (cur[pos] != c) {
+            if (next != pos) {
+                tn5250_wtd_context_sba(This, next, pos);
+            }
+            tn5250_wtd_context_ra_putc(This, c);
+            cur[pos] = c;
+            next = pos + 1;
+        }
+    }
+
+    /* An input field ending in the last position puts its trailing
+     * attribute at the top left, which we have already gone past. */
+    if (cur[0] != This->dst->data[0]) {
+        tn5250_wtd_context_sba(This, next, 0);
+        tn5250_wtd_context_putc(This, This->dst->data[0]);
+        next = 1;
+    }
+    tn5250_wtd_context_flush_at(This, next);
+    free(cur);
+
+#ifndef NDEBUG
+    tn5250_buffer_log(This->buffer, "wtd>");
+#endif
+    return;
+}
+
+/*
+ *    Flush the pending run, which ends just before ``pos''.  The RA order
+ *    is worked out from our position, so move there for the flush.
+ */
+static void tn5250_wtd_context_flush_at(Tn5250WTDContext* This, int pos) {
+    int w = tn5250_dbuffer_width(This->dst);
+    int y = This->y, x = This->x;
+
+    This->y = pos / w;
+    This->x = pos % w;
+    tn5250_wtd_context_ra_flush(This);
+    This->y = y;
+    This->x = x;
+}
+
+/*
+ *    Flush the pending run, which ends just before ``next'', and set the
+ *    buffer address to ``pos''.
+ */
+static void tn5250_wtd_context_sba(Tn5250WTDContext* This, int next, int pos) {
+    int w = tn5250_dbuffer_width(This->dst);
+
+    tn5250_wtd_context_flush_at(This, next);
+    tn5250_wtd_context_putc(This, SBA);
+    tn5250_wtd_context_putc(This, pos / w + 1);
+    tn5250_wtd_context_putc(This, pos % w + 1);
+}
+
+/*
+ *    Return 1 if the two format tables have the same fields in the same
+ *    places, so that changes can be made with SF orders alone.
+ */
+static int tn5250_wtd_context_same_format(Tn5250WTDContext* This) {
+    int i;
+
+    if (This->src->field_count != This->dst->field_count ||
+        This->src->header_length != This->dst->header_length) {
+        return 0;
+    }
+    if (This->src->header_length > 0 &&
+        memcmp(This->src->header_data, This->dst->header_data,
+               This->src->header_length) != 0) {
+        return 0;
+    }
+    for (i = 0; i < This->src->field_count; i++) {
+        if (!tn5250_wtd_context_same_field(This->src->field_table[i],
+                                           This->dst->field_table[i])) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    Compare the parts of two fields which an SF order for an existing
+ *    field cannot change.
+ */
+static int tn5250_wtd_context_same_field(Tn5250Field* a, Tn5250Field* b) {
+    const Tn5250Uint16 fcw =
+        TN5250_FIELD_FCW_CONTINUED | TN5250_FIELD_FCW_CONTINUED_FIRST |
+        TN5250_FIELD_FCW_CONTINUED_MIDDLE | TN5250_FIELD_FCW_CONTINUED_LAST |
+        TN5250_FIELD_FCW_WORDWRAP;
+
+    return a->start_row == b->start_row && a->start_col == b->start_col &&
+           a->length == b->length && (a->flags & fcw) == (b->flags & fcw) &&
+           a->nextfieldprogressionid == b->nextfieldprogressionid;
+}
+
 /****i* lib5250/tn5250_wtd_context_peek_field
  * NAME
  *    tn5250_wtd_context_peek_field
@@ -377,21 +563,21 @@ static void tn5250_wtd_context_write_field(Tn5250WTDContext* This,
     }
 
     /* Put the field control word(s). */
-    if (field->continuous) {
+    if (tn5250_field_is_continued(field)) {
         tn5250_wtd_context_putc(This, (unsigned char)0x86);
 
-        if (field->continued_first) {
+        if (tn5250_field_is_continued_first(field)) {
             tn5250_wtd_context_putc(This, (unsigned char)0x01);
         }
-        if (field->continued_middle) {
+        if (tn5250_field_is_continued_middle(field)) {
             tn5250_wtd_context_putc(This, (unsigned char)0x03);
         }
-        if (field->continued_last) {
+        if (tn5250_field_is_continued_last(field)) {
             tn5250_wtd_context_putc(This, (unsigned char)0x02);
         }
     }
 
-    if (field->wordwrap) {
+    if (tn5250_field_is_wordwrap(field)) {
         tn5250_wtd_context_putc(This, (unsigned char)0x86);
         tn5250_wtd_context_putc(This, (unsigned char)0x80);
     }
@@ -49,12 +49,13 @@ struct _Tn5250DBuffer;
  *    WTD-type orders to transition from the source display buffer and format
  *    table to the destination display buffer and format table.
  *
- *    This will be used in our 5250 server implementation later.  Currently,
- *    we only accept NULL for the source display buffer and format table and
- *    create a full set of commands and orders which we send back to the host
- *    (and the host sends back to us) for the save/restore screen
- *    functionality.  Differential Write to Display orders and data should
- *    be implemented when the 5250 server is born.
+ *    With NULL for the source display buffer and format table, we create
+ *    a full set of commands and orders which we send back to the host (and
+ *    the host sends back to us) for the save/restore screen functionality.
+ *    Given a source, we write a single Write to Display command carrying
+ *    only the orders and data needed to turn the source into the
+ *    destination.  Screens with windows, menu bars or a different size are
+ *    always converted in full.
  *
  * SOURCE
  */
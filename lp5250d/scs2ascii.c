@@ -36,7 +36,7 @@ void scs2ascii_nl(Tn5250SCS* This);
 void scs2ascii_default(Tn5250SCS* This);
 Tn5250SCS* tn5250_scs2ascii_new();
 
-Tn5250CharMap* map;
+const Tn5250CharMap* map;
 
 int main() {
     Tn5250SCS* scs = NULL;
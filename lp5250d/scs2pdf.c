@@ -116,7 +116,7 @@ struct _Tn5250SCSPrivate {
 };
 
 unsigned char nextchar;
-Tn5250CharMap* map;
+const Tn5250CharMap* map;
 
 struct _expanding_array {
     int* data;
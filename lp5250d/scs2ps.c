@@ -64,7 +64,7 @@ float mppf;
 float charwidth;
 float charheight;
 
-Tn5250CharMap* map;
+const Tn5250CharMap* map;
 
 int main() {
     int pagewidth, pagelength; /* These are unused for now */
@@ -0,0 +1,401 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* ansitest -- Check the ANSI terminal's output with a VT interpreter.
+ *
+ * Makes random edits to a display, a few cells at a time, and after each
+ * batch runs tn5250_display_update on the ANSI terminal, with its output
+ * going to a file.  The output is then played through a small VT100
+ * interpreter.  The screen it ends up with, characters and renditions,
+ * must be the same as the one a new terminal paints in one go from the
+ * final display, and the cursor must be where the display has it.  This
+ * is done plainly, with +underscores and with +ruler.
+ *
+ * Usage: ansitest [frames [seed]]
+ */
+#include "testutil.h"
+#include "ansiterm.h"
+
+#define TEST_ROWS   25
+#define TEST_COLS   80
+#define TEST_FRAMES 400
+
+/* Renditions kept for each cell: a foreground colour (0 for the default,
+ * else 1 plus the SGR colour number) and these flags. */
+#define TEST_BOLD      0x10
+#define TEST_UNDERLINE 0x20
+#define TEST_BLINK     0x40
+#define TEST_REVERSE   0x80
+
+typedef struct _TestScreen {
+    unsigned char ch[TEST_ROWS][TEST_COLS];
+    int style[TEST_ROWS][TEST_COLS];
+    int y, x, wrap, sgr;
+} TestScreen;
+
+
+static void test_edit(Tn5250Display* display);
+static char* test_capture(Tn5250Display* display, int mode, int frames,
+                          int* len);
+static void test_erase(TestScreen* s, int y, int from);
+static int test_interpret(TestScreen* s, const char* data, int len);
+static int test_compare(TestScreen* got, TestScreen* want,
+                        Tn5250Display* display, int verbose);
+
+/*
+ *    Make one random change to the display: a character, an attribute or
+ *    a blank somewhere, a blanked, refilled or rolled row, or an
+ *    indicator.
+ */
+static void test_edit(Tn5250Display* display) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    int k = test_rand(100);
+    int y = test_rand(24);
+    int x;
+
+    if (k < 60) {
+        tn5250_display_set_cursor(display, y, test_rand(80));
+        tn5250_display_addch(display, (unsigned char)(0x81 + test_rand(0x40)));
+    }
+    else if (k < 75) {
+        tn5250_display_set_cursor(display, y, test_rand(80));
+        tn5250_display_addch(display, (unsigned char)(0x20 + test_rand(0x20)));
+    }
+    else if (k < 85) {
+        tn5250_display_set_cursor(display, y, test_rand(80));
+        tn5250_display_addch(display, (unsigned char)test_rand(0x100));
+    }
+    else if (k < 88) {
+        tn5250_display_set_cursor(display, y, 0);
+        for (x = 0; x < 80; x++) {
+            tn5250_display_addch(display, 0x40);
+        }
+    }
+    else if (k < 91) {
+        /* The same text again and again, so that cells often go back to
+         * what was on the screen before the row was blanked. */
+        tn5250_display_set_cursor(display, y, 0);
+        tn5250_display_addch(display, 0x20);
+        for (x = 1; x < 40; x++) {
+            tn5250_display_addch(display, (unsigned char)(0xc1 + x % 9));
+        }
+    }
+    else if (k < 95) {
+        tn5250_dbuffer_roll(dbuffer, y, y + test_rand(24 - y),
+                            test_rand(5) - 2);
+    }
+    else if (k < 98) {
+        tn5250_display_indicator_set(display, TN5250_DISPLAY_IND_INSERT |
+                                                  TN5250_DISPLAY_IND_X_SYSTEM);
+    }
+    else {
+        tn5250_display_indicator_clear(display,
+                                       TN5250_DISPLAY_IND_INSERT |
+                                           TN5250_DISPLAY_IND_X_SYSTEM);
+    }
+}
+
+/*
+ *    Run a new ANSI terminal, in ``mode'' 0 (plain), 1 (+underscores) or
+ *    2 (+ruler), on the display for ``frames'' batches of edits, and
+ *    return everything it wrote.  With no frames it just paints the
+ *    display as it is.
+ */
+static char* test_capture(Tn5250Display* display, int mode, int frames,
+                          int* len) {
+    Tn5250Terminal* term;
+    char name[] = "/tmp/ansitestXXXXXX";
+    char* data;
+    int fd, out, i, n;
+
+    fflush(stdout);
+    fd = mkstemp(name);
+    TN5250_ASSERT(fd >= 0);
+    unlink(name);
+    out = dup(1);
+    dup2(fd, 1);
+
+    term = tn5250_ansi_terminal_new();
+    TN5250_ASSERT(term != NULL);
+    tn5250_ansi_terminal_use_underscores(term, mode == 1);
+    tn5250_ansi_terminal_display_ruler(term, mode == 2);
+    tn5250_terminal_init(term);
+    tn5250_display_set_terminal(display, term);
+    for (i = 0; i < frames; i++) {
+        for (n = test_rand(30); n >= 0; n--) {
+            test_edit(display);
+        }
+        tn5250_display_set_cursor(display, test_rand(24), test_rand(80));
+        tn5250_display_update(display);
+    }
+
+    dup2(out, 1);
+    close(out);
+    *len = (int)lseek(fd, 0, SEEK_END);
+    data = (char*)malloc(*len + 1);
+    TN5250_ASSERT(data != NULL);
+    lseek(fd, 0, SEEK_SET);
+    TN5250_ASSERT(read(fd, data, *len) == *len);
+    close(fd);
+    return data;
+}
+
+/*
+ *    Blank row ``y'' from column ``from'' to the end, as ESC [ K does.
+ */
+static void test_erase(TestScreen* s, int y, int from) {
+    for (; from < TEST_COLS; from++) {
+        s->ch[y][from] = ' ';
+        s->style[y][from] = s->sgr;
+    }
+}
+
+/*
+ *    Play ``data'' on the screen.  Only the sequences the ANSI terminal is
+ *    meant to send are understood; anything else is an error.
+ */
+static int test_interpret(TestScreen* s, const char* data, int len) {
+    int param[16];
+    int i, n, y, c, private;
+
+    for (i = 0; i < len; i++) {
+        c = (unsigned char)data[i];
+        if (c == 0x07) {
+            continue;
+        }
+        if (c != 0x1b) {
+            if (c < 0x20) {
+                printf("control character %02X in the output\n", c);
+                return 0;
+            }
+            if (s->wrap) {
+                s->x = 0;
+                if (s->y < TEST_ROWS - 1) {
+                    s->y++;
+                }
+                s->wrap = 0;
+            }
+            s->ch[s->y][s->x] = (unsigned char)c;
+            s->style[s->y][s->x] = s->sgr;
+            if (s->x == TEST_COLS - 1) {
+                s->wrap = 1;
+            }
+            else {
+                s->x++;
+            }
+            continue;
+        }
+
+        if (++i >= len || data[i] != '[') {
+            printf("unexpected escape sequence\n");
+            return 0;
+        }
+        private = 0;
+        if (i + 1 < len && data[i + 1] == '?') {
+            private = 1;
+            i++;
+        }
+        n = 0;
+        param[0] = 0;
+        while (++i < len && ((data[i] >= '0' && data[i] <= '9') ||
+                             data[i] == ';')) {
+            if (data[i] == ';') {
+                if (n < 15) {
+                    param[++n] = 0;
+                }
+            }
+            else {
+                param[n] = param[n] * 10 + data[i] - '0';
+            }
+        }
+        if (i >= len) {
+            printf("escape sequence cut short\n");
+            return 0;
+        }
+        n++;
+        switch (data[i]) {
+        case 'h':
+        case 'l':
+        case 't':
+            /* The alternate screen and window size. */
+            break;
+        case 'H':
+            s->y = (n > 0 && param[0] > 0 ? param[0] : 1) - 1;
+            s->x = (n > 1 && param[1] > 0 ? param[1] : 1) - 1;
+            if (s->y >= TEST_ROWS) {
+                s->y = TEST_ROWS - 1;
+            }
+            if (s->x >= TEST_COLS) {
+                s->x = TEST_COLS - 1;
+            }
+            s->wrap = 0;
+            break;
+        case 'J':
+            for (y = 0; y < TEST_ROWS; y++) {
+                test_erase(s, y, 0);
+            }
+            break;
+        case 'K':
+            test_erase(s, s->y, s->x);
+            break;
+        case 'm':
+            for (y = 0; y < n; y++) {
+                if (param[y] == 0) {
+                    s->sgr = 0;
+                }
+                else if (param[y] == 1) {
+                    s->sgr |= TEST_BOLD;
+                }
+                else if (param[y] == 4) {
+                    s->sgr |= TEST_UNDERLINE;
+                }
+                else if (param[y] == 5) {
+                    s->sgr |= TEST_BLINK;
+                }
+                else if (param[y] == 7) {
+                    s->sgr |= TEST_REVERSE;
+                }
+                else if (param[y] >= 30 && param[y] <= 37) {
+                    s->sgr = (s->sgr & ~0x0f) | (param[y] - 30 + 1);
+                }
+                else if (param[y] == 39) {
+                    s->sgr &= ~0x0f;
+                }
+                else {
+                    printf("unexpected rendition %d\n", param[y]);
+                    return 0;
+                }
+            }
+            break;
+        default:
+            printf("unexpected escape sequence ending in '%c'%s\n", data[i],
+                   private ? " (private)" : "");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    Is ``got'' the same as ``want'', with the cursor where the display
+ *    has it?  Plain text must also show as the display buffer's
+ *    characters.
+ */
+static int test_compare(TestScreen* got, TestScreen* want,
+                        Tn5250Display* display, int verbose) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    const Tn5250CharMap* map = tn5250_display_char_map(display);
+    const unsigned char* chars;
+    const unsigned char* attrs;
+    int y, x, plain = 0;
+
+    for (y = 0; y < TEST_ROWS; y++) {
+        for (x = 0; x < TEST_COLS; x++) {
+            if (got->ch[y][x] != want->ch[y][x] ||
+                got->style[y][x] != want->style[y][x]) {
+                if (verbose) {
+                    printf("cell %d,%d: got '%c' %02X, painted '%c' %02X\n",
+                           y, x, got->ch[y][x], got->style[y][x],
+                           want->ch[y][x], want->style[y][x]);
+                }
+                return 0;
+            }
+        }
+    }
+    if (got->y != tn5250_display_cursor_y(display) ||
+        got->x != tn5250_display_cursor_x(display)) {
+        if (verbose) {
+            printf("cursor at %d,%d, wanted %d,%d\n", got->y, got->x,
+                   tn5250_display_cursor_y(display),
+                   tn5250_display_cursor_x(display));
+        }
+        return 0;
+    }
+    for (y = 0; y < 24; y++) {
+        chars = tn5250_dbuffer_char_row(dbuffer, y);
+        attrs = tn5250_dbuffer_attr_row(dbuffer, y);
+        for (x = 0; x < TEST_COLS; x++) {
+            if (attrs[x] != 0x20 || chars[x] < 0x41 || chars[x] == 0xff) {
+                continue;
+            }
+            plain++;
+            if (want->ch[y][x] != tn5250_char_map_to_local(map, chars[x])) {
+                if (verbose) {
+                    printf("cell %d,%d shows '%c' for %02X\n", y, x,
+                           want->ch[y][x], chars[x]);
+                }
+                return 0;
+            }
+        }
+    }
+    if (plain == 0) {
+        if (verbose) {
+            printf("no plain text on the screen\n");
+        }
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    static const char* modes[] = {"plain", "+underscores", "+ruler"};
+    static TestScreen got, want;
+    Tn5250Display* display;
+    int frames = TEST_FRAMES;
+    int mode, len, ok, failed = 0;
+    char* data;
+
+    if (argc > 1) {
+        frames = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 10);
+    }
+    setenv("TERM", "xterm", 1);
+    setenv("LANG", "C", 1);
+    unsetenv("LC_ALL");
+    unsetenv("LC_CTYPE");
+
+    for (mode = 0; mode < 3; mode++) {
+        display = tn5250_display_new();
+        tn5250_display_set_char_map(display, "37");
+
+        memset(&got, 0, sizeof(got));
+        data = test_capture(display, mode, frames, &len);
+        ok = test_interpret(&got, data, len);
+        free(data);
+
+        memset(&want, 0, sizeof(want));
+        data = test_capture(display, mode, 0, &len);
+        ok = test_interpret(&want, data, len) && ok;
+        free(data);
+
+        ok = ok && test_compare(&got, &want, display, 1);
+        printf("%s: %d frames, %s\n", modes[mode], frames,
+               ok ? "screen matches" : "FAILED");
+        if (!ok) {
+            failed++;
+        }
+        tn5250_display_destroy(display);
+    }
+    return failed != 0;
+}
@@ -0,0 +1,154 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* charmapbench -- Time the character map translations.
+ *
+ * Translates a 27x132 screen both ways with every character map, a byte
+ * at a time and then a span at a time, and checks that the span
+ * functions give the same result as the byte ones.  Then looks every map
+ * up by name, checking that each name finds its own map, and times
+ * looking up a few common names over and over.
+ *
+ * Usage: charmapbench [screens]
+ */
+#include "tn5250-private.h"
+
+#include <time.h>
+
+#define BENCH_SIZE (27 * 132)
+
+static double bench_ns(clock_t start, int screens);
+static int bench_lookup(int screens);
+
+/*
+ *    CPU time since start, in nanoseconds per character translated.
+ */
+static double bench_ns(clock_t start, int screens) {
+    return (clock() - start) * 1e9 / CLOCKS_PER_SEC / screens / BENCH_SIZE;
+}
+
+/*
+ *    Look maps up by name.
+ */
+static int bench_lookup(int screens) {
+    static const char* names[] = {"37", "win1026", "870", "424"};
+    const Tn5250CharMap* map;
+    clock_t start;
+    double ms;
+    long found = 0;
+    int failed = 0;
+    int i, n;
+
+    for (map = tn5250_transmaps; map->name != NULL; map++) {
+        if (tn5250_char_map_new(map->name) != map) {
+            fprintf(stderr, "%s: lookup found the wrong map\n", map->name);
+            failed++;
+        }
+    }
+    if (tn5250_char_map_new("nosuchmap") != NULL) {
+        fprintf(stderr, "an unknown name found a map\n");
+        failed++;
+    }
+
+    n = screens * 1000;
+    start = clock();
+    for (i = 0; i < n; i++) {
+        if (tn5250_char_map_new(names[i % 4]) != NULL) {
+            found++;
+        }
+    }
+    ms = (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+    fprintf(stderr, "%d lookups by name: %.1f ms CPU, %ld found\n", n, ms,
+            found);
+    return failed;
+}
+
+int main(int argc, char* argv[]) {
+    static Tn5250Char src[BENCH_SIZE], dst[BENCH_SIZE];
+    const Tn5250CharMap* map;
+    clock_t start;
+    double local, local_n, remote, remote_n;
+    int screens, i, j;
+    int failed = 0;
+
+    screens = argc > 1 ? atoi(argv[1]) : 2000;
+    if (screens <= 0) {
+        fprintf(stderr, "usage: charmapbench [screens]\n");
+        return 2;
+    }
+
+    for (i = 0; i < BENCH_SIZE; i++) {
+        src[i] = (Tn5250Char)((i * 37 + 11) & 0xff);
+    }
+
+    fprintf(stderr, "ns per character:  to_local  _n   to_remote  _n\n");
+    for (map = tn5250_transmaps; map->name != NULL; map++) {
+        start = clock();
+        for (i = 0; i < screens; i++) {
+            for (j = 0; j < BENCH_SIZE; j++) {
+                dst[j] = tn5250_char_map_to_local(map, src[j]);
+            }
+        }
+        local = bench_ns(start, screens);
+
+        start = clock();
+        for (i = 0; i < screens; i++) {
+            tn5250_char_map_to_local_n(map, dst, src, BENCH_SIZE);
+        }
+        local_n = bench_ns(start, screens);
+        for (j = 0; j < BENCH_SIZE; j++) {
+            if (dst[j] != tn5250_char_map_to_local(map, src[j])) {
+                fprintf(stderr, "%s: to_local_n differs at %02X\n",
+                        map->name, src[j]);
+                failed++;
+                break;
+            }
+        }
+
+        start = clock();
+        for (i = 0; i < screens; i++) {
+            for (j = 0; j < BENCH_SIZE; j++) {
+                dst[j] = tn5250_char_map_to_remote(map, src[j]);
+            }
+        }
+        remote = bench_ns(start, screens);
+
+        start = clock();
+        for (i = 0; i < screens; i++) {
+            tn5250_char_map_to_remote_n(map, dst, src, BENCH_SIZE);
+        }
+        remote_n = bench_ns(start, screens);
+        for (j = 0; j < BENCH_SIZE; j++) {
+            if (dst[j] != tn5250_char_map_to_remote(map, src[j])) {
+                fprintf(stderr, "%s: to_remote_n differs at %02X\n",
+                        map->name, src[j]);
+                failed++;
+                break;
+            }
+        }
+
+        fprintf(stderr, "%-16s  %6.2f %6.2f   %6.2f %6.2f\n", map->name,
+                local, local_n, remote, remote_n);
+    }
+    failed += bench_lookup(screens);
+    return failed != 0;
+}
@@ -0,0 +1,128 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* configbench -- Time loading and looking up config variables.
+ *
+ * Writes an rc file of stanzas with 20 variables each, loads it, promotes
+ * the variables of one stanza and then looks variables up by name: three
+ * promoted ones, read as an int, a bool and a string, and one from a
+ * different stanza each time.
+ *
+ * Usage: configbench [stanzas [lookups]]
+ */
+#include "tn5250-private.h"
+
+#include <time.h>
+
+static double bench_ms(clock_t start);
+static int bench_write(const char* filename, int stanzas);
+
+/*
+ *    CPU time since start, in milliseconds.
+ */
+static double bench_ms(clock_t start) {
+    return (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*
+ *    Write an rc file of ``stanzas'' stanzas to ``filename''.  Returns 0
+ *    if it couldn't be written.
+ */
+static int bench_write(const char* filename, int stanzas) {
+    FILE* f;
+    int i, j;
+
+    if ((f = fopen(filename, "w")) == NULL) {
+        return 0;
+    }
+    for (i = 0; i < stanzas; i++) {
+        fprintf(f, "sess%d {\n", i);
+        fprintf(f, "  host = ssl:host%d.example.com\n", i);
+        fprintf(f, "  map = 37\n  +ruler\n  -underscores\n");
+        fprintf(f, "  env.DEVNAME = DEV%05d\n", i);
+        for (j = 0; j < 15; j++) {
+            fprintf(f, "  opt%d = %d\n", j, i * j);
+        }
+        fprintf(f, "}\n");
+    }
+    return fclose(f) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Config* config;
+    char filename[] = "/tmp/configbenchXXXXXX";
+    char name[32];
+    clock_t start;
+    double load_ms, promote_ms, get_ms;
+    long sum = 0;
+    int stanzas, lookups, fd, i;
+
+    stanzas = argc > 1 ? atoi(argv[1]) : 500;
+    lookups = argc > 2 ? atoi(argv[2]) : 100000;
+    if (stanzas <= 0 || lookups <= 0) {
+        fprintf(stderr, "usage: configbench [stanzas [lookups]]\n");
+        return 2;
+    }
+
+    if ((fd = mkstemp(filename)) < 0) {
+        perror(filename);
+        return 1;
+    }
+    close(fd);
+    if (!bench_write(filename, stanzas)) {
+        perror(filename);
+        unlink(filename);
+        return 1;
+    }
+
+    config = tn5250_config_new();
+    start = clock();
+    i = tn5250_config_load(config, filename);
+    load_ms = bench_ms(start);
+    unlink(filename);
+    if (i == -1) {
+        fprintf(stderr, "configbench: can't load %s\n", filename);
+        tn5250_config_unref(config);
+        return 1;
+    }
+
+    start = clock();
+    tn5250_config_promote(config, "sess0");
+    promote_ms = bench_ms(start);
+
+    start = clock();
+    for (i = 0; i < lookups; i++) {
+        sum += tn5250_config_get_int(config, "opt7");
+        sum += tn5250_config_get_bool(config, "ruler");
+        sum += tn5250_config_get(config, "map") != NULL;
+        sprintf(name, "sess%d.opt3", i % stanzas);
+        sum += tn5250_config_get_int(config, name);
+    }
+    get_ms = bench_ms(start);
+    tn5250_config_unref(config);
+
+    fprintf(stderr, "load %d stanzas: %.1f ms CPU\n", stanzas, load_ms);
+    fprintf(stderr, "promote one:     %.2f ms CPU\n", promote_ms);
+    fprintf(stderr, "%d lookups: %.1f ms CPU, %.3f us each (sum %ld)\n",
+            lookups * 4, get_ms, get_ms * 1000.0 / (lookups * 4.0), sum);
+    return 0;
+}
@@ -0,0 +1,307 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* configtest -- Check config variables against a plain list.
+ *
+ * Sets, unsets, reads and promotes random variables, and does the same
+ * to a list kept in the order the variables were first set.  Enough
+ * names are used for the table to grow well past its first
+ * TN5250_CONFIG_BUCKETS buckets.  After each step every variable must
+ * be found with its value, and a walk of ``vars'' (as the env.* walks
+ * in telnetstr.c and sslstream.c do) must give the list in order.  Some
+ * steps read a variable as an int and a bool, set it, and read it
+ * again; others unset a variable from the middle of a hash chain.
+ *
+ * Usage: configtest [steps [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_NAMES 600
+#define TEST_MAX   TEST_NAMES
+
+static const char* test_prefixes[] = {"", "s1.", "s2.", "env.", "s1.s1."};
+static const char* test_values[] = {"0",  "1",   "on",  "off", "no",
+                                    "yes", "true", "false", "42", "-7",
+                                    "abc", ""};
+
+#define TEST_PREFIXES ((int)(sizeof(test_prefixes) / sizeof(char*)))
+#define TEST_VALUES   ((int)(sizeof(test_values) / sizeof(char*)))
+
+static char* test_names[TEST_MAX];
+static char* test_vals[TEST_MAX];
+static int test_count = 0;
+
+static const char* test_name(void);
+static int test_find(const char* name);
+static void test_keep(const char* name, const char* value);
+static void test_set(Tn5250Config* config, const char* name,
+                     const char* value);
+static void test_unset(Tn5250Config* config, const char* name);
+static void test_promote(Tn5250Config* config, const char* prefix);
+static int test_unset_middle(Tn5250Config* config);
+static int test_cached(Tn5250Config* config, const char* name);
+static int test_same(Tn5250Config* config, int verbose);
+
+/*
+ *    A random name from the pool.
+ */
+static const char* test_name(void) {
+    static char name[32];
+    int n = test_rand(TEST_NAMES);
+
+    sprintf(name, "%sv%d", test_prefixes[n % TEST_PREFIXES],
+            n / TEST_PREFIXES);
+    return name;
+}
+
+/*
+ *    Where a name is in the list, or -1.
+ */
+static int test_find(const char* name) {
+    int i;
+
+    for (i = 0; i < test_count; i++) {
+        if (strcmp(test_names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ *    Set a variable in the list only; a new one goes on the end.
+ */
+static void test_keep(const char* name, const char* value) {
+    int i = test_find(name);
+
+    if (i < 0) {
+        i = test_count++;
+        test_names[i] = (char*)malloc(strlen(name) + 1);
+        strcpy(test_names[i], name);
+        test_vals[i] = NULL;
+    }
+    free(test_vals[i]);
+    test_vals[i] = (char*)malloc(strlen(value) + 1);
+    strcpy(test_vals[i], value);
+}
+
+/*
+ *    Set a variable in both.
+ */
+static void test_set(Tn5250Config* config, const char* name,
+                     const char* value) {
+    tn5250_config_set(config, name, value);
+    test_keep(name, value);
+}
+
+/*
+ *    Unset a variable in both.
+ */
+static void test_unset(Tn5250Config* config, const char* name) {
+    int i = test_find(name);
+
+    tn5250_config_unset(config, name);
+    if (i >= 0) {
+        free(test_names[i]);
+        free(test_vals[i]);
+        test_count--;
+        memmove(test_names + i, test_names + i + 1,
+                (test_count - i) * sizeof(char*));
+        memmove(test_vals + i, test_vals + i + 1,
+                (test_count - i) * sizeof(char*));
+    }
+}
+
+/*
+ *    Promote in both.  The list is walked as far as the variable which
+ *    was last when we started, reading each value as it is by then.
+ */
+static void test_promote(Tn5250Config* config, const char* prefix) {
+    int len = strlen(prefix);
+    int last = test_count;
+    char value[64];
+    int i;
+
+    tn5250_config_promote(config, prefix);
+    for (i = 0; i < last; i++) {
+        if (strncmp(test_names[i], prefix, len) == 0 &&
+            test_names[i][len] == '.') {
+            strcpy(value, test_vals[i]);
+            test_keep(test_names[i] + len + 1, value);
+        }
+    }
+}
+
+/*
+ *    Unset the variable in the middle of the first hash chain with three
+ *    or more in it.  Returns 0 if there is no such chain.
+ */
+static int test_unset_middle(Tn5250Config* config) {
+    Tn5250ConfigStr* iter;
+    char name[32];
+    unsigned long b;
+    int n;
+
+    for (b = 0; b < config->bucket_count; b++) {
+        n = 0;
+        for (iter = config->buckets[b]; iter != NULL; iter = iter->chain) {
+            n++;
+        }
+        if (n >= 3) {
+            strcpy(name, config->buckets[b]->chain->name);
+            test_unset(config, name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Read a variable as an int and a bool, so that both are cached, then
+ *    set it to something else and read it again.
+ */
+static int test_cached(Tn5250Config* config, const char* name) {
+    const char* value;
+    int ok = 1;
+
+    tn5250_config_get_int(config, name);
+    tn5250_config_get_bool(config, name);
+    value = test_values[test_rand(TEST_VALUES)];
+    test_set(config, name, value);
+    if (tn5250_config_get_int(config, name) != atoi(value)) {
+        printf("%s is %d as an int after setting it to \"%s\"\n", name,
+               tn5250_config_get_int(config, name), value);
+        ok = 0;
+    }
+    if (tn5250_config_get_bool(config, name) !=
+        !(!strcmp(value, "off") || !strcmp(value, "no") ||
+          !strcmp(value, "0") || !strcmp(value, "false"))) {
+        printf("%s is %d as a bool after setting it to \"%s\"\n", name,
+               tn5250_config_get_bool(config, name), value);
+        ok = 0;
+    }
+    return ok;
+}
+
+/*
+ *    Compare the config with the list: every variable by name, and the
+ *    walk of ``vars''.
+ */
+static int test_same(Tn5250Config* config, int verbose) {
+    Tn5250ConfigStr* iter;
+    const char* got;
+    int i;
+
+    for (i = 0; i < test_count; i++) {
+        got = tn5250_config_get(config, test_names[i]);
+        if (got == NULL || strcmp(got, test_vals[i]) != 0) {
+            if (verbose) {
+                printf("%s is %s, wanted \"%s\"\n", test_names[i],
+                       got == NULL ? "unset" : got, test_vals[i]);
+            }
+            return 0;
+        }
+    }
+    if ((int)config->count != test_count) {
+        if (verbose) {
+            printf("%lu variables, wanted %d\n", config->count, test_count);
+        }
+        return 0;
+    }
+
+    i = 0;
+    if ((iter = config->vars) != NULL) {
+        do {
+            if (i >= test_count || strcmp(iter->name, test_names[i]) != 0 ||
+                strcmp(iter->value, test_vals[i]) != 0) {
+                if (verbose) {
+                    printf("variable %d of the walk is %s, wanted %s\n", i,
+                           iter->name, i < test_count ? test_names[i] : "none");
+                }
+                return 0;
+            }
+            i++;
+            iter = iter->next;
+        } while (iter != config->vars);
+    }
+    if (i != test_count) {
+        if (verbose) {
+            printf("the walk gave %d variables, wanted %d\n", i, test_count);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    static const char* promote[] = {"s1", "s2", "s1.s1", "env"};
+    Tn5250Config* config;
+    unsigned long most = 0;
+    int steps, step, kind, ok;
+    int failed = 0, middles = 0;
+
+    steps = argc > 1 ? atoi(argv[1]) : 20000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (steps <= 0) {
+        fprintf(stderr, "usage: configtest [steps [seed]]\n");
+        return 2;
+    }
+
+    config = tn5250_config_new();
+    for (step = 0; step < steps; step++) {
+        ok = 1;
+        kind = test_rand(20);
+        if (kind < 10) {
+            test_set(config, test_name(), test_values[test_rand(TEST_VALUES)]);
+        }
+        else if (kind < 13) {
+            test_unset(config, test_name());
+        }
+        else if (kind < 15) {
+            middles += test_unset_middle(config);
+        }
+        else if (kind < 16) {
+            test_promote(config, promote[test_rand(4)]);
+        }
+        else {
+            ok = test_cached(config, test_name());
+        }
+        if (config->bucket_count > most) {
+            most = config->bucket_count;
+        }
+        if (!(ok && test_same(config, failed < 3)) && ++failed <= 3) {
+            printf("  (step %d, kind %d)\n", step, kind);
+        }
+    }
+
+    printf("%d of %d steps failed, %d unset from the middle of a chain, "
+           "up to %lu buckets\n",
+           failed, steps, middles, most);
+    if (most <= TN5250_CONFIG_BUCKETS || middles == 0) {
+        printf("the table never grew or never had a long chain\n");
+        failed++;
+    }
+    tn5250_config_unref(config);
+    return failed != 0;
+}
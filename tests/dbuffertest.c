@@ -0,0 +1,226 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* dbuffertest -- Check the views the display buffer keeps of its data.
+ *
+ * Makes random edits to a display buffer: characters, attributes and
+ * control characters typed at random places, rolls, clears, writes
+ * through tn5250_dbuffer_writable_data, copies and changes of size and
+ * character map.  After each one, the text shadows must match a fresh
+ * translation of the data plane, and the character and attribute planes
+ * must match a walk of it from the top left.
+ *
+ * Usage: dbuffertest [edits [seed]]
+ */
+#include "testutil.h"
+
+static void test_edit(Tn5250DBuffer* dbuffer);
+static int test_text(Tn5250DBuffer* dbuffer, const Tn5250CharMap* map,
+                     int verbose);
+static int test_planes(Tn5250DBuffer* dbuffer, int verbose);
+
+/*
+ *    Make one random edit.
+ */
+static void test_edit(Tn5250DBuffer* dbuffer) {
+    int w = tn5250_dbuffer_width(dbuffer);
+    int h = tn5250_dbuffer_height(dbuffer);
+    int k = test_rand(100);
+    int y = test_rand(h);
+    int top, bot;
+
+    if (k < 70) {
+        tn5250_dbuffer_cursor_set(dbuffer, y, test_rand(w));
+        tn5250_dbuffer_addch(dbuffer, (unsigned char)test_rand(0x100));
+    }
+    else if (k < 80) {
+        tn5250_dbuffer_cursor_set(dbuffer, y, test_rand(w));
+        tn5250_dbuffer_addch(dbuffer, (unsigned char)(0x20 + test_rand(0x20)));
+    }
+    else if (k < 90) {
+        top = test_rand(h);
+        bot = top + test_rand(h - top);
+        tn5250_dbuffer_roll(dbuffer, top, bot, test_rand(5) - 2);
+    }
+    else if (k < 98) {
+        tn5250_dbuffer_writable_data(dbuffer, y, y)[y * w + test_rand(w)] =
+            (unsigned char)test_rand(0x100);
+    }
+    else if (k < 99) {
+        tn5250_dbuffer_clear(dbuffer);
+    }
+    else if (w == 80) {
+        tn5250_dbuffer_set_size(dbuffer, 27, 132);
+    }
+    else {
+        tn5250_dbuffer_set_size(dbuffer, 24, 80);
+    }
+}
+
+/*
+ *    Do the text shadows hold the data plane, translated with ``map''
+ *    and with attributes and control characters shown as blanks?
+ */
+static int test_text(Tn5250DBuffer* dbuffer, const Tn5250CharMap* map,
+                     int verbose) {
+    int w = tn5250_dbuffer_width(dbuffer);
+    int h = tn5250_dbuffer_height(dbuffer);
+    const unsigned char* text;
+    const char* utf8;
+    char want[TN5250_UTF8_MAX];
+    unsigned char c;
+    int y, x, len, pos, n;
+
+    for (y = 0; y < h; y++) {
+        text = tn5250_dbuffer_text_row(dbuffer, map, y);
+        utf8 = tn5250_dbuffer_utf8_row(dbuffer, map, y, &len);
+        pos = 0;
+        for (x = 0; x < w; x++) {
+            c = dbuffer->data[y * w + x];
+            if ((c < 0x40 && c != 0x00 && c != 0x1c) || c == 0xff) {
+                c = 0x40;
+            }
+            if (text[x] != tn5250_char_map_to_local(map, c)) {
+                if (verbose) {
+                    printf("text at %d,%d: got %02X, wanted %02X\n", y, x,
+                           text[x], tn5250_char_map_to_local(map, c));
+                }
+                return 0;
+            }
+            n = tn5250_char_map_to_utf8_n(map, want, sizeof(want), &c, 1);
+            if (pos + n > len || memcmp(utf8 + pos, want, n) != 0) {
+                if (verbose) {
+                    printf("UTF-8 at %d,%d differs\n", y, x);
+                }
+                return 0;
+            }
+            pos += n;
+        }
+        if (pos != len) {
+            if (verbose) {
+                printf("UTF-8 row %d is %d bytes, wanted %d\n", y, len, pos);
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    Do the character and attribute planes agree with a walk of the data
+ *    plane, carrying the attribute from cell to cell and row to row?
+ */
+static int test_planes(Tn5250DBuffer* dbuffer, int verbose) {
+    int w = tn5250_dbuffer_width(dbuffer);
+    int h = tn5250_dbuffer_height(dbuffer);
+    const unsigned char *chars, *attrs;
+    unsigned char a = 0x20, c;
+    int y, x;
+
+    for (y = 0; y < h; y++) {
+        if (tn5250_dbuffer_row_start_attr(dbuffer, y) != a) {
+            if (verbose) {
+                printf("row %d starts with %02X, wanted %02X\n", y,
+                       tn5250_dbuffer_row_start_attr(dbuffer, y), a);
+            }
+            return 0;
+        }
+        chars = tn5250_dbuffer_char_row(dbuffer, y);
+        attrs = tn5250_dbuffer_attr_row(dbuffer, y);
+        for (x = 0; x < w; x++) {
+            c = dbuffer->data[y * w + x];
+            if ((c & 0xe0) == 0x20) {
+                a = c;
+                if (chars[x] != 0x00 || attrs[x] != 0x00) {
+                    if (verbose) {
+                        printf("attribute at %d,%d shows in the planes\n", y,
+                               x);
+                    }
+                    return 0;
+                }
+            }
+            else if (chars[x] != c || attrs[x] != a) {
+                if (verbose) {
+                    printf("planes at %d,%d: got %02X/%02X, wanted %02X/%02X\n",
+                           y, x, chars[x], attrs[x], c, a);
+                }
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    const Tn5250CharMap* maps[2];
+    Tn5250DBuffer *dbuffer, *copy = NULL;
+    int edits, i, m = 0;
+    int failed = 0;
+
+    edits = argc > 1 ? atoi(argv[1]) : 20000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (edits <= 0) {
+        fprintf(stderr, "usage: dbuffertest [edits [seed]]\n");
+        return 2;
+    }
+    maps[0] = tn5250_char_map_new("37");
+    maps[1] = tn5250_char_map_new("273");
+
+    dbuffer = tn5250_dbuffer_new(80, 24);
+    for (i = 0; i < edits; i++) {
+        test_edit(dbuffer);
+        if (test_rand(200) == 0) {
+            m = !m;
+        }
+
+        /* Keep a copy now and then, so that edits go through the
+         * copy-on-write path and the copy's views are checked too. */
+        if (copy == NULL && test_rand(50) == 0) {
+            copy = tn5250_dbuffer_copy(dbuffer);
+        }
+        else if (copy != NULL && test_rand(20) == 0) {
+            if ((!test_text(copy, maps[m], failed < 3) ||
+                 !test_planes(copy, failed < 3)) &&
+                ++failed <= 3) {
+                printf("  (copy, edit %d)\n", i);
+            }
+            tn5250_dbuffer_destroy(copy);
+            copy = NULL;
+        }
+
+        if (test_rand(4) == 0 &&
+            (!test_text(dbuffer, maps[m], failed < 3) ||
+             !test_planes(dbuffer, failed < 3)) &&
+            ++failed <= 3) {
+            printf("  (edit %d)\n", i);
+        }
+    }
+    if (copy != NULL) {
+        tn5250_dbuffer_destroy(copy);
+    }
+
+    printf("%d edits, %d checks failed\n", edits, failed);
+    tn5250_dbuffer_destroy(dbuffer);
+    return failed != 0;
+}
@@ -0,0 +1,311 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* dirtytest -- Check the dirty rows and the change generation.
+ *
+ * Makes random changes to a display buffer through each of the ways it
+ * is written to: addch, ins, del, roll, clear, dirty row ranges,
+ * writable_data, field_data and erase region.  Between them are calls
+ * which must not change anything: cursor moves, reads, format table
+ * changes and writes to a copy.  After each one,
+ * tn5250_dbuffer_take_dirty_rows must give exactly the rows the change
+ * covered, the generation must have moved on if and only if there were
+ * any, and each changed row's generation must be new while every other
+ * row's is as it was.
+ *
+ * Usage: dirtytest [changes [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_W 80
+#define TEST_H 24
+
+static void test_fields(Tn5250DBuffer* dbuffer);
+static void test_range(int* top, int* bot);
+static void test_expect(unsigned char* want, int top, int bot);
+static int test_change(Tn5250Display* display, unsigned char* want);
+static int test_check(Tn5250DBuffer* dbuffer, const unsigned char* want,
+                      const unsigned long* before, unsigned long generation,
+                      int verbose);
+
+/*
+ *    Replace the format table with up to 12 random fields.
+ */
+static void test_fields(Tn5250DBuffer* dbuffer) {
+    int n;
+
+    tn5250_dbuffer_clear_table(dbuffer);
+    n = 1 + test_rand(12);
+    while (n-- > 0) {
+        test_random_field(dbuffer, 30, 0x4000 | TN5250_FIELD_ALPHA_SHIFT,
+                          0x20);
+    }
+}
+
+/*
+ *    A random range of rows, now and then reaching past the display.
+ */
+static void test_range(int* top, int* bot) {
+    *top = test_rand(TEST_H + 4) - 2;
+    *bot = *top + test_rand(TEST_H + 2 - *top);
+}
+
+/*
+ *    Expect rows ``top'' through ``bot'' to be dirty, as far as they are
+ *    on the display.
+ */
+static void test_expect(unsigned char* want, int top, int bot) {
+    for (; top <= bot; top++) {
+        if (top >= 0 && top < TEST_H) {
+            want[top] = 1;
+        }
+    }
+}
+
+/*
+ *    Make one random change, or do something which must change nothing,
+ *    and set want[y] for each row which should be dirty.  Returns the
+ *    kind of change made.
+ */
+static int test_change(Tn5250Display* display, unsigned char* want) {
+    Tn5250DBuffer *dbuffer = tn5250_display_dbuffer(display), *copy;
+    Tn5250Field* field = NULL;
+    int kind = test_rand(13);
+    int top, bot, left, right, pos, count;
+
+    if (tn5250_dbuffer_field_count(dbuffer) > 0) {
+        field = dbuffer->field_table[test_rand(
+            tn5250_dbuffer_field_count(dbuffer))];
+    }
+    if (field == NULL && kind >= 1 && kind <= 3) {
+        kind = 0;
+    }
+
+    switch (kind) {
+    case 0: /* addch */
+        tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H),
+                                  test_rand(TEST_W));
+        test_expect(want, dbuffer->cy, dbuffer->cy);
+        tn5250_dbuffer_addch(dbuffer, (unsigned char)(0x40 + test_rand(0xbf)));
+        break;
+
+    case 1: /* ins */
+    case 2: /* del */
+    case 3: /* del_this_field_only */
+        pos = tn5250_field_start_pos(field) + test_rand(field->length);
+        tn5250_dbuffer_cursor_set(dbuffer, pos / TEST_W, pos % TEST_W);
+        count = tn5250_field_count_right(field, pos / TEST_W, pos % TEST_W);
+        test_expect(want, pos / TEST_W, (pos + count) / TEST_W);
+        if (kind == 1) {
+            tn5250_dbuffer_ins(dbuffer, field->id,
+                               (unsigned char)(0x40 + test_rand(0xbf)), count);
+        }
+        else if (kind == 2) {
+            tn5250_dbuffer_del(dbuffer, field->id, count);
+        }
+        else {
+            tn5250_dbuffer_del_this_field_only(dbuffer, count);
+        }
+        break;
+
+    case 4: /* roll */
+        top = test_rand(TEST_H);
+        bot = top + test_rand(TEST_H - top);
+        count = test_rand(2 * (bot - top) + 3) - (bot - top + 1);
+        if (count != 0) {
+            test_expect(want, top, bot);
+        }
+        tn5250_dbuffer_roll(dbuffer, top, bot, count);
+        break;
+
+    case 5: /* clear, then put the fields back */
+        test_expect(want, 0, TEST_H - 1);
+        tn5250_dbuffer_clear(dbuffer);
+        test_fields(dbuffer);
+        break;
+
+    case 6: /* mark a range */
+        test_range(&top, &bot);
+        test_expect(want, top, bot);
+        tn5250_dbuffer_mark_dirty_rows(dbuffer, top, bot);
+        break;
+
+    case 7: /* writable_data */
+        top = test_rand(TEST_H);
+        bot = top + test_rand(TEST_H - top);
+        test_expect(want, top, bot);
+        tn5250_dbuffer_writable_data(dbuffer, top, bot)[top * TEST_W] = 0x40;
+        break;
+
+    case 8: /* field_data */
+        if (field == NULL) {
+            break;
+        }
+        test_expect(want, tn5250_field_start_row(field),
+                    tn5250_field_end_row(field));
+        tn5250_dbuffer_field_data(dbuffer, field)[0] = 0x40;
+        break;
+
+    case 9: /* erase region */
+        top = 1 + test_rand(TEST_H);
+        bot = top + test_rand(TEST_H + 1 - top);
+        left = 1 + test_rand(TEST_W);
+        right = left + test_rand(TEST_W + 1 - left);
+        test_expect(want, top - 1, bot - 1);
+        tn5250_display_erase_region(display, top, left, bot, right, left,
+                                    right);
+        break;
+
+    case 10: /* cursor moves and reads */
+        tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H),
+                                  test_rand(TEST_W));
+        tn5250_dbuffer_right(dbuffer, 1 + test_rand(TEST_W));
+        tn5250_dbuffer_char_at(dbuffer, test_rand(TEST_H), test_rand(TEST_W));
+        tn5250_dbuffer_text_row(dbuffer, tn5250_display_char_map(display),
+                                test_rand(TEST_H));
+        if (field != NULL) {
+            tn5250_dbuffer_field_data_const(dbuffer, field);
+        }
+        break;
+
+    case 11: /* a new format table */
+        test_fields(dbuffer);
+        break;
+
+    case 12: /* write to a copy */
+        copy = tn5250_dbuffer_copy(dbuffer);
+        tn5250_dbuffer_cursor_set(copy, test_rand(TEST_H), test_rand(TEST_W));
+        tn5250_dbuffer_addch(copy, 0x40);
+        tn5250_dbuffer_roll(copy, 0, TEST_H - 1, 1);
+        tn5250_dbuffer_destroy(copy);
+        break;
+    }
+    return kind;
+}
+
+/*
+ *    Check the dirty rows and generations against what was expected.
+ *    ``before'' holds each row's generation, and ``generation'' the
+ *    buffer's, from before the change.
+ */
+static int test_check(Tn5250DBuffer* dbuffer, const unsigned char* want,
+                      const unsigned long* before, unsigned long generation,
+                      int verbose) {
+    unsigned long now = tn5250_dbuffer_generation(dbuffer);
+    unsigned long row;
+    unsigned char got[TEST_H];
+    int y, count, wanted = 0, top, bot, any;
+
+    count = tn5250_dbuffer_take_dirty_rows(dbuffer, got);
+    for (y = 0; y < TEST_H; y++) {
+        wanted += want[y];
+        if (got[y] != want[y]) {
+            if (verbose) {
+                printf("row %d is %sdirty\n", y, got[y] ? "" : "not ");
+            }
+            return 0;
+        }
+        row = tn5250_dbuffer_row_generation(dbuffer, y);
+        if (want[y] ? (row <= generation || row > now) : row != before[y]) {
+            if (verbose) {
+                printf("row %d has generation %lu, was %lu, buffer %lu->%lu\n",
+                       y, row, before[y], generation, now);
+            }
+            return 0;
+        }
+    }
+    if (count != wanted) {
+        if (verbose) {
+            printf("%d dirty rows counted, %d marked\n", count, wanted);
+        }
+        return 0;
+    }
+    if ((now != generation) != (wanted != 0)) {
+        if (verbose) {
+            printf("generation went from %lu to %lu with %d dirty rows\n",
+                   generation, now, wanted);
+        }
+        return 0;
+    }
+
+    top = test_rand(TEST_H);
+    bot = top + test_rand(TEST_H - top);
+    for (any = 0, y = top; y <= bot; y++) {
+        any |= want[y];
+    }
+    if (tn5250_dbuffer_changed_since(dbuffer, top, bot, generation) != any) {
+        if (verbose) {
+            printf("changed_since rows %d-%d is not %d\n", top, bot, any);
+        }
+        return 0;
+    }
+    if (tn5250_dbuffer_take_dirty_rows(dbuffer, NULL) != 0) {
+        if (verbose) {
+            printf("dirty rows left after taking them\n");
+        }
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Display* display;
+    Tn5250DBuffer* dbuffer;
+    unsigned long before[TEST_H];
+    unsigned long generation;
+    unsigned char want[TEST_H];
+    int changes, i, y, kind;
+    int failed = 0;
+
+    changes = argc > 1 ? atoi(argv[1]) : 50000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (changes <= 0) {
+        fprintf(stderr, "usage: dirtytest [changes [seed]]\n");
+        return 2;
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    dbuffer = tn5250_display_dbuffer(display);
+    test_fields(dbuffer);
+    tn5250_dbuffer_take_dirty_rows(dbuffer, NULL);
+
+    for (i = 0; i < changes; i++) {
+        generation = tn5250_dbuffer_generation(dbuffer);
+        for (y = 0; y < TEST_H; y++) {
+            before[y] = tn5250_dbuffer_row_generation(dbuffer, y);
+        }
+        memset(want, 0, sizeof(want));
+        kind = test_change(display, want);
+        if (!test_check(dbuffer, want, before, generation, failed < 3)) {
+            if (++failed <= 3) {
+                printf("  (change %d, kind %d)\n", i, kind);
+            }
+        }
+    }
+
+    printf("%d of %d changes left the wrong rows dirty\n", failed, changes);
+    tn5250_display_destroy(display);
+    return failed != 0;
+}
@@ -0,0 +1,104 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* fieldbench -- Time the format table.
+ *
+ * Builds a 27x132 display buffer holding 400 fields, a third of them
+ * bypass fields, then times copying and destroying the buffer, looking
+ * up the field under every cell with tn5250_dbuffer_field_yx and looking
+ * fields up by id.
+ *
+ * Usage: fieldbench [copies]
+ */
+#include "tn5250-private.h"
+
+#include <time.h>
+
+#define BENCH_FIELDS 400
+
+static double bench_ms(clock_t start);
+
+/*
+ *    CPU time since start, in milliseconds.
+ */
+static double bench_ms(clock_t start) {
+    return (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250DBuffer* dbuffer;
+    Tn5250Field* field;
+    clock_t start;
+    double ms;
+    long found = 0;
+    int copies, i, j;
+
+    copies = argc > 1 ? atoi(argv[1]) : 2000;
+    if (copies <= 0) {
+        fprintf(stderr, "usage: fieldbench [copies]\n");
+        return 2;
+    }
+
+    dbuffer = tn5250_dbuffer_new(132, 27);
+    for (i = 0; i < BENCH_FIELDS; i++) {
+        field = tn5250_field_new(132);
+        field->start_row = i / 15;
+        field->start_col = (i % 15) * 8 + 1;
+        field->length = 6;
+        field->FFW = i % 3 == 0 ? TN5250_FIELD_BYPASS : 0;
+        tn5250_dbuffer_add_field(dbuffer, field);
+    }
+
+    start = clock();
+    for (i = 0; i < copies; i++) {
+        tn5250_dbuffer_destroy(tn5250_dbuffer_copy(dbuffer));
+    }
+    ms = bench_ms(start);
+    fprintf(stderr, "%d copies: %.1f ms CPU, %.2f us each\n", copies, ms,
+            ms * 1000.0 / copies);
+
+    start = clock();
+    for (i = 0; i < copies / 10; i++) {
+        for (j = 0; j < 27 * 132; j++) {
+            field = tn5250_dbuffer_field_yx(dbuffer, j / 132, j % 132);
+            if (field != NULL) {
+                found++;
+            }
+        }
+    }
+    ms = bench_ms(start);
+    fprintf(stderr, "%d field_yx lookups: %.1f ms CPU, %ld found\n",
+            copies / 10 * 27 * 132, ms, found);
+
+    found = 0;
+    start = clock();
+    for (i = 0; i < copies * 100; i++) {
+        field = tn5250_dbuffer_field_by_id(dbuffer, i % BENCH_FIELDS);
+        found += field->id;
+    }
+    ms = bench_ms(start);
+    fprintf(stderr, "%d lookups by id: %.1f ms CPU (%ld)\n", copies * 100, ms,
+            found);
+
+    tn5250_dbuffer_destroy(dbuffer);
+    return 0;
+}
@@ -0,0 +1,401 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* fieldmaptest -- Check the field map and the tab order links.
+ *
+ * Each pass puts up to 30 random fields on a display, about a third of
+ * them bypass fields and some of them overlapping.  For every position,
+ * tn5250_dbuffer_field_yx must give the first field in the format table
+ * whose tn5250_field_hit_test takes the position.  From random cursor
+ * positions and from every field, tn5250_display_next_field and
+ * tn5250_display_prev_field must give what a walk of the field list
+ * gives.  Then the host sends SF orders which turn some of the fields
+ * into bypass fields and others back, and the walks are compared again.
+ *
+ * Usage: fieldmaptest [passes [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_W      80
+#define TEST_H      24
+#define TEST_SIZE   (TEST_W * TEST_H)
+#define TEST_FIELDS 30
+
+static Tn5250Record* test_pending = NULL;
+
+static void test_fields(Tn5250DBuffer* dbuffer);
+static Tn5250Field* test_field_at(Tn5250DBuffer* dbuffer, int y, int x);
+static Tn5250Field* test_next(Tn5250Display* display);
+static Tn5250Field* test_prev(Tn5250Display* display);
+static int test_map(Tn5250DBuffer* dbuffer, int verbose);
+static int test_walk(Tn5250Display* display, int y, int x, int verbose);
+static int test_walks(Tn5250Display* display, int verbose);
+static int test_bypass(Tn5250Display* display, Tn5250Session* session,
+                       int verbose);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+
+/*
+ *    Replace the format table with random fields, which may overlap.
+ *    No field starts in the top left corner, so each has a position for
+ *    its attribute before it.
+ */
+static void test_fields(Tn5250DBuffer* dbuffer) {
+    Tn5250Field* field;
+    int n, start, len;
+
+    tn5250_dbuffer_clear_table(dbuffer);
+    n = test_rand(TEST_FIELDS + 1);
+    while (n-- > 0) {
+        start = 1 + test_rand(TEST_SIZE - 1);
+        len = 1 + test_rand(60);
+        if (start + len > TEST_SIZE) {
+            len = TEST_SIZE - start;
+        }
+        field = tn5250_field_new(TEST_W);
+        field->start_row = start / TEST_W;
+        field->start_col = start % TEST_W;
+        field->length = len;
+        field->FFW = 0x4000 | TN5250_FIELD_ALPHA_SHIFT;
+        if (test_rand(3) == 0) {
+            field->FFW |= TN5250_FIELD_BYPASS;
+        }
+        field->attribute = 0x20;
+        tn5250_dbuffer_add_field(dbuffer, field);
+    }
+}
+
+/*
+ *    The field at a position, as it was found before there was a field
+ *    map: the first field in the list which takes the position.
+ */
+static Tn5250Field* test_field_at(Tn5250DBuffer* dbuffer, int y, int x) {
+    Tn5250Field* iter = dbuffer->field_list;
+
+    if (iter != NULL) {
+        do {
+            if (tn5250_field_hit_test(iter, y, x)) {
+                return iter;
+            }
+            iter = iter->next;
+        } while (iter != dbuffer->field_list);
+    }
+    return NULL;
+}
+
+/*
+ *    The next non-bypass field, by walking the field list from the field
+ *    at the cursor or, outside any field, from the first field after it.
+ */
+static Tn5250Field* test_next(Tn5250Display* display) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    int y = tn5250_display_cursor_y(display);
+    int x = tn5250_display_cursor_x(display);
+    Tn5250Field *iter, *next;
+    int i;
+
+    if ((iter = test_field_at(dbuffer, y, x)) != NULL) {
+        iter = iter->next;
+    }
+    for (i = 0; iter == NULL && i < TEST_SIZE; i++) {
+        if (++x == TEST_W) {
+            x = 0;
+            if (++y == TEST_H) {
+                y = 0;
+            }
+        }
+        iter = test_field_at(dbuffer, y, x);
+    }
+    if (iter == NULL) {
+        return NULL;
+    }
+    next = iter;
+    while (tn5250_field_is_bypass(next)) {
+        next = next->next;
+        if (next == iter) {
+            return NULL;
+        }
+    }
+    return next;
+}
+
+/*
+ *    The previous non-bypass field, the same way.
+ */
+static Tn5250Field* test_prev(Tn5250Display* display) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    int y = tn5250_display_cursor_y(display);
+    int x = tn5250_display_cursor_x(display);
+    Tn5250Field *iter, *prev;
+    int i;
+
+    if ((iter = test_field_at(dbuffer, y, x)) != NULL) {
+        iter = iter->prev;
+    }
+    for (i = 0; iter == NULL && i < TEST_SIZE; i++) {
+        if (x-- == 0) {
+            x = TEST_W - 1;
+            if (y-- == 0) {
+                y = TEST_H - 1;
+            }
+        }
+        iter = test_field_at(dbuffer, y, x);
+    }
+    if (iter == NULL) {
+        return NULL;
+    }
+    prev = iter;
+    while (tn5250_field_is_bypass(prev)) {
+        prev = prev->prev;
+        if (prev == iter) {
+            return NULL;
+        }
+    }
+    return prev;
+}
+
+/*
+ *    Compare the field map with a hit test at every position.
+ */
+static int test_map(Tn5250DBuffer* dbuffer, int verbose) {
+    Tn5250Field *got, *want;
+    int y, x;
+
+    for (y = 0; y < TEST_H; y++) {
+        for (x = 0; x < TEST_W; x++) {
+            got = tn5250_dbuffer_field_yx(dbuffer, y, x);
+            want = test_field_at(dbuffer, y, x);
+            if (got != want) {
+                if (verbose) {
+                    printf("field at %d,%d: got %d, wanted %d\n", y, x,
+                           got != NULL ? got->id : -1,
+                           want != NULL ? want->id : -1);
+                }
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/*
+ *    Compare next and prev with the list walks, from one position.
+ */
+static int test_walk(Tn5250Display* display, int y, int x, int verbose) {
+    Tn5250Field *got, *want;
+
+    tn5250_display_set_cursor(display, y, x);
+    got = tn5250_display_next_field(display);
+    want = test_next(display);
+    if (got != want) {
+        if (verbose) {
+            printf("next field from %d,%d: got %d, wanted %d\n", y, x,
+                   got != NULL ? got->id : -1, want != NULL ? want->id : -1);
+        }
+        return 0;
+    }
+    got = tn5250_display_prev_field(display);
+    want = test_prev(display);
+    if (got != want) {
+        if (verbose) {
+            printf("previous field from %d,%d: got %d, wanted %d\n", y, x,
+                   got != NULL ? got->id : -1, want != NULL ? want->id : -1);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Compare the walks from the start and end of every field and from
+ *    random positions.
+ */
+static int test_walks(Tn5250Display* display, int verbose) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    Tn5250Field* field;
+    int i;
+
+    for (i = 0; i < tn5250_dbuffer_field_count(dbuffer); i++) {
+        field = dbuffer->field_table[i];
+        if (!test_walk(display, field->start_row, field->start_col,
+                       verbose) ||
+            !test_walk(display, tn5250_field_end_row(field),
+                       tn5250_field_end_col(field), verbose)) {
+            return 0;
+        }
+    }
+    for (i = 0; i < 50; i++) {
+        if (!test_walk(display, test_rand(TEST_H), test_rand(TEST_W),
+                       verbose)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    Have the host flip the bypass bit of some of the fields with SF
+ *    orders, then compare the walks again.  Only fields which are found
+ *    at their own start can be changed by an SF; an SF anywhere else
+ *    would add a field.
+ */
+static int test_bypass(Tn5250Display* display, Tn5250Session* session,
+                       int verbose) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    int ffw[TEST_FIELDS];
+    Tn5250Field* field;
+    Tn5250Record* record;
+    Tn5250Buffer buf;
+    int count = tn5250_dbuffer_field_count(dbuffer);
+    int i, pos, len;
+
+    tn5250_buffer_init(&buf);
+    tn5250_buffer_append_byte(&buf, ESC);
+    tn5250_buffer_append_byte(&buf, CMD_WRITE_TO_DISPLAY);
+    tn5250_buffer_append_byte(&buf, 0x00); /* CC1 */
+    tn5250_buffer_append_byte(&buf, 0x00); /* CC2 */
+    for (i = 0; i < count; i++) {
+        field = dbuffer->field_table[i];
+        ffw[i] = field->FFW;
+        if (test_rand(2) != 0 ||
+            tn5250_dbuffer_field_yx(dbuffer, field->start_row,
+                                    field->start_col) != field) {
+            continue;
+        }
+        ffw[i] ^= TN5250_FIELD_BYPASS;
+        pos = tn5250_field_start_pos(field) - 1;
+        tn5250_buffer_append_byte(&buf, SBA);
+        tn5250_buffer_append_byte(&buf, (unsigned char)(pos / TEST_W + 1));
+        tn5250_buffer_append_byte(&buf, (unsigned char)(pos % TEST_W + 1));
+        tn5250_buffer_append_byte(&buf, SF);
+        tn5250_buffer_append_byte(&buf, (unsigned char)(ffw[i] >> 8));
+        tn5250_buffer_append_byte(&buf, (unsigned char)ffw[i]);
+        tn5250_buffer_append_byte(&buf, field->attribute);
+        tn5250_buffer_append_byte(&buf, (unsigned char)(field->length >> 8));
+        tn5250_buffer_append_byte(&buf, (unsigned char)field->length);
+    }
+
+    record = tn5250_record_new();
+    len = sizeof(header) + tn5250_buffer_length(&buf);
+    tn5250_record_append_byte(record, (unsigned char)(len >> 8));
+    tn5250_record_append_byte(record, (unsigned char)len);
+    for (i = 2; i < (int)sizeof(header); i++) {
+        tn5250_record_append_byte(record, header[i]);
+    }
+    for (i = 0; i < tn5250_buffer_length(&buf); i++) {
+        tn5250_record_append_byte(record, tn5250_buffer_data(&buf)[i]);
+    }
+    tn5250_buffer_free(&buf);
+    test_pending = record;
+    tn5250_session_receive(session);
+
+    if (tn5250_dbuffer_field_count(dbuffer) != count) {
+        if (verbose) {
+            printf("the SF orders left %d fields, not %d\n",
+                   tn5250_dbuffer_field_count(dbuffer), count);
+        }
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        if (dbuffer->field_table[i]->FFW != ffw[i]) {
+            if (verbose) {
+                printf("field %d has FFW %04X, not %04X\n", i,
+                       dbuffer->field_table[i]->FFW, ffw[i]);
+            }
+            return 0;
+        }
+    }
+    return test_map(dbuffer, verbose) && test_walks(display, verbose);
+}
+
+/*
+ *    The stream "receives" the record the test has queued.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    if (test_pending != NULL) {
+        stream->records = tn5250_record_list_add(stream->records, test_pending);
+        stream->record_count++;
+        test_pending = NULL;
+    }
+    return 1;
+}
+
+/*
+ *    Nothing is sent back.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Display* display;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    Tn5250DBuffer* dbuffer;
+    int passes, pass, ok;
+    int failed = 0;
+
+    passes = argc > 1 ? atoi(argv[1]) : 500;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (passes <= 0) {
+        fprintf(stderr, "usage: fieldmaptest [passes [seed]]\n");
+        return 2;
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+
+    dbuffer = tn5250_display_dbuffer(display);
+    for (pass = 0; pass < passes; pass++) {
+        test_fields(dbuffer);
+        ok = test_map(dbuffer, failed < 3) &&
+             test_walks(display, failed < 3) &&
+             test_bypass(display, session, failed < 3);
+        if (!ok && ++failed <= 3) {
+            printf("  (pass %d, %d fields)\n", pass,
+                   tn5250_dbuffer_field_count(dbuffer));
+        }
+    }
+
+    printf("%d of %d format tables failed\n", failed, passes);
+    tn5250_display_destroy(display);
+    tn5250_session_destroy(session);
+    return failed != 0;
+}
@@ -0,0 +1,161 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* fieldtest -- Check that each field flag has its own bit.
+ *
+ * For every TN5250_FIELD_FCW_* flag, tn5250_field_set_flag must set and
+ * clear that bit and no other, and the matching tn5250_field_is_*
+ * accessor must read it, and only it, whatever the other flags and the
+ * FFW hold.  The table below pairs each flag with its accessor, so a
+ * macro reading the wrong bit shows up by name.
+ *
+ * Usage: fieldtest
+ */
+#include "testutil.h"
+
+#define TEST_ACCESSOR(name)                                                    \
+    static int test_is_##name(Tn5250Field* field) {                            \
+        return tn5250_field_is_##name(field);                                  \
+    }
+
+TEST_ACCESSOR(magstripe)
+TEST_ACCESSOR(lightpen)
+TEST_ACCESSOR(magandlight)
+TEST_ACCESSOR(lightandattn)
+TEST_ACCESSOR(ideographic_only)
+TEST_ACCESSOR(ideographic_data)
+TEST_ACCESSOR(ideographic_either)
+TEST_ACCESSOR(ideographic_open)
+TEST_ACCESSOR(forward_edge)
+TEST_ACCESSOR(continued)
+TEST_ACCESSOR(continued_first)
+TEST_ACCESSOR(continued_middle)
+TEST_ACCESSOR(continued_last)
+TEST_ACCESSOR(wordwrap)
+TEST_ACCESSOR(self_check_mod11)
+TEST_ACCESSOR(self_check_mod10)
+
+struct _TestFlag {
+    const char* name;
+    Tn5250Uint16 flag;
+    int (*is)(Tn5250Field* field);
+};
+
+typedef struct _TestFlag TestFlag;
+
+#define TEST_FLAG(name, flag) {#name, TN5250_FIELD_FCW_##flag, test_is_##name}
+
+static const TestFlag test_flags[] = {
+    TEST_FLAG(magstripe, MAGSTRIPE),
+    TEST_FLAG(lightpen, LIGHTPEN),
+    TEST_FLAG(magandlight, MAGANDLIGHT),
+    TEST_FLAG(lightandattn, LIGHTANDATTN),
+    TEST_FLAG(ideographic_only, IDEOGRAPHIC_ONLY),
+    TEST_FLAG(ideographic_data, IDEOGRAPHIC_DATA),
+    TEST_FLAG(ideographic_either, IDEOGRAPHIC_EITHER),
+    TEST_FLAG(ideographic_open, IDEOGRAPHIC_OPEN),
+    TEST_FLAG(forward_edge, FORWARD_EDGE),
+    TEST_FLAG(continued, CONTINUED),
+    TEST_FLAG(continued_first, CONTINUED_FIRST),
+    TEST_FLAG(continued_middle, CONTINUED_MIDDLE),
+    TEST_FLAG(continued_last, CONTINUED_LAST),
+    TEST_FLAG(wordwrap, WORDWRAP),
+    TEST_FLAG(self_check_mod11, SELF_CHECK_MOD11),
+    TEST_FLAG(self_check_mod10, SELF_CHECK_MOD10),
+};
+
+#define TEST_COUNT ((int)(sizeof(test_flags) / sizeof(test_flags[0])))
+
+static int test_only(Tn5250Field* field, int n, int on, const char* what);
+static int test_flag(int n);
+
+/*
+ *    Check that flag n reads ``on'' and every other flag reads the
+ *    opposite.
+ */
+static int test_only(Tn5250Field* field, int n, int on, const char* what) {
+    int i, ok = 1;
+
+    for (i = 0; i < TEST_COUNT; i++) {
+        if ((test_flags[i].is(field) != 0) != (i == n ? on : !on)) {
+            printf("%s %s: tn5250_field_is_%s reads %d\n", what,
+                   test_flags[n].name, test_flags[i].name,
+                   test_flags[i].is(field));
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+/*
+ *    Set and clear flag n on a field with no other flags, and on one
+ *    with all the others, with the FFW empty and full.
+ */
+static int test_flag(int n) {
+    Tn5250Field* field = tn5250_field_new(80);
+    Tn5250Uint16 all = 0;
+    int i, ffw, ok = 1;
+
+    for (i = 0; i < TEST_COUNT; i++) {
+        if ((all & test_flags[i].flag) != 0) {
+            printf("%s shares a bit with another flag\n", test_flags[i].name);
+            ok = 0;
+        }
+        all |= test_flags[i].flag;
+    }
+
+    for (ffw = 0; ffw <= 0xffff; ffw += 0xffff) {
+        field->FFW = (Tn5250Uint16)ffw;
+
+        field->flags = 0;
+        tn5250_field_set_flag(field, test_flags[n].flag, 2);
+        if (field->flags != test_flags[n].flag) {
+            printf("setting %s gives flags %04X\n", test_flags[n].name,
+                   field->flags);
+            ok = 0;
+        }
+        ok &= test_only(field, n, 1, "setting");
+
+        field->flags = all;
+        tn5250_field_set_flag(field, test_flags[n].flag, 0);
+        if (field->flags != (Tn5250Uint16)(all & ~test_flags[n].flag)) {
+            printf("clearing %s gives flags %04X\n", test_flags[n].name,
+                   field->flags);
+            ok = 0;
+        }
+        ok &= test_only(field, n, 0, "clearing");
+    }
+    tn5250_field_destroy(field);
+    return ok;
+}
+
+int main(void) {
+    int n, failed = 0;
+
+    for (n = 0; n < TEST_COUNT; n++) {
+        if (!test_flag(n)) {
+            failed++;
+        }
+    }
+    printf("%d of %d field flags failed\n", failed, TEST_COUNT);
+    return failed != 0;
+}
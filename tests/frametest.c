@@ -0,0 +1,254 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* frametest -- Check that screen updates are drawn as frames.
+ *
+ * Runs a display on the headless terminal, with its update wrapped to
+ * count the frames drawn and note when each was drawn.  A hundred
+ * scheduled updates and a burst of records from the host must each
+ * cost one frame.  With the frame rate capped at 10 a second, a host
+ * update must be held back for about 100 ms, keystroke echo must be
+ * drawn at once, and keys typed while a frame is held back must be
+ * handled and echoed without waiting for it.
+ */
+#include "tn5250-private.h"
+
+#define TEST_RECORDS 20
+
+static Tn5250Record* test_pending[TEST_RECORDS];
+static int test_npending = 0;
+static void (*test_next_update)(Tn5250Terminal* This, Tn5250Display* display);
+static unsigned long test_updates = 0;
+static unsigned long test_drawn = 0;
+
+static void test_update(Tn5250Terminal* This, Tn5250Display* display);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+static Tn5250Record* test_record(Tn5250Display* display, int row);
+
+/*
+ *    Count the frame and note when it was drawn, then draw it.
+ */
+static void test_update(Tn5250Terminal* This, Tn5250Display* display) {
+    test_updates++;
+    test_drawn = tn5250_msec_now();
+    (*test_next_update)(This, display);
+}
+
+/*
+ *    Read the byte the test wrote to the pipe and "receive" every record
+ *    the test has queued.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    char c;
+    int i;
+
+    if (read(stream->sockfd, &c, 1) != 1) {
+        return 0;
+    }
+    for (i = 0; i < test_npending; i++) {
+        stream->records =
+            tn5250_record_list_add(stream->records, test_pending[i]);
+        stream->record_count++;
+    }
+    test_npending = 0;
+    return 1;
+}
+
+/*
+ *    Nothing is sent back.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+}
+
+/*
+ *    A Write to Display which puts "Line" at the start of ``row'' and
+ *    leaves the keyboard unlocked.
+ */
+static Tn5250Record* test_record(Tn5250Display* display, int row) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    static const char text[] = "Line";
+    Tn5250Record* record = tn5250_record_new();
+    int len = sizeof(header) + 7 + strlen(text);
+    int i;
+
+    tn5250_record_append_byte(record, (unsigned char)(len >> 8));
+    tn5250_record_append_byte(record, (unsigned char)len);
+    for (i = 2; i < (int)sizeof(header); i++) {
+        tn5250_record_append_byte(record, header[i]);
+    }
+    tn5250_record_append_byte(record, ESC);
+    tn5250_record_append_byte(record, CMD_WRITE_TO_DISPLAY);
+    tn5250_record_append_byte(record, 0x00);
+    tn5250_record_append_byte(record, TN5250_SESSION_CTL_UNLOCK);
+    tn5250_record_append_byte(record, SBA);
+    tn5250_record_append_byte(record, (unsigned char)row);
+    tn5250_record_append_byte(record, 1);
+    for (i = 0; text[i] != '\0'; i++) {
+        tn5250_record_append_byte(
+            record, tn5250_char_map_to_remote(tn5250_display_char_map(display),
+                                              (unsigned char)text[i]));
+    }
+    return record;
+}
+
+int main(void) {
+    Tn5250Display* display;
+    Tn5250Terminal* term;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    Tn5250Field* field;
+    unsigned long start, frames, skipped, updates;
+    long wait, took, drawn;
+    char buf[16];
+    int fds[2];
+    int r, i;
+    int failed = 0;
+
+    if (pipe(fds) < 0) {
+        perror("pipe");
+        return 1;
+    }
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    term = tn5250_headless_terminal_new();
+    test_next_update = term->update;
+    term->update = test_update;
+    tn5250_display_set_terminal(display, term);
+    term->conn_fd = fds[0];
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    stream->sockfd = fds[0];
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+
+    field = tn5250_field_new(80);
+    field->start_row = 10;
+    field->start_col = 10;
+    field->length = 10;
+    tn5250_dbuffer_add_field(tn5250_display_dbuffer(display), field);
+    display->keystate = TN5250_KEYSTATE_UNLOCKED;
+    tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_INHIBIT |
+                                                TN5250_DISPLAY_IND_X_SYSTEM);
+    tn5250_display_set_cursor(display, 10, 10);
+    tn5250_display_update(display);
+
+    /* A hundred scheduled updates make one frame. */
+    frames = tn5250_display_frames(display);
+    skipped = tn5250_display_frames_skipped(display);
+    updates = test_updates;
+    for (i = 0; i < 100; i++) {
+        tn5250_display_schedule_update(display, 0);
+    }
+    if (tn5250_display_flush(display) != 0 ||
+        tn5250_display_frames(display) != frames + 1 ||
+        tn5250_display_frames_skipped(display) != skipped + 99 ||
+        test_updates != updates + 1) {
+        printf("scheduled: %lu frames, %lu skipped, %lu updates\n",
+               tn5250_display_frames(display) - frames,
+               tn5250_display_frames_skipped(display) - skipped,
+               test_updates - updates);
+        failed++;
+    }
+    if (tn5250_display_flush(display) != -1) {
+        printf("scheduled: a second flush found a frame pending\n");
+        failed++;
+    }
+
+    /* So does a burst of records from the host. */
+    for (i = 0; i < TEST_RECORDS; i++) {
+        test_pending[test_npending++] = test_record(display, 1 + i);
+    }
+    updates = test_updates;
+    if (write(fds[1], "", 1) != 1) {
+        perror("write");
+    }
+    if (tn5250_session_receive(session) != 0 ||
+        test_updates != updates + 1) {
+        printf("records: %lu updates for %d records\n",
+               test_updates - updates, TEST_RECORDS);
+        failed++;
+    }
+
+    /* At 10 frames a second, a host update waits for its frame. */
+    tn5250_display_set_max_frame_rate(display, 10);
+    tn5250_headless_terminal_set_timeout(term, 300);
+    tn5250_display_update(display);
+    start = tn5250_msec_now();
+    updates = test_updates;
+    tn5250_display_schedule_update(display, 0);
+    wait = tn5250_display_flush(display);
+    r = tn5250_display_waitevent(display);
+    took = tn5250_msec_since(start);
+    drawn = (long)(test_drawn - start);
+    if (wait <= 0 || wait > 100 || r != TN5250_TERMINAL_EVENT_TIMEOUT ||
+        test_updates != updates + 1 || drawn < 80 || drawn > 1000 ||
+        took < 300) {
+        printf("held: flush said %ld ms, drawn after %ld ms, wait returned "
+               "%d after %ld ms\n",
+               wait, drawn, r, took);
+        failed++;
+    }
+
+    /* Keystroke echo is drawn at once. */
+    tn5250_display_update(display);
+    updates = test_updates;
+    tn5250_display_schedule_update(display, 1);
+    if (tn5250_display_flush(display) != 0 || test_updates != updates + 1) {
+        printf("echo: the frame was held back\n");
+        failed++;
+    }
+
+    /* A key typed while a frame is held back is echoed straight away. */
+    tn5250_display_update(display);
+    start = tn5250_msec_now();
+    tn5250_display_schedule_update(display, 0);
+    updates = test_updates;
+    tn5250_headless_terminal_push_key(term, 'x');
+    r = tn5250_display_waitevent(display);
+    drawn = (long)(test_drawn - start);
+    tn5250_headless_terminal_field_text(
+        term, tn5250_headless_terminal_field(term, 0), buf, sizeof(buf));
+    if (test_updates == updates || drawn > 50 || buf[0] != 'x') {
+        printf("typing: first frame after %ld ms, field \"%s\"\n",
+               test_updates == updates ? -1L : drawn, buf);
+        failed++;
+    }
+
+    printf("%d checks failed\n", failed);
+    tn5250_display_destroy(display);
+    tn5250_session_destroy(session);
+    close(fds[1]);
+    return failed != 0;
+}
@@ -0,0 +1,242 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* headlesstest -- Check the headless terminal.
+ *
+ * Drives a session through the headless terminal, with a stream whose
+ * socket is a pipe standing in for the host.  A thousand pushed keys
+ * must all be handled by one wait and fill a field that wraps onto the
+ * next row; a wait for unlock on a locked keyboard must time out on
+ * time; keys typed while locked must be entered once a record from the
+ * host unlocks the keyboard; and quitting must end the session.
+ */
+#include "tn5250-private.h"
+
+static Tn5250Record* test_pending = NULL;
+
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+static int test_readable(int fd);
+static Tn5250Record* test_unlock(Tn5250Display* display);
+
+/*
+ *    Read the byte the test wrote to the pipe and "receive" the record
+ *    the test has queued.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    char c;
+
+    if (read(stream->sockfd, &c, 1) != 1) {
+        return 0;
+    }
+    if (test_pending != NULL) {
+        stream->records = tn5250_record_list_add(stream->records, test_pending);
+        stream->record_count++;
+        test_pending = NULL;
+    }
+    return 1;
+}
+
+/*
+ *    Nothing is sent back.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+}
+
+/*
+ *    Is there something to read on fd right now?
+ */
+static int test_readable(int fd) {
+    struct timeval tv;
+    fd_set fdr;
+
+    FD_ZERO(&fdr);
+    FD_SET(fd, &fdr);
+    tv.tv_sec = tv.tv_usec = 0;
+    return select(fd + 1, &fdr, NULL, NULL, &tv) > 0;
+}
+
+/*
+ *    A Write to Display which puts "Ready" on the first row and unlocks
+ *    the keyboard.
+ */
+static Tn5250Record* test_unlock(Tn5250Display* display) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    static const char text[] = "Ready";
+    Tn5250Record* record = tn5250_record_new();
+    int len = sizeof(header) + 7 + strlen(text);
+    int i;
+
+    tn5250_record_append_byte(record, (unsigned char)(len >> 8));
+    tn5250_record_append_byte(record, (unsigned char)len);
+    for (i = 2; i < (int)sizeof(header); i++) {
+        tn5250_record_append_byte(record, header[i]);
+    }
+    tn5250_record_append_byte(record, ESC);
+    tn5250_record_append_byte(record, CMD_WRITE_TO_DISPLAY);
+    tn5250_record_append_byte(record, 0x00);
+    tn5250_record_append_byte(record, TN5250_SESSION_CTL_UNLOCK);
+    tn5250_record_append_byte(record, SBA);
+    tn5250_record_append_byte(record, 1);
+    tn5250_record_append_byte(record, 1);
+    for (i = 0; text[i] != '\0'; i++) {
+        tn5250_record_append_byte(
+            record, tn5250_char_map_to_remote(tn5250_display_char_map(display),
+                                              (unsigned char)text[i]));
+    }
+    return record;
+}
+
+int main(void) {
+    Tn5250Display* display;
+    Tn5250Terminal* term;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    Tn5250Field* field;
+    const char* row;
+    char buf[64];
+    unsigned long start;
+    long took;
+    int fds[2];
+    int r, i, len;
+    int failed = 0;
+
+    if (pipe(fds) < 0) {
+        perror("pipe");
+        return 1;
+    }
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    term = tn5250_headless_terminal_new();
+    tn5250_display_set_terminal(display, term);
+    term->conn_fd = fds[0];
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    stream->sockfd = fds[0];
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+
+    /* One input field which wraps from row 6 onto row 7. */
+    field = tn5250_field_new(80);
+    field->start_row = 5;
+    field->start_col = 75;
+    field->length = 10;
+    tn5250_dbuffer_add_field(tn5250_display_dbuffer(display), field);
+    display->keystate = TN5250_KEYSTATE_UNLOCKED;
+    tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_INHIBIT |
+                                                TN5250_DISPLAY_IND_X_SYSTEM);
+    tn5250_display_set_cursor(display, 5, 75);
+
+    /* A thousand keys, all handled by one wait. */
+    for (i = 0; i < 1000; i++) {
+        tn5250_headless_terminal_push_key(term, 'a');
+    }
+    if (!test_readable(tn5250_headless_terminal_wakeup_fd(term))) {
+        printf("the wakeup pipe is not readable with keys queued\n");
+        failed++;
+    }
+    r = tn5250_headless_terminal_wait(term, session,
+                                      TN5250_HEADLESS_WAIT_UNLOCKED, 1000);
+    if (r != TN5250_HEADLESS_WAIT_UNLOCKED ||
+        tn5250_headless_terminal_pending_keys(term) != 0) {
+        printf("typing: wait returned %d with %d keys left\n", r,
+               tn5250_headless_terminal_pending_keys(term));
+        failed++;
+    }
+    if (test_readable(tn5250_headless_terminal_wakeup_fd(term))) {
+        printf("the wakeup pipe is still readable\n");
+        failed++;
+    }
+    field = tn5250_headless_terminal_field(term, 0);
+    len = tn5250_headless_terminal_field_text(term, field, buf, sizeof(buf));
+    if (tn5250_headless_terminal_field_count(term) != 1 || len != 10 ||
+        strcmp(buf, "aaaaaaaaaa") != 0) {
+        printf("typing: the field holds \"%s\"\n", buf);
+        failed++;
+    }
+    row = tn5250_headless_terminal_text(term, 6, &len);
+    if (len < 6 || memcmp(row, "aaaaa ", 6) != 0) {
+        printf("typing: row 7 starts \"%.*s\"\n", len < 10 ? len : 10, row);
+        failed++;
+    }
+
+    /* Locked: waiting for unlock times out. */
+    display->keystate = TN5250_KEYSTATE_LOCKED;
+    tn5250_display_indicator_set(display, TN5250_DISPLAY_IND_X_SYSTEM);
+    start = tn5250_msec_now();
+    r = tn5250_headless_terminal_wait(term, session,
+                                      TN5250_HEADLESS_WAIT_UNLOCKED, 200);
+    took = tn5250_msec_since(start);
+    if (r != 0 || took < 200 || took > 2000) {
+        printf("locked: wait returned %d after %ld ms\n", r, took);
+        failed++;
+    }
+
+    /* Keys typed while locked go in once the host unlocks. */
+    tn5250_headless_terminal_type_string(term, "bc");
+    test_pending = test_unlock(display);
+    if (write(fds[1], "", 1) != 1) {
+        perror("write");
+    }
+    r = tn5250_headless_terminal_wait(term, session,
+                                      TN5250_HEADLESS_WAIT_UNLOCKED, 5000);
+    len = tn5250_headless_terminal_field_text(
+        term, tn5250_headless_terminal_field(term, 0), buf, sizeof(buf));
+    if (r != TN5250_HEADLESS_WAIT_UNLOCKED ||
+        tn5250_headless_terminal_pending_keys(term) != 0 ||
+        strncmp(buf, "bc", 2) != 0) {
+        printf("unlock: wait returned %d, field \"%s\"\n", r, buf);
+        failed++;
+    }
+    row = tn5250_headless_terminal_text(term, 0, &len);
+    if (len < 5 || memcmp(row, "Ready", 5) != 0) {
+        printf("unlock: row 1 starts \"%.*s\"\n", len < 10 ? len : 10, row);
+        failed++;
+    }
+
+    /* Quitting ends the session. */
+    tn5250_headless_terminal_quit(term);
+    r = tn5250_headless_terminal_wait(term, session,
+                                      TN5250_HEADLESS_WAIT_SCREEN, 1000);
+    if (r != -1) {
+        printf("quit: wait returned %d\n", r);
+        failed++;
+    }
+
+    printf("%d checks failed\n", failed);
+    tn5250_display_destroy(display);
+    tn5250_session_destroy(session);
+    close(fds[1]);
+    return failed != 0;
+}
@@ -0,0 +1,173 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* macrobench -- Time finding a macro and playing it.
+ *
+ * Writes a macro file of 24 function key macros of 500 keys each and
+ * times EXEC F1 on a headless display: looking the macro up while the
+ * file is unchanged, looking it up after the file has been touched (so
+ * that it is read again), and playing the 500 keys into four fields
+ * with tn5250_display_do_keys.
+ *
+ * Usage: macrobench [count]
+ */
+#include "tn5250-private.h"
+
+#include <time.h>
+#include <utime.h>
+
+static double bench_ms(clock_t start);
+static int bench_write(const char* filename);
+static void bench_exec(Tn5250Display* display);
+
+/*
+ *    CPU time since start, in milliseconds.
+ */
+static double bench_ms(clock_t start) {
+    return (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*
+ *    Write 24 macros which type into the fields and move between them.
+ */
+static int bench_write(const char* filename) {
+    FILE* f;
+    int n, i;
+
+    if ((f = fopen(filename, "w")) == NULL) {
+        return 0;
+    }
+    for (n = 1; n <= 24; n++) {
+        fprintf(f, "[M%02d]macro%d\n", n, n);
+        for (i = 0; i < 50; i++) {
+            fprintf(f, "abcdefghi[FIELDEXIT]");
+            if (i % 4 == 3) {
+                fputc('\n', f);
+            }
+        }
+        fprintf(f, "\n\n");
+    }
+    return fclose(f) == 0;
+}
+
+/*
+ *    EXEC F1, as far as finding the macro, and stop it again.
+ */
+static void bench_exec(Tn5250Display* display) {
+    tn5250_macro_startexec(display);
+    tn5250_macro_execfunct(display, K_F1);
+    tn5250_macro_endexec(display);
+}
+
+int main(int argc, char* argv[]) {
+    static const int fields[4][3] = {
+        {2, 10, 20}, {5, 10, 15}, {8, 30, 30}, {12, 5, 10}};
+    Tn5250Config* config;
+    Tn5250Display* display;
+    Tn5250Macro* macro;
+    Tn5250Field* field;
+    struct utimbuf times;
+    char filename[] = "/tmp/macrobenchXXXXXX";
+    clock_t start;
+    double same_ms, touched_ms, play_ms;
+    int count, fd, i;
+
+    count = argc > 1 ? atoi(argv[1]) : 10000;
+    if (count <= 0) {
+        fprintf(stderr, "usage: macrobench [count]\n");
+        return 2;
+    }
+
+    if ((fd = mkstemp(filename)) < 0) {
+        perror(filename);
+        return 1;
+    }
+    close(fd);
+    if (!bench_write(filename)) {
+        perror(filename);
+        unlink(filename);
+        return 1;
+    }
+
+    config = tn5250_config_new();
+    tn5250_config_set(config, "macros", filename);
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    tn5250_display_config(display, config);
+    tn5250_display_set_terminal(display, tn5250_headless_terminal_new());
+    macro = tn5250_macro_init();
+    tn5250_macro_attach(display, macro);
+    for (i = 0; i < 4; i++) {
+        field = tn5250_field_new(80);
+        field->start_row = fields[i][0];
+        field->start_col = fields[i][1];
+        field->length = fields[i][2];
+        field->FFW = 0x4000 | TN5250_FIELD_ALPHA_SHIFT;
+        field->attribute = 0x20;
+        tn5250_dbuffer_add_field(tn5250_display_dbuffer(display), field);
+    }
+    display->keystate = TN5250_KEYSTATE_UNLOCKED;
+    tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_INHIBIT |
+                                                TN5250_DISPLAY_IND_X_SYSTEM);
+    tn5250_display_set_cursor_home(display);
+    bench_exec(display);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+        bench_exec(display);
+    }
+    same_ms = bench_ms(start);
+
+    /* Alternate the stamp, so that every lookup sees a changed file. */
+    start = clock();
+    for (i = 0; i < count / 10; i++) {
+        times.actime = times.modtime = time(NULL) + 10 + i % 2;
+        utime(filename, &times);
+        bench_exec(display);
+    }
+    touched_ms = bench_ms(start);
+
+    start = clock();
+    for (i = 0; i < count / 10; i++) {
+        tn5250_headless_terminal_push_key(display->terminal, K_EXEC);
+        tn5250_headless_terminal_push_key(display->terminal, K_F1);
+        tn5250_display_do_keys(display);
+        tn5250_display_flush(display);
+    }
+    play_ms = bench_ms(start);
+
+    tn5250_display_destroy(display);
+    tn5250_macro_exit(macro);
+    tn5250_config_unref(config);
+    unlink(filename);
+
+    fprintf(stderr, "%d lookups, file unchanged: %.1f ms CPU, %.2f us each\n",
+            count, same_ms, same_ms * 1000.0 / count);
+    if (count >= 10) {
+        fprintf(stderr,
+                "%d lookups, file touched: %.1f ms CPU, %.2f us each\n",
+                count / 10, touched_ms, touched_ms * 1000.0 / (count / 10));
+        fprintf(stderr, "%d plays of 500 keys: %.1f ms CPU, %.2f us each\n",
+                count / 10, play_ms, play_ms * 1000.0 / (count / 10));
+    }
+    return 0;
+}
@@ -0,0 +1,468 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* macrotest -- Check that macros play like typed keys and are kept.
+ *
+ * Each pass writes a macro file holding a random macro of TEST_KEYS
+ * keys, which types into four fields and moves between them with
+ * FIELDEXIT, TAB and BACKSPACE.  One headless display plays it with
+ * EXEC F1 and another has the same keys typed one at a time; the two
+ * must end with the same screen, cursor, keyboard state and indicators,
+ * and playing the macro must draw a single frame.
+ *
+ * Then F1 must not read the file again while it is unchanged, and must
+ * pick up a new macro once it has changed, even when the new file has
+ * the same size and modification second.  Last, TEST_RECORD keys are
+ * recorded as F2 with MEMO, which saves the file, and a new macro object
+ * loading the file must find every macro as it was.
+ *
+ * Usage: macrotest [passes [seed]]
+ */
+#include "testutil.h"
+
+#include <sys/stat.h>
+#include <utime.h>
+
+#define TEST_W      80
+#define TEST_H      24
+#define TEST_SIZE   (TEST_W * TEST_H)
+#define TEST_KEYS   500
+#define TEST_RECORD 3000
+
+static unsigned long test_updates = 0;
+static void (*test_next_update)(Tn5250Terminal* This, Tn5250Display* display);
+
+static int test_key(void);
+static int test_write(const char* filename, const int* keys, int count);
+static void test_update(Tn5250Terminal* This, Tn5250Display* display);
+static Tn5250Display* test_display(Tn5250Config* config, Tn5250Macro* macro);
+static void test_destroy(Tn5250Display* display, Tn5250Macro* macro);
+static int test_same(Tn5250Display* a, Tn5250Display* b, int verbose);
+static int test_play(Tn5250Config* config, int verbose);
+static int test_reload(Tn5250Config* config, const char* filename);
+static int test_restamp(Tn5250Display* display, Tn5250Macro* macro,
+                        const char* filename, int* keys, int by_rename);
+static int test_record(Tn5250Config* config);
+
+/*
+ *    A random macro key: mostly characters, and now and then a key which
+ *    moves between the fields.
+ */
+static int test_key(void) {
+    static const char chars[] = " aBz09-+,.";
+    static const int specials[] = {K_FIELDEXIT, K_TAB, K_BACKSPACE};
+
+    if (test_rand(8) != 0) {
+        return chars[test_rand(sizeof(chars) - 1)];
+    }
+    return specials[test_rand(sizeof(specials) / sizeof(specials[0]))];
+}
+
+/*
+ *    Write a macro file with the keys as F1, split over lines as a user
+ *    might write it, and a named and a numbered macro after it.
+ */
+static int test_write(const char* filename, const int* keys, int count) {
+    FILE* f;
+    int i;
+
+    if ((f = fopen(filename, "w")) == NULL) {
+        return 0;
+    }
+    fprintf(f, "[M01]fill\n");
+    for (i = 0; i < count; i++) {
+        if (keys[i] == K_FIELDEXIT) {
+            fprintf(f, "[FIELDEXIT]");
+        }
+        else if (keys[i] == K_TAB) {
+            fprintf(f, "[TAB]");
+        }
+        else if (keys[i] == K_BACKSPACE) {
+            fprintf(f, "[BACKSPACE]");
+        }
+        else {
+            fputc(keys[i], f);
+        }
+        if (i % 60 == 59) {
+            fputc('\n', f);
+        }
+    }
+    fprintf(f, "\n\n[M]signon\nQSECOFR[TAB]secret[ENTER]\n\n");
+    fprintf(f, "[M30]thirty\nwrkactjob[ENTER]\n");
+    return fclose(f) == 0;
+}
+
+/*
+ *    Count the updates which reach the terminal.
+ */
+static void test_update(Tn5250Terminal* This, Tn5250Display* display) {
+    test_updates++;
+    (*test_next_update)(This, display);
+}
+
+/*
+ *    A display on the headless terminal with four alphanumeric fields,
+ *    the keyboard unlocked and the cursor in the first field.  If macro
+ *    isn't NULL, it is attached to the display.
+ */
+static Tn5250Display* test_display(Tn5250Config* config, Tn5250Macro* macro) {
+    static const int fields[4][3] = {
+        {2, 10, 20}, {5, 10, 15}, {8, 30, 30}, {12, 5, 10}};
+    Tn5250Display* display;
+    Tn5250Terminal* term;
+    Tn5250Field* field;
+    int i;
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    tn5250_display_config(display, config);
+    term = tn5250_headless_terminal_new();
+    test_next_update = term->update;
+    term->update = test_update;
+    tn5250_display_set_terminal(display, term);
+    if (macro != NULL) {
+        tn5250_macro_attach(display, macro);
+    }
+
+    for (i = 0; i < 4; i++) {
+        field = tn5250_field_new(TEST_W);
+        field->start_row = fields[i][0];
+        field->start_col = fields[i][1];
+        field->length = fields[i][2];
+        field->FFW = 0x4000 | TN5250_FIELD_ALPHA_SHIFT;
+        field->attribute = 0x20;
+        tn5250_dbuffer_add_field(tn5250_display_dbuffer(display), field);
+    }
+    display->keystate = TN5250_KEYSTATE_UNLOCKED;
+    tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_INHIBIT |
+                                                TN5250_DISPLAY_IND_X_SYSTEM);
+    tn5250_display_set_cursor_home(display);
+    tn5250_display_update(display);
+    return display;
+}
+
+/*
+ *    Get rid of a display and the macro object attached to it.
+ */
+static void test_destroy(Tn5250Display* display, Tn5250Macro* macro) {
+    tn5250_display_destroy(display);
+    if (macro != NULL) {
+        tn5250_macro_exit(macro);
+    }
+}
+
+/*
+ *    Are the two displays in the same state?
+ */
+static int test_same(Tn5250Display* a, Tn5250Display* b, int verbose) {
+    if (memcmp(tn5250_display_dbuffer(a)->data,
+               tn5250_display_dbuffer(b)->data, TEST_SIZE) != 0) {
+        if (verbose) {
+            printf("the screens differ\n");
+        }
+        return 0;
+    }
+    if (tn5250_display_cursor_x(a) != tn5250_display_cursor_x(b) ||
+        tn5250_display_cursor_y(a) != tn5250_display_cursor_y(b)) {
+        if (verbose) {
+            printf("cursor %d,%d against %d,%d\n", tn5250_display_cursor_y(a),
+                   tn5250_display_cursor_x(a), tn5250_display_cursor_y(b),
+                   tn5250_display_cursor_x(b));
+        }
+        return 0;
+    }
+    if (a->keystate != b->keystate || a->indicators != b->indicators) {
+        if (verbose) {
+            printf("keystate %d/%d, indicators %04X/%04X\n", a->keystate,
+                   b->keystate, a->indicators, b->indicators);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Play a new random macro with EXEC F1 and type the same keys singly
+ *    into a second display.
+ */
+static int test_play(Tn5250Config* config, int verbose) {
+    Tn5250Display *a, *b;
+    Tn5250Macro* macro;
+    int keys[TEST_KEYS];
+    unsigned long updates;
+    int i, ok;
+
+    for (i = 0; i < TEST_KEYS; i++) {
+        keys[i] = test_key();
+    }
+    if (!test_write(tn5250_config_get(config, "macros"), keys, TEST_KEYS)) {
+        perror(tn5250_config_get(config, "macros"));
+        return 0;
+    }
+
+    macro = tn5250_macro_init();
+    a = test_display(config, macro);
+    b = test_display(config, NULL);
+
+    tn5250_headless_terminal_push_key(a->terminal, K_EXEC);
+    tn5250_headless_terminal_push_key(a->terminal, K_F1);
+    updates = test_updates;
+    tn5250_display_do_keys(a);
+    tn5250_display_flush(a);
+    updates = test_updates - updates;
+
+    for (i = 0; i < TEST_KEYS; i++) {
+        tn5250_display_do_key(b, keys[i]);
+    }
+
+    ok = test_same(a, b, verbose);
+    if (ok && updates != 1) {
+        if (verbose) {
+            printf("the macro took %lu updates\n", updates);
+        }
+        ok = 0;
+    }
+    test_destroy(a, macro);
+    test_destroy(b, NULL);
+    return ok;
+}
+
+/*
+ *    F1 must keep the macros it has while the file is unchanged, and
+ *    load them again once it has changed.
+ */
+static int test_reload(Tn5250Config* config, const char* filename) {
+    Tn5250Display* display;
+    Tn5250Macro* macro;
+    Tn5250MacroData* list;
+    struct utimbuf times;
+    int keys[TEST_KEYS];
+    int i, ok = 1;
+
+    for (i = 0; i < TEST_KEYS; i++) {
+        keys[i] = test_key();
+    }
+    keys[0] = 'a';
+    macro = tn5250_macro_init();
+    display = test_display(config, macro);
+
+    tn5250_headless_terminal_push_key(display->terminal, K_EXEC);
+    tn5250_headless_terminal_push_key(display->terminal, K_F1);
+    tn5250_display_do_keys(display);
+    list = macro->list;
+
+    tn5250_headless_terminal_push_key(display->terminal, K_EXEC);
+    tn5250_headless_terminal_push_key(display->terminal, K_F1);
+    tn5250_display_do_keys(display);
+    if (macro->list != list) {
+        printf("an unchanged macro file was loaded again\n");
+        ok = 0;
+    }
+
+    /* A shorter macro, stamped later in case the clock hasn't moved on. */
+    test_write(filename, keys, TEST_KEYS / 2);
+    times.actime = times.modtime = time(NULL) + 10;
+    utime(filename, &times);
+    tn5250_headless_terminal_push_key(display->terminal, K_EXEC);
+    tn5250_headless_terminal_push_key(display->terminal, K_F1);
+    tn5250_display_do_keys(display);
+    if (tn5250_macro_find_number(macro, 1) == NULL ||
+        tn5250_macro_find_number(macro, 1)->count != TEST_KEYS / 2) {
+        printf("a changed macro file was not loaded again\n");
+        ok = 0;
+    }
+    if (!test_restamp(display, macro, filename, keys, 0) ||
+        !test_restamp(display, macro, filename, keys, 1)) {
+        ok = 0;
+    }
+
+    test_destroy(display, macro);
+    return ok;
+}
+
+/*
+ *    Write the macro file again with its first key changed, keeping the
+ *    size and the modification second, and check that F1 plays the new
+ *    macro.  The file is rewritten in place with another nanosecond
+ *    count, or written anew and renamed over the old one.
+ */
+static int test_restamp(Tn5250Display* display, Tn5250Macro* macro,
+                        const char* filename, int* keys, int by_rename) {
+    Tn5250MacroData* mac;
+    struct utimbuf times;
+    struct stat st;
+    char newname[64];
+
+    if (stat(filename, &st) != 0) {
+        return 0;
+    }
+    keys[0] = keys[0] == 'a' ? 'z' : 'a';
+    if (by_rename) {
+        sprintf(newname, "%.50s.new", filename);
+        test_write(newname, keys, TEST_KEYS / 2);
+        times.actime = times.modtime = st.st_mtime;
+        utime(newname, &times);
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+        {
+            struct timespec ts[2];
+            ts[0] = ts[1] = st.st_mtim;
+            utimensat(AT_FDCWD, newname, ts, 0);
+        }
+#endif
+        rename(newname, filename);
+    }
+    else {
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+        struct timespec ts[2];
+
+        test_write(filename, keys, TEST_KEYS / 2);
+        ts[0] = ts[1] = st.st_mtim;
+        ts[0].tv_nsec = ts[1].tv_nsec = st.st_mtim.tv_nsec ^ 1;
+        utimensat(AT_FDCWD, filename, ts, 0);
+#else
+        keys[0] = keys[0] == 'a' ? 'z' : 'a';
+        return 1; /* Only seconds to go by. */
+#endif
+    }
+
+    tn5250_headless_terminal_push_key(display->terminal, K_EXEC);
+    tn5250_headless_terminal_push_key(display->terminal, K_F1);
+    tn5250_display_do_keys(display);
+    mac = tn5250_macro_find_number(macro, 1);
+    if (mac == NULL || mac->count != TEST_KEYS / 2 || mac->keys[0] != keys[0]) {
+        printf("a macro file %s in the same second was not loaded again\n",
+               by_rename ? "replaced" : "rewritten");
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Record a long macro as F2, then check that the file it was saved to
+ *    gives back every macro.
+ */
+static int test_record(Tn5250Config* config) {
+    Tn5250Display *display, *other;
+    Tn5250Macro *macro, *loaded;
+    Tn5250MacroData *mac, *got;
+    int keys[TEST_RECORD];
+    int i, n = 0, ok = 1;
+
+    for (i = 0; i < TEST_RECORD; i++) {
+        keys[i] = test_key();
+    }
+    macro = tn5250_macro_init();
+    display = test_display(config, macro);
+    tn5250_headless_terminal_push_key(display->terminal, K_MEMO);
+    tn5250_headless_terminal_push_key(display->terminal, K_F2);
+    for (i = 0; i < TEST_RECORD; i++) {
+        tn5250_headless_terminal_push_key(display->terminal, keys[i]);
+    }
+    tn5250_headless_terminal_push_key(display->terminal, K_MEMO);
+    tn5250_display_do_keys(display);
+
+    mac = tn5250_macro_find_number(macro, 2);
+    if (tn5250_macro_rstate(display) != 0 || mac == NULL ||
+        mac->count != TEST_RECORD ||
+        memcmp(mac->keys, keys, sizeof(keys)) != 0) {
+        printf("F2 was not recorded\n");
+        test_destroy(display, macro);
+        return 0;
+    }
+
+    /* Looking a macro up by name loads the file. */
+    loaded = tn5250_macro_init();
+    other = test_display(config, loaded);
+    tn5250_macro_find(loaded, "signon");
+    for (mac = macro->list; mac != NULL; mac = mac->next, n++) {
+        if (mac->number > 0) {
+            got = tn5250_macro_find_number(loaded, mac->number);
+        }
+        else {
+            got = tn5250_macro_find(loaded, (const char*)mac->name);
+        }
+        if (got == NULL || got->count != mac->count ||
+            memcmp(got->keys, mac->keys, mac->count * sizeof(int)) != 0 ||
+            (mac->name == NULL) != (got->name == NULL) ||
+            (mac->name != NULL &&
+             strcmp((const char*)mac->name, (const char*)got->name) != 0)) {
+            printf("macro %d (%s) was not kept\n", mac->number,
+                   mac->name != NULL ? (const char*)mac->name : "");
+            ok = 0;
+        }
+    }
+    for (mac = loaded->list; mac != NULL; mac = mac->next) {
+        n--;
+    }
+    if (n != 0) {
+        printf("the saved file has a different number of macros\n");
+        ok = 0;
+    }
+
+    test_destroy(display, macro);
+    test_destroy(other, loaded);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Config* config;
+    char filename[] = "/tmp/macrotestXXXXXX";
+    int passes, pass, fd;
+    int failed = 0;
+
+    passes = argc > 1 ? atoi(argv[1]) : 200;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (passes <= 0) {
+        fprintf(stderr, "usage: macrotest [passes [seed]]\n");
+        return 2;
+    }
+
+    if ((fd = mkstemp(filename)) < 0) {
+        perror(filename);
+        return 1;
+    }
+    close(fd);
+    config = tn5250_config_new();
+    tn5250_config_set(config, "macros", filename);
+
+    for (pass = 0; pass < passes; pass++) {
+        if (!test_play(config, failed < 3)) {
+            if (++failed <= 3) {
+                printf("  (pass %d)\n", pass);
+            }
+        }
+    }
+    printf("%d of %d macros played differently\n", failed, passes);
+
+    if (!test_reload(config, filename)) {
+        failed++;
+    }
+    if (!test_play(config, 1) || !test_record(config)) {
+        failed++;
+    }
+
+    unlink(filename);
+    tn5250_config_unref(config);
+    return failed != 0;
+}
@@ -0,0 +1,281 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* pushtest -- Check that pushed display buffers keep what they saved.
+ *
+ * A pushed display buffer shares its character data and field map with
+ * the buffer it was pushed from until one of them is written to.  Each
+ * round pushes up to 16 buffers deep, with random edits to the current
+ * buffer between pushes, and then restores them one by one, editing
+ * again after each restore.  Every restored buffer must hold exactly the
+ * screen, field map and format table it had when it was pushed.
+ *
+ * Usage: pushtest [rounds [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_DEPTH 16
+
+/* What a buffer held when it was pushed. */
+typedef struct {
+    Tn5250DBuffer* id;
+    int w, h;
+    unsigned char* data;
+    int* field_map;
+    Tn5250Field* fields;
+    int field_count;
+} TestSaved;
+
+static void test_fields(Tn5250DBuffer* dbuffer);
+static void test_edit(Tn5250DBuffer* dbuffer);
+static void test_save(TestSaved* saved, Tn5250DBuffer* dbuffer);
+static void test_free(TestSaved* saved);
+static int test_same(Tn5250DBuffer* dbuffer, TestSaved* saved, int verbose);
+
+/*
+ *    Replace the format table with up to 12 random fields which don't
+ *    overlap.
+ */
+static void test_fields(Tn5250DBuffer* dbuffer) {
+    int n;
+
+    tn5250_dbuffer_clear_table(dbuffer);
+    n = test_rand(13);
+    while (n-- > 0) {
+        test_random_field(dbuffer, 30, 0x4000 | test_rand(0x2000), 0x20);
+    }
+}
+
+/*
+ *    Make one random change through one of the ways display buffers are
+ *    written to.
+ */
+static void test_edit(Tn5250DBuffer* dbuffer) {
+    int w = tn5250_dbuffer_width(dbuffer);
+    int h = tn5250_dbuffer_height(dbuffer);
+    int k = test_rand(100);
+    int y = test_rand(h);
+    Tn5250Field* field = NULL;
+    int top, bot;
+
+    if (tn5250_dbuffer_field_count(dbuffer) > 0) {
+        field = dbuffer->field_table[test_rand(
+            tn5250_dbuffer_field_count(dbuffer))];
+    }
+
+    if (k < 40) {
+        tn5250_dbuffer_cursor_set(dbuffer, y, test_rand(w));
+        tn5250_dbuffer_addch(dbuffer, (unsigned char)(0x40 + test_rand(0xbf)));
+    }
+    else if (k < 50) {
+        tn5250_dbuffer_writable_data(dbuffer, y, y)[y * w + test_rand(w)] =
+            (unsigned char)test_rand(0x100);
+    }
+    else if (k < 58) {
+        top = test_rand(h);
+        bot = top + test_rand(h - top);
+        tn5250_dbuffer_roll(dbuffer, top, bot, test_rand(5) - 2);
+    }
+    else if (k < 70 && field != NULL) {
+        tn5250_dbuffer_field_data(dbuffer, field)[test_rand(field->length)] =
+            (unsigned char)(0x40 + test_rand(0xbf));
+    }
+    else if (k < 80 && field != NULL) {
+        tn5250_dbuffer_cursor_set(dbuffer, field->start_row, field->start_col);
+        if (test_rand(2) == 0) {
+            tn5250_dbuffer_ins(dbuffer, field->id, 0xc1,
+                               tn5250_field_count_right(field,
+                                                        field->start_row,
+                                                        field->start_col));
+        }
+        else {
+            tn5250_dbuffer_del(dbuffer, field->id,
+                               tn5250_field_count_right(field,
+                                                        field->start_row,
+                                                        field->start_col));
+        }
+    }
+    else if (k < 88 && field != NULL) {
+        tn5250_field_set_mdt(field);
+    }
+    else if (k < 94) {
+        test_fields(dbuffer);
+    }
+    else if (k < 97) {
+        tn5250_dbuffer_clear(dbuffer);
+    }
+    else if (k < 98) {
+        tn5250_dbuffer_clear_table(dbuffer);
+    }
+    else if (w == 80) {
+        tn5250_dbuffer_set_size(dbuffer, 27, 132);
+    }
+    else {
+        tn5250_dbuffer_set_size(dbuffer, 24, 80);
+    }
+}
+
+/*
+ *    Keep a private copy of what ``dbuffer'' holds.
+ */
+static void test_save(TestSaved* saved, Tn5250DBuffer* dbuffer) {
+    int size = dbuffer->w * dbuffer->h;
+    int i;
+
+    saved->id = dbuffer;
+    saved->w = dbuffer->w;
+    saved->h = dbuffer->h;
+    saved->data = (unsigned char*)malloc(size);
+    saved->field_map = tn5250_new(int, size);
+    saved->field_count = tn5250_dbuffer_field_count(dbuffer);
+    saved->fields = tn5250_new(Tn5250Field, saved->field_count + 1);
+    TN5250_ASSERT(saved->data != NULL && saved->field_map != NULL &&
+                  saved->fields != NULL);
+    memcpy(saved->data, dbuffer->data, size);
+    memcpy(saved->field_map, dbuffer->field_map, size * sizeof(int));
+    for (i = 0; i < saved->field_count; i++) {
+        memcpy(&saved->fields[i], dbuffer->field_table[i], sizeof(Tn5250Field));
+    }
+}
+
+/*
+ *    Free what test_save allocated.
+ */
+static void test_free(TestSaved* saved) {
+    free(saved->data);
+    free(saved->field_map);
+    free(saved->fields);
+}
+
+/*
+ *    Does ``dbuffer'' hold what was saved?
+ */
+static int test_same(Tn5250DBuffer* dbuffer, TestSaved* saved, int verbose) {
+    Tn5250Field *f, *g;
+    int i;
+
+    if (dbuffer->w != saved->w || dbuffer->h != saved->h) {
+        if (verbose) {
+            printf("size %dx%d, wanted %dx%d\n", dbuffer->h, dbuffer->w,
+                   saved->h, saved->w);
+        }
+        return 0;
+    }
+    for (i = 0; i < saved->w * saved->h; i++) {
+        if (dbuffer->data[i] != saved->data[i]) {
+            if (verbose) {
+                printf("cell %d,%d: got %02X, wanted %02X\n", i / saved->w,
+                       i % saved->w, dbuffer->data[i], saved->data[i]);
+            }
+            return 0;
+        }
+        if (dbuffer->field_map[i] != saved->field_map[i]) {
+            if (verbose) {
+                printf("field map at %d,%d: got %d, wanted %d\n",
+                       i / saved->w, i % saved->w, dbuffer->field_map[i],
+                       saved->field_map[i]);
+            }
+            return 0;
+        }
+    }
+    if (tn5250_dbuffer_field_count(dbuffer) != saved->field_count) {
+        if (verbose) {
+            printf("got %d fields, wanted %d\n",
+                   tn5250_dbuffer_field_count(dbuffer), saved->field_count);
+        }
+        return 0;
+    }
+    for (i = 0; i < saved->field_count; i++) {
+        f = dbuffer->field_table[i];
+        g = &saved->fields[i];
+        if (f->start_row != g->start_row || f->start_col != g->start_col ||
+            f->length != g->length || f->FFW != g->FFW) {
+            if (verbose) {
+                printf("field %d differs\n", i);
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Display* display;
+    Tn5250DBuffer* dbuffer;
+    TestSaved saved[TEST_DEPTH];
+    int rounds, round, depth, level, n, i;
+    int failed = 0;
+    long restores = 0;
+
+    rounds = argc > 1 ? atoi(argv[1]) : 2000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (rounds <= 0) {
+        fprintf(stderr, "usage: pushtest [rounds [seed]]\n");
+        return 2;
+    }
+
+    display = tn5250_display_new();
+    dbuffer = tn5250_display_dbuffer(display);
+    for (i = 0; i < 24 * 80; i++) {
+        dbuffer->data[i] = (unsigned char)(0x40 + test_rand(0xbf));
+    }
+    test_fields(dbuffer);
+
+    for (round = 0; round < rounds; round++) {
+        depth = 1 + test_rand(TEST_DEPTH);
+        for (level = 0; level < depth; level++) {
+            dbuffer = tn5250_display_dbuffer(display);
+            for (n = test_rand(4); n > 0; n--) {
+                test_edit(dbuffer);
+            }
+            test_save(&saved[level], tn5250_display_push_dbuffer(display));
+        }
+
+        for (level = depth - 1; level >= 0; level--) {
+            for (n = test_rand(4); n > 0; n--) {
+                test_edit(tn5250_display_dbuffer(display));
+            }
+            tn5250_display_restore_dbuffer(display, saved[level].id);
+            if (tn5250_display_dbuffer(display) != saved[level].id) {
+                if (++failed <= 3) {
+                    printf("level %d wasn't restored\n", level);
+                    printf("  (round %d)\n", round);
+                }
+            }
+            else if (!test_same(saved[level].id, &saved[level],
+                                failed < 3)) {
+                if (++failed <= 3) {
+                    printf("  (round %d, level %d of %d)\n", round, level,
+                           depth);
+                }
+            }
+            test_free(&saved[level]);
+            restores++;
+        }
+    }
+
+    printf("%d of %ld restores failed\n", failed, restores);
+    tn5250_display_destroy(display);
+    return failed != 0;
+}
@@ -0,0 +1,125 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* recordbench -- Time screen updates with and without a recorder.
+ *
+ * Changes one to three cells of a 24x80 display and runs
+ * tn5250_display_update after each change, first with no recorder and
+ * then recording to a file, with a full repaint every 500 updates.
+ * Prints the cost per update and the size of the recording against the
+ * size of the raw screens.
+ *
+ * Usage: recordbench [updates]
+ */
+#include "tn5250-private.h"
+
+#include <sys/stat.h>
+#include <time.h>
+
+static double bench_us(clock_t start, int n);
+static void bench_edit(Tn5250Display* display, int i);
+
+/*
+ *    CPU time since start, in microseconds for each of n runs.
+ */
+static double bench_us(clock_t start, int n) {
+    return (clock() - start) * 1e6 / CLOCKS_PER_SEC / n;
+}
+
+/*
+ *    Make the changes for update i.
+ */
+static void bench_edit(Tn5250Display* display, int i) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    unsigned char* data;
+    int pos, n;
+
+    if (i % 500 == 0) {
+        data = tn5250_dbuffer_writable_data(dbuffer, 0, dbuffer->h - 1);
+        for (pos = 0; pos < dbuffer->w * dbuffer->h; pos++) {
+            data[pos] = (unsigned char)(0xc1 + (pos + i) % 9);
+        }
+    }
+    for (n = 0; n < 1 + i % 3; n++) {
+        pos = (i * 7919 + n * 104729) % (dbuffer->w * dbuffer->h);
+        data = tn5250_dbuffer_writable_data(dbuffer, pos / dbuffer->w,
+                                            pos / dbuffer->w);
+        data[pos] = (unsigned char)(0xc1 + (i + n) % 9);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    char filename[] = "/tmp/recordbenchXXXXXX";
+    Tn5250Display* display;
+    Tn5250Recorder* recorder;
+    struct stat st;
+    clock_t start;
+    double plain_us, recorded_us;
+    unsigned long dropped;
+    int updates, fd, i;
+
+    updates = argc > 1 ? atoi(argv[1]) : 20000;
+    if (updates <= 0) {
+        fprintf(stderr, "usage: recordbench [updates]\n");
+        return 2;
+    }
+    if ((fd = mkstemp(filename)) < 0) {
+        perror(filename);
+        return 1;
+    }
+    close(fd);
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    start = clock();
+    for (i = 0; i < updates; i++) {
+        bench_edit(display, i);
+        tn5250_display_update(display);
+    }
+    plain_us = bench_us(start, updates);
+
+    if ((recorder = tn5250_recorder_new(filename, "37")) == NULL) {
+        perror(filename);
+        unlink(filename);
+        return 1;
+    }
+    display->recorder = recorder;
+    start = clock();
+    for (i = 0; i < updates; i++) {
+        bench_edit(display, i);
+        tn5250_display_update(display);
+    }
+    recorded_us = bench_us(start, updates);
+    dropped = tn5250_recorder_dropped(recorder);
+    tn5250_display_destroy(display);
+
+    if (stat(filename, &st) < 0) {
+        st.st_size = 0;
+    }
+    unlink(filename);
+    fprintf(stderr, "update:             %.2f us\n", plain_us);
+    fprintf(stderr, "update and record:  %.2f us (%lu frames dropped)\n",
+            recorded_us, dropped);
+    fprintf(stderr, "recording:          %ld KB, raw screens %ld KB\n",
+            (long)st.st_size / 1024, (long)updates * 24 * 80 / 1024);
+    return 0;
+}
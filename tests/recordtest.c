@@ -0,0 +1,401 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* recordtest -- Record a session and play it back.
+ *
+ * Records a display through a run of updates, each changing a few cells
+ * and the frame number in the top left corner, with a full repaint now
+ * and then.  Two areas of the screen are nondisplay fields, one of them
+ * running on from one row to the next.  Played back frame by frame, and
+ * after random seeks, every frame must show exactly the screen, cursor
+ * and indicators it was recorded with, with the nondisplay fields
+ * blanked.  Then the same is recorded into a FIFO which nobody reads
+ * for a while: recording must not wait for the reader, and once the
+ * reader catches up, every frame after a gap must be a keyframe marked
+ * as following one.
+ *
+ * Usage: recordtest [updates [seed]]
+ */
+#include "testutil.h"
+
+#include <sys/stat.h>
+
+#if !defined(WIN32) && defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#define TEST_THREADS 1
+#endif
+
+#define TEST_W    80
+#define TEST_H    24
+#define TEST_SIZE (TEST_W * TEST_H)
+#define TEST_SEEKS 2000
+#define TEST_STALL 1000 /* How long the FIFO reader doesn't read, ms */
+
+static unsigned char* test_screens;
+static int* test_cursor;
+static unsigned long* test_indicators;
+
+static int test_attribute(int pos);
+static int test_hidden(int pos);
+static void test_edit(Tn5250Display* display, int serial);
+static void test_save(Tn5250Display* display, int serial);
+static int test_serial(Tn5250DBuffer* dbuffer);
+static int test_frame(Tn5250Player* player, int* serial, int verbose);
+static int test_record(const char* filename, int updates, int pause,
+                       unsigned long* dropped, long* took);
+static int test_play(const char* filename, int updates,
+                     unsigned long dropped, int seeks);
+
+/*
+ *    The attribute at ``pos'', or 0 if it isn't one.  Row 21 starts a
+ *    nondisplay field, and another starts near the end of row 22 and
+ *    ends at the start of row 23.
+ */
+static int test_attribute(int pos) {
+    switch (pos) {
+    case 20 * TEST_W + 10:
+        return 0x27;
+    case 21 * TEST_W + 70:
+        return 0x3f;
+    case 20 * TEST_W + 30:
+    case 22 * TEST_W + 5:
+        return 0x20;
+    }
+    return 0;
+}
+
+/*
+ *    Is ``pos'' inside one of the nondisplay fields?
+ */
+static int test_hidden(int pos) {
+    return (pos > 20 * TEST_W + 10 && pos < 20 * TEST_W + 30) ||
+           (pos > 21 * TEST_W + 70 && pos < 22 * TEST_W + 5);
+}
+
+/*
+ *    Make the changes for update ``serial'': its number in the top left
+ *    corner, a few characters elsewhere, a new cursor position and now
+ *    and then new indicators or a whole new screen.
+ */
+static void test_edit(Tn5250Display* display, int serial) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    unsigned char* data;
+    int i, n, pos;
+
+    data = tn5250_dbuffer_writable_data(dbuffer, 0, TEST_H - 1);
+    if (serial % 500 == 0) {
+        for (pos = 0; pos < TEST_SIZE; pos++) {
+            data[pos] = (unsigned char)(0x40 + test_rand(0xbf));
+        }
+    }
+    n = 1 + test_rand(3);
+    for (i = 0; i < n; i++) {
+        data[TEST_W + test_rand(TEST_SIZE - TEST_W)] =
+            (unsigned char)(0x40 + test_rand(0xbf));
+    }
+    for (pos = 0; pos < TEST_SIZE; pos++) {
+        if (test_attribute(pos) != 0) {
+            data[pos] = (unsigned char)test_attribute(pos);
+        }
+    }
+    for (i = 0, n = serial; i < 6; i++, n /= 10) {
+        data[5 - i] = (unsigned char)(0xf0 + n % 10);
+    }
+    tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H), test_rand(TEST_W));
+    if (test_rand(20) == 0) {
+        display->indicators = test_rand(0x40);
+    }
+}
+
+/*
+ *    Keep what the player should show for update ``serial''.
+ */
+static void test_save(Tn5250Display* display, int serial) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    unsigned char* screen = test_screens + (long)serial * TEST_SIZE;
+    int pos;
+
+    memcpy(screen, dbuffer->data, TEST_SIZE);
+    for (pos = 0; pos < TEST_SIZE; pos++) {
+        if (test_hidden(pos)) {
+            screen[pos] = 0x00;
+        }
+    }
+    test_cursor[serial] = dbuffer->cy * TEST_W + dbuffer->cx;
+    test_indicators[serial] = (unsigned long)display->indicators;
+}
+
+/*
+ *    The update number shown on ``dbuffer'', or -1 if it can't be read.
+ */
+static int test_serial(Tn5250DBuffer* dbuffer) {
+    int i, n = 0;
+
+    if (dbuffer->w != TEST_W || dbuffer->h != TEST_H) {
+        return -1;
+    }
+    for (i = 0; i < 6; i++) {
+        if (dbuffer->data[i] < 0xf0 || dbuffer->data[i] > 0xf9) {
+            return -1;
+        }
+        n = n * 10 + dbuffer->data[i] - 0xf0;
+    }
+    return n;
+}
+
+/*
+ *    Does the player show what was recorded for the update whose number
+ *    it shows?  The number is stored in ``serial''.
+ */
+static int test_frame(Tn5250Player* player, int* serial, int verbose) {
+    Tn5250DBuffer* dbuffer = tn5250_player_dbuffer(player);
+    const unsigned char* screen;
+    int pos;
+
+    if ((*serial = test_serial(dbuffer)) < 0) {
+        if (verbose) {
+            printf("no update number on screen\n");
+        }
+        return 0;
+    }
+    screen = test_screens + (long)*serial * TEST_SIZE;
+    for (pos = 0; pos < TEST_SIZE; pos++) {
+        if (dbuffer->data[pos] != screen[pos]) {
+            if (verbose) {
+                printf("update %d, cell %d,%d: got %02X, wanted %02X\n",
+                       *serial, pos / TEST_W, pos % TEST_W, dbuffer->data[pos],
+                       screen[pos]);
+            }
+            return 0;
+        }
+    }
+    if (dbuffer->cy * TEST_W + dbuffer->cx != test_cursor[*serial] ||
+        tn5250_player_indicators(player) != test_indicators[*serial]) {
+        if (verbose) {
+            printf("update %d: cursor or indicators differ\n", *serial);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Record ``updates'' updates to ``filename'', pausing for a
+ *    millisecond after every ``pause'' of them if that isn't zero.
+ *    Stores how many frames were dropped in ``dropped'' and how long the
+ *    updates took, not counting closing the file, in ``took''.  Returns
+ *    0 if the recording couldn't be made.
+ */
+static int test_record(const char* filename, int updates, int pause,
+                       unsigned long* dropped, long* took) {
+    Tn5250Display* display;
+    Tn5250Recorder* recorder;
+    unsigned long start;
+    int i;
+
+    if ((recorder = tn5250_recorder_new(filename, "37")) == NULL) {
+        return 0;
+    }
+    tn5250_recorder_set_keyframe_interval(recorder, 20);
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    start = tn5250_msec_now();
+    for (i = 0; i < updates; i++) {
+        test_edit(display, i);
+        test_save(display, i);
+        tn5250_recorder_frame(recorder, display);
+        if (pause != 0 && i % pause == pause - 1) {
+            usleep(1000);
+        }
+    }
+    *took = tn5250_msec_since(start);
+    *dropped = tn5250_recorder_dropped(recorder);
+    tn5250_recorder_destroy(recorder);
+    tn5250_display_destroy(display);
+    return 1;
+}
+
+/*
+ *    Play ``filename'' back, frame by frame and then with ``seeks''
+ *    random seeks.  Returns the number of checks which failed.
+ */
+static int test_play(const char* filename, int updates,
+                     unsigned long dropped, int seeks) {
+    Tn5250Player* player;
+    int* serials;
+    int failed = 0;
+    int i, n, serial, prev = -1;
+    unsigned long missing = 0, msec;
+
+    if ((player = tn5250_player_open(filename)) == NULL) {
+        printf("can't play %s\n", filename);
+        return 1;
+    }
+    serials = tn5250_new(int, tn5250_player_frame_count(player) + 1);
+    TN5250_ASSERT(serials != NULL);
+
+    for (n = 0; tn5250_player_next(player) > 0; n++) {
+        if (!test_frame(player, &serial, failed < 3)) {
+            if (++failed <= 3) {
+                printf("  (frame %d)\n", n);
+            }
+            serial = prev + 1;
+        }
+        else if (serial <= prev) {
+            if (++failed <= 3) {
+                printf("frame %d shows update %d after %d\n", n, serial, prev);
+            }
+        }
+        else if (serial != prev + 1 &&
+                 (!tn5250_player_after_gap(player) ||
+                  player->index[n].type != TN5250_RECORDER_FRAME_KEY)) {
+            if (++failed <= 3) {
+                printf("frame %d, after a gap, isn't a gap keyframe\n", n);
+            }
+        }
+        if (serial > prev) {
+            missing += serial - prev - 1;
+            prev = serial;
+        }
+        serials[n] = serial;
+    }
+    if (n != tn5250_player_frame_count(player) || prev != updates - 1 ||
+        missing != dropped) {
+        printf("played %d of %d frames, up to update %d of %d, %lu missing "
+               "and %lu dropped\n",
+               n, tn5250_player_frame_count(player), prev, updates - 1,
+               missing, dropped);
+        failed++;
+    }
+
+    for (i = 0; i < seeks && n > 0; i++) {
+        msec = (unsigned long)test_rand(tn5250_player_duration(player) + 2);
+        if (tn5250_player_seek(player, msec) < 0) {
+            failed++;
+            break;
+        }
+        /* The last frame at or before msec, or the first one. */
+        for (n = tn5250_player_frame_count(player) - 1;
+             n > 0 && player->index[n].msec > msec; n--) {
+        }
+        if (!test_frame(player, &serial, failed < 3) ||
+            serial != serials[n]) {
+            if (++failed <= 3) {
+                printf("  (seek to %lu ms shows update %d, wanted %d)\n",
+                       msec, serial, serials[n]);
+            }
+        }
+        n = tn5250_player_frame_count(player);
+    }
+
+    free(serials);
+    tn5250_player_close(player);
+    return failed;
+}
+
+int main(int argc, char* argv[]) {
+    char filename[] = "/tmp/recordtestXXXXXX";
+    unsigned long dropped;
+    long took;
+    int updates, fd;
+    int failed = 0;
+#ifdef TEST_THREADS
+    char copy[] = "/tmp/recordtestXXXXXX";
+    char buf[4096];
+    pid_t pid;
+    int in, out, n, status;
+#endif
+
+    updates = argc > 1 ? atoi(argv[1]) : 3000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (updates <= 0 || updates > 1000000) {
+        fprintf(stderr, "usage: recordtest [updates [seed]]\n");
+        return 2;
+    }
+    test_screens = (unsigned char*)malloc((size_t)updates * TEST_SIZE);
+    test_cursor = tn5250_new(int, updates);
+    test_indicators = tn5250_new(unsigned long, updates);
+    TN5250_ASSERT(test_screens != NULL && test_cursor != NULL &&
+                  test_indicators != NULL);
+
+    if ((fd = mkstemp(filename)) < 0) {
+        perror(filename);
+        return 1;
+    }
+    close(fd);
+    if (!test_record(filename, updates, 10, &dropped, &took)) {
+        perror(filename);
+        unlink(filename);
+        return 1;
+    }
+    failed += test_play(filename, updates, dropped, TEST_SEEKS);
+    unlink(filename);
+    printf("file: %d updates, %lu dropped\n", updates, dropped);
+
+#ifdef TEST_THREADS
+    /* A reader which doesn't read for a while. */
+    if ((fd = mkstemp(copy)) < 0) {
+        perror(copy);
+        return 1;
+    }
+    close(fd);
+    if (mkfifo(filename, 0600) < 0) {
+        perror(filename);
+        unlink(copy);
+        return 1;
+    }
+    if ((pid = fork()) == 0) {
+        in = open(filename, O_RDONLY);
+        out = open(copy, O_WRONLY | O_TRUNC);
+        usleep(TEST_STALL * 1000L);
+        while (in >= 0 && out >= 0 && (n = read(in, buf, sizeof(buf))) > 0) {
+            if (write(out, buf, n) != n) {
+                _exit(1);
+            }
+        }
+        _exit(in < 0 || out < 0);
+    }
+    if (pid < 0 || !test_record(filename, updates, 0, &dropped, &took)) {
+        perror(filename);
+        unlink(filename);
+        unlink(copy);
+        return 1;
+    }
+    waitpid(pid, &status, 0);
+    unlink(filename);
+    if (dropped == 0 || took >= TEST_STALL) {
+        printf("FIFO: the updates waited for the stalled reader\n");
+        failed++;
+    }
+    failed += test_play(copy, updates, dropped, 0);
+    unlink(copy);
+    printf("FIFO: %d updates, %lu dropped, %ld ms\n",
+           updates, dropped, took);
+#endif
+
+    printf("%d checks failed\n", failed);
+    free(test_screens);
+    free(test_cursor);
+    free(test_indicators);
+    return failed != 0;
+}
@@ -0,0 +1,117 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* renderbench -- Time the curses terminal's screen updates.
+ *
+ * Paints a full 24x80 screen with a few attribute changes on every row,
+ * then types keys into row 10 and runs tn5250_display_update after each
+ * one, and then repaints the whole screen after changing every row.
+ * Curses runs as TERM=vt100 with its output going to /dev/null, so this
+ * measures the terminal code and not the terminal.
+ *
+ * Usage: renderbench [keys]
+ */
+#include "tn5250-private.h"
+#include "cursesterm.h"
+
+#include <time.h>
+
+static double bench_ms(clock_t start);
+static void bench_fill(Tn5250Display* display, int shift);
+
+/*
+ *    CPU time since start, in milliseconds.
+ */
+static double bench_ms(clock_t start) {
+    return (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/*
+ *    Fill every row with text, starting with an attribute which changes
+ *    from row to row.
+ */
+static void bench_fill(Tn5250Display* display, int shift) {
+    int y, x;
+
+    for (y = 0; y < tn5250_display_height(display); y++) {
+        tn5250_display_set_cursor(display, y, 0);
+        tn5250_display_addch(display, 0x20 + ((y + shift) % 4) * 4);
+        for (x = 1; x < tn5250_display_width(display); x++) {
+            tn5250_display_addch(display, 0xc1 + (x + shift) % 9);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Terminal* term;
+    Tn5250Display* display;
+    clock_t start;
+    double keys_ms, full_ms;
+    int keys, i;
+
+    keys = argc > 1 ? atoi(argv[1]) : 20000;
+    if (keys <= 0) {
+        fprintf(stderr, "usage: renderbench [keys]\n");
+        return 2;
+    }
+
+    setenv("TERM", "vt100", 1);
+    if (freopen("/dev/null", "w", stdout) == NULL) {
+        perror("/dev/null");
+        return 1;
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    term = tn5250_curses_terminal_new();
+    tn5250_terminal_init(term);
+    tn5250_display_set_terminal(display, term);
+
+    bench_fill(display, 0);
+    tn5250_display_update(display);
+
+    start = clock();
+    for (i = 0; i < keys; i++) {
+        tn5250_display_set_cursor(display, 10, 5 + i % 40);
+        tn5250_display_addch(display, 0xc1 + i % 9);
+        tn5250_display_update(display);
+    }
+    keys_ms = bench_ms(start);
+
+    start = clock();
+    for (i = 0; i < keys / 100; i++) {
+        bench_fill(display, i + 1);
+        tn5250_display_update(display);
+    }
+    full_ms = bench_ms(start);
+
+    tn5250_terminal_term(term);
+    tn5250_display_destroy(display);
+
+    fprintf(stderr, "%d keystroke updates: %.1f ms CPU, %.2f us each\n",
+            keys, keys_ms, keys_ms * 1000.0 / keys);
+    if (keys >= 100) {
+        fprintf(stderr, "%d full repaints: %.1f ms CPU, %.2f us each\n",
+                keys / 100, full_ms, full_ms * 1000.0 / (keys / 100));
+    }
+    return 0;
+}
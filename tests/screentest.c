@@ -0,0 +1,216 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* screentest -- Check screen recognition.
+ *
+ * Learns a few random screens with two volatile regions, then makes
+ * random edits: whole screens are loaded, cells inside and outside the
+ * volatile regions are changed and changed back.  After each edit the
+ * registry must recognise the screen whose cells outside the volatile
+ * regions match the buffer, or none if no screen does.  Now and then a
+ * copy of the buffer, at the same generation but holding another screen,
+ * is looked at in between, and a fresh registry must compute the same
+ * fingerprint as the one that has been following the edits.
+ *
+ * Usage: screentest [edits [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_W       80
+#define TEST_H       24
+#define TEST_SIZE    (TEST_W * TEST_H)
+#define TEST_SCREENS 8
+
+static unsigned char test_data[TEST_SCREENS][TEST_SIZE];
+static Tn5250Screen* test_screen[TEST_SCREENS];
+
+static int test_volatile(int pos);
+static void test_put(Tn5250DBuffer* dbuffer, int pos, unsigned char c);
+static void test_load(Tn5250DBuffer* dbuffer, int k);
+static Tn5250Screen* test_expected(Tn5250DBuffer* dbuffer);
+static Tn5250ScreenRegistry* test_registry(void);
+
+/*
+ *    Is the cell in one of the volatile regions test_registry sets up?
+ */
+static int test_volatile(int pos) {
+    int y = pos / TEST_W;
+    int x = pos % TEST_W;
+
+    return (y == 0 && x >= 70) || (y == TEST_H - 1 && x < 10);
+}
+
+/*
+ *    Store one cell.
+ */
+static void test_put(Tn5250DBuffer* dbuffer, int pos, unsigned char c) {
+    int y = pos / TEST_W;
+
+    tn5250_dbuffer_writable_data(dbuffer, y, y)[pos] = c;
+}
+
+/*
+ *    Put screen k on the buffer, with random volatile cells.
+ */
+static void test_load(Tn5250DBuffer* dbuffer, int k) {
+    unsigned char* data;
+    int i;
+
+    data = tn5250_dbuffer_writable_data(dbuffer, 0, TEST_H - 1);
+    memcpy(data, test_data[k], TEST_SIZE);
+    for (i = 0; i < TEST_SIZE; i++) {
+        if (test_volatile(i)) {
+            data[i] = (unsigned char)(0x40 + test_rand(0xc0));
+        }
+    }
+}
+
+/*
+ *    Which learned screen matches the buffer outside the volatile
+ *    regions?
+ */
+static Tn5250Screen* test_expected(Tn5250DBuffer* dbuffer) {
+    int k, i;
+
+    for (k = 0; k < TEST_SCREENS; k++) {
+        for (i = 0; i < TEST_SIZE; i++) {
+            if (!test_volatile(i) && dbuffer->data[i] != test_data[k][i]) {
+                break;
+            }
+        }
+        if (i == TEST_SIZE) {
+            return test_screen[k];
+        }
+    }
+    return NULL;
+}
+
+/*
+ *    A registry with the clock and job number regions marked volatile.
+ */
+static Tn5250ScreenRegistry* test_registry(void) {
+    Tn5250ScreenRegistry* reg = tn5250_screen_registry_new();
+
+    tn5250_screen_registry_add_volatile(reg, 0, 70, 0, TEST_W - 1);
+    tn5250_screen_registry_add_volatile(reg, TEST_H - 1, 0, TEST_H - 1, 9);
+    return reg;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250ScreenRegistry *reg, *fresh;
+    Tn5250DBuffer *dbuffer, *copy;
+    Tn5250Screen *want, *got;
+    char name[16];
+    int edits, i, k, r, pos;
+    int current = 0, failed = 0;
+
+    edits = argc > 1 ? atoi(argv[1]) : 20000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (edits <= 0) {
+        fprintf(stderr, "usage: screentest [edits [seed]]\n");
+        return 2;
+    }
+
+    dbuffer = tn5250_dbuffer_new(TEST_W, TEST_H);
+    reg = test_registry();
+    for (k = 0; k < TEST_SCREENS; k++) {
+        for (i = 0; i < TEST_SIZE; i++) {
+            test_data[k][i] = (unsigned char)(0x40 + test_rand(0xc0));
+        }
+        test_load(dbuffer, k);
+        sprintf(name, "screen%d", k);
+        test_screen[k] = tn5250_screen_registry_learn(reg, name, dbuffer);
+    }
+
+    for (i = 0; i < edits; i++) {
+        r = test_rand(100);
+        pos = test_rand(TEST_SIZE);
+        if (r < 10) {
+            current = test_rand(TEST_SCREENS);
+            test_load(dbuffer, current);
+        }
+        else if (r < 55) {
+            while (!test_volatile(pos)) {
+                pos = test_rand(TEST_SIZE);
+            }
+            test_put(dbuffer, pos, (unsigned char)(0x40 + test_rand(0xc0)));
+        }
+        else if (r < 75) {
+            test_put(dbuffer, pos, (unsigned char)(0x40 + test_rand(0xc0)));
+        }
+        else {
+            test_put(dbuffer, pos, test_data[current][pos]);
+        }
+
+        want = test_expected(dbuffer);
+        got = tn5250_screen_registry_recognize(reg, dbuffer);
+        if (got != want && ++failed <= 3) {
+            printf("edit %d: recognised %s, wanted %s\n", i,
+                   got != NULL ? tn5250_screen_name(got) : "nothing",
+                   want != NULL ? tn5250_screen_name(want) : "nothing");
+        }
+
+        if (i % 50 == 0) {
+            /* Put a screen on a copy and on the buffer, bring both to
+             * the same generation and look at each in turn. */
+            copy = tn5250_dbuffer_copy(dbuffer);
+            test_load(copy, test_rand(TEST_SCREENS));
+            test_load(dbuffer, current);
+            while (tn5250_dbuffer_generation(copy) <
+                   tn5250_dbuffer_generation(dbuffer)) {
+                test_put(copy, pos, copy->data[pos]);
+            }
+            while (tn5250_dbuffer_generation(dbuffer) <
+                   tn5250_dbuffer_generation(copy)) {
+                test_put(dbuffer, pos, dbuffer->data[pos]);
+            }
+            got = tn5250_screen_registry_recognize(reg, copy);
+            if (got != test_expected(copy) && ++failed <= 3) {
+                printf("edit %d: the copy was not recognised\n", i);
+            }
+            want = test_expected(dbuffer);
+            got = tn5250_screen_registry_recognize(reg, dbuffer);
+            if (got != want && ++failed <= 3) {
+                printf("edit %d: recognised %s after the copy\n", i,
+                       got != NULL ? tn5250_screen_name(got) : "nothing");
+            }
+            tn5250_dbuffer_destroy(copy);
+
+            fresh = test_registry();
+            if (tn5250_screen_registry_fingerprint(fresh, dbuffer) !=
+                    tn5250_screen_registry_fingerprint(reg, dbuffer) &&
+                ++failed <= 3) {
+                printf("edit %d: a fresh registry's fingerprint differs\n", i);
+            }
+            tn5250_screen_registry_destroy(fresh);
+        }
+    }
+
+    printf("%d edits, %lu hits, %lu misses, %d checks failed\n", edits,
+           tn5250_screen_registry_hits(reg),
+           tn5250_screen_registry_misses(reg), failed);
+    tn5250_screen_registry_destroy(reg);
+    tn5250_dbuffer_destroy(dbuffer);
+    return failed != 0;
+}
@@ -0,0 +1,408 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* scripttest -- Run scripts on many sessions from one thread.
+ *
+ * Each of TEST_SESSIONS sessions talks over a socketpair to a fake host
+ * in a child process, which waits TEST_DELAY ms before each reply.  The
+ * host sends a sign on screen with two fields; the script fills them in
+ * and presses Enter, waits for the menu, types an option and waits for
+ * the last screen.  The host checks that it got the field contents and
+ * the option.  One more host never answers the Enter, and its script
+ * must time out.  All the scripts run together through
+ * tn5250_script_run, so the others must finish in much less time than
+ * the hosts' delays would take one session after another, and without
+ * waiting for the silent host.
+ *
+ * Usage: scripttest [sessions]
+ */
+#include "tn5250-private.h"
+
+#define TEST_SESSIONS 50
+#define TEST_DELAY    50   /* How long a host takes to reply, ms */
+#define TEST_WAIT     1000 /* Longest a script waits for a screen, ms */
+
+static const Tn5250CharMap* test_map = NULL;
+
+static int test_read(int fd, unsigned char* buf, int len);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+static void test_text(Tn5250Buffer* buf, int row, int col, const char* text);
+static void test_field(Tn5250Buffer* buf, int row, int col, int len);
+static int test_screen(int fd, int kind);
+static int test_got(const unsigned char* data, int len, const char* text);
+static void test_host(int fd, int silent);
+static int test_script(Tn5250Script* s, void* data);
+
+/*
+ *    Read exactly len bytes.  Returns 0 at the end of the stream.
+ */
+static int test_read(int fd, unsigned char* buf, int len) {
+    int n, got = 0;
+
+    while (got < len) {
+        if ((n = read(fd, buf + got, len - got)) <= 0) {
+            return 0;
+        }
+        got += n;
+    }
+    return 1;
+}
+
+/*
+ *    Receive one record from the host.  Records are sent as they are,
+ *    starting with their two byte length, without the telnet framing.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    Tn5250Record* record;
+    unsigned char buf[4096];
+    int len, i;
+
+    if (!test_read(stream->sockfd, buf, 2)) {
+        return 0;
+    }
+    len = (buf[0] << 8) | buf[1];
+    if (len < 10 || len > (int)sizeof(buf) ||
+        !test_read(stream->sockfd, buf + 2, len - 2)) {
+        return 0;
+    }
+    record = tn5250_record_new();
+    for (i = 0; i < len; i++) {
+        tn5250_record_append_byte(record, buf[i]);
+    }
+    stream->records = tn5250_record_list_add(stream->records, record);
+    stream->record_count++;
+    return 1;
+}
+
+/*
+ *    Send a record to the host in the same way.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+    Tn5250Buffer out;
+
+    tn5250_buffer_init(&out);
+    tn5250_buffer_append_byte(&out, (unsigned char)((length + 10) >> 8));
+    tn5250_buffer_append_byte(&out, (unsigned char)(length + 10));
+    tn5250_buffer_append_byte(&out, 0x12);
+    tn5250_buffer_append_byte(&out, 0xa0);
+    tn5250_buffer_append_byte(&out,
+                              (unsigned char)(header.h5250.flowtype >> 8));
+    tn5250_buffer_append_byte(&out, (unsigned char)header.h5250.flowtype);
+    tn5250_buffer_append_byte(&out, 4);
+    tn5250_buffer_append_byte(&out, header.h5250.flags);
+    tn5250_buffer_append_byte(&out, 0);
+    tn5250_buffer_append_byte(&out, header.h5250.opcode);
+    tn5250_buffer_append_data(&out, data, length);
+    if (write(stream->sockfd, tn5250_buffer_data(&out),
+              tn5250_buffer_length(&out)) != tn5250_buffer_length(&out)) {
+        perror("write");
+    }
+    tn5250_buffer_free(&out);
+}
+
+/*
+ *    Put text on the screen at row, col (from 1).
+ */
+static void test_text(Tn5250Buffer* buf, int row, int col, const char* text) {
+    tn5250_buffer_append_byte(buf, SBA);
+    tn5250_buffer_append_byte(buf, (unsigned char)row);
+    tn5250_buffer_append_byte(buf, (unsigned char)col);
+    for (; *text != '\0'; text++) {
+        tn5250_buffer_append_byte(
+            buf, tn5250_char_map_to_remote(test_map, (unsigned char)*text));
+    }
+}
+
+/*
+ *    Start an input field of len characters, with its attribute at
+ *    row, col (from 1).
+ */
+static void test_field(Tn5250Buffer* buf, int row, int col, int len) {
+    tn5250_buffer_append_byte(buf, SBA);
+    tn5250_buffer_append_byte(buf, (unsigned char)row);
+    tn5250_buffer_append_byte(buf, (unsigned char)col);
+    tn5250_buffer_append_byte(buf, SF);
+    tn5250_buffer_append_byte(buf, 0x40);
+    tn5250_buffer_append_byte(buf, 0x00);
+    tn5250_buffer_append_byte(buf, 0x20);
+    tn5250_buffer_append_byte(buf, 0x00);
+    tn5250_buffer_append_byte(buf, (unsigned char)len);
+}
+
+/*
+ *    Send a screen: 0 is the sign on screen, 1 the menu and 2 the last
+ *    screen, which has no fields and doesn't read them.
+ */
+static int test_screen(int fd, int kind) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    Tn5250Buffer buf;
+    int len, ok;
+
+    tn5250_buffer_init(&buf);
+    tn5250_buffer_append_data(&buf, (unsigned char*)header, sizeof(header));
+    tn5250_buffer_append_byte(&buf, ESC);
+    tn5250_buffer_append_byte(&buf, CMD_CLEAR_UNIT);
+    tn5250_buffer_append_byte(&buf, ESC);
+    tn5250_buffer_append_byte(&buf, CMD_WRITE_TO_DISPLAY);
+    tn5250_buffer_append_byte(&buf, 0x00);
+    tn5250_buffer_append_byte(&buf, TN5250_SESSION_CTL_UNLOCK);
+    if (kind == 0) {
+        test_text(&buf, 1, 35, "Sign On");
+        test_text(&buf, 6, 10, "User");
+        test_field(&buf, 6, 30, 10);
+        test_text(&buf, 7, 10, "Password");
+        test_field(&buf, 7, 30, 10);
+    }
+    else if (kind == 1) {
+        test_text(&buf, 1, 35, "Main Menu");
+        test_text(&buf, 20, 2, "Selection");
+        test_field(&buf, 20, 12, 2);
+    }
+    else {
+        test_text(&buf, 1, 35, "Done");
+    }
+    if (kind != 2) {
+        tn5250_buffer_append_byte(&buf, ESC);
+        tn5250_buffer_append_byte(&buf, CMD_READ_MDT_FIELDS);
+        tn5250_buffer_append_byte(&buf, 0x00);
+        tn5250_buffer_append_byte(&buf, 0x00);
+    }
+
+    len = tn5250_buffer_length(&buf);
+    tn5250_buffer_data(&buf)[0] = (unsigned char)(len >> 8);
+    tn5250_buffer_data(&buf)[1] = (unsigned char)len;
+    ok = write(fd, tn5250_buffer_data(&buf), len) == len;
+    tn5250_buffer_free(&buf);
+    return ok;
+}
+
+/*
+ *    Is text, in the host character set, somewhere in data?
+ */
+static int test_got(const unsigned char* data, int len, const char* text) {
+    int n = strlen(text), i, j;
+
+    for (i = 0; i + n <= len; i++) {
+        for (j = 0; j < n && data[i + j] == tn5250_char_map_to_remote(
+                                                test_map,
+                                                (unsigned char)text[j]);
+             j++) {
+        }
+        if (j == n) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Be the host: send the sign on screen, and after each Enter from the
+ *    terminal wait TEST_DELAY ms and send the next screen.  Exits with 0
+ *    if the terminal sent what the script typed.  A silent host never
+ *    answers the first Enter, and hangs up well after the script has
+ *    given up.
+ */
+static void test_host(int fd, int silent) {
+    static const char* const expect[2][2] = {{"QSECOFR", "SECRET"},
+                                             {"42", "42"}};
+    unsigned char buf[4096];
+    int kind, len, ok = 1;
+
+    if (!test_screen(fd, 0)) {
+        _exit(1);
+    }
+    for (kind = 0; kind < 2; kind++) {
+        if (!test_read(fd, buf, 2)) {
+            _exit(1);
+        }
+        len = (buf[0] << 8) | buf[1];
+        if (len < 13 || len > (int)sizeof(buf) ||
+            !test_read(fd, buf + 2, len - 2)) {
+            _exit(1);
+        }
+        if (buf[12] != TN5250_SESSION_AID_ENTER ||
+            !test_got(buf + 13, len - 13, expect[kind][0]) ||
+            !test_got(buf + 13, len - 13, expect[kind][1])) {
+            ok = 0;
+        }
+        if (silent) {
+            usleep(3 * TEST_WAIT * 1000);
+            _exit(1);
+        }
+        usleep(TEST_DELAY * 1000);
+        if (!test_screen(fd, kind + 1)) {
+            _exit(1);
+        }
+    }
+    _exit(ok ? 0 : 1);
+}
+
+/*
+ *    Sign on, wait for the next screen, which should be the menu with its
+ *    one field, pick option 42 and wait for the last screen.
+ */
+static int test_script(Tn5250Script* s, void* data) {
+    const Tn5250ScriptField* fields;
+
+    TN5250_SCRIPT_BEGIN(s);
+    TN5250_SCRIPT_WAIT_FOR(s, TN5250_SCRIPT_WAIT_TEXT, "Sign On", TEST_WAIT);
+    if (tn5250_script_result(s) == 0) {
+        return TN5250_SCRIPT_FAILED;
+    }
+    tn5250_script_set_field(s, 0, "QSECOFR");
+    tn5250_script_set_field(s, 1, "SECRET");
+    tn5250_script_send_key(s, K_ENTER);
+    TN5250_SCRIPT_WAIT_FOR(s, TN5250_SCRIPT_WAIT_SCREEN, NULL, TEST_WAIT);
+    if (tn5250_script_result(s) == 0 ||
+        tn5250_script_read_fields(s, &fields) != 1) {
+        return TN5250_SCRIPT_FAILED;
+    }
+    tn5250_script_send_keys(s, "42\n");
+    TN5250_SCRIPT_WAIT_FOR(s, TN5250_SCRIPT_WAIT_TEXT, "Done", TEST_WAIT);
+    if (tn5250_script_result(s) == 0) {
+        return TN5250_SCRIPT_FAILED;
+    }
+    TN5250_SCRIPT_END(s);
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Script** scripts;
+    Tn5250Display* display;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    pid_t* pids;
+    unsigned long start;
+    long took = -1;
+    int sessions, i, j, fds[2], status, running, done;
+    int failed = 0;
+
+    sessions = argc > 1 ? atoi(argv[1]) : TEST_SESSIONS;
+    if (sessions <= 0) {
+        fprintf(stderr, "usage: scripttest [sessions]\n");
+        return 2;
+    }
+    test_map = tn5250_char_map_new("37");
+    scripts = tn5250_new(Tn5250Script*, sessions + 1);
+    pids = tn5250_new(pid_t, sessions + 1);
+    TN5250_ASSERT(scripts != NULL && pids != NULL);
+
+    /* The last session is the one with the silent host. */
+    for (i = 0; i <= sessions; i++) {
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+            perror("socketpair");
+            return 1;
+        }
+        if ((pids[i] = fork()) < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pids[i] == 0) {
+            /* Don't hold the other hosts' sessions open. */
+            for (j = 0; j < i; j++) {
+                close(tn5250_script_fd(scripts[j]));
+            }
+            close(fds[0]);
+            test_host(fds[1], i == sessions);
+        }
+        close(fds[1]);
+
+        display = tn5250_display_new();
+        tn5250_display_set_char_map(display, "37");
+        tn5250_display_set_terminal(display, tn5250_headless_terminal_new());
+        session = tn5250_session_new();
+        tn5250_display_set_session(display, session);
+        stream = tn5250_new(Tn5250Stream, 1);
+        TN5250_ASSERT(stream != NULL);
+        memset(stream, 0, sizeof(Tn5250Stream));
+        stream->streamtype = TN5250_STREAM;
+        stream->handle_receive = test_receive;
+        stream->send_packet = test_send;
+        stream->sockfd = fds[0];
+        tn5250_buffer_init(&stream->sb_buf);
+        tn5250_session_set_stream(session, stream);
+        scripts[i] = tn5250_script_new(session, test_script, NULL);
+    }
+
+    start = tn5250_msec_now();
+    do {
+        running = tn5250_script_run(scripts, sessions + 1, 10);
+        for (i = done = 0; i < sessions; i++) {
+            done += tn5250_script_status(scripts[i]) == TN5250_SCRIPT_DONE;
+        }
+        if (done == sessions && took < 0) {
+            took = (long)tn5250_msec_since(start);
+        }
+    } while (running > 0 && tn5250_msec_since(start) < 4 * TEST_WAIT);
+
+    if (tn5250_script_status(scripts[sessions]) != TN5250_SCRIPT_FAILED) {
+        printf("the script with the silent host ended with %d\n",
+               tn5250_script_status(scripts[sessions]));
+        failed++;
+    }
+    /* Hanging up lets a host still waiting for an Enter go. */
+    kill(pids[sessions], SIGKILL);
+    for (i = 0; i <= sessions; i++) {
+        if (i < sessions &&
+            tn5250_script_status(scripts[i]) != TN5250_SCRIPT_DONE) {
+            if (++failed <= 3) {
+                printf("session %d: the script ended with %d\n", i,
+                       tn5250_script_status(scripts[i]));
+            }
+        }
+        session = tn5250_script_session(scripts[i]);
+        tn5250_script_destroy(scripts[i]);
+        close(session->stream->sockfd);
+        display = session->display;
+        tn5250_session_destroy(session);
+        tn5250_display_destroy(display);
+        if (waitpid(pids[i], &status, 0) != pids[i] ||
+            (i < sessions &&
+             (!WIFEXITED(status) || WEXITSTATUS(status) != 0))) {
+            if (++failed <= 3) {
+                printf("session %d: the host didn't get the fields\n", i);
+            }
+        }
+    }
+
+    /* One after another, the hosts alone would take 2 * TEST_DELAY each. */
+    if (took < 0) {
+        printf("%d of %d scripts finished\n", done, sessions);
+        failed++;
+    }
+    else {
+        printf("%d sessions finished in %ld ms\n", sessions, took);
+        if (sessions > 1 && took >= sessions * TEST_DELAY) {
+            printf("the scripts didn't run together\n");
+            failed++;
+        }
+    }
+    free(scripts);
+    free(pids);
+    tn5250_char_map_destroy(test_map);
+    return failed != 0;
+}
@@ -0,0 +1,283 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* searchtest -- Check on-screen text search and waiting for text.
+ *
+ * tn5250_dbuffer_find is compared with a plain scan over random screens
+ * drawn from a three letter alphabet, random rectangles and random
+ * patterns.  Then tn5250_session_wait_for_text is run against a stream
+ * whose socket is a pipe: it must time out on time with nothing coming,
+ * keep waiting through signals, find text that is already on the screen
+ * and find text that a record from the host puts there.
+ *
+ * Usage: searchtest [searches [seed]]
+ */
+#include "testutil.h"
+
+#include <signal.h>
+#include <sys/time.h>
+
+#define TEST_W 80
+#define TEST_H 24
+
+static Tn5250Record* test_pending = NULL;
+static volatile int test_signals = 0;
+
+static int test_scan(Tn5250DBuffer* dbuffer, const unsigned char* pat, int len,
+                     int top, int left, int bottom, int right, int* y, int* x);
+static int test_find(int searches);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+static void test_alarm(int sig);
+static int test_wait(void);
+
+/*
+ *    The obvious search, for reference.
+ */
+static int test_scan(Tn5250DBuffer* dbuffer, const unsigned char* pat, int len,
+                     int top, int left, int bottom, int right, int* y,
+                     int* x) {
+    int i, j;
+
+    for (i = top; i <= bottom; i++) {
+        for (j = left; j + len - 1 <= right; j++) {
+            if (memcmp(dbuffer->data + i * TEST_W + j, pat, len) == 0) {
+                *y = i;
+                *x = j;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Compare tn5250_dbuffer_find with test_scan.  Returns the number of
+ *    searches which gave a different answer.
+ */
+static int test_find(int searches) {
+    Tn5250DBuffer* dbuffer = tn5250_dbuffer_new(TEST_W, TEST_H);
+    unsigned char pat[6];
+    int top, left, bottom, right, len;
+    int found, y, x, want, wy, wx;
+    int i, j, bad = 0;
+
+    for (i = 0; i < searches; i++) {
+        for (j = 0; j < 20; j++) {
+            tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H),
+                                      test_rand(TEST_W));
+            tn5250_dbuffer_addch(dbuffer, (unsigned char)(0xc1 + test_rand(3)));
+        }
+        top = test_rand(TEST_H);
+        bottom = top + test_rand(TEST_H - top);
+        left = test_rand(TEST_W);
+        right = left + test_rand(TEST_W - left);
+        len = 1 + test_rand(sizeof(pat));
+        for (j = 0; j < len; j++) {
+            pat[j] = (unsigned char)(0xc1 + test_rand(3));
+        }
+
+        y = x = wy = wx = -1;
+        found = tn5250_dbuffer_find(dbuffer, pat, len, top, left, bottom, right,
+                                    &y, &x);
+        want = test_scan(dbuffer, pat, len, top, left, bottom, right, &wy,
+                         &wx);
+        if (found != want || (found && (y != wy || x != wx))) {
+            if (++bad <= 3) {
+                printf("search %d: found %d at %d,%d, wanted %d at %d,%d\n", i,
+                       found, y, x, want, wy, wx);
+            }
+        }
+    }
+    tn5250_dbuffer_destroy(dbuffer);
+    return bad;
+}
+
+/*
+ *    Read the byte the test wrote to the pipe and "receive" the record
+ *    the test has queued.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    char c;
+
+    if (read(stream->sockfd, &c, 1) != 1) {
+        return 0;
+    }
+    if (test_pending != NULL) {
+        stream->records = tn5250_record_list_add(stream->records, test_pending);
+        stream->record_count++;
+        test_pending = NULL;
+    }
+    return 1;
+}
+
+/*
+ *    Nothing is sent back.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+}
+
+/*
+ *    Interrupt whatever system call is running.
+ */
+static void test_alarm(int sig) {
+    test_signals++;
+}
+
+/*
+ *    Run tn5250_session_wait_for_text against a pipe.  Returns the number
+ *    of checks which failed.
+ */
+static int test_wait(void) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    static const char text[] = "Sign On";
+    Tn5250Display* display;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    Tn5250Record* record;
+    struct sigaction sa;
+    struct itimerval it;
+    unsigned long start;
+    long took;
+    int fds[2];
+    int r, i, len;
+    int bad = 0;
+
+    if (pipe(fds) < 0) {
+        perror("pipe");
+        return 1;
+    }
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    stream->sockfd = fds[0];
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+
+    /* Nothing comes: time out, on time. */
+    start = tn5250_msec_now();
+    r = tn5250_session_wait_for_text(session, text, 0, 0, 23, 79, 200);
+    took = tn5250_msec_since(start);
+    if (r != 0 || took < 200 || took > 2000) {
+        printf("silent wait: returned %d after %ld ms\n", r, took);
+        bad++;
+    }
+
+    /* Signals every 20 ms don't end the wait early. */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = test_alarm;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGALRM, &sa, NULL);
+    memset(&it, 0, sizeof(it));
+    it.it_interval.tv_usec = 20000;
+    it.it_value.tv_usec = 20000;
+    setitimer(ITIMER_REAL, &it, NULL);
+    start = tn5250_msec_now();
+    r = tn5250_session_wait_for_text(session, text, 0, 0, 23, 79, 300);
+    took = tn5250_msec_since(start);
+    memset(&it, 0, sizeof(it));
+    setitimer(ITIMER_REAL, &it, NULL);
+    if (r != 0 || took < 300 || took > 3000 || test_signals == 0) {
+        printf("interrupted wait: returned %d after %ld ms, %d signals\n", r,
+               took, test_signals);
+        bad++;
+    }
+
+    /* The host puts the text at row 6, column 10. */
+    record = tn5250_record_new();
+    len = sizeof(header) + 7 + strlen(text);
+    tn5250_record_append_byte(record, (unsigned char)(len >> 8));
+    tn5250_record_append_byte(record, (unsigned char)len);
+    for (i = 2; i < (int)sizeof(header); i++) {
+        tn5250_record_append_byte(record, header[i]);
+    }
+    tn5250_record_append_byte(record, ESC);
+    tn5250_record_append_byte(record, CMD_WRITE_TO_DISPLAY);
+    tn5250_record_append_byte(record, 0x00);
+    tn5250_record_append_byte(record, 0x00);
+    tn5250_record_append_byte(record, SBA);
+    tn5250_record_append_byte(record, 6);
+    tn5250_record_append_byte(record, 10);
+    for (i = 0; text[i] != '\0'; i++) {
+        tn5250_record_append_byte(
+            record, tn5250_char_map_to_remote(tn5250_display_char_map(display),
+                                              (unsigned char)text[i]));
+    }
+    test_pending = record;
+    if (write(fds[1], "", 1) != 1) {
+        perror("write");
+    }
+    r = tn5250_session_wait_for_text(session, text, 5, 0, 5, 79, 5000);
+    if (r != 1) {
+        printf("wait for the host: returned %d\n", r);
+        bad++;
+    }
+
+    /* It is there now, so a wait with no time left still finds it. */
+    r = tn5250_session_wait_for_text(session, text, 0, 0, 23, 79, 0);
+    if (r != 1) {
+        printf("text already there: returned %d\n", r);
+        bad++;
+    }
+    r = tn5250_session_wait_for_text(session, text, 6, 0, 23, 79, 0);
+    if (r != 0) {
+        printf("text outside the region: returned %d\n", r);
+        bad++;
+    }
+
+    tn5250_display_destroy(display);
+    tn5250_session_destroy(session);
+    close(fds[1]);
+    return bad;
+}
+
+int main(int argc, char* argv[]) {
+    int searches, bad, failed;
+
+    searches = argc > 1 ? atoi(argv[1]) : 200000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (searches <= 0) {
+        fprintf(stderr, "usage: searchtest [searches [seed]]\n");
+        return 2;
+    }
+
+    bad = test_find(searches);
+    failed = test_wait();
+    printf("%d searches, %d differed; %d wait checks failed\n", searches, bad,
+           failed);
+    return bad != 0 || failed != 0;
+}
@@ -0,0 +1,199 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* shadowbench -- Time screen updates with observers watching.
+ *
+ * Changes one to three cells of a 24x80 display and runs
+ * tn5250_display_update after each change, with a shadow socket and 0,
+ * 10 or 100 observers reading it in a child process, with and without
+ * one more which never reads.  The time is wall clock time in the
+ * session, since the observers are looked after by another thread.
+ *
+ * Usage: shadowbench [updates]
+ */
+#include "tn5250-private.h"
+
+#include <sys/time.h>
+
+static double bench_now(void);
+static void bench_child(const char* path, int viewers, int stalled, int in,
+                        int out);
+static void bench_run(const char* path, int viewers, int stalled,
+                      int updates);
+
+/*
+ *    Wall clock time in microseconds.
+ */
+static double bench_now(void) {
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+/*
+ *    Connect the observers, say so on ``out'' and read until ``in'' is
+ *    closed.
+ */
+static void bench_child(const char* path, int viewers, int stalled, int in,
+                        int out) {
+    Tn5250ShadowViewer** v;
+    Tn5250ShadowViewer* idle = NULL;
+    fd_set fdr;
+    char c;
+    int i, fd, sm;
+
+    v = tn5250_new(Tn5250ShadowViewer*, viewers + 1);
+    for (i = 0; i < viewers; i++) {
+        if ((v[i] = tn5250_shadow_viewer_new(path)) == NULL) {
+            _exit(1);
+        }
+    }
+    if (stalled && (idle = tn5250_shadow_viewer_new(path)) == NULL) {
+        _exit(1);
+    }
+    if (write(out, "", 1) != 1) {
+        _exit(1);
+    }
+    for (;;) {
+        FD_ZERO(&fdr);
+        FD_SET(in, &fdr);
+        sm = in + 1;
+        for (i = 0; i < viewers; i++) {
+            if (v[i] != NULL) {
+                fd = tn5250_shadow_viewer_fd(v[i]);
+                FD_SET(fd, &fdr);
+                sm = fd + 1 > sm ? fd + 1 : sm;
+            }
+        }
+        if (select(sm, &fdr, NULL, NULL, NULL) <= 0) {
+            continue;
+        }
+        if (FD_ISSET(in, &fdr) && read(in, &c, 1) <= 0) {
+            break;
+        }
+        for (i = 0; i < viewers; i++) {
+            if (v[i] != NULL && FD_ISSET(tn5250_shadow_viewer_fd(v[i]), &fdr) &&
+                tn5250_shadow_viewer_read(v[i]) < 0) {
+                tn5250_shadow_viewer_destroy(v[i]);
+                v[i] = NULL;
+            }
+        }
+    }
+    for (i = 0; i < viewers; i++) {
+        if (v[i] != NULL) {
+            tn5250_shadow_viewer_destroy(v[i]);
+        }
+    }
+    if (idle != NULL) {
+        tn5250_shadow_viewer_destroy(idle);
+    }
+    free(v);
+    _exit(0);
+}
+
+/*
+ *    Time the updates with this many observers.
+ */
+static void bench_run(const char* path, int viewers, int stalled,
+                      int updates) {
+    Tn5250Display* display;
+    Tn5250DBuffer* dbuffer;
+    Tn5250Shadow* shadow;
+    unsigned char* data;
+    double start, us;
+    pid_t pid;
+    int ready[2], done[2];
+    char c;
+    int i, n, pos, status;
+
+    if ((shadow = tn5250_shadow_new(path)) == NULL) {
+        fprintf(stderr, "can't shadow sessions here\n");
+        exit(1);
+    }
+    if (pipe(ready) < 0 || pipe(done) < 0 || (pid = fork()) < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (pid == 0) {
+        close(ready[0]);
+        close(done[1]);
+        bench_child(path, viewers, stalled, done[0], ready[1]);
+    }
+    close(ready[1]);
+    close(done[0]);
+    if (read(ready[0], &c, 1) != 1) {
+        fprintf(stderr, "the observers couldn't connect\n");
+        exit(1);
+    }
+    close(ready[0]);
+    while (tn5250_shadow_observers(shadow) < viewers + stalled) {
+        usleep(1000);
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    display->shadow = shadow;
+    dbuffer = tn5250_display_dbuffer(display);
+    start = bench_now();
+    for (i = 0; i < updates; i++) {
+        for (n = 0; n < 1 + i % 3; n++) {
+            pos = (i * 7919 + n * 104729) % (dbuffer->w * dbuffer->h);
+            data = tn5250_dbuffer_writable_data(dbuffer, pos / dbuffer->w,
+                                                pos / dbuffer->w);
+            data[pos] = (unsigned char)(0xc1 + (i + n) % 9);
+        }
+        tn5250_display_update(display);
+    }
+    us = (bench_now() - start) / updates;
+    fprintf(stderr, "%3d observers%s %.2f us (%lu resyncs)\n", viewers,
+            stalled ? " + 1 stalled:" : ":           ", us,
+            tn5250_shadow_resyncs(shadow));
+    tn5250_display_destroy(display);
+    close(done[1]);
+    waitpid(pid, &status, 0);
+}
+
+int main(int argc, char* argv[]) {
+    static const int viewers[] = {0, 10, 100};
+    char dir[] = "/tmp/shadowbenchXXXXXX";
+    char path[64];
+    int updates, i;
+
+    updates = argc > 1 ? atoi(argv[1]) : 20000;
+    if (updates <= 0) {
+        fprintf(stderr, "usage: shadowbench [updates]\n");
+        return 2;
+    }
+    if (mkdtemp(dir) == NULL) {
+        perror(dir);
+        return 1;
+    }
+    sprintf(path, "%s/socket", dir);
+
+    for (i = 0; i < (int)(sizeof(viewers) / sizeof(viewers[0])); i++) {
+        bench_run(path, viewers[i], 0, updates);
+        bench_run(path, viewers[i], 1, updates);
+    }
+    rmdir(dir);
+    return 0;
+}
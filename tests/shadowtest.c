@@ -0,0 +1,336 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* shadowtest -- Watch a session over a shadow socket.
+ *
+ * A child process connects ten viewers and one which doesn't read until
+ * the session has finished.  The session then makes a run of updates,
+ * each changing a few cells in the top four rows, the cursor and
+ * sometimes the indicators, with a full repaint every 500.  The stalled
+ * viewer can only see the last repaint if it is sent the whole screen
+ * again, since the deltas it was waiting for are long gone.  Part of
+ * the screen is a nondisplay field.  Once the session sends the child
+ * the final screen, every viewer, the stalled one included, must end on
+ * exactly that screen, with the nondisplay field blanked.  The socket
+ * must only be open to its owner, and a file which isn't a socket must
+ * not be replaced.
+ *
+ * Exits with 77, which "make check" counts as skipped, if this platform
+ * can't shadow sessions.
+ *
+ * Usage: shadowtest [updates [seed]]
+ */
+#include "testutil.h"
+
+#include <sys/stat.h>
+
+#define TEST_W       80
+#define TEST_H       24
+#define TEST_SIZE    (TEST_W * TEST_H)
+#define TEST_VIEWERS 10
+#define TEST_LIMIT   20000 /* Longest the viewers may take to catch up, ms */
+#define TEST_SKIP    77
+
+/* What every viewer should end up showing. */
+typedef struct {
+    unsigned char data[TEST_SIZE];
+    int cursor;
+    unsigned long indicators;
+} TestScreen;
+
+static int test_attribute(int pos);
+static void test_edit(Tn5250Display* display, int serial);
+static int test_same(Tn5250ShadowViewer* viewer, TestScreen* want);
+static int test_child(const char* path, int in, int out);
+
+/*
+ *    The attribute at ``pos'', or 0 if it isn't one.  Row 21 holds a
+ *    nondisplay field.
+ */
+static int test_attribute(int pos) {
+    switch (pos) {
+    case 20 * TEST_W + 10:
+        return 0x27;
+    case 20 * TEST_W + 30:
+        return 0x20;
+    }
+    return 0;
+}
+
+/*
+ *    Make the changes for update ``serial''.
+ */
+static void test_edit(Tn5250Display* display, int serial) {
+    Tn5250DBuffer* dbuffer = tn5250_display_dbuffer(display);
+    unsigned char* data;
+    int i, n, pos;
+
+    data = tn5250_dbuffer_writable_data(dbuffer, 0, TEST_H - 1);
+    if (serial % 500 == 0) {
+        for (pos = 0; pos < TEST_SIZE; pos++) {
+            data[pos] = (unsigned char)(0x40 + test_rand(0xbf));
+        }
+    }
+    n = 1 + test_rand(3);
+    for (i = 0; i < n; i++) {
+        data[test_rand(4 * TEST_W)] = (unsigned char)(0x40 + test_rand(0xbf));
+    }
+    for (pos = 0; pos < TEST_SIZE; pos++) {
+        if (test_attribute(pos) != 0) {
+            data[pos] = (unsigned char)test_attribute(pos);
+        }
+    }
+    tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H), test_rand(TEST_W));
+    if (test_rand(20) == 0) {
+        display->indicators = test_rand(0x40);
+    }
+}
+
+/*
+ *    Does the viewer show the screen we want?
+ */
+static int test_same(Tn5250ShadowViewer* viewer, TestScreen* want) {
+    Tn5250DBuffer* dbuffer = tn5250_shadow_viewer_dbuffer(viewer);
+
+    return dbuffer->w == TEST_W && dbuffer->h == TEST_H &&
+           memcmp(dbuffer->data, want->data, TEST_SIZE) == 0 &&
+           dbuffer->cy * TEST_W + dbuffer->cx == want->cursor &&
+           tn5250_shadow_viewer_indicators(viewer) == want->indicators;
+}
+
+/*
+ *    Connect the viewers, say so on ``out'', and keep them reading until
+ *    the final screen has come in on ``in'' and they all show it.  The
+ *    last viewer doesn't read until then.  Returns the number of viewers
+ *    which don't show it.
+ */
+static int test_child(const char* path, int in, int out) {
+    Tn5250ShadowViewer* viewers[TEST_VIEWERS + 1];
+    TestScreen want;
+    unsigned char done[TEST_VIEWERS + 1];
+    unsigned long start = 0;
+    fd_set fdr;
+    struct timeval tv;
+    long got = 0;
+    int i, n, fd, sm, left;
+
+    for (i = 0; i <= TEST_VIEWERS; i++) {
+        if ((viewers[i] = tn5250_shadow_viewer_new(path)) == NULL) {
+            return TEST_VIEWERS + 1;
+        }
+    }
+    if (write(out, "", 1) != 1) {
+        return TEST_VIEWERS + 1;
+    }
+    memset(done, 0, sizeof(done));
+    left = TEST_VIEWERS + 1;
+
+    while (left > 0) {
+        if (got == (long)sizeof(want) &&
+            tn5250_msec_since(start) > TEST_LIMIT) {
+            break;
+        }
+        FD_ZERO(&fdr);
+        sm = 0;
+        if (got < (long)sizeof(want)) {
+            FD_SET(in, &fdr);
+            sm = in + 1;
+        }
+        for (i = 0; i <= TEST_VIEWERS; i++) {
+            if (done[i] || (i == TEST_VIEWERS && got < (long)sizeof(want))) {
+                continue;
+            }
+            fd = tn5250_shadow_viewer_fd(viewers[i]);
+            FD_SET(fd, &fdr);
+            if (fd + 1 > sm) {
+                sm = fd + 1;
+            }
+        }
+        tv.tv_sec = 0;
+        tv.tv_usec = 100000;
+        if (select(sm, &fdr, NULL, NULL, &tv) <= 0) {
+            continue;
+        }
+        if (got < (long)sizeof(want) && FD_ISSET(in, &fdr)) {
+            if ((n = read(in, (char*)&want + got, sizeof(want) - got)) <= 0) {
+                break;
+            }
+            if ((got += n) == (long)sizeof(want)) {
+                start = tn5250_msec_now();
+            }
+        }
+        for (i = 0; i <= TEST_VIEWERS; i++) {
+            if (done[i] || (i == TEST_VIEWERS && got < (long)sizeof(want)) ||
+                !FD_ISSET(tn5250_shadow_viewer_fd(viewers[i]), &fdr)) {
+                continue;
+            }
+            if (tn5250_shadow_viewer_read(viewers[i]) < 0) {
+                done[i] = 1;
+                continue;
+            }
+            if (got == (long)sizeof(want) && test_same(viewers[i], &want)) {
+                done[i] = 1;
+                left--;
+            }
+        }
+        /* Viewers which were already up to date when the screen came. */
+        for (i = 0; i < TEST_VIEWERS && got == (long)sizeof(want); i++) {
+            if (!done[i] && test_same(viewers[i], &want)) {
+                done[i] = 1;
+                left--;
+            }
+        }
+    }
+    for (i = 0; i <= TEST_VIEWERS; i++) {
+        tn5250_shadow_viewer_destroy(viewers[i]);
+    }
+    return left;
+}
+
+int main(int argc, char* argv[]) {
+    char dir[] = "/tmp/shadowtestXXXXXX";
+    char path[64], file[64];
+    Tn5250Display* display;
+    Tn5250DBuffer* dbuffer;
+    Tn5250Shadow* shadow;
+    TestScreen want;
+    struct stat st;
+    unsigned long start;
+    long took;
+    pid_t pid;
+    char c;
+    int to_child[2], from_child[2];
+    int updates, i, fd, status;
+    int failed = 0;
+
+    updates = argc > 1 ? atoi(argv[1]) : 20000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (updates <= 0) {
+        fprintf(stderr, "usage: shadowtest [updates [seed]]\n");
+        return 2;
+    }
+    if (mkdtemp(dir) == NULL) {
+        perror(dir);
+        return 1;
+    }
+    sprintf(path, "%s/socket", dir);
+    sprintf(file, "%s/file", dir);
+
+    /* A file which isn't a socket is left alone. */
+    if ((fd = open(file, O_CREAT | O_WRONLY, 0600)) >= 0) {
+        close(fd);
+    }
+    if ((shadow = tn5250_shadow_new(file)) != NULL) {
+        printf("a shadow was started over a plain file\n");
+        tn5250_shadow_destroy(shadow);
+        failed++;
+    }
+    if (lstat(file, &st) < 0 || !S_ISREG(st.st_mode)) {
+        printf("the plain file was removed\n");
+        failed++;
+    }
+    unlink(file);
+
+    if ((shadow = tn5250_shadow_new(path)) == NULL) {
+        printf("can't shadow sessions here, skipped\n");
+        rmdir(dir);
+        return TEST_SKIP;
+    }
+    if (lstat(path, &st) < 0 || !S_ISSOCK(st.st_mode) ||
+        (st.st_mode & 077) != 0) {
+        printf("the socket isn't private to its owner\n");
+        failed++;
+    }
+
+    if (pipe(to_child) < 0 || pipe(from_child) < 0) {
+        perror("pipe");
+        return 1;
+    }
+    if ((pid = fork()) < 0) {
+        perror("fork");
+        return 1;
+    }
+    if (pid == 0) {
+        close(to_child[1]);
+        close(from_child[0]);
+        _exit(test_child(path, to_child[0], from_child[1]));
+    }
+    close(to_child[0]);
+    close(from_child[1]);
+
+    /* Wait for the child to connect and the shadow to take it on. */
+    if (read(from_child[0], &c, 1) != 1) {
+        printf("the viewers couldn't connect\n");
+        failed++;
+    }
+    start = tn5250_msec_now();
+    while (tn5250_shadow_observers(shadow) < TEST_VIEWERS + 1 &&
+           tn5250_msec_since(start) < 5000) {
+        usleep(1000);
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    start = tn5250_msec_now();
+    for (i = 0; i < updates; i++) {
+        test_edit(display, i);
+        tn5250_shadow_frame(shadow, display);
+    }
+    took = tn5250_msec_since(start);
+
+    dbuffer = tn5250_display_dbuffer(display);
+    memcpy(want.data, dbuffer->data, TEST_SIZE);
+    for (i = 20 * TEST_W + 11; i < 20 * TEST_W + 30; i++) {
+        want.data[i] = 0x00;
+    }
+    want.cursor = dbuffer->cy * TEST_W + dbuffer->cx;
+    want.indicators = (unsigned long)display->indicators;
+    if (write(to_child[1], &want, sizeof(want)) != (long)sizeof(want)) {
+        perror("write");
+    }
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        printf("%d of %d viewers didn't end on the session's screen\n",
+               WIFEXITED(status) ? WEXITSTATUS(status) : -1,
+               TEST_VIEWERS + 1);
+        failed++;
+    }
+    printf("%d updates, %lu deltas sent, %lu resyncs, %.2f us per update\n",
+           updates, tn5250_shadow_broadcasts(shadow),
+           tn5250_shadow_resyncs(shadow), took * 1000.0 / updates);
+
+    tn5250_shadow_destroy(shadow);
+    tn5250_display_destroy(display);
+    if (lstat(path, &st) == 0) {
+        printf("the socket was left behind\n");
+        unlink(path);
+        failed++;
+    }
+    rmdir(dir);
+    close(to_child[1]);
+    close(from_child[0]);
+
+    printf("%d checks failed\n", failed);
+    return failed != 0;
+}
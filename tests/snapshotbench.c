@@ -0,0 +1,83 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* snapshotbench -- Time screen snapshots against buffer copies.
+ *
+ * On a 24x80 display buffer with 40 fields, makes a one-cell edit and
+ * then takes and releases a snapshot, and then does the same with
+ * tn5250_dbuffer_copy in place of the snapshot.
+ *
+ * Usage: snapshotbench [edits]
+ */
+#include "tn5250-private.h"
+
+#include <time.h>
+
+static double bench_us(clock_t start, int n);
+
+/*
+ *    CPU time since start, in microseconds for each of n runs.
+ */
+static double bench_us(clock_t start, int n) {
+    return (clock() - start) * 1e6 / CLOCKS_PER_SEC / n;
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250DBuffer* dbuffer;
+    Tn5250Field* field;
+    clock_t start;
+    int edits, i;
+
+    edits = argc > 1 ? atoi(argv[1]) : 200000;
+    if (edits <= 0) {
+        fprintf(stderr, "usage: snapshotbench [edits]\n");
+        return 2;
+    }
+
+    dbuffer = tn5250_dbuffer_new(80, 24);
+    for (i = 0; i < 40; i++) {
+        field = tn5250_field_new(80);
+        field->start_row = i % 24;
+        field->start_col = (i / 24) * 40 + 1;
+        field->length = 20;
+        tn5250_dbuffer_add_field(dbuffer, field);
+    }
+
+    start = clock();
+    for (i = 0; i < edits; i++) {
+        tn5250_dbuffer_cursor_set(dbuffer, i % 24, i % 80);
+        tn5250_dbuffer_addch(dbuffer, 0xc1);
+        tn5250_snapshot_unref(tn5250_snapshot_new(dbuffer));
+    }
+    fprintf(stderr, "edit and snapshot: %.2f us\n", bench_us(start, edits));
+
+    start = clock();
+    for (i = 0; i < edits; i++) {
+        tn5250_dbuffer_cursor_set(dbuffer, i % 24, i % 80);
+        tn5250_dbuffer_addch(dbuffer, 0xc1);
+        tn5250_dbuffer_destroy(tn5250_dbuffer_copy(dbuffer));
+    }
+    fprintf(stderr, "edit and copy:     %.2f us\n", bench_us(start, edits));
+
+    tn5250_dbuffer_destroy(dbuffer);
+    return 0;
+}
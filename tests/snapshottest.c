@@ -0,0 +1,233 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* snapshottest -- Check screen snapshots.
+ *
+ * Makes random one-cell edits to a display buffer with 40 fields and
+ * takes a snapshot after each.  Every snapshot must match the buffer,
+ * share the rows that did not change with the one before, and stay the
+ * same while a second thread reads and releases it and the buffer goes
+ * on changing.  Without threads the snapshots are checked and released
+ * one at a time.
+ *
+ * Usage: snapshottest [edits]
+ */
+#include "testutil.h"
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+#define TEST_THREADS 1
+#endif
+
+#define TEST_W     80
+#define TEST_H     24
+#define TEST_QUEUE 64
+
+
+static unsigned long test_sum(Tn5250Snapshot* snap);
+static int test_same(Tn5250Snapshot* snap, Tn5250DBuffer* dbuffer);
+static int test_sharing(Tn5250DBuffer* dbuffer);
+
+#ifdef TEST_THREADS
+/* Snapshots on their way to the reader, with the sum each had when it
+ * was taken. */
+static Tn5250Snapshot* test_queue[TEST_QUEUE];
+static unsigned long test_sums[TEST_QUEUE];
+static int test_head = 0, test_tail = 0, test_done = 0;
+static pthread_mutex_t test_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t test_cond = PTHREAD_COND_INITIALIZER;
+
+static void* test_reader(void* arg);
+#endif
+
+/*
+ *    A checksum over every cell and the cursor.
+ */
+static unsigned long test_sum(Tn5250Snapshot* snap) {
+    unsigned long sum;
+    int y, x;
+
+    sum = tn5250_snapshot_cursor_y(snap) * 256 + tn5250_snapshot_cursor_x(snap);
+    for (y = 0; y < tn5250_snapshot_height(snap); y++) {
+        for (x = 0; x < tn5250_snapshot_width(snap); x++) {
+            sum = (sum * 31 + tn5250_snapshot_char_at(snap, y, x)) &
+                  0xffffffffUL;
+        }
+    }
+    return sum;
+}
+
+/*
+ *    Does the snapshot hold what the buffer holds?  Only characters are
+ *    ever written, so no cell is hidden by a nondisplay attribute.
+ */
+static int test_same(Tn5250Snapshot* snap, Tn5250DBuffer* dbuffer) {
+    int y;
+
+    if (tn5250_snapshot_cursor_y(snap) != tn5250_dbuffer_cursor_y(dbuffer) ||
+        tn5250_snapshot_cursor_x(snap) != tn5250_dbuffer_cursor_x(dbuffer)) {
+        printf("the cursor differs\n");
+        return 0;
+    }
+    for (y = 0; y < TEST_H; y++) {
+        if (memcmp(tn5250_snapshot_row(snap, y), dbuffer->data + y * TEST_W,
+                   TEST_W) != 0) {
+            printf("row %d differs\n", y);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    A snapshot after a one-cell edit shares every other row with the
+ *    one before, and a snapshot with no edit in between is the same one.
+ */
+static int test_sharing(Tn5250DBuffer* dbuffer) {
+    Tn5250Snapshot *a, *b, *c;
+    int y, ok = 1;
+
+    a = tn5250_snapshot_new(dbuffer);
+    tn5250_dbuffer_cursor_set(dbuffer, 3, 3);
+    tn5250_dbuffer_addch(dbuffer, 0xc1);
+    b = tn5250_snapshot_new(dbuffer);
+    c = tn5250_snapshot_new(dbuffer);
+    for (y = 0; y < TEST_H; y++) {
+        if ((a->rows[y] == b->rows[y]) != (y != 3)) {
+            printf("row %d is %s\n", y, y == 3 ? "shared" : "not shared");
+            ok = 0;
+        }
+    }
+    if (c != b) {
+        printf("a second snapshot with no edit is a new one\n");
+        ok = 0;
+    }
+    tn5250_snapshot_unref(c);
+    tn5250_snapshot_unref(b);
+    tn5250_snapshot_unref(a);
+    return ok;
+}
+
+#ifdef TEST_THREADS
+/*
+ *    Take snapshots off the queue, check that each still has the sum it
+ *    was queued with and release it.  Returns the number that did not.
+ */
+static void* test_reader(void* arg) {
+    Tn5250Snapshot* snap;
+    unsigned long sum;
+    long* bad = (long*)arg;
+
+    pthread_mutex_lock(&test_lock);
+    for (;;) {
+        while (test_tail == test_head && !test_done) {
+            pthread_cond_wait(&test_cond, &test_lock);
+        }
+        if (test_tail == test_head) {
+            break;
+        }
+        snap = test_queue[test_tail % TEST_QUEUE];
+        sum = test_sums[test_tail % TEST_QUEUE];
+        test_tail++;
+        pthread_cond_broadcast(&test_cond);
+        pthread_mutex_unlock(&test_lock);
+
+        if (test_sum(snap) != sum) {
+            (*bad)++;
+        }
+        tn5250_snapshot_unref(snap);
+        pthread_mutex_lock(&test_lock);
+    }
+    pthread_mutex_unlock(&test_lock);
+    return NULL;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    Tn5250DBuffer* dbuffer;
+    Tn5250Field* field;
+    Tn5250Snapshot* snap;
+    int edits, i;
+    int failed = 0;
+    long bad = 0;
+#ifdef TEST_THREADS
+    pthread_t reader;
+#endif
+
+    edits = argc > 1 ? atoi(argv[1]) : 20000;
+    if (edits <= 0) {
+        fprintf(stderr, "usage: snapshottest [edits]\n");
+        return 2;
+    }
+
+    dbuffer = tn5250_dbuffer_new(TEST_W, TEST_H);
+    for (i = 0; i < 40; i++) {
+        field = tn5250_field_new(TEST_W);
+        field->start_row = i % TEST_H;
+        field->start_col = (i / TEST_H) * 40 + 1;
+        field->length = 20;
+        tn5250_dbuffer_add_field(dbuffer, field);
+    }
+
+    if (!test_sharing(dbuffer)) {
+        failed++;
+    }
+
+#ifdef TEST_THREADS
+    pthread_create(&reader, NULL, test_reader, &bad);
+#endif
+    for (i = 0; i < edits; i++) {
+        tn5250_dbuffer_cursor_set(dbuffer, test_rand(TEST_H),
+                                  test_rand(TEST_W));
+        tn5250_dbuffer_addch(dbuffer, (unsigned char)(0x40 + test_rand(0xc0)));
+        snap = tn5250_snapshot_new(dbuffer);
+        if (!test_same(snap, dbuffer) && ++failed <= 3) {
+            printf("  (edit %d)\n", i);
+        }
+
+#ifdef TEST_THREADS
+        pthread_mutex_lock(&test_lock);
+        while (test_head - test_tail >= TEST_QUEUE) {
+            pthread_cond_wait(&test_cond, &test_lock);
+        }
+        test_queue[test_head % TEST_QUEUE] = snap;
+        test_sums[test_head % TEST_QUEUE] = test_sum(snap);
+        test_head++;
+        pthread_cond_broadcast(&test_cond);
+        pthread_mutex_unlock(&test_lock);
+#else
+        tn5250_snapshot_unref(snap);
+#endif
+    }
+#ifdef TEST_THREADS
+    pthread_mutex_lock(&test_lock);
+    test_done = 1;
+    pthread_cond_broadcast(&test_cond);
+    pthread_mutex_unlock(&test_lock);
+    pthread_join(reader, NULL);
+#endif
+
+    printf("%d snapshots, %d checks failed, %ld changed while read\n", edits,
+           failed, bad);
+    tn5250_dbuffer_destroy(dbuffer);
+    return failed != 0 || bad != 0;
+}
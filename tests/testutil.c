@@ -0,0 +1,69 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* testutil -- What the tests have in common. */
+#include "testutil.h"
+
+unsigned long test_seed = 1;
+
+/*
+ *    A random number from 0 to n - 1.
+ */
+int test_rand(int n) {
+    test_seed = (test_seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+    return (int)((test_seed >> 8) % (unsigned long)n);
+}
+
+/*
+ *    Add a field of 1 to maxlen positions at a random place, with the
+ *    given FFW and attribute.  The field and the attributes before and
+ *    after it must not touch any field already in the format table, and
+ *    the field never ends in the last position.  Returns the new field,
+ *    or NULL (having added nothing) if the place chosen was taken.
+ */
+Tn5250Field* test_random_field(Tn5250DBuffer* dbuffer, int maxlen,
+                               int ffw, int attribute) {
+    int w = tn5250_dbuffer_width(dbuffer);
+    int size = w * tn5250_dbuffer_height(dbuffer);
+    Tn5250Field* field;
+    int start, len, i, other;
+
+    start = 1 + test_rand(size - maxlen - 2);
+    len = 1 + test_rand(maxlen);
+    for (i = 0; i < dbuffer->field_count; i++) {
+        field = dbuffer->field_table[i];
+        other = tn5250_field_start_pos(field);
+        if (start - 1 <= other + field->length &&
+            other - 1 <= start + len) {
+            return NULL;
+        }
+    }
+
+    field = tn5250_field_new(w);
+    field->start_row = start / w;
+    field->start_col = start % w;
+    field->length = len;
+    field->FFW = ffw;
+    field->attribute = attribute;
+    tn5250_dbuffer_add_field(dbuffer, field);
+    return field;
+}
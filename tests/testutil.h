@@ -0,0 +1,40 @@
+#ifndef TESTUTIL_H
+#define TESTUTIL_H
+
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* testutil -- What the tests have in common.
+ *
+ * The tests make their cases from test_rand, not rand(), so that a seed
+ * gives the same cases on every platform.  Each test sets test_seed from
+ * its command line before making any.
+ */
+#include "tn5250-private.h"
+
+extern unsigned long test_seed;
+
+extern int test_rand(int n);
+extern Tn5250Field* test_random_field(Tn5250DBuffer* dbuffer, int maxlen,
+                                      int ffw, int attribute);
+
+#endif /* TESTUTIL_H */
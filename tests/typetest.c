@@ -0,0 +1,302 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* typetest -- Check that typing a run of keys matches typing them singly.
+ *
+ * Builds two identical headless displays over random field layouts and
+ * types the same random keys into both: one key at a time through
+ * tn5250_display_do_key into the first, and as runs through
+ * tn5250_display_do_text into the second.  Whenever the keyboard stops
+ * being unlocked both are unlocked again and typing carries on.  The
+ * two must agree at every step on how many keys were taken, the screen,
+ * the cursor, the keyboard state, the indicators, the modified data
+ * tags and what was sent to the host.
+ *
+ * Usage: typetest [layouts [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_W    80
+#define TEST_H    24
+#define TEST_SIZE (TEST_W * TEST_H)
+#define TEST_KEYS 80
+
+static Tn5250Stream* test_streams[2];
+static unsigned long test_sent[2];
+
+static int test_key(void);
+static void test_fields(Tn5250Display* display, unsigned long seed);
+static Tn5250Display* test_display(int n, unsigned long seed);
+static int test_single(Tn5250Display* display, const int* keys, int count);
+static void test_unlock(Tn5250Display* display);
+static int test_same(Tn5250Display* a, Tn5250Display* b, int verbose);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+
+/*
+ *    A random key: mostly characters, some of them not valid in every
+ *    kind of field, and now and then a key that moves, edits or sends.
+ */
+static int test_key(void) {
+    static const char chars[] = " aBz09-+,.";
+    static const int specials[] = {K_FIELDEXIT, K_TAB,      K_BACKSPACE,
+                                   K_FIELDMINUS, K_FIELDPLUS, K_INSERT,
+                                   K_DELETE,     K_DUPLICATE, K_ENTER};
+
+    if (test_rand(10) != 0) {
+        return chars[test_rand(sizeof(chars) - 1)];
+    }
+    return specials[test_rand(sizeof(specials) / sizeof(specials[0]))];
+}
+
+/*
+ *    Add up to 12 random fields which don't overlap.  The layout only
+ *    depends on ``seed'', so two displays can be given the same one.
+ */
+static void test_fields(Tn5250Display* display, unsigned long seed) {
+    static const int types[] = {
+        TN5250_FIELD_ALPHA_SHIFT, TN5250_FIELD_ALPHA_ONLY,
+        TN5250_FIELD_NUM_SHIFT,   TN5250_FIELD_NUM_ONLY,
+        TN5250_FIELD_DIGIT_ONLY,  TN5250_FIELD_SIGNED_NUM};
+    unsigned long saved = test_seed;
+    int n, ffw;
+
+    test_seed = seed;
+    n = 1 + test_rand(12);
+    while (n-- > 0) {
+        ffw = 0x4000 | types[test_rand(sizeof(types) / sizeof(int))];
+        if (test_rand(8) == 0) {
+            ffw |= TN5250_FIELD_BYPASS;
+        }
+        if (test_rand(4) == 0) {
+            ffw |= TN5250_FIELD_MONOCASE;
+        }
+        if (test_rand(8) == 0) {
+            ffw |= TN5250_FIELD_AUTO_ENTER;
+        }
+        if (test_rand(8) == 0) {
+            ffw |= TN5250_FIELD_FER;
+        }
+        if (test_rand(8) == 0) {
+            ffw |= TN5250_FIELD_DUP_ENABLE;
+        }
+        if (test_rand(8) == 0) {
+            ffw |= TN5250_FIELD_RIGHT_ZERO + test_rand(2);
+        }
+        test_random_field(tn5250_display_dbuffer(display), 30, ffw, 0x20);
+    }
+    test_seed = saved;
+}
+
+/*
+ *    A display with a headless terminal, a session and a stream which
+ *    records what is sent, as test_streams[n], and the fields for
+ *    ``seed''.
+ */
+static Tn5250Display* test_display(int n, unsigned long seed) {
+    Tn5250Display* display;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    tn5250_display_set_terminal(display, tn5250_headless_terminal_new());
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+    test_streams[n] = stream;
+    test_sent[n] = TN5250_DBUFFER_HASH_BASIS;
+
+    test_fields(display, seed);
+    display->keystate = TN5250_KEYSTATE_UNLOCKED;
+    tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_INHIBIT |
+                                                TN5250_DISPLAY_IND_X_SYSTEM);
+    tn5250_display_set_cursor_home(display);
+    return display;
+}
+
+/*
+ *    Type keys one at a time, stopping as tn5250_display_do_text does
+ *    when the keyboard is no longer unlocked.
+ */
+static int test_single(Tn5250Display* display, const int* keys, int count) {
+    int i = 0;
+
+    while (i < count) {
+        tn5250_display_do_key(display, keys[i++]);
+        if (display->keystate != TN5250_KEYSTATE_UNLOCKED) {
+            break;
+        }
+    }
+    return i;
+}
+
+/*
+ *    Get the keyboard unlocked again: reset an error, or play the host
+ *    answering an aid key.
+ */
+static void test_unlock(Tn5250Display* display) {
+    if (display->keystate == TN5250_KEYSTATE_LOCKED) {
+        display->keystate = TN5250_KEYSTATE_UNLOCKED;
+        tn5250_display_indicator_clear(display, TN5250_DISPLAY_IND_X_SYSTEM);
+    }
+    else {
+        tn5250_display_do_key(display, K_RESET);
+    }
+}
+
+/*
+ *    Are the two displays in the same state?
+ */
+static int test_same(Tn5250Display* a, Tn5250Display* b, int verbose) {
+    Tn5250DBuffer* da = tn5250_display_dbuffer(a);
+    Tn5250DBuffer* db = tn5250_display_dbuffer(b);
+    int i;
+
+    if (memcmp(da->data, db->data, TEST_SIZE) != 0) {
+        if (verbose) {
+            printf("the screens differ\n");
+        }
+        return 0;
+    }
+    if (tn5250_display_cursor_x(a) != tn5250_display_cursor_x(b) ||
+        tn5250_display_cursor_y(a) != tn5250_display_cursor_y(b)) {
+        if (verbose) {
+            printf("cursor %d,%d against %d,%d\n", tn5250_display_cursor_y(a),
+                   tn5250_display_cursor_x(a), tn5250_display_cursor_y(b),
+                   tn5250_display_cursor_x(b));
+        }
+        return 0;
+    }
+    if (a->keystate != b->keystate || a->keySRC != b->keySRC ||
+        a->indicators != b->indicators) {
+        if (verbose) {
+            printf("keystate %d/%d, SRC %d/%d, indicators %04X/%04X\n",
+                   a->keystate, b->keystate, a->keySRC, b->keySRC,
+                   a->indicators, b->indicators);
+        }
+        return 0;
+    }
+    if (da->master_mdt != db->master_mdt) {
+        if (verbose) {
+            printf("master MDT %d/%d\n", da->master_mdt, db->master_mdt);
+        }
+        return 0;
+    }
+    for (i = 0; i < tn5250_dbuffer_field_count(da); i++) {
+        if (da->field_table[i]->FFW != db->field_table[i]->FFW) {
+            if (verbose) {
+                printf("field %d FFW %04X/%04X\n", i, da->field_table[i]->FFW,
+                       db->field_table[i]->FFW);
+            }
+            return 0;
+        }
+    }
+    if (test_sent[0] != test_sent[1]) {
+        if (verbose) {
+            printf("different data was sent\n");
+        }
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Nothing is ever received.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    return 1;
+}
+
+/*
+ *    Hash what each display sends.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+    unsigned long* h = &test_sent[stream == test_streams[1]];
+    int i;
+
+    *h = tn5250_dbuffer_hash_byte(*h, header.h5250.opcode);
+    for (i = 0; i < length; i++) {
+        *h = tn5250_dbuffer_hash_byte(*h, data[i]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Tn5250Display *a, *b;
+    int keys[TEST_KEYS];
+    int layouts, layout, count, pos, na, nb, i;
+    int failed = 0;
+    unsigned long seed;
+
+    layouts = argc > 1 ? atoi(argv[1]) : 20000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (layouts <= 0) {
+        fprintf(stderr, "usage: typetest [layouts [seed]]\n");
+        return 2;
+    }
+
+    for (layout = 0; layout < layouts; layout++) {
+        seed = (unsigned long)test_rand(0x7fffffff);
+        a = test_display(0, seed);
+        b = test_display(1, seed);
+        count = 1 + test_rand(TEST_KEYS);
+        for (i = 0; i < count; i++) {
+            keys[i] = test_key();
+        }
+
+        for (pos = 0; pos < count; pos += na) {
+            na = test_single(a, keys + pos, count - pos);
+            nb = tn5250_display_do_text(b, keys + pos, count - pos);
+            if (na != nb || !test_same(a, b, failed < 3)) {
+                if (++failed <= 3) {
+                    printf("  (layout %d, key %d: %d keys taken against %d)\n",
+                           layout, pos, na, nb);
+                }
+                break;
+            }
+            if (a->keystate != TN5250_KEYSTATE_UNLOCKED) {
+                test_unlock(a);
+                test_unlock(b);
+            }
+        }
+
+        tn5250_session_destroy(a->session);
+        tn5250_display_destroy(a);
+        tn5250_session_destroy(b->session);
+        tn5250_display_destroy(b);
+    }
+
+    printf("%d layouts, %d differed\n", layouts, failed);
+    return failed != 0;
+}
@@ -0,0 +1,150 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* utf8test -- Check the UTF-8 translations of every character map.
+ *
+ * Every displayable EBCDIC character of every map goes to UTF-8 and
+ * back, alone and then all in one span, and must come back as the
+ * character tn5250_char_map_to_local and tn5250_char_map_to_remote give
+ * for it.  Malformed UTF-8 must become SUB, and a short destination must
+ * never get part of a character.
+ */
+#include "tn5250-private.h"
+
+#define TEST_CHARS (0x100 - 0x40)
+#define TEST_SUB   0x3f           /* EBCDIC SUB */
+#define TEST_FFFD  "\xef\xbf\xbd" /* U+FFFD in UTF-8 */
+
+static int test_map(const Tn5250CharMap* map);
+static int test_malformed(void);
+static int test_short(void);
+
+/*
+ *    Round trip one map, a character at a time and all at once.  Bytes
+ *    the map's local character set leaves undefined go out as U+FFFD and
+ *    come back as SUB.
+ */
+static int test_map(const Tn5250CharMap* map) {
+    Tn5250Char src[TEST_CHARS], back[TEST_CHARS * TN5250_UTF8_MAX];
+    Tn5250Char want[TEST_CHARS];
+    char utf8[TEST_CHARS * TN5250_UTF8_MAX];
+    int i, n;
+
+    for (i = 0; i < TEST_CHARS; i++) {
+        src[i] = (Tn5250Char)(0x40 + i);
+        n = tn5250_char_map_to_utf8_n(map, utf8, TN5250_UTF8_MAX, src + i, 1);
+        if (n == 3 && memcmp(utf8, TEST_FFFD, 3) == 0) {
+            want[i] = TEST_SUB;
+        }
+        else {
+            want[i] = tn5250_char_map_to_remote(
+                map, tn5250_char_map_to_local(map, src[i]));
+        }
+        if (n < 1 || tn5250_char_map_from_utf8_n(map, back, utf8, n) != 1 ||
+            back[0] != want[i]) {
+            printf("%s: %02X came back as %02X\n", map->name, src[i],
+                   back[0]);
+            return 0;
+        }
+    }
+
+    n = tn5250_char_map_to_utf8_n(map, utf8, sizeof(utf8), src, TEST_CHARS);
+    if (tn5250_char_map_from_utf8_n(map, back, utf8, n) != TEST_CHARS ||
+        memcmp(back, want, sizeof(want)) != 0) {
+        printf("%s: the whole span did not come back\n", map->name);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ *    Bad sequences each turn into SUB.
+ */
+static int test_malformed(void) {
+    /* A stray continuation byte, an overlong NUL, a truncated euro sign
+     * and a byte which never appears in UTF-8, each followed by 'z'. */
+    static const char bad[] = "\x80z\xc0\x80z\xe2\x82z\xffz";
+    const Tn5250CharMap* map = tn5250_char_map_new("37");
+    Tn5250Char out[sizeof(bad)];
+    int n, i;
+
+    n = tn5250_char_map_from_utf8_n(map, out, bad, sizeof(bad) - 1);
+    if (n != 8) {
+        printf("malformed: %d characters, wanted 8\n", n);
+        return 0;
+    }
+    for (i = 0; i < n; i += 2) {
+        if (out[i] != TEST_SUB || out[i + 1] != 0xa9) {
+            printf("malformed: got %02X %02X at %d\n", out[i], out[i + 1], i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    A destination too short for the text gets whole characters only,
+ *    as many as fit.
+ */
+static int test_short(void) {
+    /* "A", a half width katakana and "A" again in code page 290, which
+     * take one, three and one bytes of UTF-8. */
+    static const Tn5250Char src[] = {0xc1, 0x81, 0xc1};
+    static const int fits[] = {0, 1, 1, 1, 2, 3, 3, 3};
+    const Tn5250CharMap* map = tn5250_char_map_new("290");
+    Tn5250Char back[8];
+    char utf8[8];
+    int len, n, k, i;
+
+    for (len = 0; len < (int)sizeof(utf8); len++) {
+        n = tn5250_char_map_to_utf8_n(map, utf8, len, src, 3);
+        k = n <= len ? tn5250_char_map_from_utf8_n(map, back, utf8, n) : -1;
+        for (i = 0; i < k && back[i] == src[i]; i++) {
+        }
+        if (k != fits[len] || i != k) {
+            printf("short: %d bytes of room gave %d characters, wanted %d\n",
+                   len, k, fits[len]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    const Tn5250CharMap* map;
+    int maps = 0, failed = 0;
+
+    for (map = tn5250_transmaps; map->name != NULL; map++) {
+        maps++;
+        if (!test_map(map)) {
+            failed++;
+        }
+    }
+    if (!test_malformed()) {
+        failed++;
+    }
+    if (!test_short()) {
+        failed++;
+    }
+    printf("%d maps round tripped, %d checks failed\n", maps, failed);
+    return failed != 0;
+}
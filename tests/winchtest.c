@@ -0,0 +1,257 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* winchtest -- Time 80/132 column switches in the curses terminal.
+ *
+ * The curses terminal runs in a child on a pty, as TERM=xterm, and
+ * switches between 24x80 and 27x132 a few times.  The parent plays the
+ * xterm: when it sees the resize request it waits RESIZE_DELAY ms and
+ * then sets the new size on the pty, which sends SIGWINCH.  Each switch
+ * must return from tn5250_display_update without waiting for the xterm,
+ * and the terminal must take up the new size once it has been resized.
+ * When the terminal is shut down, the SIGWINCH handler it found must be
+ * put back.
+ *
+ * Exits with 77, which "make check" counts as skipped, when there is no
+ * pty or no xterm terminfo entry.
+ */
+#define _GNU_SOURCE /* posix_openpt and friends on glibc */
+#include "tn5250-private.h"
+#include "cursesterm.h"
+
+#include <sys/ioctl.h>
+#include <termios.h>
+
+#define SWITCHES      5
+#define RESIZE_DELAY  200  /* How long the "xterm" takes to resize, ms */
+#define UPDATE_LIMIT  100  /* Longest an update may block, ms */
+#define RESIZE_LIMIT  5000 /* Longest to wait for the new size, ms */
+#define TEST_LIMIT    60000 /* Longest the whole test may take, ms */
+#define TEST_SKIP     77
+#define TEST_HANDLER  2 /* Child exit status: SIGWINCH not restored */
+
+static void test_winch(int sig);
+static void test_child(const char* slave, int out);
+static int test_parent(int master, pid_t pid, int in);
+
+/*
+ *    The SIGWINCH handler the terminal must restore.
+ */
+static void test_winch(int sig) {
+}
+
+/*
+ *    Run the terminal on the pty, and write a line for each switch to
+ *    ``out'': the width, how long the update took and how long until the
+ *    terminal had the new size, or -1 if it never did.
+ */
+static void test_child(const char* slave, int out) {
+    Tn5250Terminal* term;
+    Tn5250Display* display;
+    struct sigaction sa;
+    unsigned long t0, t1;
+    long painted;
+    char line[64];
+    int fd, i;
+
+    setsid();
+    if ((fd = open(slave, O_RDWR)) < 0) {
+        _exit(TEST_SKIP);
+    }
+#ifdef TIOCSCTTY
+    ioctl(fd, TIOCSCTTY, 0);
+#endif
+    dup2(fd, 0);
+    dup2(fd, 1);
+    dup2(fd, 2);
+    if (fd > 2) {
+        close(fd);
+    }
+    setenv("TERM", "xterm", 1);
+
+    sa.sa_handler = test_winch;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = 0;
+    sigaction(SIGWINCH, &sa, NULL);
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    term = tn5250_curses_terminal_new();
+    tn5250_terminal_init(term);
+    tn5250_display_set_terminal(display, term);
+    term->wait_limit = 50;
+
+    for (i = 0; i < SWITCHES; i++) {
+        if (i % 2 == 0) {
+            tn5250_dbuffer_set_size(tn5250_display_dbuffer(display), 27, 132);
+        }
+        else {
+            tn5250_dbuffer_set_size(tn5250_display_dbuffer(display), 24, 80);
+        }
+        t0 = tn5250_msec_now();
+        tn5250_display_update(display);
+        t1 = tn5250_msec_now();
+        while (tn5250_terminal_width(term) - 1 !=
+                   tn5250_display_width(display) &&
+               tn5250_msec_since(t0) < RESIZE_LIMIT) {
+            tn5250_terminal_waitevent(term);
+        }
+        painted = -1;
+        if (tn5250_terminal_width(term) - 1 == tn5250_display_width(display)) {
+            painted = (long)tn5250_msec_since(t0);
+        }
+        sprintf(line, "%d %lu %ld\n", tn5250_display_width(display),
+                t1 - t0, painted);
+        write(out, line, strlen(line));
+    }
+
+    tn5250_terminal_term(term);
+    sigaction(SIGWINCH, NULL, &sa);
+    _exit(sa.sa_handler == test_winch ? 0 : TEST_HANDLER);
+}
+
+/*
+ *    Be the xterm until the child has finished, then check its timings.
+ *    The parent holds the slave open too, so reads from the master never
+ *    fail while the child is starting up or going away.
+ */
+static int test_parent(int master, pid_t pid, int in) {
+    struct winsize ws;
+    unsigned long start, due = 0;
+    int pending = 0;
+    char buf[4096], results[1024];
+    char *p, *line;
+    struct timeval tv;
+    fd_set fdr;
+    int n, len, rows, cols, width, status;
+    unsigned long blocked;
+    long painted;
+    int count = 0, failed = 0, no_terminfo = 0;
+
+    memset(&ws, 0, sizeof(ws));
+    start = tn5250_msec_now();
+    while (waitpid(pid, &status, WNOHANG) != pid) {
+        if (tn5250_msec_since(start) > TEST_LIMIT) {
+            printf("the terminal hung\n");
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            return 1;
+        }
+        if (pending && tn5250_msec_until(due) <= 0) {
+            ioctl(master, TIOCSWINSZ, &ws);
+            pending = 0;
+        }
+        tv.tv_sec = 0;
+        tv.tv_usec = 10000;
+        FD_ZERO(&fdr);
+        FD_SET(master, &fdr);
+        if (select(master + 1, &fdr, NULL, NULL, &tv) <= 0 ||
+            (n = read(master, buf, sizeof(buf) - 1)) <= 0) {
+            continue;
+        }
+        buf[n] = '\0';
+        if (strstr(buf, "Error opening terminal") != NULL) {
+            no_terminfo = 1;
+        }
+        for (p = buf; (p = memchr(p, 0x1b, buf + n - p)) != NULL; p++) {
+            if (sscanf(p, "\x1b[8;%d;%dt", &rows, &cols) == 2) {
+                ws.ws_row = rows;
+                ws.ws_col = cols;
+                due = tn5250_msec_now() + RESIZE_DELAY;
+                pending = 1;
+            }
+        }
+    }
+    if (no_terminfo ||
+        (WIFEXITED(status) && WEXITSTATUS(status) == TEST_SKIP)) {
+        printf("no xterm terminfo or pty, skipped\n");
+        return TEST_SKIP;
+    }
+    if (WIFEXITED(status) && WEXITSTATUS(status) == TEST_HANDLER) {
+        printf("the SIGWINCH handler was not restored\n");
+        failed++;
+    }
+
+    len = 0;
+    while (len < (int)sizeof(results) - 1 &&
+           (n = read(in, results + len, sizeof(results) - 1 - len)) > 0) {
+        len += n;
+    }
+    results[len] = '\0';
+    for (line = strtok(results, "\n"); line != NULL;
+         line = strtok(NULL, "\n")) {
+        if (sscanf(line, "%d %lu %ld", &width, &blocked, &painted) != 3) {
+            continue;
+        }
+        count++;
+        printf("switch to %d columns: update took %lu ms, new size after "
+               "%ld ms\n",
+               width, blocked, painted);
+        if (blocked >= UPDATE_LIMIT || painted < 0) {
+            failed++;
+        }
+    }
+    if (count != SWITCHES) {
+        printf("%d of %d switches reported\n", count, SWITCHES);
+        return 1;
+    }
+    return failed != 0;
+}
+
+int main(void) {
+    struct winsize ws;
+    int master, slavefd, pipefd[2];
+    const char* slave;
+    pid_t pid;
+
+    if ((master = posix_openpt(O_RDWR | O_NOCTTY)) < 0 ||
+        grantpt(master) < 0 || unlockpt(master) < 0 ||
+        (slave = ptsname(master)) == NULL) {
+        printf("no pty, skipped\n");
+        return TEST_SKIP;
+    }
+    memset(&ws, 0, sizeof(ws));
+    ws.ws_row = 25;
+    ws.ws_col = 80;
+    ioctl(master, TIOCSWINSZ, &ws);
+
+    if ((slavefd = open(slave, O_RDWR | O_NOCTTY)) < 0) {
+        printf("can't open %s, skipped\n", slave);
+        return TEST_SKIP;
+    }
+    if (pipe(pipefd) < 0) {
+        perror("pipe");
+        return 1;
+    }
+    if ((pid = fork()) < 0) {
+        perror("fork");
+        return 1;
+    }
+    if (pid == 0) {
+        close(master);
+        close(slavefd);
+        close(pipefd[0]);
+        test_child(slave, pipefd[1]);
+    }
+    close(pipefd[1]);
+    return test_parent(master, pid, pipefd[0]);
+}
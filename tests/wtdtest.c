@@ -0,0 +1,307 @@
+/* TN5250 - An implementation of the 5250 telnet protocol.
+ * Copyright (C) 1997-2008 Michael Madore
+ *
+ * This file is part of TN5250.
+ *
+ * TN5250 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2.1, or (at your option)
+ * any later version.
+ *
+ * TN5250 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+ * Boston, MA 02111-1307 USA
+ *
+ */
+
+/* wtdtest -- Round trip differential Write to Display data.
+ *
+ * Each pass puts a random screen and format table on a display, makes a
+ * second screen from it by changing cells, fields or the whole format,
+ * and has Tn5250WTDContext write the difference.  The data goes through
+ * the session's parser to the display, which must then match the second
+ * screen cell for cell and field for field.
+ *
+ * Usage: wtdtest [passes [seed]]
+ */
+#include "testutil.h"
+
+#define TEST_W    80
+#define TEST_H    24
+#define TEST_SIZE (TEST_W * TEST_H)
+
+static Tn5250Record* test_pending = NULL;
+
+static unsigned char test_cell(void);
+static void test_put(Tn5250DBuffer* buf, int pos, unsigned char c);
+static void test_fields(Tn5250DBuffer* buf);
+static int test_edge(Tn5250DBuffer* buf, int pos);
+static void test_change(Tn5250DBuffer* dst, int mode);
+static int test_same(Tn5250DBuffer* got, Tn5250DBuffer* want, int verbose);
+static int test_receive(Tn5250Stream* stream);
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data);
+
+/*
+ *    A random screen cell: mostly nulls and blanks, some characters.
+ */
+static unsigned char test_cell(void) {
+    int r = test_rand(10);
+
+    if (r < 3) {
+        return 0x00;
+    }
+    if (r < 4) {
+        return 0x40;
+    }
+    return (unsigned char)(0x40 + test_rand(0xbf));
+}
+
+/*
+ *    Store one cell.
+ */
+static void test_put(Tn5250DBuffer* buf, int pos, unsigned char c) {
+    int y = pos / TEST_W;
+
+    tn5250_dbuffer_writable_data(buf, y, y)[pos] = c;
+}
+
+/*
+ *    Add up to 24 random fields which don't overlap, each with its
+ *    attribute before it and a blank after it, as an SF leaves them.
+ */
+static void test_fields(Tn5250DBuffer* buf) {
+    Tn5250Field* field;
+    int n, start;
+
+    n = test_rand(25);
+    while (n-- > 0) {
+        field = test_random_field(buf, 30, 0x4000 | test_rand(0x2000),
+                                  0x20 + test_rand(0x20));
+        if (field == NULL) {
+            continue;
+        }
+        if (test_rand(4) == 0) {
+            field->nextfieldprogressionid = (unsigned char)(1 + test_rand(20));
+        }
+        start = tn5250_field_start_pos(field);
+        test_put(buf, start - 1, field->attribute);
+        test_put(buf, start + field->length, 0x20);
+    }
+}
+
+/*
+ *    Is pos the attribute before a field or the cell after it?
+ */
+static int test_edge(Tn5250DBuffer* buf, int pos) {
+    Tn5250Field* field;
+    int i, start;
+
+    for (i = 0; i < tn5250_dbuffer_field_count(buf); i++) {
+        field = buf->field_table[i];
+        start = field->start_row * TEST_W + field->start_col;
+        if (pos == start - 1 || pos == start + field->length) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *    Make the destination screen.  Mode 0 builds a new format table over
+ *    a third of the cells changed; the others change some cells outside
+ *    the field edges, and modes 2 and 3 also change field formats and
+ *    attributes.
+ */
+static void test_change(Tn5250DBuffer* dst, int mode) {
+    Tn5250Field* field;
+    int i, n, pos;
+
+    if (mode == 0) {
+        tn5250_dbuffer_clear_table(dst);
+        for (i = 0; i < TEST_SIZE; i++) {
+            if (test_rand(3) == 0) {
+                test_put(dst, i, test_cell());
+            }
+        }
+        test_fields(dst);
+        return;
+    }
+
+    n = test_rand(60);
+    for (i = 0; i < n; i++) {
+        pos = test_rand(TEST_SIZE);
+        if (!test_edge(dst, pos)) {
+            test_put(dst, pos, test_cell());
+        }
+    }
+    if (mode < 2) {
+        return;
+    }
+    for (i = 0; i < tn5250_dbuffer_field_count(dst); i++) {
+        if (test_rand(3) == 0) {
+            field = dst->field_table[i];
+            field->FFW = 0x4000 | test_rand(0x2000);
+            field->attribute = (unsigned char)(0x20 + test_rand(0x20));
+            test_put(dst, field->start_row * TEST_W + field->start_col - 1,
+                     field->attribute);
+        }
+    }
+}
+
+/*
+ *    Does the display hold the screen we meant to send?
+ */
+static int test_same(Tn5250DBuffer* got, Tn5250DBuffer* want, int verbose) {
+    const unsigned char* a = got->data;
+    const unsigned char* b = want->data;
+    Tn5250Field *f, *g;
+    int i;
+
+    for (i = 0; i < TEST_SIZE; i++) {
+        if (a[i] != b[i]) {
+            if (verbose) {
+                printf("cell %d,%d: got %02X, wanted %02X\n", i / TEST_W,
+                       i % TEST_W, a[i], b[i]);
+            }
+            return 0;
+        }
+    }
+    if (tn5250_dbuffer_field_count(got) != tn5250_dbuffer_field_count(want)) {
+        if (verbose) {
+            printf("got %d fields, wanted %d\n",
+                   tn5250_dbuffer_field_count(got),
+                   tn5250_dbuffer_field_count(want));
+        }
+        return 0;
+    }
+    for (i = 0; i < tn5250_dbuffer_field_count(want); i++) {
+        f = want->field_table[i];
+        g = tn5250_dbuffer_field_yx(got, f->start_row, f->start_col);
+        if (g == NULL || g->start_row != f->start_row ||
+            g->start_col != f->start_col || g->length != f->length ||
+            g->FFW != f->FFW || g->attribute != f->attribute ||
+            g->nextfieldprogressionid != f->nextfieldprogressionid) {
+            if (verbose) {
+                printf("field at %d,%d differs\n", f->start_row, f->start_col);
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ *    The stream "receives" the record the test has queued.
+ */
+static int test_receive(Tn5250Stream* stream) {
+    if (test_pending != NULL) {
+        stream->records = tn5250_record_list_add(stream->records, test_pending);
+        stream->record_count++;
+        test_pending = NULL;
+    }
+    return 1;
+}
+
+/*
+ *    Nothing is sent back.
+ */
+static void test_send(Tn5250Stream* stream, int length, StreamHeader header,
+                      unsigned char* data) {
+}
+
+int main(int argc, char* argv[]) {
+    /* A 5250 record header for a Put/Get with no flags. */
+    static const unsigned char header[10] = {
+        0x00, 0x00, 0x12, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x00,
+        TN5250_RECORD_OPCODE_PUT_GET};
+    Tn5250Display* display;
+    Tn5250Session* session;
+    Tn5250Stream* stream;
+    Tn5250DBuffer *rx, *src, *dst;
+    Tn5250WTDContext* ctx;
+    Tn5250Buffer buf;
+    Tn5250Record* record;
+    int passes, pass, mode, len, i;
+    int failed = 0;
+    long bytes = 0;
+
+    passes = argc > 1 ? atoi(argv[1]) : 3000;
+    if (argc > 2) {
+        test_seed = strtoul(argv[2], NULL, 0);
+    }
+    if (passes <= 0) {
+        fprintf(stderr, "usage: wtdtest [passes [seed]]\n");
+        return 2;
+    }
+
+    display = tn5250_display_new();
+    tn5250_display_set_char_map(display, "37");
+    session = tn5250_session_new();
+    tn5250_display_set_session(display, session);
+
+    stream = tn5250_new(Tn5250Stream, 1);
+    TN5250_ASSERT(stream != NULL);
+    memset(stream, 0, sizeof(Tn5250Stream));
+    stream->streamtype = TN5250_STREAM;
+    stream->handle_receive = test_receive;
+    stream->send_packet = test_send;
+    tn5250_buffer_init(&stream->sb_buf);
+    tn5250_session_set_stream(session, stream);
+
+    for (pass = 0; pass < passes; pass++) {
+        mode = test_rand(4);
+
+        /* The display starts out holding the source screen. */
+        rx = tn5250_display_dbuffer(display);
+        tn5250_dbuffer_clear(rx);
+        for (i = 0; i < TEST_SIZE; i++) {
+            test_put(rx, i, test_cell());
+        }
+        test_fields(rx);
+        src = tn5250_dbuffer_copy(rx);
+        dst = tn5250_dbuffer_copy(rx);
+        test_change(dst, mode);
+
+        tn5250_buffer_init(&buf);
+        ctx = tn5250_wtd_context_new(&buf, src, dst);
+        tn5250_wtd_context_set_ic(ctx, 1, 1);
+        tn5250_wtd_context_convert(ctx);
+        tn5250_wtd_context_destroy(ctx);
+        bytes += tn5250_buffer_length(&buf);
+
+        record = tn5250_record_new();
+        len = sizeof(header) + tn5250_buffer_length(&buf);
+        tn5250_record_append_byte(record, (unsigned char)(len >> 8));
+        tn5250_record_append_byte(record, (unsigned char)len);
+        for (i = 2; i < (int)sizeof(header); i++) {
+            tn5250_record_append_byte(record, header[i]);
+        }
+        for (i = 0; i < tn5250_buffer_length(&buf); i++) {
+            tn5250_record_append_byte(record, tn5250_buffer_data(&buf)[i]);
+        }
+        tn5250_buffer_free(&buf);
+        test_pending = record;
+        tn5250_session_receive(session);
+
+        if (!test_same(tn5250_display_dbuffer(display), dst, failed < 3)) {
+            if (++failed <= 3) {
+                printf("  (pass %d, mode %d)\n", pass, mode);
+            }
+        }
+        tn5250_dbuffer_destroy(src);
+        tn5250_dbuffer_destroy(dst);
+    }
+
+    printf("%d of %d round trips failed, %ld bytes of data per pass\n",
+           failed, passes, bytes / passes);
+    tn5250_display_destroy(display);
+    tn5250_session_destroy(session);
+    return failed != 0;
+}
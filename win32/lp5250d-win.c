@@ -53,7 +53,7 @@ struct _Tn5250Printer {
     int count;
     FILE* fileh;
     unsigned char prevchar;
-    Tn5250CharMap* map;
+    const Tn5250CharMap* map;
     char* cmd;
 };
 typedef struct _Tn5250Printer Tn5250Printer;
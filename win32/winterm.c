@@ -429,6 +429,7 @@ Tn5250Terminal* tn5250_win32_terminal_new(HINSTANCE hInst, HINSTANCE hPrev,
     r->data->pd = NULL;
 
     r->conn_fd = -1;
+    r->wait_limit = -1;
     r->init = win32_terminal_init;
     r->term = win32_terminal_term;
     r->destroy = win32_terminal_destroy;
@@ -1673,16 +1674,16 @@ static int win32_get_key(Tn5250Terminal* This) {
         This->data->k_buf[j] = This->data->k_buf[j + 1];
     }
 
-#if 0
-   {
-       char *blah;
-       blah = malloc(This->data->k_buf_len+1);
-       for (j=0; j<This->data->k_buf_len; j++)
-           blah[j] = This->data->k_buf[j];
-       blah[This->data->k_buf_len] = '\0';
-       TN5250_LOG(("WIN32: getkey %c, %d bytes left:\n", i, This->data->k_buf_len));
-       TN5250_LOG(("WIN32: buffer %s\n", blah));
-       free(blah);
+#if 0
+   {
+       char *blah;
+       blah = malloc(This->data->k_buf_len+1);
+       for (j=0; j<This->data->k_buf_len; j++)
+           blah[j] = This->data->k_buf[j];
+       blah[This->data->k_buf_len] = '\0';
+       TN5250_LOG(("WIN32: getkey %c, %d bytes left:\n", i, This->data->k_buf_len));
+       TN5250_LOG(("WIN32: buffer %s\n", blah));
+       free(blah);
    }
 #endif
 